@@ -0,0 +1,110 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Tokenization throughput of each analyzer, as the column inverter and MATCH queries use them:
+ * every document gets its analyzer from the AnalyzerPool and releases it afterwards.
+ * Runs with 1 thread and with all hardware threads, reports documents/second and MB/second.
+ * The chinese analyzer is skipped when its dictionary is not installed (/var/infinity/resource by default).
+ */
+
+#include "base_profiler.h"
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+import stl;
+import term;
+import analyzer;
+import analyzer_pool;
+
+using namespace infinity;
+
+namespace {
+
+Vector<String> MakeDocuments(SizeT doc_count, SizeT words_per_doc) {
+    static const Vector<String> words{"the",        "infinity", "database", "vector",  "search",    "full",    "text",     "index",
+                                      "analyzers",  "running",  "tokens",   "posting", "documents", "queries", "Boost",    "units",
+                                      "throughput", "shared",   "threads",  "pool",    "中文",      "分词",    "搜索引擎", "数据库"};
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<SizeT> pick(0, words.size() - 1);
+    Vector<String> docs(doc_count);
+    for (auto &doc : docs) {
+        for (SizeT i = 0; i < words_per_doc; ++i) {
+            doc += words[pick(rng)];
+            doc += i % 12 == 11 ? ". " : " ";
+        }
+    }
+    return docs;
+}
+
+void Run(const String &name, const Vector<String> &docs, SizeT thread_count) {
+    if (AnalyzerPool::instance().Get(name).get() == nullptr) {
+        std::cout << std::left << std::setw(12) << name << "not available" << std::endl;
+        return;
+    }
+    SizeT bytes = 0;
+    for (const auto &doc : docs) {
+        bytes += doc.size();
+    }
+    Vector<SizeT> term_counts(thread_count, 0);
+
+    BaseProfiler profiler;
+    profiler.Begin();
+    Vector<Thread> threads;
+    for (SizeT t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            SizeT term_count = 0;
+            for (SizeT i = t; i < docs.size(); i += thread_count) {
+                PooledAnalyzer analyzer = AnalyzerPool::instance().Get(name);
+                TermList term_list;
+                analyzer->Analyze(docs[i], term_list);
+                term_count += term_list.size();
+            }
+            term_counts[t] = term_count;
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    profiler.End();
+
+    f64 seconds = static_cast<f64>(profiler.Elapsed()) / 1e9;
+    SizeT term_count = 0;
+    for (SizeT count : term_counts) {
+        term_count += count;
+    }
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(4) << thread_count << " threads" << std::setw(14) << std::fixed
+              << std::setprecision(1) << static_cast<f64>(docs.size()) / seconds << " docs/s" << std::setw(10) << static_cast<f64>(bytes) / seconds / 1e6
+              << " MB/s" << std::setw(12) << term_count << " terms" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    SizeT doc_count = 200000;
+    if (argc > 1) {
+        doc_count = std::stoull(argv[1]);
+    }
+    const SizeT words_per_doc = 64;
+    Vector<String> docs = MakeDocuments(doc_count, words_per_doc);
+    std::cout << "documents: " << doc_count << ", words per document: " << words_per_doc << std::endl;
+
+    const SizeT max_threads = std::max<SizeT>(1, std::thread::hardware_concurrency());
+    for (const String name : {"standard", "ngram-2", "ngram-3", "chinese"}) {
+        Run(name, docs, 1);
+        Run(name, docs, max_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,237 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Tail latency of short tasks mixed with a few long ones (e.g. point KNN queries next to a MATCH over a large table)
+// under three dispatch policies:
+//   blocking:      per worker blocking queue, tasks are dispatched to the least loaded worker and never move again
+//   polling:       per worker queue which the worker spins on, same dispatch
+//   work_stealing: per worker deque, idle workers steal the oldest task of the others
+
+#include "threadutil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace infinity;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchTask {
+    std::chrono::microseconds work_;
+    bool short_task_{true};
+    // worker the task was dispatched to, it may run on another one after stealing
+    std::size_t dispatch_worker_id_{};
+    Clock::time_point submit_time_{};
+    Clock::time_point finish_time_{};
+};
+
+void SpinFor(std::chrono::microseconds duration) {
+    auto end = Clock::now() + duration;
+    while (Clock::now() < end) {
+    }
+}
+
+struct TaskDeque {
+    void Push(BenchTask *task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(task);
+            size_.store(tasks_.size());
+        }
+        cv_.notify_one();
+    }
+
+    BenchTask *Pop(bool wait) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wait) {
+            cv_.wait(lock, [this] { return !tasks_.empty(); });
+        } else if (tasks_.empty()) {
+            return nullptr;
+        }
+        BenchTask *task = tasks_.front();
+        tasks_.pop_front();
+        size_.store(tasks_.size());
+        return task;
+    }
+
+    BenchTask *Steal() {
+        if (size_.load() == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return nullptr;
+        }
+        BenchTask *task = tasks_.front();
+        tasks_.pop_front();
+        size_.store(tasks_.size());
+        return task;
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<BenchTask *> tasks_;
+    std::atomic_uint64_t size_{0};
+};
+
+enum class Policy { kBlocking, kPolling, kWorkStealing };
+
+const char *PolicyName(Policy policy) {
+    switch (policy) {
+        case Policy::kBlocking:
+            return "blocking";
+        case Policy::kPolling:
+            return "polling";
+        case Policy::kWorkStealing:
+            return "work_stealing";
+    }
+    return "invalid";
+}
+
+// nullptr in a queue terminates its worker
+void RunPolicy(Policy policy, std::size_t worker_count, std::vector<BenchTask> &tasks, std::chrono::microseconds submit_interval) {
+    std::vector<std::unique_ptr<TaskDeque>> queues;
+    std::vector<std::atomic_uint64_t> workloads(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        queues.emplace_back(std::make_unique<TaskDeque>());
+    }
+    std::atomic_bool running{true};
+    std::atomic_uint64_t done_count{0};
+
+    auto worker_loop = [&](std::size_t worker_id) {
+        std::mt19937 rand_gen(worker_id + 1);
+        while (running || done_count < tasks.size()) {
+            BenchTask *task = nullptr;
+            switch (policy) {
+                case Policy::kBlocking: {
+                    task = queues[worker_id]->Pop(true);
+                    break;
+                }
+                case Policy::kPolling: {
+                    task = queues[worker_id]->Pop(false);
+                    break;
+                }
+                case Policy::kWorkStealing: {
+                    task = queues[worker_id]->Pop(false);
+                    if (task == nullptr) {
+                        std::size_t start = rand_gen() % worker_count;
+                        for (std::size_t i = 0; i < worker_count && task == nullptr; ++i) {
+                            std::size_t victim = (start + i) % worker_count;
+                            if (victim != worker_id) {
+                                task = queues[victim]->Steal();
+                            }
+                        }
+                    }
+                    if (task == nullptr) {
+                        std::this_thread::yield();
+                    }
+                    break;
+                }
+            }
+            if (task == nullptr) {
+                if (policy == Policy::kBlocking) {
+                    break;
+                }
+                continue;
+            }
+            SpinFor(task->work_);
+            task->finish_time_ = Clock::now();
+            --workloads[task->dispatch_worker_id_];
+            ++done_count;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    std::size_t cpu_count = std::thread::hardware_concurrency();
+    for (std::size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+        workers.emplace_back(worker_loop, worker_id);
+        ThreadUtil::pin(workers.back(), worker_id % cpu_count);
+    }
+
+    for (auto &task : tasks) {
+        std::size_t target = 0;
+        for (std::size_t worker_id = 1; worker_id < worker_count; ++worker_id) {
+            if (workloads[worker_id] < workloads[target]) {
+                target = worker_id;
+            }
+        }
+        ++workloads[target];
+        task.dispatch_worker_id_ = target;
+        task.submit_time_ = Clock::now();
+        queues[target]->Push(&task);
+        std::this_thread::sleep_for(submit_interval);
+    }
+    while (done_count < tasks.size()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    running = false;
+    for (auto &queue : queues) {
+        queue->Push(nullptr);
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    std::vector<double> latencies;
+    for (const auto &task : tasks) {
+        if (task.short_task_) {
+            latencies.push_back(std::chrono::duration<double, std::micro>(task.finish_time_ - task.submit_time_).count());
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) { return latencies[std::min(latencies.size() - 1, static_cast<std::size_t>(p * latencies.size()))]; };
+    printf("%-14s short task latency(us) p50: %10.1f p99: %10.1f p99.9: %10.1f max: %10.1f\n",
+           PolicyName(policy),
+           percentile(0.5),
+           percentile(0.99),
+           percentile(0.999),
+           latencies.back());
+}
+
+} // namespace
+
+auto main(int argc, char *argv[]) -> int {
+    std::size_t worker_count = argc > 1 ? std::stoul(argv[1]) : std::max(2u, std::thread::hardware_concurrency() / 2);
+    std::size_t task_count = argc > 2 ? std::stoul(argv[2]) : 20000;
+    // one task in long_task_period is a long one
+    std::size_t long_task_period = argc > 3 ? std::stoul(argv[3]) : 500;
+    const auto short_work = std::chrono::microseconds(50);
+    const auto long_work = std::chrono::microseconds(50000);
+    const auto submit_interval = std::chrono::microseconds(20);
+    printf("workers: %zu, tasks: %zu, long task every %zu tasks\n", worker_count, task_count, long_task_period);
+
+    for (Policy policy : {Policy::kBlocking, Policy::kPolling, Policy::kWorkStealing}) {
+        std::vector<BenchTask> tasks(task_count);
+        for (std::size_t i = 0; i < task_count; ++i) {
+            bool short_task = (i % long_task_period) != long_task_period - 1;
+            tasks[i].short_task_ = short_task;
+            tasks[i].work_ = short_task ? short_work : long_work;
+        }
+        RunPolicy(policy, worker_count, tasks, submit_interval);
+    }
+    return 0;
+}
@@ -15,6 +15,7 @@ import stl;
 import index_base;
 import ann_ivf_flat;
 import annivfflat_index_data;
+import index_ivfflat;
 
 import local_file_system;
 import knn_expr;
@@ -172,7 +173,32 @@ int main() {
     if (choose_n_probes_step != 0) {
         n_probes_step = choose_n_probes_step;
     }
-    std::string build_parameter = "." + data_type + "." + metric_str + ".C." + std::to_string(centroids);
+    // let user choose how the centroid lists are stored
+    std::cout << "please input encode type: 0 for plain, 1 for sq8, 2 for fp16" << std::endl;
+    IVFEncodeType encode_type = IVFEncodeType::kPlain;
+    {
+        int choose_encode = 0;
+        std::cin >> choose_encode;
+        switch (choose_encode) {
+            case 0: {
+                encode_type = IVFEncodeType::kPlain;
+                break;
+            }
+            case 1: {
+                encode_type = IVFEncodeType::kSQ8;
+                break;
+            }
+            case 2: {
+                encode_type = IVFEncodeType::kFP16;
+                break;
+            }
+            default:
+                std::cout << "invalid input, exit." << std::endl;
+                return -1;
+        }
+    }
+    std::string build_parameter =
+        "." + data_type + "." + metric_str + ".C." + std::to_string(centroids) + ".E." + IVFEncodeTypeToString(encode_type);
     std::string ivfflat_index_name =
         std::string(homeDir) + std::string(ivfflat_index_name_prefix) + data_type + std::string(ivfflat_index_name_suffix) + build_parameter;
     std::cout << "data_type: " << data_type << std::endl;
@@ -180,6 +206,7 @@ int main() {
     std::cout << "dimension: " << dimension << std::endl;
     std::cout << "base_counts: " << base_counts << std::endl;
     std::cout << "centroids: " << centroids << std::endl;
+    std::cout << "encode: " << IVFEncodeTypeToString(encode_type) << std::endl;
     std::cout << "n_probes_begin: " << n_probes_begin << std::endl;
     std::cout << "n_probes_end: " << n_probes_end << std::endl;
     std::cout << "n_probes_step: " << n_probes_step << std::endl;
@@ -233,12 +260,12 @@ int main() {
             switch (metric) {
                 case MetricType::kMetricL2: {
                     ann_index_data =
-                        AnnIVFFlatL2<f32>::CreateIndex(dimension, train_count, input_train_ptr, base_counts, input_embeddings.get(), centroids);
+                        AnnIVFFlatL2<f32>::CreateIndex(dimension, train_count, input_train_ptr, base_counts, input_embeddings.get(), centroids, encode_type);
                     break;
                 }
                 case MetricType::kMetricInnerProduct: {
                     ann_index_data =
-                        AnnIVFFlatIP<f32>::CreateIndex(dimension, train_count, input_train_ptr, base_counts, input_embeddings.get(), centroids);
+                        AnnIVFFlatIP<f32>::CreateIndex(dimension, train_count, input_train_ptr, base_counts, input_embeddings.get(), centroids, encode_type);
                     break;
                 }
                 default:
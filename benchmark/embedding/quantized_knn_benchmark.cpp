@@ -0,0 +1,174 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Single thread brute force knn over float, float16, bfloat16, int8 and bit embeddings of the same random data,
+ * with the distance functions and merge heap of PhysicalKnnScan.
+ * Half precision vectors are the float vectors rounded, int8 vectors are the float vectors scaled to [-127, 127],
+ * bit vectors keep the sign of each dimension.
+ * Reports the bytes per vector, the queries per second and the recall@topk against the exact float result of the same metric.
+ */
+
+#include "base_profiler.h"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+import stl;
+import knn_scan_data;
+import merge_knn;
+import knn_result_handler;
+import knn_expr;
+import internal_types;
+import default_values;
+
+using namespace infinity;
+
+namespace {
+
+template <typename DataType, template <typename, typename> typename C>
+Vector<Set<u64>> Search(const String &name,
+                        KnnDistanceType distance_type,
+                        const DataType *base,
+                        const DataType *queries,
+                        SizeT dim,
+                        SizeT base_n,
+                        SizeT query_n,
+                        SizeT topk) {
+    KnnDistance1<DataType> distance(distance_type);
+    Vector<Set<u64>> results(query_n);
+
+    BaseProfiler profiler;
+    profiler.Begin();
+    for (SizeT query_idx = 0; query_idx < query_n; ++query_idx) {
+        MergeKnn<f32, C> merge_heap(1, topk);
+        merge_heap.Begin();
+        for (SizeT block_id = 0; block_id * DEFAULT_BLOCK_CAPACITY < base_n; ++block_id) {
+            SizeT row_cnt = std::min<SizeT>(DEFAULT_BLOCK_CAPACITY, base_n - block_id * DEFAULT_BLOCK_CAPACITY);
+            merge_heap.Search(queries + query_idx * dim,
+                              base + block_id * DEFAULT_BLOCK_CAPACITY * dim,
+                              dim,
+                              distance.dist_func_,
+                              row_cnt,
+                              0,
+                              block_id);
+        }
+        merge_heap.End();
+        const RowID *row_ids = merge_heap.GetIDsByIdx(0);
+        for (SizeT i = 0; i < topk; ++i) {
+            results[query_idx].insert(row_ids[i].segment_offset_);
+        }
+    }
+    profiler.End();
+
+    f64 seconds = static_cast<f64>(profiler.Elapsed()) / 1e9;
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(8) << dim * sizeof(DataType) << " bytes/vector" << std::setw(12)
+              << std::fixed << std::setprecision(1) << static_cast<f64>(query_n) / seconds << " queries/s" << std::endl;
+    return results;
+}
+
+f64 Recall(const Vector<Set<u64>> &truth, const Vector<Set<u64>> &results, SizeT topk) {
+    SizeT hit = 0;
+    for (SizeT i = 0; i < truth.size(); ++i) {
+        for (u64 id : results[i]) {
+            hit += truth[i].contains(id);
+        }
+    }
+    return static_cast<f64>(hit) / static_cast<f64>(truth.size() * topk);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    SizeT base_n = 100000;
+    SizeT query_n = 100;
+    if (argc > 1) {
+        base_n = std::stoull(argv[1]);
+    }
+    if (argc > 2) {
+        query_n = std::stoull(argv[2]);
+    }
+    const SizeT dim = 768;
+    const SizeT topk = 10;
+    std::cout << "base: " << base_n << ", queries: " << query_n << ", dimension: " << dim << ", topk: " << topk << std::endl;
+
+    std::mt19937 rng(42);
+    std::normal_distribution<f32> dist(0.0f, 1.0f);
+    SizeT total_n = base_n + query_n;
+    Vector<f32> f32_data(total_n * dim);
+    for (auto &v : f32_data) {
+        v = dist(rng);
+    }
+
+    f32 max_abs = 0.0f;
+    for (f32 v : f32_data) {
+        max_abs = std::max(max_abs, std::abs(v));
+    }
+    Vector<Float16T> f16_data(f32_data.begin(), f32_data.end());
+    Vector<BFloat16T> bf16_data(f32_data.begin(), f32_data.end());
+    Vector<i8> i8_data(total_n * dim);
+    for (SizeT i = 0; i < f32_data.size(); ++i) {
+        i8_data[i] = static_cast<i8>(std::lround(f32_data[i] / max_abs * 127.0f));
+    }
+    const SizeT bit_bytes = EmbeddingType::EmbeddingSize(EmbeddingDataType::kElemBit, dim);
+    Vector<u8> bit_data(total_n * bit_bytes, 0);
+    for (SizeT row = 0; row < total_n; ++row) {
+        for (SizeT i = 0; i < dim; ++i) {
+            if (f32_data[row * dim + i] > 0.0f) {
+                bit_data[row * bit_bytes + i / 8] |= static_cast<u8>(1u << (7 - i % 8));
+            }
+        }
+    }
+
+    auto truth = Search<f32, CompareMax>("float l2", KnnDistanceType::kL2, f32_data.data(), f32_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    auto ip_truth =
+        Search<f32, CompareMin>("float ip", KnnDistanceType::kInnerProduct, f32_data.data(), f32_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    auto f16_l2 =
+        Search<Float16T, CompareMax>("float16 l2", KnnDistanceType::kL2, f16_data.data(), f16_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    auto f16_ip = Search<Float16T, CompareMin>("float16 ip",
+                                               KnnDistanceType::kInnerProduct,
+                                               f16_data.data(),
+                                               f16_data.data() + base_n * dim,
+                                               dim,
+                                               base_n,
+                                               query_n,
+                                               topk);
+    auto bf16_l2 =
+        Search<BFloat16T, CompareMax>("bfloat16 l2", KnnDistanceType::kL2, bf16_data.data(), bf16_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    auto bf16_ip = Search<BFloat16T, CompareMin>("bfloat16 ip",
+                                                 KnnDistanceType::kInnerProduct,
+                                                 bf16_data.data(),
+                                                 bf16_data.data() + base_n * dim,
+                                                 dim,
+                                                 base_n,
+                                                 query_n,
+                                                 topk);
+    auto i8_l2 = Search<i8, CompareMax>("int8 l2", KnnDistanceType::kL2, i8_data.data(), i8_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    Search<i8, CompareMin>("int8 ip", KnnDistanceType::kInnerProduct, i8_data.data(), i8_data.data() + base_n * dim, dim, base_n, query_n, topk);
+    auto bit_hamming = Search<u8, CompareMax>("bit hamming",
+                                              KnnDistanceType::kHamming,
+                                              bit_data.data(),
+                                              bit_data.data() + base_n * bit_bytes,
+                                              bit_bytes,
+                                              base_n,
+                                              query_n,
+                                              topk);
+
+    std::cout << std::fixed << std::setprecision(3) << "recall@" << topk << " float16 l2: " << Recall(truth, f16_l2, topk)
+              << ", float16 ip: " << Recall(ip_truth, f16_ip, topk) << ", bfloat16 l2: " << Recall(truth, bf16_l2, topk)
+              << ", bfloat16 ip: " << Recall(ip_truth, bf16_ip, topk) << ", int8 l2: " << Recall(truth, i8_l2, topk)
+              << ", bit hamming: " << Recall(truth, bit_hamming, topk) << std::endl;
+    return 0;
+}
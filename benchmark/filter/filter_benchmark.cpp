@@ -0,0 +1,149 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Single thread filter benchmark: `column <op> constant` and `column <op> column` over one vector of rows,
+ * evaluated into a compact bit column and converted into a selection, as PhysicalFilter does.
+ * The per row path and the SIMD kernels are measured on the same data, results are rows/second per core.
+ */
+
+#include "base_profiler.h"
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+import stl;
+import column_vector;
+import selection;
+import binary_operator;
+import simd_compare;
+import expression_selector;
+import internal_types;
+import logical_type;
+import data_type;
+import bitmask;
+import default_values;
+
+using namespace infinity;
+
+namespace {
+
+template <SIMDCompareType compare_type>
+struct CompareRun {
+    template <typename TA, typename TB, typename TC>
+    static inline void Run(TA left, TB right, TC &result) {
+        if constexpr (compare_type == SIMDCompareType::kEqual) {
+            result.SetValue(left == right);
+        } else {
+            result.SetValue(left < right);
+        }
+    }
+};
+
+// Tagged with simd_compare_type, BinaryOperator dispatches it to the SIMD kernels.
+template <SIMDCompareType compare_type>
+struct SIMDCompare : CompareRun<compare_type> {
+    static constexpr SIMDCompareType simd_compare_type = compare_type;
+};
+
+template <SIMDCompareType compare_type>
+struct RowCompare : CompareRun<compare_type> {};
+
+template <typename Operator>
+struct Wrapper {
+    template <typename LeftValueType, typename RightValueType, typename TargetValueType>
+    inline static void Execute(LeftValueType left, RightValueType right, TargetValueType &result, Bitmask *, SizeT, void *) {
+        return Operator::template Run<LeftValueType, RightValueType, TargetValueType>(left, right, result);
+    }
+};
+
+template <typename T>
+SharedPtr<ColumnVector> MakeFlatColumn(LogicalType logical_type, SizeT count, std::mt19937 &rng) {
+    auto column = MakeShared<ColumnVector>(MakeShared<DataType>(logical_type));
+    column->Initialize(ColumnVectorType::kFlat, count);
+    auto *data = reinterpret_cast<T *>(column->data());
+    std::uniform_int_distribution<int> dist(0, 99);
+    for (SizeT i = 0; i < count; ++i) {
+        data[i] = static_cast<T>(dist(rng));
+    }
+    column->Finalize(count);
+    return column;
+}
+
+template <typename T>
+SharedPtr<ColumnVector> MakeConstantColumn(LogicalType logical_type, T value) {
+    auto column = MakeShared<ColumnVector>(MakeShared<DataType>(logical_type));
+    column->Initialize(ColumnVectorType::kConstant, 1);
+    reinterpret_cast<T *>(column->data())[0] = value;
+    column->Finalize(1);
+    return column;
+}
+
+template <typename T, typename Operator>
+void RunCase(const String &name, const SharedPtr<ColumnVector> &left, const SharedPtr<ColumnVector> &right, SizeT count, SizeT rounds) {
+    auto result = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+    result->Initialize(ColumnVectorType::kCompactBit, count);
+    SizeT selected = 0;
+
+    BaseProfiler profiler;
+    profiler.Begin();
+    for (SizeT round = 0; round < rounds; ++round) {
+        BinaryOperator::Execute<T, T, BooleanT, Wrapper<Operator>>(left, right, result, count, nullptr, true);
+        auto selection = MakeShared<Selection>();
+        selection->Initialize(count);
+        ExpressionSelector::Select(result, count, selection, true);
+        selected += selection->Size();
+    }
+    profiler.End();
+
+    f64 seconds = static_cast<f64>(profiler.Elapsed()) / 1e9;
+    f64 rows_per_second = static_cast<f64>(count * rounds) / seconds;
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+              << rows_per_second / 1e6 << " M rows/s/core"
+              << "  selectivity " << std::setprecision(3) << static_cast<f64>(selected) / static_cast<f64>(count * rounds) << std::endl;
+}
+
+template <typename T>
+void RunType(const String &type_name, LogicalType logical_type, SizeT count, SizeT rounds) {
+    std::mt19937 rng(42);
+    auto left = MakeFlatColumn<T>(logical_type, count, rng);
+    auto right = MakeFlatColumn<T>(logical_type, count, rng);
+    auto constant = MakeConstantColumn<T>(logical_type, static_cast<T>(50));
+
+    RunCase<T, RowCompare<SIMDCompareType::kLess>>(type_name + " col < const  (row)", left, constant, count, rounds);
+    RunCase<T, SIMDCompare<SIMDCompareType::kLess>>(type_name + " col < const  (simd)", left, constant, count, rounds);
+    RunCase<T, RowCompare<SIMDCompareType::kEqual>>(type_name + " col = const  (row)", left, constant, count, rounds);
+    RunCase<T, SIMDCompare<SIMDCompareType::kEqual>>(type_name + " col = const  (simd)", left, constant, count, rounds);
+    RunCase<T, RowCompare<SIMDCompareType::kLess>>(type_name + " col < col    (row)", left, right, count, rounds);
+    RunCase<T, SIMDCompare<SIMDCompareType::kLess>>(type_name + " col < col    (simd)", left, right, count, rounds);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    SizeT rounds = 10000;
+    if (argc > 1) {
+        rounds = std::stoull(argv[1]);
+    }
+    SizeT count = DEFAULT_VECTOR_SIZE;
+    std::cout << "rows per vector: " << count << ", vectors: " << rounds << std::endl;
+
+    RunType<TinyIntT>("tinyint", LogicalType::kTinyInt, count, rounds);
+    RunType<SmallIntT>("smallint", LogicalType::kSmallInt, count, rounds);
+    RunType<IntegerT>("integer", LogicalType::kInteger, count, rounds);
+    RunType<BigIntT>("bigint", LogicalType::kBigInt, count, rounds);
+    RunType<FloatT>("float", LogicalType::kFloat, count, rounds);
+    RunType<DoubleT>("double", LogicalType::kDouble, count, rounds);
+    return 0;
+}
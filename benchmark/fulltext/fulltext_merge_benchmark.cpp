@@ -0,0 +1,135 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+/**
+ * Merge of full text index chunks, as OPTIMIZE consolidates them.
+ * Builds chunk_count chunks of random documents with the standard analyzer, then merges them with one key range
+ * and with one key range per hardware thread. Reports the seconds and the MB/second of source postings merged.
+ */
+
+#include "base_profiler.h"
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+import stl;
+import memory_pool;
+import memory_indexer;
+import column_index_merger;
+import column_vector;
+import data_type;
+import logical_type;
+import value;
+import index_defines;
+import internal_types;
+
+using namespace infinity;
+
+namespace {
+
+String Word(SizeT n) {
+    String word;
+    for (++n; n > 0; n /= 26) {
+        word += static_cast<char>('a' + n % 26);
+    }
+    return word;
+}
+
+void CreateChunks(const String &index_dir, SizeT chunk_count, SizeT docs_per_chunk, Vector<String> &base_names, Vector<RowID> &base_rowids) {
+    const SizeT vocabulary = 200000;
+    const SizeT words_per_doc = 64;
+    std::mt19937 rng(42);
+    // skewed like natural text: few frequent words, a long tail of rare ones
+    std::lognormal_distribution<f64> pick(0.0, 2.5);
+
+    MemoryPool byte_slice_pool;
+    RecyclePool buffer_pool;
+    ThreadPool inverting_thread_pool(4);
+    ThreadPool commiting_thread_pool(2);
+    for (SizeT chunk = 0; chunk < chunk_count; ++chunk) {
+        SharedPtr<ColumnVector> column = ColumnVector::Make(MakeShared<DataType>(LogicalType::kVarchar));
+        column->Initialize();
+        for (SizeT i = 0; i < docs_per_chunk; ++i) {
+            String doc;
+            for (SizeT j = 0; j < words_per_doc; ++j) {
+                doc += Word(static_cast<SizeT>(pick(rng) * 1000) % vocabulary);
+                doc += ' ';
+            }
+            Value v = Value::MakeVarchar(doc);
+            column->AppendValue(v);
+        }
+        base_names.push_back("chunk" + std::to_string(chunk));
+        base_rowids.emplace_back(0U, static_cast<u32>(chunk * docs_per_chunk));
+        MemoryIndexer indexer(index_dir,
+                              base_names.back(),
+                              base_rowids.back(),
+                              OPTION_FLAG_ALL,
+                              "standard",
+                              byte_slice_pool,
+                              buffer_pool,
+                              inverting_thread_pool,
+                              commiting_thread_pool);
+        indexer.Insert(column, 0, docs_per_chunk);
+        indexer.Dump();
+    }
+}
+
+void Merge(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, SizeT part_count) {
+    SizeT posting_bytes = 0;
+    for (const String &base_name : base_names) {
+        posting_bytes += std::filesystem::file_size(std::filesystem::path(index_dir) / (base_name + POSTING_SUFFIX));
+    }
+    MemoryPool memory_pool;
+    RecyclePool buffer_pool;
+    ColumnIndexMerger merger(index_dir, OPTION_FLAG_ALL, &memory_pool, &buffer_pool, part_count);
+
+    BaseProfiler profiler;
+    profiler.Begin();
+    merger.Merge(base_names, base_rowids, "merged" + std::to_string(part_count));
+    profiler.End();
+
+    f64 seconds = static_cast<f64>(profiler.Elapsed()) / 1e9;
+    std::cout << std::right << std::setw(4) << part_count << " key ranges" << std::setw(12) << std::fixed << std::setprecision(3) << seconds << " s"
+              << std::setw(12) << std::setprecision(1) << static_cast<f64>(posting_bytes) / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    SizeT chunk_count = 8;
+    SizeT docs_per_chunk = 20000;
+    if (argc > 1) {
+        chunk_count = std::stoull(argv[1]);
+    }
+    if (argc > 2) {
+        docs_per_chunk = std::stoull(argv[2]);
+    }
+    const String index_dir = "/var/infinity/fulltext_merge_benchmark";
+    std::filesystem::remove_all(index_dir);
+    std::filesystem::create_directories(index_dir);
+
+    Vector<String> base_names;
+    Vector<RowID> base_rowids;
+    CreateChunks(index_dir, chunk_count, docs_per_chunk, base_names, base_rowids);
+    std::cout << "chunks: " << chunk_count << ", documents per chunk: " << docs_per_chunk << std::endl;
+
+    const SizeT max_threads = std::max<SizeT>(1, std::thread::hardware_concurrency());
+    Merge(index_dir, base_names, base_rowids, 1);
+    Merge(index_dir, base_names, base_rowids, max_threads);
+
+    std::filesystem::remove_all(index_dir);
+    return 0;
+}
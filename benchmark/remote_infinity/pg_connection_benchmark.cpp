@@ -0,0 +1,192 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Open many idle PG connections, then report the memory and threads of the server and the latency of simple queries
+// sent round robin over the connections.
+// Usage: pg_connection_benchmark [server pid] [connections, 1000,10000] [queries] [query] [host] [port]
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+void WriteAll(int fd, const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = write(fd, data.data() + written, data.size() - written);
+        if (n <= 0) {
+            std::cerr << "write failed: " << strerror(errno) << std::endl;
+            exit(-1);
+        }
+        written += n;
+    }
+}
+
+void ReadAll(int fd, char *data, size_t size) {
+    size_t read_bytes = 0;
+    while (read_bytes < size) {
+        ssize_t n = read(fd, data + read_bytes, size - read_bytes);
+        if (n <= 0) {
+            std::cerr << "read failed: " << (n == 0 ? "connection closed" : strerror(errno)) << std::endl;
+            exit(-1);
+        }
+        read_bytes += n;
+    }
+}
+
+void AppendU32(std::string &message, uint32_t value) {
+    value = htonl(value);
+    message.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Skips the messages up to ReadyForQuery
+void WaitReadyForQuery(int fd) {
+    std::string body;
+    while (true) {
+        char header[5];
+        ReadAll(fd, header, sizeof(header));
+        uint32_t length;
+        std::memcpy(&length, header + 1, sizeof(length));
+        length = ntohl(length);
+        body.resize(length - sizeof(length));
+        ReadAll(fd, body.data(), body.size());
+        if (header[0] == 'E') {
+            std::cerr << "error response: " << body.substr(1) << std::endl;
+        }
+        if (header[0] == 'Z') {
+            return;
+        }
+    }
+}
+
+int Connect(const std::string &host, uint16_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        std::cerr << "socket failed: " << strerror(errno) << std::endl;
+        exit(-1);
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    inet_pton(AF_INET, host.c_str(), &address.sin_addr);
+    if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        std::cerr << "connect failed: " << strerror(errno) << std::endl;
+        exit(-1);
+    }
+    int no_delay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+    std::string parameters("user");
+    parameters.push_back('\0');
+    parameters.append("infinity");
+    parameters.push_back('\0');
+    parameters.push_back('\0');
+    std::string startup;
+    AppendU32(startup, 2 * sizeof(uint32_t) + parameters.size());
+    AppendU32(startup, 196608); // protocol 3.0
+    startup.append(parameters);
+    WriteAll(fd, startup);
+    WaitReadyForQuery(fd);
+    return fd;
+}
+
+void PrintServerStatus(int server_pid) {
+    if (server_pid <= 0) {
+        return;
+    }
+    std::ifstream status("/proc/" + std::to_string(server_pid) + "/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmRSS") || line.starts_with("Threads")) {
+            std::cout << "  server " << line << std::endl;
+        }
+    }
+}
+
+} // namespace
+
+auto main(int argc, char *argv[]) -> int {
+    int server_pid = argc > 1 ? std::stoi(argv[1]) : 0;
+    std::string connection_counts = argc > 2 ? argv[2] : "1000,10000";
+    size_t query_count = argc > 3 ? std::stoul(argv[3]) : 10000;
+    std::string query = argc > 4 ? argv[4] : "show tables;";
+    std::string host = argc > 5 ? argv[5] : "127.0.0.1";
+    uint16_t port = argc > 6 ? std::stoi(argv[6]) : 5432;
+
+    rlimit file_limit{};
+    getrlimit(RLIMIT_NOFILE, &file_limit);
+    file_limit.rlim_cur = file_limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &file_limit);
+
+    std::string query_message("Q");
+    AppendU32(query_message, sizeof(uint32_t) + query.size() + 1);
+    query_message.append(query);
+    query_message.push_back('\0');
+
+    std::cout << "before connecting" << std::endl;
+    PrintServerStatus(server_pid);
+
+    std::vector<int> connections;
+    std::stringstream counts(connection_counts);
+    std::string count_string;
+    while (std::getline(counts, count_string, ',')) {
+        size_t connection_count = std::stoul(count_string);
+        auto connect_start = std::chrono::steady_clock::now();
+        while (connections.size() < connection_count) {
+            connections.push_back(Connect(host, port));
+        }
+        auto connect_end = std::chrono::steady_clock::now();
+        std::cout << connections.size() << " connections, connect: " << std::chrono::duration<double>(connect_end - connect_start).count() << "s"
+                  << std::endl;
+        PrintServerStatus(server_pid);
+
+        std::vector<double> latencies;
+        latencies.reserve(query_count);
+        for (size_t i = 0; i < query_count; ++i) {
+            int fd = connections[i % connections.size()];
+            auto query_start = std::chrono::steady_clock::now();
+            WriteAll(fd, query_message);
+            WaitReadyForQuery(fd);
+            latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - query_start).count());
+        }
+        std::sort(latencies.begin(), latencies.end());
+        double sum = 0;
+        for (double latency : latencies) {
+            sum += latency;
+        }
+        std::cout << "  " << query_count << " queries, latency avg: " << sum / latencies.size() << "us, p50: " << latencies[latencies.size() / 2]
+                  << "us, p99: " << latencies[latencies.size() * 99 / 100] << "us" << std::endl;
+        PrintServerStatus(server_pid);
+    }
+
+    for (int fd : connections) {
+        std::string terminate("X");
+        AppendU32(terminate, sizeof(uint32_t));
+        WriteAll(fd, terminate);
+        close(fd);
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Insert the same embeddings through the row insert, one constant expression per cell, and through the columnar
+// insert, one typed buffer per column.
+
+#include "InfinityService.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TTransportUtils.h>
+#include <vector>
+
+using namespace apache::thrift;
+using namespace apache::thrift::protocol;
+using namespace apache::thrift::transport;
+using namespace infinity_thrift_rpc;
+
+namespace {
+
+struct InfinityClient {
+    std::shared_ptr<TTransport> socket;
+    std::shared_ptr<TTransport> transport;
+    std::shared_ptr<TProtocol> protocol;
+    std::unique_ptr<InfinityServiceClient> client;
+    int64_t session_id;
+    InfinityClient() {
+        socket.reset(new TSocket("127.0.0.1", 23817));
+        transport.reset(new TBufferedTransport(socket));
+        protocol.reset(new TBinaryProtocol(transport));
+        client = std::make_unique<InfinityServiceClient>(protocol);
+        transport->open();
+        CommonResponse response;
+        client->Connect(response);
+        session_id = response.session_id;
+    }
+    ~InfinityClient() {
+        CommonResponse ret;
+        CommonRequest req;
+        req.session_id = session_id;
+        client->Disconnect(ret, req);
+        transport->close();
+    }
+};
+
+const std::string db_name = "default_db";
+const std::string table_name = "insert_benchmark";
+
+void CreateTable(InfinityClient &client, int32_t dimension) {
+    CommonResponse response;
+    DropTableRequest drop_request;
+    drop_request.__set_session_id(client.session_id);
+    drop_request.__set_db_name(db_name);
+    drop_request.__set_table_name(table_name);
+    drop_request.drop_option.__set_conflict_type(DropConflict::Ignore);
+    client.client->DropTable(response, drop_request);
+
+    ColumnDef id_column;
+    id_column.__set_id(0);
+    id_column.__set_name("id");
+    id_column.data_type.__set_logic_type(LogicType::Integer);
+    id_column.constant_expr.__set_literal_type(LiteralType::Null);
+
+    ColumnDef vector_column;
+    vector_column.__set_id(1);
+    vector_column.__set_name("vec");
+    vector_column.data_type.__set_logic_type(LogicType::Embedding);
+    EmbeddingType embedding_type;
+    embedding_type.__set_dimension(dimension);
+    embedding_type.__set_element_type(ElementType::ElementFloat32);
+    vector_column.data_type.physical_type.__set_embedding_type(embedding_type);
+    vector_column.constant_expr.__set_literal_type(LiteralType::Null);
+
+    CreateTableRequest create_request;
+    create_request.__set_session_id(client.session_id);
+    create_request.__set_db_name(db_name);
+    create_request.__set_table_name(table_name);
+    create_request.__set_column_defs({id_column, vector_column});
+    create_request.create_option.__set_conflict_type(CreateConflict::Error);
+    client.client->CreateTable(response, create_request);
+    if (response.error_code != 0) {
+        std::cerr << "Create table failed: " << response.error_msg << std::endl;
+        exit(-1);
+    }
+}
+
+InsertRequest RowInsertRequest(InfinityClient &client, const std::vector<float> &data, size_t row_begin, size_t row_count, size_t dimension) {
+    InsertRequest request;
+    request.__set_session_id(client.session_id);
+    request.__set_db_name(db_name);
+    request.__set_table_name(table_name);
+    request.__set_column_names({"id", "vec"});
+    request.fields.resize(row_count);
+    for (size_t i = 0; i < row_count; ++i) {
+        size_t row = row_begin + i;
+        auto &parse_exprs = request.fields[i].parse_exprs;
+        parse_exprs.resize(2);
+        parse_exprs[0].type.constant_expr = std::make_shared<ConstantExpr>();
+        parse_exprs[0].type.constant_expr->__set_literal_type(LiteralType::Int64);
+        parse_exprs[0].type.constant_expr->__set_i64_value(row);
+        parse_exprs[0].type.__isset.constant_expr = true;
+        parse_exprs[1].type.constant_expr = std::make_shared<ConstantExpr>();
+        parse_exprs[1].type.constant_expr->__set_literal_type(LiteralType::DoubleArray);
+        parse_exprs[1].type.constant_expr->__set_f64_array_value(
+            std::vector<double>(data.begin() + row * dimension, data.begin() + (row + 1) * dimension));
+        parse_exprs[1].type.__isset.constant_expr = true;
+    }
+    return request;
+}
+
+InsertRequest ColumnarInsertRequest(InfinityClient &client, const std::vector<float> &data, size_t row_begin, size_t row_count, size_t dimension) {
+    InsertRequest request;
+    request.__set_session_id(client.session_id);
+    request.__set_db_name(db_name);
+    request.__set_table_name(table_name);
+    request.column_fields.resize(2);
+
+    ColumnField &id_field = request.column_fields[0];
+    id_field.__set_column_name("id");
+    id_field.__set_column_type(ColumnType::ColumnInt32);
+    std::string ids(row_count * sizeof(int32_t), '\0');
+    for (size_t i = 0; i < row_count; ++i) {
+        int32_t id = row_begin + i;
+        std::memcpy(ids.data() + i * sizeof(int32_t), &id, sizeof(int32_t));
+    }
+    id_field.column_vectors.emplace_back(std::move(ids));
+
+    ColumnField &vector_field = request.column_fields[1];
+    vector_field.__set_column_name("vec");
+    vector_field.__set_column_type(ColumnType::ColumnEmbedding);
+    vector_field.__set_element_type(ElementType::ElementFloat32);
+    vector_field.column_vectors.emplace_back(reinterpret_cast<const char *>(data.data() + row_begin * dimension), row_count * dimension * sizeof(float));
+    request.__isset.column_fields = true;
+    return request;
+}
+
+} // namespace
+
+auto main(int argc, char *argv[]) -> int {
+    size_t row_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    size_t batch_size = argc > 2 ? std::stoul(argv[2]) : 8192;
+    size_t dimension = argc > 3 ? std::stoul(argv[3]) : 768;
+    std::cout << "rows: " << row_count << ", batch: " << batch_size << ", dimension: " << dimension << std::endl;
+
+    std::vector<float> data(row_count * dimension);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    for (auto &value : data) {
+        value = distribution(rng);
+    }
+
+    InfinityClient client;
+    for (bool columnar : {false, true}) {
+        CreateTable(client, dimension);
+        double build_seconds = 0;
+        double rpc_seconds = 0;
+        for (size_t row_begin = 0; row_begin < row_count; row_begin += batch_size) {
+            size_t batch_rows = std::min(batch_size, row_count - row_begin);
+            auto build_start = std::chrono::steady_clock::now();
+            InsertRequest request = columnar ? ColumnarInsertRequest(client, data, row_begin, batch_rows, dimension)
+                                             : RowInsertRequest(client, data, row_begin, batch_rows, dimension);
+            auto rpc_start = std::chrono::steady_clock::now();
+            CommonResponse response;
+            client.client->Insert(response, request);
+            auto rpc_end = std::chrono::steady_clock::now();
+            if (response.error_code != 0) {
+                std::cerr << "Insert failed: " << response.error_msg << std::endl;
+                exit(-1);
+            }
+            build_seconds += std::chrono::duration<double>(rpc_start - build_start).count();
+            rpc_seconds += std::chrono::duration<double>(rpc_end - rpc_start).count();
+        }
+        std::cout << (columnar ? "columnar" : "row     ") << " insert, request build: " << build_seconds << "s, rpc: " << rpc_seconds
+                  << "s, rows/s: " << row_count / rpc_seconds << std::endl;
+    }
+    return 0;
+}
@@ -126,6 +126,7 @@ enum ClientErrorCode : int64_t {
     kTooManyConnections = 5003,
     kConfigurationLimitExceed = 5004,
     kQueryIsTooComplex = 5005,
+    kSchedulerBusy = 5006,
 
     // 6. Query intervention
     kQueryCancelled = 6001,
@@ -113,6 +113,7 @@ class ErrorCode(IntEnum):
     TOO_MANY_CONNECTIONS = 5003,
     CONFIGURATION_LIMIT_EXCEED = 5004,
     QUERY_IS_TOO_COMPLEX = 5005,
+    SCHEDULER_BUSY = 5006,
 
     QUERY_CANCELLED = 6001,
     QUERY_NOT_SUPPORTED = 6002,
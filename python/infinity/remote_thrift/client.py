@@ -150,6 +150,12 @@ class ThriftInfinityClient:
         return CommonResponse(ErrorCode.TOO_MANY_CONNECTIONS, "insert failed with exception: " + str(inner_ex))
 
     # Can be used in compact mode
+    def insert_columns(self, db_name: str, table_name: str, column_fields: list[ColumnField]):
+        return self.client.Insert(InsertRequest(session_id=self.session_id,
+                                                db_name=db_name,
+                                                table_name=table_name,
+                                                column_fields=column_fields))
+
     # def insert(self, db_name: str, table_name: str, column_names: list[str], fields: list[Field]):
     #     return self.client.Insert(InsertRequest(session_id=self.session_id,
     #                                             db_name=db_name,
@@ -165,7 +171,7 @@ class ThriftInfinityClient:
                                                 import_option=import_options))
 
     def select(self, db_name: str, table_name: str, select_list, search_expr,
-               where_expr, group_by_list, limit_expr, offset_expr):
+               where_expr, group_by_list, limit_expr, offset_expr, arrow_format=False):
         return self.client.Select(SelectRequest(session_id=self.session_id,
                                                 db_name=db_name,
                                                 table_name=table_name,
@@ -175,6 +181,7 @@ class ThriftInfinityClient:
                                                 group_by_list=group_by_list,
                                                 limit_expr=limit_expr,
                                                 offset_expr=offset_expr,
+                                                arrow_format=arrow_format,
                                                 ))
 
     def explain(self, db_name: str, table_name: str, select_list, search_expr,
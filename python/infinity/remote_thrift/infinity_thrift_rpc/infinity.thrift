@@ -229,6 +229,7 @@ struct ColumnField {
 1: ColumnType column_type,
 2: list<binary> column_vectors = [],
 3: string column_name,
+4: optional ElementType element_type,
 }
 
 struct ImportOption {
@@ -413,6 +414,7 @@ struct InsertRequest {
 3:  list<string> column_names = [],
 4:  list<Field> fields = [],
 5:  i64 session_id,
+6:  list<ColumnField> column_fields = [],
 }
 
 struct ImportRequest{
@@ -468,6 +470,7 @@ struct SelectRequest {
 9:  optional ParsedExpr limit_expr,
 10:  optional ParsedExpr offset_expr,
 11:  optional list<OrderByExpr> order_by_list = [],
+12:  optional bool arrow_format = false,
 }
 
 struct SelectResponse {
@@ -475,6 +478,7 @@ struct SelectResponse {
 2: string error_msg,
 3: list<ColumnDef> column_defs = [],
 4: list<ColumnField> column_fields = [];
+5: list<binary> arrow_batches = [];
 }
 
 struct DeleteRequest {
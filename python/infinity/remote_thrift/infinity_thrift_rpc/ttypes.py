@@ -2352,18 +2352,20 @@ class ColumnField(object):
      - column_type
      - column_vectors
      - column_name
+     - element_type
 
     """
 
 
     def __init__(self, column_type=None, column_vectors=[
-    ], column_name=None,):
+    ], column_name=None, element_type=None,):
         self.column_type = column_type
         if column_vectors is self.thrift_spec[2][4]:
             column_vectors = [
             ]
         self.column_vectors = column_vectors
         self.column_name = column_name
+        self.element_type = element_type
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -2394,6 +2396,11 @@ class ColumnField(object):
                     self.column_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.element_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -2419,6 +2426,10 @@ class ColumnField(object):
             oprot.writeFieldBegin('column_name', TType.STRING, 3)
             oprot.writeString(self.column_name.encode('utf-8') if sys.version_info[0] == 2 else self.column_name)
             oprot.writeFieldEnd()
+        if self.element_type is not None:
+            oprot.writeFieldBegin('element_type', TType.I32, 4)
+            oprot.writeI32(self.element_type)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -4710,13 +4721,15 @@ class InsertRequest(object):
      - column_names
      - fields
      - session_id
+     - column_fields
 
     """
 
 
     def __init__(self, db_name=None, table_name=None, column_names=[
     ], fields=[
-    ], session_id=None,):
+    ], session_id=None, column_fields=[
+    ],):
         self.db_name = db_name
         self.table_name = table_name
         if column_names is self.thrift_spec[3][4]:
@@ -4728,6 +4741,10 @@ class InsertRequest(object):
             ]
         self.fields = fields
         self.session_id = session_id
+        if column_fields is self.thrift_spec[6][4]:
+            column_fields = [
+            ]
+        self.column_fields = column_fields
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -4774,6 +4791,17 @@ class InsertRequest(object):
                     self.session_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.LIST:
+                    self.column_fields = []
+                    (_etype295, _size292) = iprot.readListBegin()
+                    for _i296 in range(_size292):
+                        _elem297 = ColumnField()
+                        _elem297.read(iprot)
+                        self.column_fields.append(_elem297)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -4810,6 +4838,13 @@ class InsertRequest(object):
             oprot.writeFieldBegin('session_id', TType.I64, 5)
             oprot.writeI64(self.session_id)
             oprot.writeFieldEnd()
+        if self.column_fields is not None:
+            oprot.writeFieldBegin('column_fields', TType.LIST, 6)
+            oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
+            for iter298 in self.column_fields:
+                iter298.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5293,6 +5328,7 @@ class SelectRequest(object):
      - limit_expr
      - offset_expr
      - order_by_list
+     - arrow_format
 
     """
 
@@ -5300,7 +5336,7 @@ class SelectRequest(object):
     def __init__(self, session_id=None, db_name=None, table_name=None, select_list=[
     ], search_expr=None, where_expr=None, group_by_list=[
     ], having_expr=None, limit_expr=None, offset_expr=None, order_by_list=[
-    ],):
+    ], arrow_format=False,):
         self.session_id = session_id
         self.db_name = db_name
         self.table_name = table_name
@@ -5321,6 +5357,7 @@ class SelectRequest(object):
             order_by_list = [
             ]
         self.order_by_list = order_by_list
+        self.arrow_format = arrow_format
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5409,6 +5446,11 @@ class SelectRequest(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 12:
+                if ftype == TType.BOOL:
+                    self.arrow_format = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5472,6 +5514,10 @@ class SelectRequest(object):
                 iter237.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.arrow_format is not None:
+            oprot.writeFieldBegin('arrow_format', TType.BOOL, 12)
+            oprot.writeBool(self.arrow_format)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5497,12 +5543,14 @@ class SelectResponse(object):
      - error_msg
      - column_defs
      - column_fields
+     - arrow_batches
 
     """
 
 
     def __init__(self, error_code=None, error_msg=None, column_defs=[
     ], column_fields=[
+    ], arrow_batches=[
     ],):
         self.error_code = error_code
         self.error_msg = error_msg
@@ -5514,6 +5562,10 @@ class SelectResponse(object):
             column_fields = [
             ]
         self.column_fields = column_fields
+        if arrow_batches is self.thrift_spec[5][4]:
+            arrow_batches = [
+            ]
+        self.arrow_batches = arrow_batches
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5556,6 +5608,16 @@ class SelectResponse(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.arrow_batches = []
+                    (_etype302, _size299) = iprot.readListBegin()
+                    for _i303 in range(_size299):
+                        _elem304 = iprot.readBinary()
+                        self.arrow_batches.append(_elem304)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5588,6 +5650,13 @@ class SelectResponse(object):
                 iter251.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.arrow_batches is not None:
+            oprot.writeFieldBegin('arrow_batches', TType.LIST, 5)
+            oprot.writeListBegin(TType.STRING, len(self.arrow_batches))
+            for iter305 in self.arrow_batches:
+                oprot.writeBinary(iter305)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -7028,6 +7097,7 @@ ColumnField.thrift_spec = (
     (2, TType.LIST, 'column_vectors', (TType.STRING, 'BINARY', False), [
     ], ),  # 2
     (3, TType.STRING, 'column_name', 'UTF8', None, ),  # 3
+    (4, TType.I32, 'element_type', None, None, ),  # 4
 )
 all_structs.append(ImportOption)
 ImportOption.thrift_spec = (
@@ -7242,6 +7312,8 @@ InsertRequest.thrift_spec = (
     (4, TType.LIST, 'fields', (TType.STRUCT, [Field, None], False), [
     ], ),  # 4
     (5, TType.I64, 'session_id', None, None, ),  # 5
+    (6, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
+    ], ),  # 6
 )
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
@@ -7299,6 +7371,7 @@ SelectRequest.thrift_spec = (
     (10, TType.STRUCT, 'offset_expr', [ParsedExpr, None], None, ),  # 10
     (11, TType.LIST, 'order_by_list', (TType.STRUCT, [OrderByExpr, None], False), [
     ], ),  # 11
+    (12, TType.BOOL, 'arrow_format', None, False, ),  # 12
 )
 all_structs.append(SelectResponse)
 SelectResponse.thrift_spec = (
@@ -7309,6 +7382,8 @@ SelectResponse.thrift_spec = (
     ], ),  # 3
     (4, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
     ], ),  # 4
+    (5, TType.LIST, 'arrow_batches', (TType.STRING, 'BINARY', False), [
+    ], ),  # 5
 )
 all_structs.append(DeleteRequest)
 DeleteRequest.thrift_spec = (
@@ -227,8 +227,11 @@ class InfinityThriftQueryBuilder(ABC):
         return self._table._execute_query(query)
 
     def to_df(self) -> pd.DataFrame:
+        return self._result_to_df(*self.to_result())
+
+    @staticmethod
+    def _result_to_df(data_dict: dict[str, list[Any]], data_type_dict: dict[str, Any]) -> pd.DataFrame:
         df_dict = {}
-        data_dict, data_type_dict = self.to_result()
         for k, v in data_dict.items():
             data_series = pd.Series(
                 v, dtype=logic_type_to_dtype(data_type_dict[k]))
@@ -239,7 +242,19 @@ class InfinityThriftQueryBuilder(ABC):
         return pl.from_pandas(self.to_df())
 
     def to_arrow(self) -> Table:
-        return pa.Table.from_pandas(self.to_df())
+        query = Query(
+            columns=self._columns,
+            search=self._search,
+            filter=self._filter,
+            limit=self._limit,
+            offset=self._offset
+        )
+        self.reset()
+        res = self._table._execute_query_arrow(query)
+        if res is None:
+            # some column has no arrow encoding on the server, convert the regular result instead
+            return pa.Table.from_pandas(self._result_to_df(*self._table._execute_query(query)))
+        return res
 
     def explain(self, explain_type=ExplainType.Physical) -> Any:
         query = ExplainQuery(
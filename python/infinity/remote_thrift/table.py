@@ -15,6 +15,7 @@ import functools
 import inspect
 import os
 import numpy as np
+import pyarrow as pa
 from abc import ABC
 from typing import Optional, Union, List, Any
 
@@ -26,7 +27,7 @@ from infinity.errors import ErrorCode
 from infinity.index import IndexInfo
 from infinity.remote_thrift.query_builder import Query, InfinityThriftQueryBuilder, ExplainQuery
 from infinity.remote_thrift.types import build_result
-from infinity.remote_thrift.utils import traverse_conditions, name_validity_check, select_res_to_polars
+from infinity.remote_thrift.utils import traverse_conditions, name_validity_check, select_res_to_polars, to_column_field
 from infinity.table import Table, ExplainType
 from infinity.common import ConflictType
 
@@ -213,6 +214,17 @@ class RemoteTable(Table, ABC):
         else:
             raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
 
+    def insert_columns(self, columns: dict[str, Any]):
+        # {"c1": np.array([1, 2], dtype=np.int32), "c2": ["a", "b"], "vec": np.zeros((2, 768), dtype=np.float32)}
+        # The dtype of each array must match the column type, an embedding column takes a 2-D array.
+        column_fields = [to_column_field(column_name, values) for column_name, values in columns.items()]
+        res = self._conn.insert_columns(db_name=self._db_name, table_name=self._table_name,
+                                        column_fields=column_fields)
+        if res.error_code == ErrorCode.OK:
+            return res
+        else:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+
     def import_data(self, file_path: str, import_options: {} = None):
         options = ttypes.ImportOption()
         options.has_header = False
@@ -383,6 +395,27 @@ class RemoteTable(Table, ABC):
         else:
             raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
 
+    def _execute_query_arrow(self, query: Query) -> Optional[pa.Table]:
+
+        # the server encodes the result as an arrow IPC stream, one record batch per data block,
+        # None if some column type has no arrow encoding
+        res = self._conn.select(db_name=self._db_name,
+                                table_name=self._table_name,
+                                select_list=query.columns,
+                                search_expr=query.search,
+                                where_expr=query.filter,
+                                group_by_list=None,
+                                limit_expr=query.limit,
+                                offset_expr=query.offset,
+                                arrow_format=True)
+
+        if res.error_code == ErrorCode.OK:
+            return pa.ipc.open_stream(b"".join(res.arrow_batches)).read_all()
+        elif res.error_code == ErrorCode.NOT_SUPPORTED:
+            return None
+        else:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+
     def _explain_query(self, query: ExplainQuery) -> Any:
         res = self._conn.explain(db_name=self._db_name,
                                  table_name=self._table_name,
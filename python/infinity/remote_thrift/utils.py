@@ -15,6 +15,7 @@
 import re
 import functools
 import inspect
+import numpy as np
 import pandas as pd
 import polars as pl
 import sqlglot.expressions as exp
@@ -197,6 +198,55 @@ def name_validity_check(arg_name: str, name_type: str = "Table"):
     return decorator
 
 
+_dtype_to_column_type = {
+    np.dtype(np.bool_): ttypes.ColumnType.ColumnBool,
+    np.dtype(np.int8): ttypes.ColumnType.ColumnInt8,
+    np.dtype(np.int16): ttypes.ColumnType.ColumnInt16,
+    np.dtype(np.int32): ttypes.ColumnType.ColumnInt32,
+    np.dtype(np.int64): ttypes.ColumnType.ColumnInt64,
+    np.dtype(np.float32): ttypes.ColumnType.ColumnFloat32,
+    np.dtype(np.float64): ttypes.ColumnType.ColumnFloat64,
+}
+
+# uint8 arrays are the packed bytes of bit embeddings
+_dtype_to_element_type = {
+    np.dtype(np.uint8): ttypes.ElementType.ElementBit,
+    np.dtype(np.int8): ttypes.ElementType.ElementInt8,
+    np.dtype(np.int16): ttypes.ElementType.ElementInt16,
+    np.dtype(np.int32): ttypes.ElementType.ElementInt32,
+    np.dtype(np.int64): ttypes.ElementType.ElementInt64,
+    np.dtype(np.float32): ttypes.ElementType.ElementFloat32,
+    np.dtype(np.float64): ttypes.ElementType.ElementFloat64,
+}
+
+
+def to_column_field(column_name: str, values) -> ttypes.ColumnField:
+    # varchar: row_count + 1 u32 offsets and the concatenated utf-8 bytes
+    if isinstance(values, (list, tuple)) and len(values) > 0 and isinstance(values[0], str):
+        encoded = [value.encode("utf-8") for value in values]
+        offsets = np.zeros(len(encoded) + 1, dtype="<u4")
+        np.cumsum([len(value) for value in encoded], out=offsets[1:])
+        return ttypes.ColumnField(column_type=ttypes.ColumnType.ColumnVarchar,
+                                  column_vectors=[offsets.tobytes(), b"".join(encoded)],
+                                  column_name=column_name)
+    array = np.asarray(values)
+    if array.ndim == 2:
+        # embeddings, one row per vector in the element type of the column
+        if array.dtype not in _dtype_to_element_type:
+            raise Exception(f"Unsupported embedding data of {column_name}: {array.dtype}")
+        element_type = _dtype_to_element_type[array.dtype]
+        array = np.ascontiguousarray(array, dtype=array.dtype.newbyteorder("<"))
+        return ttypes.ColumnField(column_type=ttypes.ColumnType.ColumnEmbedding,
+                                  column_vectors=[array.tobytes()],
+                                  column_name=column_name,
+                                  element_type=element_type)
+    if array.ndim != 1 or array.dtype not in _dtype_to_column_type:
+        raise Exception(f"Unsupported column data of {column_name}: {array.dtype} with {array.ndim} dimensions")
+    column_type = _dtype_to_column_type[array.dtype]
+    array = np.ascontiguousarray(array, dtype=array.dtype.newbyteorder("<"))
+    return ttypes.ColumnField(column_type=column_type, column_vectors=[array.tobytes()], column_name=column_name)
+
+
 def select_res_to_polars(res) -> pl.DataFrame:
     df_dict = {}
     data_dict, data_type_dict = build_result(res)
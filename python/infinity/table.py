@@ -62,6 +62,10 @@ class Table(ABC):
     def insert(self, data: list[dict[str, Union[str, int, float, list[Union[int, float]]]]]):
         pass
 
+    @abstractmethod
+    def insert_columns(self, columns: dict[str, Any]):
+        pass
+
     @abstractmethod
     def import_data(self, file_path: str, options=None):
         pass
@@ -5,6 +5,8 @@ TEST_REMOTE_HOST = NetworkAddress("127.0.0.1", 23817)
 # TEST_REMOTE_HOST = NetworkAddress("192.168.200.151", 23817)
 # infinity thrift server port
 infinity_server_port = 23817
+# infinity pg server port
+infinity_pg_port = 5432
 
 identifier_limit = 65536
 database_count_limit = 65536
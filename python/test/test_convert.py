@@ -1,3 +1,5 @@
+from decimal import Decimal
+
 import pytest
 from infinity.errors import ErrorCode
 
@@ -45,6 +47,54 @@ class TestConvert(TestSdk):
         print(res)
         db_obj.drop_table("test_to_pa", ConflictType.Error)
 
+    def test_to_pa_types(self):
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_to_pa_types", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_to_pa_types", {
+            "c1": {"type": "int"}, "c2": {"type": "varchar"}, "c3": {"type": "vector,3,float"}}, ConflictType.Error)
+        table_obj.insert([{"c1": 1, "c2": "short", "c3": [1.0, 2.0, 3.0]},
+                          {"c1": 2, "c2": "a varchar longer than the inline length", "c3": [4.0, 5.0, 6.0]}])
+
+        res = table_obj.output(["c1", "c2", "c3"]).to_arrow()
+        assert res.num_rows == 2
+        assert str(res.schema.field("c1").type) == "int32"
+        assert str(res.schema.field("c2").type) == "string"
+        assert res.schema.field("c3").type.list_size == 3
+        assert sorted(res.to_pylist(), key=lambda row: row["c1"]) == [
+            {"c1": 1, "c2": "short", "c3": [1.0, 2.0, 3.0]},
+            {"c1": 2, "c2": "a varchar longer than the inline length", "c3": [4.0, 5.0, 6.0]}]
+        db_obj.drop_table("test_to_pa_types", ConflictType.Error)
+
+    def test_to_pa_hugeint(self):
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_to_pa_hugeint", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_to_pa_hugeint", {
+            "c1": {"type": "int"}, "c2": {"type": "hugeint"}}, ConflictType.Error)
+        table_obj.insert([{"c1": 1, "c2": -5}, {"c1": 2, "c2": pow(2, 63) - 1}])
+
+        # hugeint is sent as a decimal of scale 0
+        res = table_obj.output(["c1", "c2"]).to_arrow()
+        assert str(res.schema.field("c2").type) == "decimal128(38, 0)"
+        assert sorted(res.to_pylist(), key=lambda row: row["c1"]) == [
+            {"c1": 1, "c2": Decimal(-5)}, {"c1": 2, "c2": Decimal(pow(2, 63) - 1)}]
+        db_obj.drop_table("test_to_pa_hugeint", ConflictType.Error)
+
+    def test_to_pa_fallback(self):
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_to_pa_fallback", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_to_pa_fallback", {
+            "c1": {"type": "int"}, "c2": {"type": "varchar"}}, ConflictType.Error)
+        table_obj.insert([{"c1": 1, "c2": "a"}, {"c1": 2, "c2": "b"}])
+
+        # a result the server can't encode as arrow is converted from the regular result
+        table_obj._execute_query_arrow = lambda query: None
+        res = table_obj.output(["c1", "c2"]).to_arrow()
+        assert sorted(res.to_pylist(), key=lambda row: row["c1"]) == [{"c1": 1, "c2": "a"}, {"c1": 2, "c2": "b"}]
+        db_obj.drop_table("test_to_pa_fallback", ConflictType.Error)
+
     def test_to_df(self):
         infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
         db_obj = infinity_obj.get_database("default_db")
@@ -17,6 +17,7 @@ import pytest
 
 from common import common_values
 import infinity
+import infinity.index as index
 from infinity.table import ExplainType
 from infinity.common import ConflictType
 from test_sdkbase import TestSdk
@@ -72,3 +73,39 @@ class TestExplain(TestSdk):
                 print(res)
 
         db_obj.drop_table("test_explain_default", ConflictType.Error)
+
+    def test_explain_knn_filter_strategy(self):
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_explain_knn_filter_strategy", ConflictType.Ignore)
+        table = db_obj.create_table("test_explain_knn_filter_strategy", {
+            "c1": {"type": "int"}, "c2": {"type": "vector,4,float"}}, ConflictType.Error)
+        assert table
+
+        table.insert([{"c1": 2, "c2": [0.1, 0.2, 0.3, -0.2]},
+                      {"c1": 4, "c2": [0.2, 0.1, 0.3, 0.4]},
+                      {"c1": 6, "c2": [0.3, 0.2, 0.1, 0.4]},
+                      {"c1": 8, "c2": [0.4, 0.3, 0.2, 0.1]}])
+        table.create_index("idx1", [index.IndexInfo("c2", index.IndexType.Hnsw,
+                                                    [index.InitParameter("M", "16"),
+                                                     index.InitParameter("ef_construction", "200"),
+                                                     index.InitParameter("metric", "l2")])], ConflictType.Error)
+
+        def explain_knn(filter, brute_force_selectivity):
+            res = table.output(["c1"]).knn("c2", [0.3, 0.3, 0.2, 0.2], "float", "l2", 3,
+                                           {"brute_force_selectivity": brute_force_selectivity}).filter(
+                filter).explain()
+            return "\n".join(res.to_series(0).to_list())
+
+        # explain reports the policy only, the strategy of each segment is decided at execution
+        plan = explain_knn("c1 < 7", "0.8")
+        print(plan)
+        assert "brute force below selectivity 0.8" in plan
+        assert "decided per segment at execution" in plan
+        assert "segment 0:" not in plan
+
+        plan = explain_knn("c1 < 7", "0.7")
+        print(plan)
+        assert "brute force below selectivity 0.7" in plan
+
+        db_obj.drop_table("test_explain_knn_filter_strategy", ConflictType.Error)
@@ -24,6 +24,7 @@ import infinity
 import infinity.index as index
 from infinity.common import ConflictType
 from infinity.errors import ErrorCode
+from infinity.remote_thrift.utils import to_column_field
 from utils import start_infinity_service_in_subporcess
 from test_sdkbase import TestSdk
 
@@ -741,3 +742,70 @@ class TestInsert(TestSdk):
         # disconnect
         res = infinity_obj.disconnect()
         assert res.error_code == ErrorCode.OK
+
+    def test_insert_columns(self):
+        """
+        target: test columnar insert
+        method: insert int, varchar and embedding columns as typed buffers, more rows than one block
+        expected: ok
+        """
+        import numpy as np
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default_db")
+        db_obj.drop_table("test_insert_columns", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_insert_columns", {
+            "c1": {"type": "int"}, "c2": {"type": "varchar"}, "c3": {"type": "vector,4,float"}}, ConflictType.Error)
+        assert table_obj
+
+        row_count = 10000
+        res = table_obj.insert_columns({
+            "c3": np.arange(row_count * 4, dtype=np.float32).reshape(row_count, 4),
+            "c1": np.arange(row_count, dtype=np.int32),
+            "c2": [f"row_{i}" for i in range(row_count)],
+        })
+        assert res.error_code == ErrorCode.OK
+
+        res = table_obj.output(["c1", "c2"]).filter("c1 = 9999").to_df()
+        pd.testing.assert_frame_equal(res, pd.DataFrame({'c1': (9999,), 'c2': ("row_9999",)}).astype(
+            {'c1': dtype('int32')}))
+
+        # the dtype must match the column type
+        with pytest.raises(Exception):
+            table_obj.insert_columns({
+                "c1": np.arange(2, dtype=np.int64),
+                "c2": ["a", "b"],
+                "c3": np.zeros((2, 4), dtype=np.float32),
+            })
+
+        # so must the element type of an embedding, even if the byte size matches
+        with pytest.raises(Exception, match="ERROR:"):
+            table_obj.insert_columns({
+                "c1": np.arange(2, dtype=np.int32),
+                "c2": ["a", "b"],
+                "c3": np.zeros((2, 4), dtype=np.int32),
+            })
+        with pytest.raises(Exception, match="ERROR:"):
+            table_obj.insert_columns({
+                "c1": np.arange(2, dtype=np.int32),
+                "c2": ["a", "b"],
+                "c3": np.zeros((4, 2), dtype=np.float64),
+            })
+
+        # an embedding without element type is rejected by the server
+        column_fields = [to_column_field("c1", np.arange(2, dtype=np.int32)),
+                         to_column_field("c2", ["a", "b"]),
+                         to_column_field("c3", np.zeros((2, 4), dtype=np.float32))]
+        column_fields[2].element_type = None
+        res = table_obj._conn.insert_columns(db_name="default_db", table_name="test_insert_columns",
+                                             column_fields=column_fields)
+        assert res.error_code != ErrorCode.OK
+
+        # nothing of the failed inserts is visible
+        res = table_obj.output(["c1"]).to_df()
+        assert len(res) == row_count
+
+        res = db_obj.drop_table("test_insert_columns", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
+        res = infinity_obj.disconnect()
+        assert res.error_code == ErrorCode.OK
@@ -0,0 +1,274 @@
+# Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+import socket
+import struct
+import threading
+
+from common import common_values
+from test_sdkbase import TestSdk
+
+
+class PGClient:
+    """Speaks the PG wire protocol over a raw socket, so tests can send partial and malformed messages."""
+
+    def __init__(self, timeout=10):
+        self.sock = socket.create_connection(("127.0.0.1", common_values.infinity_pg_port), timeout=timeout)
+
+    def close(self):
+        self.sock.close()
+
+    def send(self, data: bytes):
+        self.sock.sendall(data)
+
+    def recv_exact(self, size: int) -> bytes:
+        data = b""
+        while len(data) < size:
+            chunk = self.sock.recv(size - len(data))
+            if not chunk:
+                raise ConnectionError("connection closed by the server")
+            data += chunk
+        return data
+
+    def read_message(self):
+        message_type = self.recv_exact(1)
+        length = struct.unpack("!I", self.recv_exact(4))[0]
+        return message_type, self.recv_exact(length - 4)
+
+    def read_until_ready(self):
+        messages = []
+        while True:
+            message_type, body = self.read_message()
+            messages.append((message_type, body))
+            if message_type == b"Z":
+                return messages
+
+    @staticmethod
+    def startup_message() -> bytes:
+        body = struct.pack("!I", 196608) + b"user\0infinity\0\0"
+        return struct.pack("!I", len(body) + 4) + body
+
+    @staticmethod
+    def message(message_type: bytes, body: bytes) -> bytes:
+        return message_type + struct.pack("!I", len(body) + 4) + body
+
+    @staticmethod
+    def query_message(query: str) -> bytes:
+        return PGClient.message(b"Q", query.encode() + b"\0")
+
+    @staticmethod
+    def parse_message(query: str, statement: str = "") -> bytes:
+        return PGClient.message(b"P", statement.encode() + b"\0" + query.encode() + b"\0" + struct.pack("!h", 0))
+
+    @staticmethod
+    def bind_message(statement: str = "", portal: str = "", result_formats=()) -> bytes:
+        body = portal.encode() + b"\0" + statement.encode() + b"\0" + struct.pack("!hh", 0, 0)
+        body += struct.pack("!h", len(result_formats)) + b"".join(struct.pack("!h", f) for f in result_formats)
+        return PGClient.message(b"B", body)
+
+    @staticmethod
+    def describe_message(object_type: bytes, name: str = "") -> bytes:
+        return PGClient.message(b"D", object_type + name.encode() + b"\0")
+
+    @staticmethod
+    def execute_message(portal: str = "", max_rows: int = 0) -> bytes:
+        return PGClient.message(b"E", portal.encode() + b"\0" + struct.pack("!i", max_rows))
+
+    @staticmethod
+    def sync_message() -> bytes:
+        return PGClient.message(b"S", b"")
+
+    def startup(self):
+        self.send(self.startup_message())
+        return self.read_until_ready()
+
+    def query(self, query: str):
+        self.send(self.query_message(query))
+        return self.read_until_ready()
+
+
+def message_types(messages):
+    return [message_type for message_type, _ in messages]
+
+
+def data_rows(messages):
+    """The column values of the DataRow messages, None for NULL."""
+    rows = []
+    for message_type, body in messages:
+        if message_type != b"D":
+            continue
+        column_count = struct.unpack("!h", body[:2])[0]
+        position = 2
+        row = []
+        for _ in range(column_count):
+            length = struct.unpack("!i", body[position:position + 4])[0]
+            position += 4
+            if length < 0:
+                row.append(None)
+            else:
+                row.append(body[position:position + length])
+                position += length
+        rows.append(row)
+    return rows
+
+
+class TestPGProtocol(TestSdk):
+
+    def test_simple_query(self):
+        client = PGClient()
+        assert message_types(client.startup())[-1] == b"Z"
+        types = message_types(client.query("SELECT 1;"))
+        assert b"E" not in types
+        assert b"C" in types
+        client.close()
+
+    def test_ssl_request(self):
+        client = PGClient()
+        client.send(struct.pack("!II", 8, 80877103))
+        assert client.recv_exact(1) == b"N"
+        assert message_types(client.startup())[-1] == b"Z"
+        client.close()
+
+    def test_large_message(self):
+        # larger than the receive buffer of the connection
+        client = PGClient()
+        client.startup()
+        types = message_types(client.query(" " * 100000 + "SELECT 1;"))
+        assert b"E" not in types
+        assert b"C" in types
+        client.close()
+
+    def test_stalled_client(self):
+        # clients stopping in the middle of a message hold no server thread
+        stalled_clients = []
+        for _ in range(64):
+            client = PGClient()
+            client.startup()
+            message = PGClient.query_message(" " * 100000 + "SELECT 1;")
+            client.send(message[:50000])
+            stalled_clients.append((client, message))
+
+        results = []
+
+        def run_query():
+            client = PGClient(timeout=30)
+            client.startup()
+            results.append(message_types(client.query("SELECT 1;")))
+            client.close()
+
+        threads = [threading.Thread(target=run_query) for _ in range(8)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        assert len(results) == 8
+        for types in results:
+            assert b"C" in types
+
+        # the stalled clients finish their message later
+        for client, message in stalled_clients:
+            client.send(message[50000:])
+            assert b"C" in message_types(client.read_until_ready())
+            client.close()
+
+    def test_message_too_long(self):
+        client = PGClient()
+        client.startup()
+        client.send(b"Q" + struct.pack("!I", 0x7fffffff))
+        try:
+            closed = client.sock.recv(1) == b""
+        except ConnectionResetError:
+            closed = True
+        assert closed
+        client.close()
+
+    def test_extended_query(self):
+        client = PGClient()
+        client.startup()
+        assert b"E" not in message_types(client.query("DROP TABLE IF EXISTS test_pg_extended_query;"))
+        assert b"E" not in message_types(client.query("CREATE TABLE test_pg_extended_query (c1 integer, c2 varchar);"))
+        assert b"E" not in message_types(
+            client.query("INSERT INTO test_pg_extended_query VALUES (1, 'a'), (2, 'b'), (3, 'c');"))
+
+        # text format
+        client.send(PGClient.parse_message("SELECT c1, c2 FROM test_pg_extended_query ORDER BY c1;")
+                    + PGClient.bind_message()
+                    + PGClient.describe_message(b"P")
+                    + PGClient.execute_message()
+                    + PGClient.sync_message())
+        messages = client.read_until_ready()
+        assert message_types(messages) == [b"1", b"2", b"T", b"D", b"D", b"D", b"C", b"Z"]
+        assert data_rows(messages) == [[b"1", b"a"], [b"2", b"b"], [b"3", b"c"]]
+
+        # binary integer column, at most 2 rows per Execute
+        client.send(PGClient.parse_message("SELECT c1 FROM test_pg_extended_query ORDER BY c1;", "stmt")
+                    + PGClient.bind_message("stmt", "portal", [1])
+                    + PGClient.execute_message("portal", 2)
+                    + PGClient.execute_message("portal", 2)
+                    + PGClient.sync_message())
+        messages = client.read_until_ready()
+        assert message_types(messages) == [b"1", b"2", b"D", b"D", b"s", b"D", b"C", b"Z"]
+        assert data_rows(messages) == [[struct.pack("!i", 1)], [struct.pack("!i", 2)], [struct.pack("!i", 3)]]
+
+        assert b"E" not in message_types(client.query("DROP TABLE test_pg_extended_query;"))
+        client.close()
+
+    def test_extended_query_error(self):
+        # after an error, the messages are discarded until Sync
+        client = PGClient()
+        client.startup()
+        client.send(PGClient.bind_message("no_such_statement")
+                    + PGClient.describe_message(b"P")
+                    + PGClient.execute_message()
+                    + PGClient.sync_message())
+        assert message_types(client.read_until_ready()) == [b"E", b"Z"]
+
+        client.send(PGClient.parse_message("SELECT * FROM no_such_table;")
+                    + PGClient.bind_message()
+                    + PGClient.execute_message()
+                    + PGClient.parse_message("SELECT 1;")
+                    + PGClient.sync_message())
+        assert message_types(client.read_until_ready()) == [b"1", b"2", b"E", b"Z"]
+
+        types = message_types(client.query("SELECT 1;"))
+        assert b"E" not in types
+        assert b"C" in types
+        client.close()
+
+    def test_malformed_message(self):
+        malformed_messages = [
+            # unterminated query string
+            PGClient.message(b"P", b"\0SELECT 1;"),
+            # unknown result format code
+            PGClient.message(b"B", b"\0\0" + struct.pack("!hhhh", 0, 0, 1, 7)),
+            # unknown object type
+            PGClient.message(b"D", b"X\0"),
+            # Execute without the row limit
+            PGClient.message(b"E", b"\0"),
+            # unknown message type, its body must not be read as the next message
+            PGClient.message(b"y", PGClient.query_message("SELECT 1;")),
+        ]
+        client = PGClient()
+        client.startup()
+        for malformed_message in malformed_messages:
+            client.send(malformed_message
+                        + PGClient.parse_message("SELECT 1;")
+                        + PGClient.bind_message()
+                        + PGClient.execute_message()
+                        + PGClient.sync_message())
+            assert message_types(client.read_until_ready()) == [b"E", b"Z"]
+
+            types = message_types(client.query("SELECT 1;"))
+            assert b"E" not in types
+            assert b"C" in types
+        client.close()
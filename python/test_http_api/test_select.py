@@ -166,6 +166,25 @@ class TestSelect(HttpTest):
         return
 
 
+    def test_http_select_varchar_float(self):
+        db_name = "default_db"
+        table_name = "test_select_varchar_float"
+        self.show_database(db_name)
+        self.drop_table(db_name, table_name)
+        self.create_table(db_name, table_name, [
+            {"name": "c1", "type": "varchar"},
+            {"name": "c2", "type": "float"},
+        ])
+        self.insert(db_name, table_name, [{"c1": 'say "hi"\\', "c2": 2.0},
+                                          {"c1": "a varchar longer than the inline length", "c2": -0.5}])
+        self.select(db_name, table_name, ["c1", "c2"], "", {}, {}, {
+            "error_code": 0,
+            "output": [{'c1': 'say "hi"\\', 'c2': '2.000000'},
+                       {'c1': 'a varchar longer than the inline length', 'c2': '-0.500000'}]
+        })
+        self.drop_table(db_name, table_name)
+        return
+
     def test_http_select_embedding_int32(self):
         httputils.check_data(TEST_TMP_DIR)
         db_name = "default_db"
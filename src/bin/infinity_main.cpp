@@ -32,6 +32,10 @@ namespace {
 
 infinity::PGServer pg_server;
 
+// 0: thread pool server, a worker thread per connection up to the connection limit
+// 1: non-blocking server, io threads poll the connections and a worker pool runs the requests, clients use the framed
+//    transport
+// 2: a new thread per connection
 #define THRIFT_SERVER_TYPE 0
 
 #if THRIFT_SERVER_TYPE == 0
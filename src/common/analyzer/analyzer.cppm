@@ -83,11 +83,11 @@ protected:
 
     SharedPtr<Analyzer> inner_analyzer_;
     /// Whether including speical characters (e.g. puncutations) in the result.
-    bool extract_special_char_;
+    bool extract_special_char_{false};
 
     /// Whether converting speical characters (e.g. puncutations) into a particular place holder
     /// symbol in the result.
     /// Be effect only when extract_special_char_ is set.
-    bool convert_to_placeholder_;
+    bool convert_to_placeholder_{false};
 };
 } // namespace infinity
\ No newline at end of file
@@ -35,9 +35,41 @@ constexpr u64 Str2Int(const char *str, u64 last_value = basis) {
     return (*str != '\0' && *str != '-') ? Str2Int(str + 1, (*str ^ last_value) * prime) : last_value;
 }
 
-UniquePtr<Analyzer> AnalyzerPool::Get(const std::string_view &name) {
+namespace {
+
+// idle analyzers of the current thread by name
+HashMap<String, Vector<UniquePtr<Analyzer>>> &IdleAnalyzers() {
+    thread_local HashMap<String, Vector<UniquePtr<Analyzer>>> idle_analyzers;
+    return idle_analyzers;
+}
+
+} // namespace
+
+void AnalyzerRecycler::operator()(Analyzer *analyzer) const {
+    UniquePtr<Analyzer> owned(analyzer);
+    if (owned.get() == nullptr) {
+        return;
+    }
+    Vector<UniquePtr<Analyzer>> &idle = IdleAnalyzers()[name_];
+    if (idle.size() < AnalyzerPool::MAX_IDLE_PER_THREAD) {
+        idle.push_back(std::move(owned));
+    }
+}
+
+PooledAnalyzer AnalyzerPool::Get(const std::string_view &name) {
+    auto &idle_analyzers = IdleAnalyzers();
+    if (auto iter = idle_analyzers.find(String(name)); iter != idle_analyzers.end() && !iter->second.empty()) {
+        Analyzer *analyzer = iter->second.back().release();
+        iter->second.pop_back();
+        return PooledAnalyzer(analyzer, AnalyzerRecycler{String(name)});
+    }
+    return PooledAnalyzer(Create(name).release(), AnalyzerRecycler{String(name)});
+}
+
+UniquePtr<Analyzer> AnalyzerPool::Create(const std::string_view &name) {
     switch (Str2Int(name.data())) {
         case Str2Int(CHINESE.data()): {
+            std::lock_guard<std::mutex> guard(cache_mutex_);
             Analyzer *prototype = cache_[CHINESE].get();
             if (prototype == nullptr) {
                 String path;
@@ -55,6 +87,7 @@ UniquePtr<Analyzer> AnalyzerPool::Get(const std::string_view &name) {
                 prototype = analyzer.get();
                 cache_[CHINESE] = std::move(analyzer);
             }
+            // shares the jieba dictionary and the stopwords of the prototype
             return MakeUnique<ChineseAnalyzer>(*reinterpret_cast<ChineseAnalyzer *>(prototype));
         } break;
         case Str2Int(STANDARD.data()): {
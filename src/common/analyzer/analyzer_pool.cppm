@@ -23,11 +23,24 @@ import analyzer;
 
 namespace infinity {
 
+// Gives the analyzer back to the pool of the thread that releases it.
+export struct AnalyzerRecycler {
+    String name_{};
+
+    void operator()(Analyzer *analyzer) const;
+};
+
+// Analyzers keep per call state (tokenizer cursor, output buffers, stemmer environment), so one instance serves one thread at a time.
+// The dictionaries behind them (jieba dictionary and stopwords, char type tables, stemmer tables) are immutable and shared by all instances.
+export using PooledAnalyzer = std::unique_ptr<Analyzer, AnalyzerRecycler>;
+
 export class AnalyzerPool : public Singleton<AnalyzerPool> {
 public:
     using CacheType = FlatHashMap<std::string_view, UniquePtr<Analyzer>>;
 
-    UniquePtr<Analyzer> Get(const std::string_view &name);
+    // Reuses an analyzer released by the calling thread before, without locking, and creates one otherwise.
+    // Callers must not change the options of the analyzer they get.
+    PooledAnalyzer Get(const std::string_view &name);
 
     void Set(const std::string_view &name);
 
@@ -36,8 +49,17 @@ public:
     static constexpr std::string_view STANDARD = "standard";
     static constexpr std::string_view NGRAM = "ngram";
 
+    // analyzers kept by each thread for each name
+    static constexpr SizeT MAX_IDLE_PER_THREAD = 4;
+
 private:
+    friend struct AnalyzerRecycler;
+
+    UniquePtr<Analyzer> Create(const std::string_view &name);
+
+    // prototypes holding the shared dictionaries, only touched when a thread has no idle analyzer
+    std::mutex cache_mutex_{};
     CacheType cache_{};
 };
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
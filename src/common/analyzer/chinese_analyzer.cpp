@@ -47,14 +47,10 @@ namespace fs = std::filesystem;
 
 ChineseAnalyzer::ChineseAnalyzer(const String &path) : dict_path_(path) {}
 
-ChineseAnalyzer::ChineseAnalyzer(const ChineseAnalyzer &other) {
-    own_jieba_ = false;
-    jieba_ = other.jieba_;
-}
-ChineseAnalyzer::~ChineseAnalyzer() {
-    if (own_jieba_ && jieba_)
-        delete jieba_;
-}
+ChineseAnalyzer::ChineseAnalyzer(const ChineseAnalyzer &other)
+    : Analyzer(), jieba_(other.jieba_), stopwords_(other.stopwords_), dict_path_(other.dict_path_) {}
+
+ChineseAnalyzer::~ChineseAnalyzer() = default;
 
 bool ChineseAnalyzer::Load() {
     fs::path root(dict_path_);
@@ -86,25 +82,30 @@ bool ChineseAnalyzer::Load() {
     }
 
     try {
-        jieba_ = new cppjieba::Jieba(dict_path.string(), hmm_path.string(), userdict_path.string(), idf_path.string(), stopwords_path.string());
+        jieba_ =
+            MakeShared<cppjieba::Jieba>(dict_path.string(), hmm_path.string(), userdict_path.string(), idf_path.string(), stopwords_path.string());
     } catch (const std::exception &e) {
         return false;
     }
-    own_jieba_ = true;
-    LoadStopwordsDict(stopwords_path.string());
+    stopwords_ = LoadStopwordsDict(stopwords_path.string());
     return true;
 }
 
-void ChineseAnalyzer::LoadStopwordsDict(const String &stopwords_path) {
+SharedPtr<const FlatHashSet<String>> ChineseAnalyzer::LoadStopwordsDict(const String &stopwords_path) {
+    auto stopwords = MakeShared<FlatHashSet<String>>();
     std::ifstream ifs(stopwords_path);
     String line;
     while (getline(ifs, line)) {
-        stopwords_.insert(line);
+        stopwords->insert(line);
     }
+    return stopwords;
 }
 
 int ChineseAnalyzer::AnalyzeImpl(const Term &input, void *data, HookTypeForJieba func) {
     Parse(input.text_);
+    if (cut_words_.empty()) {
+        return 0;
+    }
     for (u32 i = 0; i < cut_words_.size(); ++i) {
         if (!Accept_token(cut_words_[i].word))
             continue;
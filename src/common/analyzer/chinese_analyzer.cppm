@@ -28,6 +28,7 @@ export class ChineseAnalyzer : public Analyzer {
 public:
     ChineseAnalyzer(const String &path);
 
+    // shares the loaded dictionary and stopwords of `other`
     ChineseAnalyzer(const ChineseAnalyzer &other);
 
     ~ChineseAnalyzer();
@@ -40,14 +41,14 @@ protected:
     int AnalyzeImpl(const Term &input, void *data, HookTypeForJieba func) override;
 
 private:
-    void LoadStopwordsDict(const String &stopwords_path);
-    bool Accept_token(const String &term) { return !stopwords_.contains(term); }
+    static SharedPtr<const FlatHashSet<String>> LoadStopwordsDict(const String &stopwords_path);
+    bool Accept_token(const String &term) { return !stopwords_->contains(term); }
 
 private:
-    cppjieba::Jieba *jieba_{nullptr};
+    // immutable after Load(), cutting only reads the dictionary so copies share it across threads
+    SharedPtr<cppjieba::Jieba> jieba_{};
+    SharedPtr<const FlatHashSet<String>> stopwords_{};
     String dict_path_;
-    bool own_jieba_{};
     Vector<cppjieba::Word> cut_words_;
-    FlatHashSet<String> stopwords_;
 };
 } // namespace infinity
@@ -48,52 +48,42 @@ inline void ToLower(char *data, size_t len) {
     }
 }
 
+// Lowercases the ASCII letters of data into out, which holds at least len + 1 chars, and null terminates it.
 inline void ToLower(const char *data, size_t len, char *out, size_t out_limit) {
-    memcpy(out, data, len);
-    char *begin = out;
-    char *end = out + len;
-    char *p = begin;
+    size_t i = 0;
+#if defined(__AVX2__)
+    {
+        const auto a_minus1 = _mm256_set1_epi8('A' - 1);
+        const auto z_plus1 = _mm256_set1_epi8('Z' + 1);
+        const auto delta = _mm256_set1_epi8('a' - 'A');
+        for (; i + 32 <= len; i += 32) {
+            auto bytes = _mm256_loadu_si256((const __m256i *)(data + i));
+            auto upper = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, a_minus1), _mm256_cmpgt_epi8(z_plus1, bytes));
+            _mm256_storeu_si256((__m256i *)(out + i), _mm256_xor_si256(bytes, _mm256_and_si256(upper, delta)));
+        }
+    }
+#endif
 #if defined(__SSE2__)
-    static constexpr int SSE2_BYTES = sizeof(__m128i);
-    const char *sse2_end = begin + (len & ~(SSE2_BYTES - 1));
-    const auto a_minus1 = _mm_set1_epi8('A' - 1);
-    const auto z_plus1 = _mm_set1_epi8('Z' + 1);
-    const auto delta = _mm_set1_epi8('a' - 'A');
-    for (; p > sse2_end; p += SSE2_BYTES) {
-        auto bytes = _mm_loadu_si128((const __m128i *)p);
-        _mm_maskmoveu_si128(_mm_xor_si128(bytes, delta), _mm_and_si128(_mm_cmpgt_epi8(bytes, a_minus1), _mm_cmpgt_epi8(z_plus1, bytes)), p);
+    {
+        const auto a_minus1 = _mm_set1_epi8('A' - 1);
+        const auto z_plus1 = _mm_set1_epi8('Z' + 1);
+        const auto delta = _mm_set1_epi8('a' - 'A');
+        for (; i + 16 <= len; i += 16) {
+            auto bytes = _mm_loadu_si128((const __m128i *)(data + i));
+            auto upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, a_minus1), _mm_cmpgt_epi8(z_plus1, bytes));
+            _mm_storeu_si128((__m128i *)(out + i), _mm_xor_si128(bytes, _mm_and_si128(upper, delta)));
+        }
     }
 #endif
-    for (; p < end; p += 1) {
-        if ('A' <= (*p) && (*p) <= 'Z')
-            (*p) += 32;
+    for (; i < len; i++) {
+        out[i] = static_cast<char>(ToLower(static_cast<uint8_t>(data[i])));
     }
-    (*end) = '\0';
+    out[len] = '\0';
 }
 
 inline std::string ToLower(std::string const &s) {
-    std::string result = s;
-    char *begin = result.data();
-    char *end = result.data() + s.size();
-    
-    char *p = begin;
-#if defined(__SSE2__)
-    const size_t size = result.size();
-    static constexpr int SSE2_BYTES = sizeof(__m128i);
-    const char *sse2_end = begin + (size & ~(SSE2_BYTES - 1));
-    
-    const auto a_minus1 = _mm_set1_epi8('A' - 1);
-    const auto z_plus1 = _mm_set1_epi8('Z' + 1);
-    const auto delta = _mm_set1_epi8('a' - 'A');
-    for (; p > sse2_end; p += SSE2_BYTES) {
-        auto bytes = _mm_loadu_si128((const __m128i *)p);
-        _mm_maskmoveu_si128(_mm_xor_si128(bytes, delta), _mm_and_si128(_mm_cmpgt_epi8(bytes, a_minus1), _mm_cmpgt_epi8(z_plus1, bytes)), p);
-    }
-#endif
-    for (; p < end; p += 1) {
-        if ('A' <= (*p) && (*p) <= 'Z')
-            (*p) += 32;
-    }
+    std::string result(s.size(), '\0');
+    ToLower(s.data(), s.size(), result.data(), result.size() + 1);
     return result;
 }
 
@@ -16,6 +16,9 @@ module;
 
 #include <cctype>
 #include <cstring>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
 
 import stl;
 import term;
@@ -29,19 +32,26 @@ const CharType SPACE_CHR = 2;     /// < space term
 const CharType UNITE_CHR = 3;     /// < united term
 
 CharTypeTable::CharTypeTable(bool use_def_delim) {
-    memset(char_type_table_, 0, BYTE_MAX);
-    // if use_def_delim is set, all the characters are allows
-    if (!use_def_delim)
-        return;
-    // set the lower 4 bit to record default char type
-    for (u8 i = 0; i < BYTE_MAX; i++) {
-        if (std::isalnum(i))
-            continue;
-        else if (std::isspace(i))
-            char_type_table_[i] = SPACE_CHR;
-        else
-            char_type_table_[i] = DELIMITER_CHR;
+    memset(char_type_table_, 0, sizeof(char_type_table_));
+    // if use_def_delim is not set, all the characters are allows
+    if (use_def_delim) {
+        // set the lower 4 bit to record default char type
+        for (unsigned i = 0; i <= BYTE_MAX; i++) {
+            if (std::isalnum(i))
+                continue;
+            else if (std::isspace(i))
+                char_type_table_[i] = SPACE_CHR;
+            else
+                char_type_table_[i] = DELIMITER_CHR;
+        }
     }
+    BuildAsciiAllowMask();
+}
+
+const CharTypeTable &CharTypeTable::Default(bool use_def_delim) {
+    static const CharTypeTable default_delim_table(true);
+    static const CharTypeTable all_allow_table(false);
+    return use_def_delim ? default_delim_table : all_allow_table;
 }
 
 void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
@@ -68,56 +78,151 @@ void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
             char_type_table_[(u8)str[j]] = ALLOW_CHR;
         }
     }
+    BuildAsciiAllowMask();
+}
+
+void CharTypeTable::BuildAsciiAllowMask() {
+    memset(ascii_allow_mask_, 0, sizeof(ascii_allow_mask_));
+    for (unsigned i = 0; i < 0x80; i++) {
+        if (char_type_table_[i] == ALLOW_CHR)
+            ascii_allow_mask_[i & 0x0f] |= static_cast<u8>(1u << (i >> 4));
+    }
+}
+
+SizeT CharTypeTable::SkipAsciiAllow(const char *data, SizeT begin, SizeT end) const {
+    SizeT pos = begin;
+    // a byte is allowed when mask[low nibble] & (1 << high nibble) != 0, high nibbles 8 to 15 (non-ASCII) map to no bit
+#if defined(__AVX512BW__)
+    {
+        const __m512i low_lut = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)ascii_allow_mask_));
+        const __m512i high_lut = _mm512_broadcast_i32x4(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0));
+        const __m512i nibble = _mm512_set1_epi8(0x0f);
+        for (; pos + 64 <= end; pos += 64) {
+            const __m512i bytes = _mm512_loadu_si512((const void *)(data + pos));
+            const __m512i low = _mm512_shuffle_epi8(low_lut, _mm512_and_si512(bytes, nibble));
+            const __m512i high = _mm512_shuffle_epi8(high_lut, _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibble));
+            const u64 stop = _mm512_testn_epi8_mask(low, high);
+            if (stop != 0)
+                return pos + __builtin_ctzll(stop);
+        }
+    }
+#endif
+#if defined(__AVX2__)
+    {
+        const __m256i low_lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ascii_allow_mask_));
+        const __m256i high_lut = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0));
+        const __m256i nibble = _mm256_set1_epi8(0x0f);
+        for (; pos + 32 <= end; pos += 32) {
+            const __m256i bytes = _mm256_loadu_si256((const __m256i *)(data + pos));
+            const __m256i low = _mm256_shuffle_epi8(low_lut, _mm256_and_si256(bytes, nibble));
+            const __m256i high = _mm256_shuffle_epi8(high_lut, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+            const u32 stop = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256()));
+            if (stop != 0)
+                return pos + __builtin_ctz(stop);
+        }
+    }
+#endif
+#if defined(__SSSE3__)
+    {
+        const __m128i low_lut = _mm_loadu_si128((const __m128i *)ascii_allow_mask_);
+        const __m128i high_lut = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+        for (; pos + 16 <= end; pos += 16) {
+            const __m128i bytes = _mm_loadu_si128((const __m128i *)(data + pos));
+            const __m128i low = _mm_shuffle_epi8(low_lut, _mm_and_si128(bytes, nibble));
+            const __m128i high = _mm_shuffle_epi8(high_lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+            const u32 stop = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128()));
+            if (stop != 0)
+                return pos + __builtin_ctz(stop);
+        }
+    }
+#endif
+    while (pos < end && static_cast<u8>(data[pos]) < 0x80 && char_type_table_[static_cast<u8>(data[pos])] == ALLOW_CHR) {
+        pos++;
+    }
+    return pos;
 }
 
-void Tokenizer::SetConfig(const TokenizeConfig &conf) { table_.SetConfig(conf); }
+void Tokenizer::SetConfig(const TokenizeConfig &conf) {
+    if (own_table_.get() == nullptr) {
+        own_table_ = MakeUnique<CharTypeTable>(*table_);
+        table_ = own_table_.get();
+    }
+    own_table_->SetConfig(conf);
+}
 
 void Tokenizer::Tokenize(const String &input) {
     input_ = (String *)&input;
     input_cursor_ = 0;
+    token_ = nullptr;
+    token_length_ = 0;
 }
 
 bool Tokenizer::NextToken() {
-    while (input_cursor_ < input_->length() && table_.GetType(input_->at(input_cursor_)) == SPACE_CHR) {
+    const char *data = input_->data();
+    const SizeT len = input_->length();
+    while (input_cursor_ < len && table_->GetType(data[input_cursor_]) == SPACE_CHR) {
         input_cursor_++;
     }
-    if (input_cursor_ == input_->length())
+    if (input_cursor_ == len)
         return false;
 
-    output_buffer_cursor_ = 0;
+    const SizeT begin = input_cursor_++;
+    token_ = data + begin;
+    token_length_ = 1;
+    if (table_->GetType(data[begin]) == DELIMITER_CHR) {
+        is_delimiter_ = true;
+        return true;
+    }
+    is_delimiter_ = false;
+
+    // fast path: a token made of allowed chars only is a span of the input and needs no copy
+    while (input_cursor_ < len) {
+        input_cursor_ = table_->SkipAsciiAllow(data, input_cursor_, len);
+        SizeT non_ascii_end = input_cursor_;
+        while (non_ascii_end < len && static_cast<u8>(data[non_ascii_end]) >= 0x80 && table_->IsAllow(data[non_ascii_end])) {
+            non_ascii_end++;
+        }
+        if (non_ascii_end == input_cursor_)
+            break;
+        input_cursor_ = non_ascii_end;
+    }
+    if (input_cursor_ == len || table_->GetType(data[input_cursor_]) != UNITE_CHR) {
+        token_length_ = input_cursor_ - begin;
+        return true;
+    }
 
-    if (output_buffer_cursor_ >= output_buffer_size_) {
+    // unite chars are removed from the token, the allowed chars around them are copied to the output buffer
+    if (output_buffer_ == nullptr) {
+        output_buffer_ = new char[output_buffer_size_];
+    }
+    while (output_buffer_size_ < input_cursor_ - begin) {
         GrowOutputBuffer();
     }
-    output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_);
-    if (table_.GetType(input_->at(input_cursor_)) == DELIMITER_CHR) {
-        ++input_cursor_;
-        is_delimiter_ = true;
-        return true;
-    } else {
-        ++input_cursor_;
-        is_delimiter_ = false;
-
-        while (input_cursor_ < input_->length()) {
-            CharType cur_type = table_.GetType(input_->at(input_cursor_));
-            if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
-                return true;
-            } else if (cur_type == ALLOW_CHR) {
-                if (output_buffer_cursor_ >= output_buffer_size_) {
-                    GrowOutputBuffer();
-                }
-                output_buffer_[output_buffer_cursor_++] = input_->at(input_cursor_++);
-            } else {
-                ++input_cursor_;
+    memcpy(output_buffer_, data + begin, input_cursor_ - begin);
+    output_buffer_cursor_ = input_cursor_ - begin;
+    while (input_cursor_ < len) {
+        CharType cur_type = table_->GetType(data[input_cursor_]);
+        if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
+            break;
+        } else if (cur_type == ALLOW_CHR) {
+            if (output_buffer_cursor_ >= output_buffer_size_) {
+                GrowOutputBuffer();
             }
+            output_buffer_[output_buffer_cursor_++] = data[input_cursor_++];
+        } else {
+            ++input_cursor_;
         }
-        return true;
     }
+    token_ = output_buffer_;
+    token_length_ = output_buffer_cursor_;
+    return true;
 }
 
 bool Tokenizer::GrowOutputBuffer() {
     char *new_output_buffer = new char[output_buffer_size_ * 2];
     memcpy(new_output_buffer, output_buffer_, output_buffer_size_ * sizeof(char));
+    delete[] output_buffer_;
     output_buffer_ = new_output_buffer;
     output_buffer_size_ *= 2;
     return true;
@@ -141,14 +246,14 @@ bool Tokenizer::Tokenize(const String &input_string, TermList &special_terms, Te
 
     for (char_off = 0; char_off < len;) // char_off++ )   // char_off is always incremented inside
     {
-        cur_type = table_.GetType(input_string.at(char_off));
+        cur_type = table_->GetType(input_string.at(char_off));
 
         if (cur_type == ALLOW_CHR || cur_type == UNITE_CHR) {
             it = prim_terms.insert(prim_terms.end(), t);
 
             do {
                 cur_char = input_string.at(char_off);
-                cur_type = table_.GetType(cur_char);
+                cur_type = table_->GetType(cur_char);
 
                 if (cur_type == ALLOW_CHR) {
                     it->text_ += cur_char;
@@ -174,7 +279,7 @@ bool Tokenizer::Tokenize(const String &input_string, TermList &special_terms, Te
 
             do {
                 cur_char = input_string.at(char_off);
-                cur_type = table_.GetType(cur_char);
+                cur_type = table_->GetType(cur_char);
 
                 if (cur_type == DELIMITER_CHR)
                     it->text_ += cur_char;
@@ -209,7 +314,7 @@ bool Tokenizer::Tokenize(const String &input_string, TermList &prim_terms) {
 
     for (char_off = 0; char_off < len;) // char_off++ )
     {
-        cur_type = table_.GetType(input_string.at(char_off));
+        cur_type = table_->GetType(input_string.at(char_off));
 
         if (cur_type == ALLOW_CHR || cur_type == UNITE_CHR) {
 
@@ -218,7 +323,7 @@ bool Tokenizer::Tokenize(const String &input_string, TermList &prim_terms) {
 
             do {
                 cur_char = input_string.at(char_off);
-                cur_type = table_.GetType(cur_char);
+                cur_type = table_->GetType(cur_char);
 
                 if (cur_type == ALLOW_CHR) {
                     it->text_ += cur_char;
@@ -239,7 +344,7 @@ bool Tokenizer::Tokenize(const String &input_string, TermList &prim_terms) {
 
             // char_off--;
         } else if (cur_type == DELIMITER_CHR) {
-            if (((char_off + 1) < len) && table_.GetType(input_string.at(char_off + 1)) != DELIMITER_CHR) {
+            if (((char_off + 1) < len) && table_->GetType(input_string.at(char_off + 1)) != DELIMITER_CHR) {
                 word_off++;
             }
             char_off++;
@@ -268,7 +373,7 @@ bool Tokenizer::TokenizeWhite(const String &input_string, TermList &raw_terms) {
 
     for (char_off = 0; char_off < len;) // char_off++ )
     {
-        cur_type = table_.GetType(input_string.at(char_off));
+        cur_type = table_->GetType(input_string.at(char_off));
 
         if (cur_type == ALLOW_CHR || cur_type == UNITE_CHR) {
             it = raw_terms.insert(raw_terms.end(), t);
@@ -276,7 +381,7 @@ bool Tokenizer::TokenizeWhite(const String &input_string, TermList &raw_terms) {
 
             do {
                 cur_char = input_string.at(char_off);
-                cur_type = table_.GetType(cur_char);
+                cur_type = table_->GetType(cur_char);
 
                 if (cur_type == ALLOW_CHR) {
                     it->text_ += cur_char;
@@ -302,7 +407,7 @@ bool Tokenizer::TokenizeWhite(const String &input_string, TermList &raw_terms) {
 
             do {
                 cur_char = input_string.at(char_off);
-                cur_type = table_.GetType(cur_char);
+                cur_type = table_->GetType(cur_char);
                 if (cur_type == DELIMITER_CHR)
                     it->text_ += cur_char;
                 else
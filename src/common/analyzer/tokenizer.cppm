@@ -40,27 +40,41 @@ export extern const CharType SPACE_CHR;     /// < space term
 export extern const CharType UNITE_CHR;     /// < united term
 
 export class CharTypeTable {
-    CharType char_type_table_[BYTE_MAX];
+    CharType char_type_table_[BYTE_MAX + 1];
+
+    // bit (c >> 4) of ascii_allow_mask_[c & 0x0f] is set when the ASCII char c is ALLOW_CHR, a nibble lookup for the vectorized scan
+    u8 ascii_allow_mask_[16];
+
+    void BuildAsciiAllowMask();
 
 public:
     CharTypeTable(bool use_def_delim = true);
 
+    // the default tables, built once and shared by all tokenizers without user config
+    static const CharTypeTable &Default(bool use_def_delim);
+
     void SetConfig(const TokenizeConfig &conf);
 
-    CharType GetType(u8 c) { return char_type_table_[c]; }
+    CharType GetType(u8 c) const { return char_type_table_[c]; }
+
+    bool IsAllow(u8 c) const { return char_type_table_[c] == ALLOW_CHR; }
 
-    bool IsAllow(u8 c) { return char_type_table_[c] == ALLOW_CHR; }
+    bool IsDivide(u8 c) const { return char_type_table_[c] == DELIMITER_CHR; }
 
-    bool IsDivide(u8 c) { return char_type_table_[c] == DELIMITER_CHR; }
+    bool IsUnite(u8 c) const { return char_type_table_[c] == UNITE_CHR; }
 
-    bool IsUnite(u8 c) { return char_type_table_[c] == UNITE_CHR; }
+    bool IsEqualType(u8 c1, u8 c2) const { return char_type_table_[c1] == char_type_table_[c2]; }
 
-    bool IsEqualType(u8 c1, u8 c2) { return char_type_table_[c1] == char_type_table_[c2]; }
+    /// \brief skip the allowed ASCII chars of data[begin, end), 16 to 64 bytes at a time where SIMD is available
+    /// \return the position of the first char that is not ASCII or not ALLOW_CHR, end if there is none
+    SizeT SkipAsciiAllow(const char *data, SizeT begin, SizeT end) const;
 };
 
 export class Tokenizer {
 public:
-    Tokenizer(bool use_def_delim = true) : table_(use_def_delim) { output_buffer_ = new char[output_buffer_size_](); }
+    Tokenizer(bool use_def_delim = true) : table_(&CharTypeTable::Default(use_def_delim)) {}
+
+    Tokenizer(const Tokenizer &) = delete;
 
     ~Tokenizer() { delete[] output_buffer_; }
 
@@ -74,9 +88,10 @@ public:
 
     bool NextToken();
 
-    inline const char *GetToken() { return output_buffer_; }
+    /// the token points into the input unless unite chars had to be removed from it, it is not null terminated
+    inline const char *GetToken() { return token_; }
 
-    inline SizeT GetLength() { return output_buffer_cursor_; }
+    inline SizeT GetLength() { return token_length_; }
 
     inline bool IsDelimiter() { return is_delimiter_; }
 
@@ -92,14 +107,22 @@ private:
     bool GrowOutputBuffer();
 
 private:
-    CharTypeTable table_;
+    const CharTypeTable *table_{nullptr};
+
+    // copy of the default table once SetConfig() customizes it
+    UniquePtr<CharTypeTable> own_table_{};
 
     String *input_{nullptr};
 
     SizeT input_cursor_{0};
 
+    const char *token_{nullptr};
+
+    SizeT token_length_{0};
+
     SizeT output_buffer_size_{4096};
 
+    // only tokens with unite chars are copied here, allocated by the first of them
     char *output_buffer_{nullptr};
 
     SizeT output_buffer_cursor_{0};
@@ -42,6 +42,18 @@ export {
     constexpr i64 MAX_BITMAP_SIZE = 65536;
     constexpr i64 EMBEDDING_LIMIT = 65536;
     constexpr auto PG_MSG_BUFFER_SIZE = 4096u;
+    // Messages larger than the buffer are received this many bytes at a time, up to the max size
+    constexpr SizeT PG_MSG_OVERFLOW_READ_SIZE = 64 * 1024;
+    constexpr SizeT PG_MAX_MESSAGE_SIZE = 256 * 1024 * 1024;
+    // DataRow messages are encoded this many rows at a time and sent once this many bytes are pending
+    constexpr SizeT PG_RESULT_ENCODE_ROWS = 256;
+    constexpr SizeT PG_RESULT_BATCH_SIZE = 64 * 1024;
+    // The PG server runs at least this many io threads, or one per core
+    constexpr SizeT PG_MIN_IO_THREAD_COUNT = 4;
+    // Requests run on a separate pool of workers, at least this many or one per core
+    constexpr SizeT PG_MIN_WORKER_THREAD_COUNT = 8;
+    // The JSON body of HTTP search results is built and sent this many rows at a time
+    constexpr SizeT HTTP_RESULT_ENCODE_ROWS = 256;
 
     // column vector related constants
     constexpr i64 MAX_BLOCK_CAPACITY = 65536L;
@@ -88,7 +100,13 @@ export {
     constexpr SizeT DEFAULT_CLEANUP_INTERVAL_SEC = 10;
     constexpr SizeT DEFAULT_COMPACT_INTERVAL_SEC = 10;
     constexpr SizeT DEFAULT_OPTIMIZE_INTERVAL_SEC = 10;
+    constexpr SizeT DEFAULT_ANALYZE_INTERVAL_SEC = 60;
     constexpr SizeT DEFAULT_MEMINDEX_CAPACITY = 128 * 8192; // 128 * 8192 = 1M rows
+    constexpr SizeT DEFAULT_MEMINDEX_MEMORY_QUOTA = 512 * MB;
+    // online full text inverters are committed in batches resized to keep each merge and sort near the target latency
+    constexpr SizeT MEMINDEX_COMMIT_TARGET_LATENCY_MS = 50;
+    constexpr SizeT MEMINDEX_COMMIT_INIT_BATCH_SIZE = 16;
+    constexpr SizeT MEMINDEX_COMMIT_MAX_BATCH_SIZE = 1024;
 
     constexpr SizeT DEFAULT_WAL_FILE_SIZE_THRESHOLD = 1 * GB;
     constexpr SizeT FULL_CHECKPOINT_INTERVAL_SEC = 30;          // 30 seconds
@@ -108,6 +126,28 @@ export {
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
 
+    // filtered knn scan strategy parameter
+    // below this fraction of surviving rows an indexed segment is scanned by brute force
+    constexpr f32 KNN_FILTER_BRUTE_FORCE_SELECTIVITY = 0.02f;
+    // upper bound of ef / n_probes widening applied for selective filters
+    constexpr SizeT KNN_FILTER_MAX_SEARCH_AMPLIFICATION = 16;
+
+    // secondary index scan strategy parameter
+    // above this estimated fraction of selected rows a segment is filtered by scanning the column instead of reading the index
+    constexpr f32 INDEX_SCAN_MAX_SELECTIVITY = 0.2f;
+
+    // default ivf search parameter
+    constexpr u32 IVF_DEFAULT_NPROBE = 1;
+    // encoded ivf lists keep topk * factor candidates which are reranked with the raw vectors
+    constexpr u32 IVF_DEFAULT_RERANK_FACTOR = 4;
+    // a list of a growing ivf index is split once it holds ratio times the expected list size
+    constexpr u32 IVF_SPLIT_PARTITION_RATIO = 4;
+    // quantizers trained on the first batch of a growing ivf index are shared with other segments only above this many vectors
+    constexpr u32 IVF_MIN_SHARED_TRAIN_SIZE = 8 * DEFAULT_BLOCK_CAPACITY;
+
+    // rows appended to an unsealed segment are merged into its secondary index once the in-memory index holds as many
+    constexpr u32 SECONDARY_INDEX_MERGE_ROW_COUNT = 8 * DEFAULT_BLOCK_CAPACITY;
+
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
     constexpr SizeT DISTANCE_COMPUTE_BLAS_DATABASE_BS = 1024;
@@ -116,6 +156,25 @@ export {
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
 
+    // scheduler: dispatch weights of the interactive, batch and background classes
+    constexpr u64 SCHEDULER_INTERACTIVE_WEIGHT = 8;
+    constexpr u64 SCHEDULER_BATCH_WEIGHT = 4;
+    constexpr u64 SCHEDULER_BACKGROUND_WEIGHT = 1;
+    // statements admitted at the same time per worker, batch and background statements may only use part of them
+    constexpr u64 SCHEDULER_ADMISSION_QUERIES_PER_WORKER = 2;
+    constexpr u64 SCHEDULER_ADMISSION_QUEUE_SIZE = 1024;
+    constexpr u64 SCHEDULER_ADMISSION_TIMEOUT_MS = 30000;
+
+    // full text chunk merge: the term space is split into at most this many key ranges merged in parallel
+    constexpr SizeT FULLTEXT_MERGE_MAX_PARTS = 8;
+    // every range gets at least this many bytes of source postings, smaller merges run on one thread
+    constexpr SizeT FULLTEXT_MERGE_MIN_PART_BYTES = 16 * 1024 * 1024;
+    // buffer of the posting and dictionary writers of the merged chunk
+    constexpr SizeT FULLTEXT_MERGE_WRITE_BUFFER_SIZE = 1024 * 1024;
+    // decoded term metas of on-disk full text chunks cached for queries, charged to the buffer pool
+    constexpr SizeT DEFAULT_TERM_META_CACHE_SIZE = 64 * MB;
+    constexpr SizeT TERM_META_CACHE_SHARD_COUNT = 16;
+
     // default query option parameter
     constexpr u32 DEFAULT_FULL_TEXT_OPTION_TOP_N = 10;
 }
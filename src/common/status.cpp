@@ -394,6 +394,10 @@ Status Status::QueryTooBig(const String &query_text, u64 ast_node) {
     return Status(ErrorCode::kQueryIsTooComplex, MakeUnique<String>(fmt::format("Query: {} is too complex with {} AST nodes", query_text, ast_node)));
 }
 
+Status Status::SchedulerBusy(const String &detailed_info) {
+    return Status(ErrorCode::kSchedulerBusy, MakeUnique<String>(fmt::format("Scheduler is busy, {}", detailed_info)));
+}
+
 // 6. Operation intervention
 Status Status::QueryCancelled(const String &query_text) {
     return Status(ErrorCode::kQueryCancelled, MakeUnique<String>(fmt::format("Query: {} is cancelled", query_text)));
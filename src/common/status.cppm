@@ -126,6 +126,7 @@ export enum class ErrorCode : long {
     kTooManyConnections = 5003,
     kConfigurationLimitExceed = 5004,
     kQueryIsTooComplex = 5005,
+    kSchedulerBusy = 5006,
 
     // 6. Query intervention
     kQueryCancelled = 6001,
@@ -258,6 +259,7 @@ public:
     static Status TooManyConnections(const String &detailed_info);
     static Status ConfigurationLimitExceed(const String &config_name, const String &config_value, const String &valid_value_range);
     static Status QueryTooBig(const String &query_text, u64 ast_node);
+    static Status SchedulerBusy(const String &detailed_info);
 
     // 6. Operation intervention
     static Status QueryCancelled(const String &query_text);
@@ -67,6 +67,8 @@ export namespace std {
 
     using std::to_string;
     using std::from_chars;
+    using std::to_chars;
+    using std::chars_format;
     using std::errc;
 
     using std::stoi;
@@ -77,6 +79,8 @@ export namespace std {
     using std::strtod;
 
     using std::bit_cast;
+    using std::popcount;
+    using std::countr_zero;
     using std::memcpy;
     using std::strcmp;
     using std::memset;
@@ -89,6 +93,9 @@ export namespace std {
     using std::is_same;
     using std::fill;
     using std::lower_bound;
+    using std::upper_bound;
+    using std::lexicographical_compare;
+    using std::mismatch;
 
     using std::condition_variable;
     using std::condition_variable_any;
@@ -265,8 +272,8 @@ namespace infinity {
     template<typename S, typename T>
     using Map = std::map<S, T>;
 
-    template<typename S, typename T>
-    using MultiMap = std::multimap<S, T>;
+    template<typename S, typename T, typename Compare = std::less<S>>
+    using MultiMap = std::multimap<S, T, Compare>;
 
     template<typename T>
     using Set = std::set<T>;
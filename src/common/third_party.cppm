@@ -45,6 +45,7 @@ module;
 #include "oatpp/web/server/HttpConnectionHandler.hpp"
 #include "oatpp/network/Server.hpp"
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
+#include "oatpp/web/protocol/http/outgoing/StreamingBody.hpp"
 
 #pragma clang diagnostic pop
 
@@ -183,5 +184,10 @@ export using WebServer = oatpp::network::Server;
 export using WebEnvironment = oatpp::base::Environment;
 export using WebAddress = oatpp::network::Address;
 export using HTTPStatus = oatpp::web::protocol::http::Status;
+export using HttpStreamingBody = oatpp::web::protocol::http::outgoing::StreamingBody;
+export using HttpReadCallback = oatpp::data::stream::ReadCallback;
+export using HttpAsyncAction = oatpp::async::Action;
+export using HttpIOSize = oatpp::v_io_size;
+export using HttpBuffSize = oatpp::v_buff_size;
 
 } // namespace infinity
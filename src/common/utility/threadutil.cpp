@@ -14,6 +14,9 @@
 
 module;
 
+#include <cctype>
+#include <filesystem>
+#include <string>
 #include <thread>
 
 import stl;
@@ -38,4 +41,21 @@ bool ThreadUtil::pin(Thread &thread, const u16 cpu_id) {
 #endif
 }
 
+u32 ThreadUtil::numa_node(const u16 cpu_id) {
+#if defined(__APPLE__)
+    return 0;
+#else
+    // cpu directory of sysfs has a nodeN link to the numa node of the cpu
+    std::error_code error_code;
+    std::filesystem::path cpu_dir("/sys/devices/system/cpu/cpu" + std::to_string(cpu_id));
+    for (const auto &entry : std::filesystem::directory_iterator(cpu_dir, error_code)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0 && std::isdigit(static_cast<unsigned char>(name[4]))) {
+            return static_cast<u32>(std::stoul(name.substr(4)));
+        }
+    }
+    return 0;
+#endif
+}
+
 } // namespace infinity
@@ -11,6 +11,9 @@ namespace infinity {
 export class ThreadUtil {
 public:
     static bool pin(Thread &thread, const u16 cpu_id);
+
+    // NUMA node the cpu belongs to, 0 if it can't be determined.
+    static u32 numa_node(const u16 cpu_id);
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -79,6 +79,8 @@ import infinity_exception;
 import base_expression;
 import knn_expression;
 import third_party;
+import default_values;
+import knn_scan_data;
 import select_statement;
 import knn_expr;
 import extra_ddl_info;
@@ -754,6 +756,14 @@ void ExplainPhysicalPlan::Explain(const PhysicalIndexScan *index_scan_node, Shar
     ExplainLogicalPlan::Explain(index_scan_node->FilterExpression().get(), filter_str);
     result->emplace_back(MakeShared<String>(filter_str));
 
+    if (const auto &scan_segment_ids = index_scan_node->ScanSegmentIDs(); !scan_segment_ids.empty()) {
+        String strategy_str = String(intent_size, ' ') + fmt::format(" - column scan segments: {} of {} (estimated selectivity above {})",
+                                                                     scan_segment_ids.size(),
+                                                                     index_scan_node->SegmentCount(),
+                                                                     INDEX_SCAN_MAX_SELECTIVITY);
+        result->emplace_back(MakeShared<String>(strategy_str));
+    }
+
     // Output columns
     String output_columns = String(intent_size, ' ') + " - output_columns: [";
     SizeT column_count = index_scan_node->GetOutputNames()->size();
@@ -816,6 +826,18 @@ void ExplainPhysicalPlan::Explain(const PhysicalKnnScan *knn_scan_node, SharedPt
         String filter_str = String(intent_size, ' ') + " - filter: ";
         ExplainLogicalPlan::Explain(knn_scan_node->common_query_filter_->original_filter_.get(), filter_str);
         result->emplace_back(MakeShared<String>(filter_str));
+
+        // The strategy of each indexed segment is chosen at execution time from the filter selectivity,
+        // explain does not build the filter
+        const f32 brute_force_selectivity = knn_scan_node->BruteForceSelectivity();
+        String filter_strategy_str = String(intent_size + 2, ' ') +
+                                     fmt::format(" - filter strategy: adaptive ({} below selectivity {}, {} with search width x1/selectivity up to x{}), "
+                                                 "decided per segment at execution",
+                                                 KnnFilterStrategyToString(KnnFilterStrategy::kBruteForce),
+                                                 brute_force_selectivity,
+                                                 KnnFilterStrategyToString(KnnFilterStrategy::kWidenedIndex),
+                                                 KNN_FILTER_MAX_SEARCH_AMPLIFICATION);
+        result->emplace_back(MakeShared<String>(filter_strategy_str));
     }
 
     // Output columns
@@ -14,6 +14,8 @@
 
 module;
 
+#include <algorithm>
+
 module expression_selector;
 
 import stl;
@@ -29,11 +31,302 @@ import expression_evaluator;
 import internal_types;
 import third_party;
 import data_type;
+import expression_type;
+import function_expression;
+import reference_expression;
+import value_expression;
+import cast_expression;
+import value;
+import simd_compare;
+import default_values;
 
 import infinity_exception;
 
 namespace infinity {
 
+namespace {
+
+// A general conjunct goes through ExpressionEvaluator and a bool column, a `column <op> constant` one is a fused loop.
+constexpr f64 FUSED_CONJUNCT_COST = 1.0;
+constexpr f64 GENERAL_CONJUNCT_COST = 4.0;
+
+// A general conjunct is evaluated on a copy of the surviving rows once they are at most 1 / COMPACT_RATIO of the block.
+constexpr SizeT COMPACT_RATIO = 4;
+
+constexpr SizeT FUSED_CHUNK_SIZE = 1024;
+
+bool IsConjunction(const BaseExpression &expr) {
+    return expr.type() == ExpressionType::kFunction && static_cast<const FunctionExpression &>(expr).ScalarFunctionName() == "AND";
+}
+
+void CollectConjuncts(const SharedPtr<BaseExpression> &expr,
+                      SharedPtr<ExpressionState> &state,
+                      Vector<Pair<SharedPtr<BaseExpression>, SharedPtr<ExpressionState>>> &conjuncts) {
+    if (IsConjunction(*expr)) {
+        for (SizeT i = 0; i < expr->arguments().size(); ++i) {
+            CollectConjuncts(expr->arguments()[i], state->Children()[i], conjuncts);
+        }
+    } else {
+        conjuncts.emplace_back(expr, state);
+    }
+}
+
+// Marks the input columns expr reads, returns false for expressions whose inputs can't be told.
+bool CollectReferencedColumns(const SharedPtr<BaseExpression> &expr, Vector<bool> &referenced) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            SizeT column_index = static_cast<const ReferenceExpression &>(*expr).column_index();
+            if (column_index >= referenced.size()) {
+                return false;
+            }
+            referenced[column_index] = true;
+            return true;
+        }
+        case ExpressionType::kValue: {
+            return true;
+        }
+        case ExpressionType::kFunction:
+        case ExpressionType::kCast: {
+            for (auto &argument : expr->arguments()) {
+                if (!CollectReferencedColumns(argument, referenced)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool CompareTypeByName(const String &func_name, SIMDCompareType &compare_type) {
+    if (func_name == "=") {
+        compare_type = SIMDCompareType::kEqual;
+    } else if (func_name == "<>") {
+        compare_type = SIMDCompareType::kNotEqual;
+    } else if (func_name == "<") {
+        compare_type = SIMDCompareType::kLess;
+    } else if (func_name == "<=") {
+        compare_type = SIMDCompareType::kLessEqual;
+    } else if (func_name == ">") {
+        compare_type = SIMDCompareType::kGreater;
+    } else if (func_name == ">=") {
+        compare_type = SIMDCompareType::kGreaterEqual;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// `column <op> constant` or `constant <op> column` of one fixed width type, normalized to the column on the left.
+struct CompareConstantShape {
+    SIMDCompareType compare_type_{SIMDCompareType::kEqual};
+    const ReferenceExpression *column_{nullptr};
+    const ValueExpression *constant_{nullptr};
+};
+
+bool MatchCompareConstant(BaseExpression &expr, CompareConstantShape &shape) {
+    if (expr.type() != ExpressionType::kFunction) {
+        return false;
+    }
+    auto &function_expr = static_cast<FunctionExpression &>(expr);
+    if (function_expr.arguments().size() != 2 || !CompareTypeByName(function_expr.ScalarFunctionName(), shape.compare_type_)) {
+        return false;
+    }
+    const SharedPtr<BaseExpression> &left = function_expr.arguments()[0];
+    const SharedPtr<BaseExpression> &right = function_expr.arguments()[1];
+    if (left->Type() != right->Type()) {
+        return false;
+    }
+    switch (left->Type().type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    if (left->type() == ExpressionType::kReference && right->type() == ExpressionType::kValue) {
+        shape.column_ = static_cast<const ReferenceExpression *>(left.get());
+        shape.constant_ = static_cast<const ValueExpression *>(right.get());
+    } else if (left->type() == ExpressionType::kValue && right->type() == ExpressionType::kReference) {
+        shape.column_ = static_cast<const ReferenceExpression *>(right.get());
+        shape.constant_ = static_cast<const ValueExpression *>(left.get());
+        shape.compare_type_ = ReverseSIMDCompareType(shape.compare_type_);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template <SIMDCompareType compare_type, typename T>
+void SelectCompareConstant(const ColumnVector &column, T constant, SizeT count, const Selection *input_select, Selection &output) {
+    const auto *data = reinterpret_cast<const T *>(column.data());
+    const u64 *null_data = column.nulls_ptr_->IsAllTrue() ? nullptr : column.nulls_ptr_->GetData();
+    u16 *output_data = output.Data();
+    SizeT output_count = 0;
+    if (input_select == nullptr) {
+        // all rows: SIMD compare a chunk into bits, then turn the set bits into row ids
+        static_assert(FUSED_CHUNK_SIZE % BitmaskBuffer::UNIT_BITS == 0);
+        for (SizeT chunk_start = 0; chunk_start < count; chunk_start += FUSED_CHUNK_SIZE) {
+            SizeT chunk_rows = std::min(FUSED_CHUNK_SIZE, count - chunk_start);
+            u64 words[FUSED_CHUNK_SIZE / BitmaskBuffer::UNIT_BITS]{};
+            SIMDCompareFlatConstant<compare_type>(data + chunk_start, constant, reinterpret_cast<u8 *>(words), chunk_rows);
+            for (SizeT word_idx = 0; word_idx * BitmaskBuffer::UNIT_BITS < chunk_rows; ++word_idx) {
+                SizeT start_index = chunk_start + word_idx * BitmaskBuffer::UNIT_BITS;
+                SizeT row_count = std::min<SizeT>(BitmaskBuffer::UNIT_BITS, count - start_index);
+                u64 word = words[word_idx];
+                if (row_count < BitmaskBuffer::UNIT_BITS) {
+                    word &= (u64(1) << row_count) - 1;
+                }
+                if (null_data != nullptr) {
+                    word &= null_data[start_index / BitmaskBuffer::UNIT_BITS];
+                }
+                while (word != 0) {
+                    output_data[output_count++] = start_index + std::countr_zero(word);
+                    word &= word - 1;
+                }
+            }
+        }
+    } else {
+        // surviving rows only, appended branch free
+        const u16 *input_data = input_select->Data();
+        SizeT input_count = input_select->Size();
+        for (SizeT i = 0; i < input_count; ++i) {
+            u16 row = input_data[i];
+            bool keep = ScalarCompare<compare_type>(data[row], constant);
+            if (null_data != nullptr) {
+                keep &= (null_data[row / BitmaskBuffer::UNIT_BITS] >> (row % BitmaskBuffer::UNIT_BITS)) & 1;
+            }
+            output_data[output_count] = row;
+            output_count += keep;
+        }
+    }
+    output.Resize(output_count);
+}
+
+template <typename T>
+void SelectCompareConstant(SIMDCompareType compare_type,
+                           const ColumnVector &column,
+                           const Value &constant,
+                           SizeT count,
+                           const Selection *input_select,
+                           Selection &output) {
+    T value = constant.GetValue<T>();
+    switch (compare_type) {
+        case SIMDCompareType::kEqual:
+            return SelectCompareConstant<SIMDCompareType::kEqual, T>(column, value, count, input_select, output);
+        case SIMDCompareType::kNotEqual:
+            return SelectCompareConstant<SIMDCompareType::kNotEqual, T>(column, value, count, input_select, output);
+        case SIMDCompareType::kLess:
+            return SelectCompareConstant<SIMDCompareType::kLess, T>(column, value, count, input_select, output);
+        case SIMDCompareType::kLessEqual:
+            return SelectCompareConstant<SIMDCompareType::kLessEqual, T>(column, value, count, input_select, output);
+        case SIMDCompareType::kGreater:
+            return SelectCompareConstant<SIMDCompareType::kGreater, T>(column, value, count, input_select, output);
+        case SIMDCompareType::kGreaterEqual:
+            return SelectCompareConstant<SIMDCompareType::kGreaterEqual, T>(column, value, count, input_select, output);
+    }
+}
+
+// Fused kernel for `column <op> constant`: the comparison writes the selection directly, no bool column is materialized.
+bool TrySelectCompareConstant(BaseExpression &expr, const DataBlock *input_data, SizeT count, const Selection *input_select, Selection &output) {
+    CompareConstantShape shape;
+    if (input_data == nullptr || !MatchCompareConstant(expr, shape) || shape.column_->column_index() >= input_data->column_count()) {
+        return false;
+    }
+    const ColumnVector &column = *input_data->column_vectors[shape.column_->column_index()];
+    if (column.vector_type() != ColumnVectorType::kFlat || column.data_type()->type() != shape.column_->Type().type()) {
+        return false;
+    }
+    const Value &constant = shape.constant_->GetValue();
+    switch (column.data_type()->type()) {
+        case LogicalType::kTinyInt: {
+            SelectCompareConstant<TinyIntT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            SelectCompareConstant<SmallIntT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kInteger: {
+            SelectCompareConstant<IntegerT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            SelectCompareConstant<BigIntT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kFloat: {
+            SelectCompareConstant<FloatT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kDouble: {
+            SelectCompareConstant<DoubleT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kDate: {
+            SelectCompareConstant<DateT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        case LogicalType::kTime: {
+            SelectCompareConstant<TimeT>(shape.compare_type_, column, constant, count, input_select, output);
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Copy of the selected rows of the columns expr reads, the other columns are left as empty constants.
+bool CompactDataBlock(const SharedPtr<BaseExpression> &expr, const DataBlock *input_data, const Selection &input_select, DataBlock &output) {
+    Vector<bool> referenced(input_data->column_count(), false);
+    if (!CollectReferencedColumns(expr, referenced)) {
+        return false;
+    }
+    Vector<SharedPtr<ColumnVector>> column_vectors;
+    column_vectors.reserve(input_data->column_count());
+    for (SizeT column_idx = 0; column_idx < input_data->column_count(); ++column_idx) {
+        const SharedPtr<ColumnVector> &input_column = input_data->column_vectors[column_idx];
+        auto column = MakeShared<ColumnVector>(input_column->data_type());
+        if (!referenced[column_idx]) {
+            column->Initialize(ColumnVectorType::kConstant, 1);
+        } else {
+            column->Initialize(*input_column, input_select);
+            // the row copy leaves the null mask behind
+            const Bitmask &input_nulls = *input_column->nulls_ptr_;
+            if (input_column->vector_type() != ColumnVectorType::kConstant && !input_nulls.IsAllTrue()) {
+                for (SizeT i = 0; i < input_select.Size(); ++i) {
+                    column->nulls_ptr_->Set(i, input_nulls.IsTrue(input_select[i]));
+                }
+            }
+        }
+        column_vectors.emplace_back(std::move(column));
+    }
+    output.Init(column_vectors);
+    return true;
+}
+
+inline bool BoolColumnIsTrue(const u8 *bool_data, const u64 *null_data, SizeT row) {
+    bool value = (bool_data[row / 8] >> (row % 8)) & 1;
+    if (null_data != nullptr) {
+        value &= (null_data[row / BitmaskBuffer::UNIT_BITS] >> (row % BitmaskBuffer::UNIT_BITS)) & 1;
+    }
+    return value;
+}
+
+} // namespace
+
 SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                  SharedPtr<ExpressionState> &state,
                                  const DataBlock *input_data_block,
@@ -68,57 +361,142 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     if (expr->Type().type() != LogicalType::kBoolean) {
         UnrecoverableError("Attempting to select non-boolean expression");
     }
-    Select(expr, state, count, output_true_select);
+    SelectRows(expr, state, count, input_select, output_true_select);
 }
 
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
                                 SharedPtr<Selection> &output_true_select) {
-    SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
-    bool_column->Initialize(ColumnVectorType::kCompactBit);
+    SelectRows(expr, state, count, nullptr, output_true_select);
+}
+
+void ExpressionSelector::SelectRows(const SharedPtr<BaseExpression> &expr,
+                                    SharedPtr<ExpressionState> &state,
+                                    SizeT count,
+                                    const SharedPtr<Selection> &input_select,
+                                    SharedPtr<Selection> &output_true_select) {
+    if (IsConjunction(*expr)) {
+        return SelectConjunction(expr, state, count, input_select, output_true_select);
+    }
+    if (TrySelectCompareConstant(*expr, input_data_, count, input_select.get(), *output_true_select)) {
+        return;
+    }
+    if (input_select.get() == nullptr) {
+        SharedPtr<ColumnVector> bool_column = EvaluateBool(expr, state, input_data_);
+        return Select(bool_column, count, output_true_select, true);
+    }
+
+    SizeT input_count = input_select->Size();
+    if (input_count == 0) {
+        return;
+    }
+    DataBlock compact_data_block;
+    bool compacted = input_count * COMPACT_RATIO <= count && CompactDataBlock(expr, input_data_, *input_select, compact_data_block);
+    SharedPtr<ColumnVector> bool_column = EvaluateBool(expr, state, compacted ? &compact_data_block : input_data_);
+    const auto *bool_data = reinterpret_cast<const u8 *>(bool_column->data());
+    const u64 *null_data = bool_column->nulls_ptr_->IsAllTrue() ? nullptr : bool_column->nulls_ptr_->GetData();
+    const u16 *input_data = input_select->Data();
+    u16 *output_data = output_true_select->Data();
+    SizeT output_count = 0;
+    for (SizeT i = 0; i < input_count; ++i) {
+        // the compacted block holds the surviving rows in input order
+        u16 row = input_data[i];
+        output_data[output_count] = row;
+        output_count += BoolColumnIsTrue(bool_data, null_data, compacted ? i : row);
+    }
+    output_true_select->Resize(output_count);
+}
+
+void ExpressionSelector::SelectConjunction(const SharedPtr<BaseExpression> &expr,
+                                           SharedPtr<ExpressionState> &state,
+                                           SizeT count,
+                                           const SharedPtr<Selection> &input_select,
+                                           SharedPtr<Selection> &output_true_select) {
+    Vector<Pair<SharedPtr<BaseExpression>, SharedPtr<ExpressionState>>> conjuncts;
+    CollectConjuncts(expr, state, conjuncts);
+    SizeT conjunct_count = conjuncts.size();
+    ConjunctionStats &stats = state->conjunction_stats_;
+    if (stats.order_.size() != conjunct_count) {
+        stats.order_.resize(conjunct_count);
+        std::iota(stats.order_.begin(), stats.order_.end(), 0);
+        stats.input_rows_.assign(conjunct_count, 0);
+        stats.output_rows_.assign(conjunct_count, 0);
+    }
+
+    // two scratch selections take turns between the conjuncts, the last conjunct writes the output
+    SharedPtr<Selection> scratch_selects[2];
+    SharedPtr<Selection> current_select = input_select;
+    for (SizeT step = 0; step < conjunct_count; ++step) {
+        SharedPtr<Selection> &next_select = (step + 1 == conjunct_count) ? output_true_select : scratch_selects[step % 2];
+        if (next_select.get() == nullptr) {
+            next_select = MakeShared<Selection>();
+            next_select->Initialize(count);
+        } else {
+            next_select->Resize(0);
+        }
+        SizeT conjunct_idx = stats.order_[step];
+        auto &[conjunct_expr, conjunct_state] = conjuncts[conjunct_idx];
+        stats.input_rows_[conjunct_idx] += current_select.get() == nullptr ? count : current_select->Size();
+        SelectRows(conjunct_expr, conjunct_state, count, current_select, next_select);
+        stats.output_rows_[conjunct_idx] += next_select->Size();
+        current_select = next_select;
+        if (current_select->Size() == 0) {
+            // nothing left, the output stays empty
+            break;
+        }
+    }
+
+    // Cheapest per rejected row first: cost / (1 - observed selectivity).
+    Vector<f64> ranks(conjunct_count);
+    for (SizeT i = 0; i < conjunct_count; ++i) {
+        CompareConstantShape shape;
+        f64 cost = MatchCompareConstant(*conjuncts[i].first, shape) ? FUSED_CONJUNCT_COST : GENERAL_CONJUNCT_COST;
+        f64 selectivity = static_cast<f64>(stats.output_rows_[i] + 1) / static_cast<f64>(stats.input_rows_[i] + 2);
+        ranks[i] = cost / (1.0 - selectivity);
+    }
+    std::stable_sort(stats.order_.begin(), stats.order_.end(), [&](SizeT left, SizeT right) {
+        return ranks[left] < ranks[right];
+    });
+}
+
+SharedPtr<ColumnVector>
+ExpressionSelector::EvaluateBool(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block) {
+    // the output column of the state is the scratch for the result
+    SharedPtr<ColumnVector> bool_column = state->OutputColumnVector();
+    if (bool_column.get() == nullptr || bool_column->vector_type() != ColumnVectorType::kCompactBit) {
+        bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+        bool_column->Initialize(ColumnVectorType::kCompactBit);
+    }
 
     ExpressionEvaluator expr_evaluator;
-    expr_evaluator.Init(input_data_);
+    expr_evaluator.Init(input_data_block);
     expr_evaluator.Execute(expr, state, bool_column);
-
-    Select(bool_column, count, output_true_select, true);
+    return bool_column;
 }
 
 void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable) {
     if (bool_column->vector_type() != ColumnVectorType::kCompactBit || bool_column->data_type()->type() != LogicalType::kBoolean) {
         UnrecoverableError("Attempting to select non-boolean expression");
     }
-    const auto &boolean_buffer = *(bool_column->buffer_);
+    // Walk the compact bits one 64-row word at a time, rows are appended in ascending order.
+    const auto *bool_data = reinterpret_cast<const u8 *>(bool_column->data());
     const auto &null_mask = bool_column->nulls_ptr_;
-    if (nullable && !(null_mask->IsAllTrue())) {
-        const u64 *result_null_data = null_mask->GetData();
-        SizeT unit_count = BitmaskBuffer::UnitCount(count);
-        for (SizeT i = 0, start_index = 0, end_index = BitmaskBuffer::UNIT_BITS; i < unit_count; ++i, end_index += BitmaskBuffer::UNIT_BITS) {
-            end_index = std::min(end_index, count);
-            if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
-                // all data of 64 rows are not null
-                for (; start_index < end_index; ++start_index) {
-                    if (boolean_buffer.GetCompactBit(start_index)) {
-                        output_true_select->Append(start_index);
-                    }
-                }
-            } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
-                // all data of 64 rows are null
-                start_index = end_index;
-            } else {
-                for (; start_index < end_index; ++start_index) {
-                    if ((null_mask->IsTrue(start_index)) && boolean_buffer.GetCompactBit(start_index)) {
-                        output_true_select->Append(start_index);
-                    }
-                }
-            }
+    const u64 *null_data = (nullable && !(null_mask->IsAllTrue())) ? null_mask->GetData() : nullptr;
+    static_assert(BitmaskBuffer::UNIT_BITS == 64, "static_assert: BitmaskBuffer::UNIT_BITS == 64");
+    for (SizeT unit_idx = 0, start_index = 0; start_index < count; ++unit_idx, start_index += BitmaskBuffer::UNIT_BITS) {
+        SizeT row_count = std::min<SizeT>(BitmaskBuffer::UNIT_BITS, count - start_index);
+        u64 word = 0;
+        std::memcpy(&word, bool_data + start_index / 8, (row_count + 7) / 8);
+        if (row_count < BitmaskBuffer::UNIT_BITS) {
+            word &= (u64(1) << row_count) - 1;
         }
-    } else {
-        for (SizeT idx = 0; idx < count; ++idx) {
-            if (boolean_buffer.GetCompactBit(idx)) {
-                output_true_select->Append(idx);
-            }
+        if (null_data != nullptr) {
+            word &= null_data[unit_idx];
+        }
+        while (word != 0) {
+            output_true_select->Append(start_index + std::countr_zero(word));
+            word &= word - 1;
         }
     }
 }
@@ -46,6 +46,22 @@ public:
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
 private:
+    // Select the rows of input_select (all rows when it is null) that satisfy expr.
+    void SelectRows(const SharedPtr<BaseExpression> &expr,
+                    SharedPtr<ExpressionState> &state,
+                    SizeT count,
+                    const SharedPtr<Selection> &input_select,
+                    SharedPtr<Selection> &output_true_select);
+
+    // Evaluate the conjuncts of an AND tree one after another, each one only on the rows the previous ones kept.
+    void SelectConjunction(const SharedPtr<BaseExpression> &expr,
+                           SharedPtr<ExpressionState> &state,
+                           SizeT count,
+                           const SharedPtr<Selection> &input_select,
+                           SharedPtr<Selection> &output_true_select);
+
+    SharedPtr<ColumnVector> EvaluateBool(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block);
+
     const DataBlock *input_data_{nullptr};
 };
 
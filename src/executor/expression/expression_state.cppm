@@ -24,6 +24,7 @@ import function_expression;
 import value_expression;
 import in_expression;
 import column_vector;
+import function_data;
 
 export module expression_state;
 
@@ -36,6 +37,14 @@ export enum class AggregateFlag : i8 {
     kRunAndFinish = 3,
 };
 
+// Conjunct evaluation order of an AND tree and the rows each conjunct saw and kept so far.
+// It holds no column data, so an operator can keep it across data blocks while the expression state is rebuilt per block.
+export struct ConjunctionStats {
+    Vector<SizeT> order_{};
+    Vector<u64> input_rows_{};
+    Vector<u64> output_rows_{};
+};
+
 export class ExpressionState {
 public:
     // Static functions
@@ -66,6 +75,12 @@ public:
 
     AggregateFlag agg_flag_{AggregateFlag::kUninitialized};
 
+    // data a scalar function keeps across the data blocks
+    SharedPtr<FunctionData> function_data_{};
+
+    // AND tree evaluated by the ExpressionSelector
+    ConjunctionStats conjunction_stats_{};
+
 private:
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
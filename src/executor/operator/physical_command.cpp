@@ -35,6 +35,7 @@ import config;
 import status;
 import infinity_exception;
 import compact_segments_task;
+import logger;
 
 namespace infinity {
 
@@ -66,6 +67,18 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                 return true;
             }
 
+            if (set_command->var_name() == query_priority_name) {
+                if (set_command->value_type() != SetVarType::kString) {
+                    RecoverableError(Status::DataTypeMismatch("String", set_command->value_type_str()));
+                }
+                QueryPriority query_priority = String2QueryPriority(set_command->value_str());
+                if (query_priority == QueryPriority::kInvalid) {
+                    RecoverableError(Status::SetInvalidVarValue("query priority", "interactive, batch, background"));
+                }
+                query_context->current_session()->options()->query_priority_ = query_priority;
+                return true;
+            }
+
             if (set_command->var_name() == log_level) {
                 if (set_command->value_type() != SetVarType::kString) {
                     RecoverableError(Status::DataTypeMismatch("String", set_command->value_type_str()));
@@ -143,6 +156,12 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
             compact_task->Execute();
             break;
         }
+        case CommandType::kAnalyzeTable: {
+            auto *txn = query_context->GetTxn();
+            SizeT analyzed_count = table_entry_->Analyze(txn, false);
+            LOG_INFO(fmt::format("Analyze table {}: {} segments analyzed", *table_entry_->GetTableName(), analyzed_count));
+            break;
+        }
         default: {
             UnrecoverableError("Invalid command type.");
         }
@@ -57,7 +57,7 @@ public:
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const override { return output_types_; }
 
 public:
-    TableEntry *table_entry_ = nullptr; // only used for compact command
+    TableEntry *table_entry_ = nullptr; // only used for compact and analyze command
 
     const SharedPtr<CommandInfo> command_info_{};
 
@@ -72,12 +72,16 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
         DataBlock* output_data_block = data_block.get();
         operator_state->data_block_array_.emplace_back(std::move(data_block));
 
+        // a fresh state per block, so that heap backed intermediate columns don't grow with the number of blocks;
+        // only the conjunct statistics are carried over
         SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
+        std::swap(condition_state->conjunction_stats_, filter_operator_state->condition_stats_);
         DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
 
         // selector contains a pointer to input data, which should not be shared by multiple tasks
         ExpressionSelector selector;
         SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        std::swap(condition_state->conjunction_stats_, filter_operator_state->condition_stats_);
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
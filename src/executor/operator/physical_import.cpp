@@ -53,6 +53,7 @@ import status;
 import column_vector;
 import default_values;
 import embedding_info;
+import internal_types;
 import column_def;
 import constant_expr;
 import wal_entry;
@@ -109,9 +110,12 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
         RecoverableError(Status::ImportFileFormatError("FVECS file must have only one embedding column."));
     }
     auto embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
-    if (embedding_info->Type() != kElemFloat) {
+    // half precision columns narrow the float vectors of the file
+    const EmbeddingDataType elem_type = embedding_info->Type();
+    if (elem_type != kElemFloat && elem_type != kElemFloat16 && elem_type != kElemBFloat16) {
         RecoverableError(Status::ImportFileFormatError("FVECS file must have only one embedding column with float element."));
     }
+    const SizeT elem_size = EmbeddingType::EmbeddingDataWidth(elem_type);
 
     LocalFileSystem fs;
 
@@ -150,6 +154,7 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
     BufferHandle buffer_handle = block_entry->GetColumnBlockEntry(0)->buffer()->Load();
     SizeT row_idx = 0;
     auto buf_ptr = static_cast<ptr_t>(buffer_handle.GetDataMut());
+    Vector<FloatT> row_buffer(elem_type == kElemFloat ? 0 : dimension);
     while (true) {
         int dim;
         nbytes = fs.Read(*file_handler, &dim, sizeof(dimension));
@@ -157,8 +162,29 @@ void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorStat
             RecoverableError(
                 Status::ImportFileFormatError(fmt::format("Dimension in file ({}) doesn't match with table definition ({}).", dim, dimension)));
         }
-        ptr_t dst_ptr = buf_ptr + block_entry->row_count() * sizeof(FloatT) * dimension;
-        fs.Read(*file_handler, dst_ptr, sizeof(FloatT) * dimension);
+        ptr_t dst_ptr = buf_ptr + block_entry->row_count() * elem_size * dimension;
+        switch (elem_type) {
+            case kElemFloat16: {
+                fs.Read(*file_handler, row_buffer.data(), sizeof(FloatT) * dimension);
+                auto *dst = reinterpret_cast<Float16T *>(dst_ptr);
+                for (int i = 0; i < dimension; ++i) {
+                    dst[i] = Float16T(row_buffer[i]);
+                }
+                break;
+            }
+            case kElemBFloat16: {
+                fs.Read(*file_handler, row_buffer.data(), sizeof(FloatT) * dimension);
+                auto *dst = reinterpret_cast<BFloat16T *>(dst_ptr);
+                for (int i = 0; i < dimension; ++i) {
+                    dst[i] = BFloat16T(row_buffer[i]);
+                }
+                break;
+            }
+            default: {
+                fs.Read(*file_handler, dst_ptr, sizeof(FloatT) * dimension);
+                break;
+            }
+        }
         block_entry->IncreaseRowCount(1);
         ++row_idx;
 
@@ -598,6 +624,18 @@ void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<Col
                             column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
                             break;
                         }
+                        case kElemFloat16: {
+                            Vector<float> &&embedding = line_json[column_def->name_].get<Vector<float>>();
+                            Vector<Float16T> half_embedding(embedding.begin(), embedding.end());
+                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(half_embedding.data()));
+                            break;
+                        }
+                        case kElemBFloat16: {
+                            Vector<float> &&embedding = line_json[column_def->name_].get<Vector<float>>();
+                            Vector<BFloat16T> half_embedding(embedding.begin(), embedding.end());
+                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(half_embedding.data()));
+                            break;
+                        }
                         default: {
                             UnrecoverableError("Not implement: Embedding type.");
                         }
@@ -32,8 +32,17 @@ import secondary_index_scan_execute_expression;
 import logical_type;
 import table_index_entry;
 import segment_index_entry;
+import secondary_index_in_mem;
 import segment_entry;
 import fast_rough_filter;
+import segment_iter;
+import block_entry;
+import block_column_iter;
+import buffer_manager;
+import secondary_index_data;
+import value;
+import top_n_threshold;
+import physical_limit;
 // TODO:use bitset
 import bitmask;
 import filter_value_type_classification;
@@ -46,12 +55,14 @@ PhysicalIndexScan::PhysicalIndexScan(u64 id,
                                      HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                      Vector<FilterExecuteElem> &&filter_execute_command,
                                      UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                     HashSet<SegmentID> &&scan_segment_ids,
+                                     SharedPtr<TopNThreshold> top_n_threshold,
                                      SharedPtr<Vector<LoadMeta>> load_metas,
                                      bool add_row_id)
     : PhysicalOperator(PhysicalOperatorType::kIndexScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
       index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(std::move(column_index_map)),
       filter_execute_command_(std::move(filter_execute_command)), fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)),
-      add_row_id_(add_row_id) {
+      scan_segment_ids_(std::move(scan_segment_ids)), top_n_threshold_(std::move(top_n_threshold)), add_row_id_(add_row_id) {
     // output only one hidden column: RowID
     // create empty output_names_ and output_types_
     output_names_ = MakeShared<Vector<String>>();
@@ -225,24 +236,97 @@ struct FilterResult {
         selected_rows_.emplace<Vector<u32>>();
     }
 
+    // drop the rows at or after row_end
+    inline void RestrictToRows(u32 row_end) {
+        std::visit(Overload{[&](Vector<u32> &selected_rows) {
+                                selected_rows.erase(std::lower_bound(selected_rows.begin(), selected_rows.end(), row_end), selected_rows.end());
+                            },
+                            [&](Bitmask &bitmask) {
+                                for (u32 i = row_end; i < SegmentRowCount(); ++i) {
+                                    bitmask.SetFalse(i);
+                                }
+                            }},
+                   selected_rows_);
+    }
+
+    template <typename ColumnValueType>
+    inline void ExecuteSingleRangeT(const FilterIntervalRangeT<ColumnValueType> &interval_range,
+                                    SegmentIndexEntry &index_entry,
+                                    const SecondaryIndexInMem *secondary_index_in_mem,
+                                    TxnTimeStamp begin_ts) {
+        u32 in_mem_row_count = secondary_index_in_mem == nullptr ? 0 : secondary_index_in_mem->RowCount();
+        ExecuteSingleRangeInIndexT(interval_range, index_entry, in_mem_row_count);
+        if (secondary_index_in_mem == nullptr) {
+            return;
+        }
+        // the index may have been rebuilt with rows committed after begin_ts
+        RestrictToRows(secondary_index_in_mem->VisibleRowEnd(begin_ts));
+        // rows appended since the index was built
+        auto [begin_val, end_val] = interval_range.GetRange();
+        FilterResult in_mem_result(SegmentRowCount(), SegmentRowActualCount());
+        auto &in_mem_selected_rows = in_mem_result.selected_rows_.emplace<Vector<u32>>();
+        static_cast<const SecondaryIndexInMemT<ColumnValueType> *>(secondary_index_in_mem)->SearchRange(begin_val, end_val, begin_ts, in_mem_selected_rows);
+        MergeOr(in_mem_result);
+    }
+
+    // varchar range is searched as the range of ordinals in the dictionary of the segment
+    inline void ExecuteSingleRangeT(const FilterIntervalRangeT<VarcharT> &interval_range,
+                                    SegmentIndexEntry &index_entry,
+                                    const SecondaryIndexInMem *secondary_index_in_mem,
+                                    TxnTimeStamp begin_ts) {
+        u32 in_mem_row_count = secondary_index_in_mem == nullptr ? 0 : secondary_index_in_mem->RowCount();
+        const VarcharKeyRange &range = interval_range.GetRange();
+        Pair<IntegerT, IntegerT> ordinal_range;
+        {
+            BufferHandle index_handle_head = index_entry.GetIndex();
+            auto index = static_cast<const SecondaryIndexDataHead *>(index_handle_head.GetData());
+            ordinal_range = index->SearchDictionary(range);
+        }
+        if (auto [begin_ordinal, end_ordinal] = ordinal_range; begin_ordinal <= end_ordinal) {
+            ExecuteSingleRangeInIndexT(FilterIntervalRangeT<IntegerT>(begin_ordinal, end_ordinal), index_entry, in_mem_row_count);
+        } else {
+            SetEmptyResult();
+        }
+        if (secondary_index_in_mem == nullptr) {
+            return;
+        }
+        // the index may have been rebuilt with rows committed after begin_ts
+        RestrictToRows(secondary_index_in_mem->VisibleRowEnd(begin_ts));
+        // rows appended since the index was built
+        FilterResult in_mem_result(SegmentRowCount(), SegmentRowActualCount());
+        auto &in_mem_selected_rows = in_mem_result.selected_rows_.emplace<Vector<u32>>();
+        static_cast<const SecondaryIndexInMemT<VarcharT> *>(secondary_index_in_mem)->SearchRange(range, begin_ts, in_mem_selected_rows);
+        MergeOr(in_mem_result);
+    }
+
     template <typename ColumnValueType>
     inline void
-    ExecuteSingleRangeT(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentIndexEntry &index_entry, SegmentID segment_id) {
+    ExecuteSingleRangeInIndexT(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentIndexEntry &index_entry, u32 in_mem_row_count) {
         using T = FilterIntervalRangeT<ColumnValueType>::T;
         BufferHandle index_handle_head = index_entry.GetIndex();
         auto index = static_cast<const SecondaryIndexDataHead *>(index_handle_head.GetData());
         auto index_part_capacity = index->GetPartCapacity();
         auto index_part_num = index->GetPartNum();
         auto index_data_num = index->GetDataNum();
-        if (index_data_num != SegmentRowActualCount()) {
-            if (index_data_num < SegmentRowActualCount()) {
-                UnrecoverableError("FilterResult::ExecuteSingleRange(): index_data_num < SegmentRowActualCount(). index error.");
+        if (index_data_num + in_mem_row_count != SegmentRowActualCount()) {
+            if (index_data_num + in_mem_row_count < SegmentRowActualCount()) {
+                LOG_WARN(fmt::format("FilterResult::ExecuteSingleRange(): index_data_num: {}, in_mem_row_count: {}, SegmentRowActualCount(): {}. "
+                                     "Some rows are being appended.",
+                                     index_data_num,
+                                     in_mem_row_count,
+                                     SegmentRowActualCount()));
             } else {
-                LOG_INFO(fmt::format("FilterResult::ExecuteSingleRange(): index_data_num: {}, SegmentRowActualCount(): {}. Some rows are deleted.",
+                LOG_INFO(fmt::format("FilterResult::ExecuteSingleRange(): index_data_num: {}, in_mem_row_count: {}, SegmentRowActualCount(): {}. "
+                                     "Some rows are deleted.",
                                      index_data_num,
+                                     in_mem_row_count,
                                      SegmentRowActualCount()));
             }
         }
+        if (index_data_num == 0) {
+            // all rows of the segment are in the in-memory index
+            return SetEmptyResult();
+        }
         auto [begin_val, end_val] = interval_range.GetRange();
         // 1. search PGM and get approximate search range
         // result:
@@ -414,7 +498,8 @@ struct FilterResult {
 
     inline void ExecuteSingleRange(const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
                                    const FilterExecuteSingleRange &single_range,
-                                   SegmentID segment_id) {
+                                   SegmentID segment_id,
+                                   TxnTimeStamp begin_ts) {
         // step 1. check if range is empty
         if (single_range.IsEmpty()) {
             return SetEmptyResult();
@@ -423,10 +508,11 @@ struct FilterResult {
         ColumnID column_id = single_range.GetColumnID();
         auto const &index_by_segment = column_index_map.at(column_id)->index_by_segment();
         SegmentIndexEntry &index_entry = *(index_by_segment.at(segment_id));
-        // step 3. search index
+        // step 3. search index, keep the index from being rebuilt during the search
+        auto [secondary_index_in_mem, secondary_index_lock] = index_entry.GetSecondaryIndexSnapshot();
         auto &interval_range_variant = single_range.GetIntervalRange();
         std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) {
-                                ExecuteSingleRangeT(interval_range, index_entry, segment_id);
+                                ExecuteSingleRangeT(interval_range, index_entry, secondary_index_in_mem.get(), begin_ts);
                             },
                             [](const std::monostate &empty) {
                                 UnrecoverableError("FilterResult::ExecuteSingleRange(): class member interval_range_ not initialized!");
@@ -434,6 +520,51 @@ struct FilterResult {
                    interval_range_variant);
     }
 
+    // evaluate the range on the column data of the segment instead of reading the index
+    inline void
+    ExecuteSingleRangeByScan(const FilterExecuteSingleRange &single_range, SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts) {
+        if (single_range.IsEmpty()) {
+            return SetEmptyResult();
+        }
+        const ColumnID column_id = single_range.GetColumnID();
+        auto &bitmask = selected_rows_.emplace<Bitmask>();
+        bitmask.Initialize(std::bit_ceil(SegmentRowCount()));
+        bitmask.SetAllFalse();
+        // in_range(column_iter, value_ptr, block_offset): whether the visible row is selected
+        auto scan_column = [&](auto &&in_range) {
+            auto block_iter = BlockEntryIter(segment_entry);
+            for (auto *block_entry = block_iter.Next(); block_entry != nullptr; block_entry = block_iter.Next()) {
+                const u32 block_segment_offset = block_entry->block_id() * DEFAULT_BLOCK_CAPACITY;
+                BlockColumnIter<true> column_iter(block_entry->GetColumnBlockEntry(column_id), buffer_mgr, begin_ts);
+                for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
+                    auto &[ptr, offset] = next_pair.value();
+                    if (in_range(column_iter, ptr, offset)) {
+                        bitmask.SetTrue(block_segment_offset + offset);
+                    }
+                }
+            }
+        };
+        std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) {
+                                const auto key_range = interval_range.GetRange();
+                                scan_column([&](const BlockColumnIter<true> &, const void *ptr, BlockOffset) {
+                                    auto key = ConvertToOrderedKeyValue(*static_cast<const ColumnValueType *>(ptr));
+                                    return key_range.first <= key and key <= key_range.second;
+                                });
+                            },
+                            [&](const FilterIntervalRangeT<VarcharT> &interval_range) {
+                                const VarcharKeyRange &range = interval_range.GetRange();
+                                scan_column([&](const BlockColumnIter<true> &column_iter, const void *, BlockOffset offset) {
+                                    Value value = column_iter.column_vector()->GetValue(offset);
+                                    const String &val = value.GetVarchar();
+                                    return range.NotBeforeBegin(val) and range.NotAfterEnd(val);
+                                });
+                            },
+                            [](const std::monostate &empty) {
+                                UnrecoverableError("FilterResult::ExecuteSingleRangeByScan(): class member interval_range_ not initialized!");
+                            }},
+                   single_range.GetIntervalRange());
+    }
+
     inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks, SegmentID segment_id, const DeleteFilter &delete_filter) const {
         const u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
         const u32 selected_row_num = SelectedNum(); // before delete filter
@@ -515,11 +646,12 @@ struct FilterResult {
     }
 };
 
+// execute_single_range(result, single_range): solve one range of the command into result
+template <typename ExecuteSingleRange>
 FilterResult SolveSecondaryIndexFilterInner(const Vector<FilterExecuteElem> &filter_execute_command,
-                                            const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
-                                            const SegmentID segment_id,
                                             const u32 segment_row_count,
-                                            const u32 segment_row_actual_count) {
+                                            const u32 segment_row_actual_count,
+                                            ExecuteSingleRange &&execute_single_range) {
     Vector<FilterResult> result_stack;
     // execute filter_execute_command_ (Reverse Polish notation)
     for (auto const &elem : filter_execute_command) {
@@ -549,7 +681,7 @@ FilterResult SolveSecondaryIndexFilterInner(const Vector<FilterExecuteElem> &fil
                             },
                             [&](const FilterExecuteSingleRange &single_range) {
                                 result_stack.emplace_back(segment_row_count, segment_row_actual_count);
-                                result_stack.back().ExecuteSingleRange(column_index_map, single_range, segment_id);
+                                execute_single_range(result_stack.back(), single_range);
                             }},
                    elem);
     }
@@ -564,12 +696,18 @@ std::variant<Vector<u32>, Bitmask> SolveSecondaryIndexFilter(const Vector<Filter
                                                              const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
                                                              const SegmentID segment_id,
                                                              const u32 segment_row_count,
-                                                             const u32 segment_row_actual_count) {
+                                                             const u32 segment_row_actual_count,
+                                                             const TxnTimeStamp begin_ts) {
     if (filter_execute_command.empty()) {
         // return all true
         return std::variant<Vector<u32>, Bitmask>(std::in_place_type<Bitmask>);
     }
-    auto result = SolveSecondaryIndexFilterInner(filter_execute_command, column_index_map, segment_id, segment_row_count, segment_row_actual_count);
+    auto result = SolveSecondaryIndexFilterInner(filter_execute_command,
+                                                 segment_row_count,
+                                                 segment_row_actual_count,
+                                                 [&](FilterResult &filter_result, const FilterExecuteSingleRange &single_range) {
+                                                     filter_result.ExecuteSingleRange(column_index_map, single_range, segment_id, begin_ts);
+                                                 });
     return std::move(result.selected_rows_);
 }
 
@@ -599,9 +737,11 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
     } else {
         segment_entry = iter->second;
     }
-    // check FastRoughFilter
+    // check FastRoughFilter, the top-N threshold and the limit
     const auto &fast_rough_filter = *segment_entry->GetFastRoughFilter();
-    if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) {
+    const bool limit_over = limit_counter_ and limit_counter_->IsLimitOver();
+    if (limit_over or (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) or
+        (top_n_threshold_ and !top_n_threshold_->Evaluate(begin_ts, fast_rough_filter))) {
         // skip this segment
         LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}, skipped after FastRoughFilter", next_idx, segment_ids.size()));
         // output one empty data block
@@ -613,7 +753,7 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
         output_data_blocks.emplace_back(std::move(data_block));
         // update next_idx
         // check if jobs are all done
-        if (++next_idx >= segment_ids.size()) {
+        if (++next_idx >= segment_ids.size() or limit_over) {
             // Finished
             index_scan_operator_state->SetComplete();
         }
@@ -627,7 +767,19 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
     // prepare filter for deleted rows
     DeleteFilter delete_filter(segment_entry, begin_ts);
     // output
-    auto result = SolveSecondaryIndexFilterInner(filter_execute_command_, column_index_map_, segment_id, segment_row_count, segment_row_actual_count);
+    auto result = scan_segment_ids_.contains(segment_id)
+                      ? SolveSecondaryIndexFilterInner(filter_execute_command_,
+                                                       segment_row_count,
+                                                       segment_row_actual_count,
+                                                       [&](FilterResult &filter_result, const FilterExecuteSingleRange &single_range) {
+                                                           filter_result.ExecuteSingleRangeByScan(single_range, segment_entry, txn->buffer_mgr(), begin_ts);
+                                                       })
+                      : SolveSecondaryIndexFilterInner(filter_execute_command_,
+                                                       segment_row_count,
+                                                       segment_row_actual_count,
+                                                       [&](FilterResult &filter_result, const FilterExecuteSingleRange &single_range) {
+                                                           filter_result.ExecuteSingleRange(column_index_map_, single_range, segment_id, begin_ts);
+                                                       });
     result.Output(output_data_blocks, segment_id, delete_filter);
 
     LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}, finished", next_idx, segment_ids.size()));
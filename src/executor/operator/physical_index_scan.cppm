@@ -36,6 +36,8 @@ import table_index_entry;
 import segment_index_entry;
 import fast_rough_filter;
 import bitmask;
+import top_n_threshold;
+import physical_limit;
 
 namespace infinity {
 
@@ -53,6 +55,8 @@ public:
                                HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                Vector<FilterExecuteElem> &&filter_execute_command,
                                UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               HashSet<SegmentID> &&scan_segment_ids,
+                               SharedPtr<TopNThreshold> top_n_threshold,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = true);
 
@@ -86,6 +90,13 @@ public:
 
     inline auto &FilterExpression() const { return index_filter_qualified_; }
 
+    inline const HashSet<SegmentID> &ScanSegmentIDs() const { return scan_segment_ids_; }
+
+    inline SizeT SegmentCount() const { return base_table_ref_->block_index_->SegmentCount(); }
+
+    // for LIMIT without ORDER BY: stop once the limit is reached
+    void SetLimitCounter(SharedPtr<LimitCounter> limit_counter) { limit_counter_ = std::move(limit_counter); }
+
 private:
     void ExecuteInternal(QueryContext *query_context, IndexScanOperatorState *index_scan_operator_state) const;
 
@@ -101,6 +112,13 @@ private:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
+    // segments in which the filter is evaluated on the column data instead of the index
+    HashSet<SegmentID> scan_segment_ids_{};
+
+    SharedPtr<TopNThreshold> top_n_threshold_{};
+
+    SharedPtr<LimitCounter> limit_counter_{};
+
     bool add_row_id_{};
     mutable Vector<SizeT> column_ids_{};
 };
@@ -109,6 +127,7 @@ export std::variant<Vector<u32>, Bitmask> SolveSecondaryIndexFilter(const Vector
                                                                     const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
                                                                     const SegmentID segment_id,
                                                                     const u32 segment_row_count,
-                                                                    const u32 segment_row_actual_count);
+                                                                    const u32 segment_row_actual_count,
+                                                                    const TxnTimeStamp begin_ts);
 
 } // namespace infinity
@@ -66,6 +66,8 @@ import block_entry;
 import segment_index_entry;
 import segment_entry;
 import abstract_hnsw;
+import profiler;
+import internal_types;
 
 namespace infinity {
 
@@ -139,6 +141,76 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
     }
 }
 
+// Build the filter bitmask of one block from the segment level filter result.
+// Return false if no row of the block survives the filter.
+bool BuildBlockFilterBitmask(const std::variant<Vector<u32>, Bitmask> &filter_result, BlockID block_id, SizeT row_count, Bitmask &bitmask) {
+    bitmask.Initialize(std::bit_ceil(row_count));
+    const u32 block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+    const u32 block_end_offset = block_start_offset + row_count;
+    if (std::holds_alternative<Vector<u32>>(filter_result)) {
+        const Vector<u32> &filter_result_vector = std::get<Vector<u32>>(filter_result);
+        const auto it1 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_start_offset);
+        const auto it2 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_end_offset);
+        bitmask.SetAllFalse();
+        for (auto it = it1; it < it2; ++it) {
+            bitmask.SetTrue(*it - block_start_offset);
+        }
+        return it1 < it2;
+    }
+    u32 u64_start_offset = block_start_offset / 64;
+    u32 u64_end_offset = (block_end_offset - 1) / 64;
+    if (const u64 *filter_data = std::get<Bitmask>(filter_result).GetData(); filter_data) {
+        bitmask.SetAllFalse();
+        u64 *data = bitmask.GetData();
+        u64 any_true = 0;
+        for (u32 i = u64_start_offset; i <= u64_end_offset; ++i) {
+            data[i - u64_start_offset] = filter_data[i];
+            any_true |= filter_data[i];
+        }
+        return any_true != 0;
+    }
+    return true;
+}
+
+// Fraction of the segment rows which survive the filter.
+f32 EstimateFilterSelectivity(const std::variant<Vector<u32>, Bitmask> &filter_result, SizeT segment_row_count) {
+    if (segment_row_count == 0) {
+        return 0.0f;
+    }
+    SizeT survive_count = 0;
+    if (std::holds_alternative<Vector<u32>>(filter_result)) {
+        survive_count = std::get<Vector<u32>>(filter_result).size();
+    } else {
+        const Bitmask &filter_bitmask = std::get<Bitmask>(filter_result);
+        if (filter_bitmask.GetData() == nullptr) {
+            return 1.0f;
+        }
+        // the bitmask is allocated with bit_ceil(segment_row_count) bits, bits beyond the segment rows stay true
+        SizeT count_true = filter_bitmask.CountTrue();
+        SizeT padding = filter_bitmask.count() - std::min(filter_bitmask.count(), segment_row_count);
+        survive_count = count_true - std::min(count_true, padding);
+    }
+    return std::min(1.0f, static_cast<f32>(survive_count) / static_cast<f32>(segment_row_count));
+}
+
+// Pick the search strategy of an indexed segment from the filter selectivity.
+// Graph and IVF search degenerate when most visited vectors are rejected by the filter:
+// the search width is widened by 1/selectivity, so it is left as is when nothing is filtered out,
+// and below the threshold the surviving rows are few enough that a brute force scan is both exact and cheaper.
+Pair<KnnFilterStrategy, f32> ChooseFilterStrategy(f32 selectivity, f32 brute_force_selectivity) {
+    if (selectivity < brute_force_selectivity) {
+        return {KnnFilterStrategy::kBruteForce, 1.0f};
+    }
+    if (selectivity >= 1.0f) {
+        return {KnnFilterStrategy::kIndex, 1.0f};
+    }
+    f32 amplification = static_cast<f32>(KNN_FILTER_MAX_SEARCH_AMPLIFICATION);
+    if (selectivity > 0.0f) {
+        amplification = std::min(amplification, 1.0f / selectivity);
+    }
+    return {KnnFilterStrategy::kWidenedIndex, amplification};
+}
+
 void PhysicalKnnScan::Init() {}
 
 bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -164,6 +236,61 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
             }
             break;
         }
+        case kElemInt8: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<i8, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<i8, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Only l2 and ip distance are supported for int8 embedding"));
+                }
+            }
+            break;
+        }
+        case kElemFloat16: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<Float16T, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<Float16T, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Only l2 and ip distance are supported for float16 embedding"));
+                }
+            }
+            break;
+        }
+        case kElemBFloat16: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<BFloat16T, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<BFloat16T, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Only l2 and ip distance are supported for bfloat16 embedding"));
+                }
+            }
+            break;
+        }
+        case kElemBit: {
+            if (dist_type != KnnDistanceType::kHamming) {
+                RecoverableError(Status::NotSupport("Only hamming distance is supported for bit embedding"));
+            }
+            ExecuteInternal<u8, CompareMax>(query_context, knn_scan_operator_state);
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport("Not implemented"));
         }
@@ -237,6 +364,16 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
     LOG_TRACE(fmt::format("KnnScan: brute force task: {}, index task: {}", block_column_entries_->size(), index_entries_->size()));
 }
 
+f32 PhysicalKnnScan::BruteForceSelectivity() const {
+    f32 brute_force_selectivity = KNN_FILTER_BRUTE_FORCE_SELECTIVITY;
+    for (const auto &opt_param : knn_expression_->opt_params_) {
+        if (opt_param.param_name_ == "brute_force_selectivity") {
+            brute_force_selectivity = ParseBruteForceSelectivity(opt_param.param_value_);
+        }
+    }
+    return brute_force_selectivity;
+}
+
 SizeT PhysicalKnnScan::BlockEntryCount() const { return base_table_ref_->block_index_->BlockCount(); }
 
 template <typename DataType, template <typename, typename> typename C>
@@ -252,8 +389,10 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
     auto knn_scan_shared_data = knn_scan_function_data->knn_scan_shared_data_;
 
     auto dist_func = static_cast<KnnDistance1<DataType> *>(knn_scan_function_data->knn_distance_.get());
-    auto merge_heap = static_cast<MergeKnn<DataType, C> *>(knn_scan_function_data->merge_knn_base_.get());
+    auto merge_heap = static_cast<MergeKnn<f32, C> *>(knn_scan_function_data->merge_knn_base_.get());
     auto query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_);
+    // element count of one vector, bit embeddings are packed into bytes
+    const SizeT dim = EmbeddingType::EmbeddingSize(knn_scan_shared_data->elem_type_, knn_scan_shared_data->dimension_) / sizeof(DataType);
 
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
@@ -277,28 +416,7 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             // filter for segment
             const std::variant<Vector<u32>, Bitmask> &filter_result = it->second;
             Bitmask bitmask;
-            bitmask.Initialize(std::bit_ceil(row_count));
-            const u32 block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-            const u32 block_end_offset = block_start_offset + row_count;
-            if (std::holds_alternative<Vector<u32>>(filter_result)) {
-                const Vector<u32> &filter_result_vector = std::get<Vector<u32>>(filter_result);
-                const auto it1 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_start_offset);
-                const auto it2 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_end_offset);
-                bitmask.SetAllFalse();
-                for (auto it = it1; it < it2; ++it) {
-                    bitmask.SetTrue(*it - block_start_offset);
-                }
-            } else {
-                u32 u64_start_offset = block_start_offset / 64;
-                u32 u64_end_offset = (block_end_offset - 1) / 64;
-                if (const u64 *filter_data = std::get<Bitmask>(filter_result).GetData(); filter_data) {
-                    bitmask.SetAllFalse();
-                    u64 *data = bitmask.GetData();
-                    for (u32 i = u64_start_offset; i <= u64_end_offset; ++i) {
-                        data[i - u64_start_offset] = filter_data[i];
-                    }
-                }
-            }
+            BuildBlockFilterBitmask(filter_result, block_id, row_count, bitmask);
             block_entry->SetDeleteBitmask(begin_ts, bitmask);
 
             ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
@@ -306,7 +424,7 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             auto data = reinterpret_cast<const DataType *>(column_vector.data());
             merge_heap->Search(query,
                                data,
-                               knn_scan_shared_data->dimension_,
+                               dim,
                                dist_func->dist_func_,
                                row_count,
                                block_entry->segment_id(),
@@ -346,159 +464,247 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             }
             bool use_bitmask = !bitmask.IsAllTrue();
 
-            switch (segment_index_entry->table_index_entry()->index_base()->index_type_) {
-                case IndexType::kIVFFlat: {
-                    BufferHandle index_handle = segment_index_entry->GetIndex();
-                    auto index = static_cast<const AnnIVFFlatIndexData<DataType> *>(index_handle.GetData());
-                    i32 n_probes = 1;
-                    auto IVFFlatScanTemplate = [&]<typename AnnIVFFlatType, typename... OptionalFilter>(OptionalFilter &&...filter) {
-                        AnnIVFFlatType ann_ivfflat_query(query,
-                                                         knn_scan_shared_data->query_count_,
-                                                         knn_scan_shared_data->topk_,
-                                                         knn_scan_shared_data->dimension_,
-                                                         knn_scan_shared_data->elem_type_);
-                        ann_ivfflat_query.Begin();
-                        ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
-                        ann_ivfflat_query.EndWithoutSort();
-                        auto dists = ann_ivfflat_query.GetDistances();
-                        auto row_ids = ann_ivfflat_query.GetIDs();
-                        // TODO: now only work for one query
-                        // FIXME: cant work for multiple queries
-                        auto result_count = std::lower_bound(dists,
-                                                             dists + knn_scan_shared_data->topk_,
-                                                             AnnIVFFlatType::InvalidValue(),
-                                                             AnnIVFFlatType::CompareDist) -
-                                            dists;
-                        merge_heap->Search(dists, row_ids, result_count);
-                    };
-                    auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
-                        switch (knn_scan_shared_data->knn_distance_type_) {
-                            case KnnDistanceType::kL2: {
-                                IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<DataType>>(std::forward<OptionalFilter>(filter)...);
-                                break;
-                            }
-                            case KnnDistanceType::kInnerProduct: {
-                                IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<DataType>>(std::forward<OptionalFilter>(filter)...);
-                                break;
-                            }
-                            default: {
-                                RecoverableError(Status::NotSupport("Not implemented"));
-                            }
-                        }
-                    };
-                    if (use_bitmask) {
-                        if (segment_entry->CheckAnyDelete(begin_ts)) {
-                            DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
-                            IVFFlatScan(filter);
-                        } else {
-                            BitmaskFilter<SegmentOffset> filter(bitmask);
-                            IVFFlatScan(filter);
-                        }
-                    } else {
-                        if (segment_entry->CheckAnyDelete(begin_ts)) {
-                            DeleteFilter filter(segment_entry, begin_ts);
-                            IVFFlatScan(filter);
-                        } else {
-                            IVFFlatScan();
-                        }
+            f32 selectivity = use_bitmask ? EstimateFilterSelectivity(filter_result, segment_row_count) : 1.0f;
+            auto [filter_strategy, search_amplification] = ChooseFilterStrategy(selectivity, knn_scan_shared_data->brute_force_selectivity_);
+            LOG_TRACE(fmt::format("KnnScan: {} index {}/{} selectivity: {}, strategy: {}, amplification: {}",
+                                  knn_scan_function_data->task_id_,
+                                  index_idx + 1,
+                                  index_task_n,
+                                  selectivity,
+                                  KnnFilterStrategyToString(filter_strategy),
+                                  search_amplification));
+            BaseProfiler strategy_profiler(fmt::format("KnnScan {}", KnnFilterStrategyToString(filter_strategy)));
+            strategy_profiler.Begin();
+
+            if (filter_strategy == KnnFilterStrategy::kBruteForce) {
+                KnnExpression *knn_expr = knn_expression_.get();
+                ColumnExpression *column_expr = static_cast<ColumnExpression *>(knn_expr->arguments()[0].get());
+                SizeT knn_column_id = column_expr->binding().column_idx;
+                BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+
+                BlockEntryIter block_entry_iter(segment_entry);
+                for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+                    const auto row_count = block_entry->row_count();
+                    Bitmask block_bitmask;
+                    if (!BuildBlockFilterBitmask(filter_result, block_entry->block_id(), row_count, block_bitmask)) {
+                        continue;
                     }
-                    break;
+                    block_entry->SetDeleteBitmask(begin_ts, block_bitmask);
+
+                    ColumnVector column_vector = block_entry->GetColumnBlockEntry(knn_column_id)->GetColumnVector(buffer_mgr);
+                    auto data = reinterpret_cast<const DataType *>(column_vector.data());
+                    merge_heap->Search(query,
+                                       data,
+                                       dim,
+                                       dist_func->dist_func_,
+                                       row_count,
+                                       segment_id,
+                                       block_entry->block_id(),
+                                       block_bitmask);
                 }
-                case IndexType::kHnsw: {
-                    const auto *index_hnsw = static_cast<const IndexHnsw *>(segment_index_entry->table_index_entry()->index_base());
-
-                    auto hnsw_search = [&](BufferHandle index_handle, bool with_lock) {
-                        AbstractHnsw<f32, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
-
-                        for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
-                            if (opt_param.param_name_ == "ef") {
-                                u64 ef = std::stoull(opt_param.param_value_);
-                                abstract_hnsw.SetEf(ef);
-                            }
-                        }
-
-                        i64 result_n = -1;
-                        for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-                            const DataType *query =
-                                static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
-
-                            SizeT result_n1 = 0;
-                            UniquePtr<DataType[]> d_ptr = nullptr;
-                            UniquePtr<SegmentOffset[]> l_ptr = nullptr;
+            } else {
+                switch (segment_index_entry->table_index_entry()->index_base()->index_type_) {
+                    case IndexType::kIVFFlat: {
+                        if constexpr (!std::is_same_v<DataType, f32>) {
+                            RecoverableError(Status::NotSupport("IVFFlat index only supports float embedding"));
+                        } else {
+                            BufferHandle index_handle = segment_index_entry->GetIndex();
+                            auto index = static_cast<const AnnIVFFlatIndexData<DataType> *>(index_handle.GetData());
+                            i32 n_probes = static_cast<i32>(std::ceil(knn_scan_shared_data->ivf_nprobe_ * search_amplification));
+                            // encoded lists only give approximate distances, keep more candidates and rerank them exactly
+                            const i64 candidate_k = index->Encoded() ? knn_scan_shared_data->topk_ * knn_scan_shared_data->ivf_rerank_factor_
+                                                                     : knn_scan_shared_data->topk_;
+                            auto IVFFlatScanTemplate = [&]<typename AnnIVFFlatType, typename... OptionalFilter>(OptionalFilter &&...filter) {
+                                AnnIVFFlatType ann_ivfflat_query(query,
+                                                                 knn_scan_shared_data->query_count_,
+                                                                 candidate_k,
+                                                                 knn_scan_shared_data->dimension_,
+                                                                 knn_scan_shared_data->elem_type_);
+                                ann_ivfflat_query.Begin();
+                                ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
+                                ann_ivfflat_query.EndWithoutSort();
+                                if (!index->Encoded()) {
+                                    auto dists = ann_ivfflat_query.GetDistances();
+                                    auto row_ids = ann_ivfflat_query.GetIDs();
+                                    // TODO: now only work for one query
+                                    // FIXME: cant work for multiple queries
+                                    auto result_count = std::lower_bound(dists,
+                                                                         dists + knn_scan_shared_data->topk_,
+                                                                         AnnIVFFlatType::InvalidValue(),
+                                                                         AnnIVFFlatType::CompareDist) -
+                                                        dists;
+                                    merge_heap->Search(dists, row_ids, result_count);
+                                    return;
+                                }
+                                // rerank the candidates with the raw vectors of the segment
+                                KnnExpression *knn_expr = knn_expression_.get();
+                                ColumnExpression *column_expr = static_cast<ColumnExpression *>(knn_expr->arguments()[0].get());
+                                SizeT knn_column_id = column_expr->binding().column_idx;
+                                BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+                                HashMap<BlockID, ColumnVector> block_column_vectors;
+                                auto exact_dists = MakeUniqueForOverwrite<DataType[]>(candidate_k);
+                                for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                    const DataType *query_i = query + query_idx * knn_scan_shared_data->dimension_;
+                                    auto dists = ann_ivfflat_query.GetDistanceByIdx(query_idx);
+                                    auto row_ids = ann_ivfflat_query.GetIDByIdx(query_idx);
+                                    auto candidate_count =
+                                        std::lower_bound(dists, dists + candidate_k, AnnIVFFlatType::InvalidValue(), AnnIVFFlatType::CompareDist) - dists;
+                                    for (i64 i = 0; i < candidate_count; ++i) {
+                                        BlockID block_id = row_ids[i].segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+                                        BlockOffset block_offset = row_ids[i].segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+                                        auto iter = block_column_vectors.find(block_id);
+                                        if (iter == block_column_vectors.end()) {
+                                            BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                                            if (block_entry == nullptr) {
+                                                UnrecoverableError(fmt::format("Cannot find segment id: {}, block id: {}", segment_id, block_id));
+                                            }
+                                            iter = block_column_vectors.emplace(block_id, block_entry->GetColumnBlockEntry(knn_column_id)->GetColumnVector(buffer_mgr))
+                                                       .first;
+                                        }
+                                        const auto *raw_vector =
+                                            reinterpret_cast<const DataType *>(iter->second.data()) + block_offset * knn_scan_shared_data->dimension_;
+                                        exact_dists[i] = dist_func->dist_func_(query_i, raw_vector, knn_scan_shared_data->dimension_);
+                                    }
+                                    merge_heap->Search(query_idx, exact_dists.get(), row_ids, candidate_count);
+                                }
+                            };
+                            auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
+                                switch (knn_scan_shared_data->knn_distance_type_) {
+                                    case KnnDistanceType::kL2: {
+                                        IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<DataType>>(std::forward<OptionalFilter>(filter)...);
+                                        break;
+                                    }
+                                    case KnnDistanceType::kInnerProduct: {
+                                        IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<DataType>>(std::forward<OptionalFilter>(filter)...);
+                                        break;
+                                    }
+                                    default: {
+                                        RecoverableError(Status::NotSupport("Not implemented"));
+                                    }
+                                }
+                            };
                             if (use_bitmask) {
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
-                                    std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                    IVFFlatScan(filter);
                                 } else {
                                     BitmaskFilter<SegmentOffset> filter(bitmask);
-                                    std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                    IVFFlatScan(filter);
                                 }
                             } else {
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteFilter filter(segment_entry, begin_ts);
-                                    std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                    IVFFlatScan(filter);
                                 } else {
-                                    if (!with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, false);
-                                    } else {
-                                        AppendFilter filter(block_index->GetSegmentOffset(segment_id));
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, true);
-                                    }
+                                    // the ivf index of a growing segment may already hold rows appended after begin_ts
+                                    AppendFilter filter(block_index->GetSegmentOffset(segment_id));
+                                    IVFFlatScan(filter);
                                 }
                             }
+                        }
+                        break;
+                    }
+                    case IndexType::kHnsw: {
+                        const auto *index_hnsw = static_cast<const IndexHnsw *>(segment_index_entry->table_index_entry()->index_base());
 
-                            if (result_n < 0) {
-                                result_n = result_n1;
-                            } else if (result_n != (i64)result_n1) {
-                                UnrecoverableError("KnnScan: result_n mismatch");
-                            }
+                        auto hnsw_search = [&](BufferHandle index_handle, bool with_lock) {
+                            AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
 
-                            switch (knn_scan_shared_data->knn_distance_type_) {
-                                case KnnDistanceType::kInvalid: {
-                                    UnrecoverableError("Invalid distance type");
+                            // ef is passed to each search, the shared index is left unchanged
+                            u64 ef = index_hnsw->ef_ != 0 ? index_hnsw->ef_ : index_hnsw->ef_construction_;
+                            for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                                if (opt_param.param_name_ == "ef") {
+                                    ef = std::stoull(opt_param.param_value_);
                                 }
-                                case KnnDistanceType::kL2:
-                                case KnnDistanceType::kHamming: {
-                                    break;
+                            }
+                            const SizeT search_ef = static_cast<SizeT>(std::ceil(ef * search_amplification));
+
+                            i64 result_n = -1;
+                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                const DataType *query =
+                                    static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * dim;
+
+                                SizeT result_n1 = 0;
+                                UniquePtr<f32[]> d_ptr = nullptr;
+                                UniquePtr<SegmentOffset[]> l_ptr = nullptr;
+                                if (use_bitmask) {
+                                    if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                        DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, search_ef, filter, with_lock);
+                                    } else {
+                                        BitmaskFilter<SegmentOffset> filter(bitmask);
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, search_ef, filter, with_lock);
+                                    }
+                                } else {
+                                    if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                        DeleteFilter filter(segment_entry, begin_ts);
+                                        std::tie(result_n1, d_ptr, l_ptr) =
+                                            abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, search_ef, filter, with_lock);
+                                    } else {
+                                        if (!with_lock) {
+                                            std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, search_ef, false);
+                                        } else {
+                                            AppendFilter filter(block_index->GetSegmentOffset(segment_id));
+                                            std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, search_ef, filter, true);
+                                        }
+                                    }
                                 }
-                                case KnnDistanceType::kCosine:
-                                case KnnDistanceType::kInnerProduct: {
-                                    for (i64 i = 0; i < result_n; ++i) {
-                                        d_ptr[i] = -d_ptr[i];
+
+                                if (result_n < 0) {
+                                    result_n = result_n1;
+                                } else if (result_n != (i64)result_n1) {
+                                    UnrecoverableError("KnnScan: result_n mismatch");
+                                }
+
+                                switch (knn_scan_shared_data->knn_distance_type_) {
+                                    case KnnDistanceType::kInvalid: {
+                                        UnrecoverableError("Invalid distance type");
+                                    }
+                                    case KnnDistanceType::kL2:
+                                    case KnnDistanceType::kHamming: {
+                                        break;
+                                    }
+                                    case KnnDistanceType::kCosine:
+                                    case KnnDistanceType::kInnerProduct: {
+                                        for (i64 i = 0; i < result_n; ++i) {
+                                            d_ptr[i] = -d_ptr[i];
+                                        }
+                                        break;
                                     }
-                                    break;
                                 }
+
+                                auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_n);
+                                for (i64 i = 0; i < result_n; ++i) {
+                                    row_ids[i] = RowID{segment_id, l_ptr[i]};
+                                }
+                                merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
                             }
+                        };
 
-                            auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_n);
-                            for (i64 i = 0; i < result_n; ++i) {
-                                row_ids[i] = RowID{segment_id, l_ptr[i]};
+                        auto [chunk_index_entries, memory_index_entry] = segment_index_entry->GetHnswIndexSnapshot();
+                        for (auto &chunk_index_entry : chunk_index_entries) {
+                            if (chunk_index_entry->CheckVisible(begin_ts)) {
+                                BufferHandle index_handle = chunk_index_entry->GetIndex();
+                                hnsw_search(index_handle, false);
                             }
-                            merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
                         }
-                    };
-
-                    auto [chunk_index_entries, memory_index_entry] = segment_index_entry->GetHnswIndexSnapshot();
-                    for (auto &chunk_index_entry : chunk_index_entries) {
-                        if (chunk_index_entry->CheckVisible(begin_ts)) {
-                            BufferHandle index_handle = chunk_index_entry->GetIndex();
-                            hnsw_search(index_handle, false);
+                        if (memory_index_entry.get() != nullptr) {
+                            BufferHandle index_handle = memory_index_entry->GetIndex();
+                            hnsw_search(index_handle, true);
                         }
+
+                        break;
                     }
-                    if (memory_index_entry.get() != nullptr) {
-                        BufferHandle index_handle = memory_index_entry->GetIndex();
-                        hnsw_search(index_handle, true);
+                    default: {
+                        RecoverableError(Status::NotSupport("Not implemented"));
                     }
-
-                    break;
-                }
-                default: {
-                    RecoverableError(Status::NotSupport("Not implemented"));
                 }
             }
+
+            strategy_profiler.End();
+            query_context->RecordStrategy(strategy_profiler.name(), strategy_profiler.Elapsed());
         }
     }
     if (knn_scan_shared_data->current_index_idx_ >= index_task_n && knn_scan_shared_data->current_block_idx_ >= brute_task_n) {
@@ -526,7 +732,7 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         SizeT output_block_idx = 0;
         DataBlock *output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-            DataType *result_dists = merge_heap->GetDistancesByIdx(query_idx);
+            f32 *result_dists = merge_heap->GetDistancesByIdx(query_idx);
             RowID *row_ids = merge_heap->GetIDsByIdx(query_idx);
 
             for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
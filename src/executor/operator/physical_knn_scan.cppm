@@ -74,6 +74,8 @@ public:
 
     void PlanWithIndex(QueryContext *query_context);
 
+    f32 BruteForceSelectivity() const;
+
     inline SizeT TaskCount() const { return block_column_entries_->size() + index_entries_->size(); }
 
     SizeT TaskletCount() override { return block_column_entries_->size() + index_entries_->size(); }
@@ -148,7 +148,12 @@ PhysicalLimit::PhysicalLimit(u64 id,
         offset = (static_pointer_cast<ValueExpression>(offset_expr_))->GetValue().value_.big_int;
     }
 
-    counter_ = MakeUnique<UnSyncCounter>(offset, limit);
+    if (left_->TaskletCount() > 1) {
+        // the tasks of the fragment share the counter
+        counter_ = MakeShared<AtomicCounter>(offset, limit);
+    } else {
+        counter_ = MakeShared<UnSyncCounter>(offset, limit);
+    }
 }
 
 void PhysicalLimit::Init() {}
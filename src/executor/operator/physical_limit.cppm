@@ -110,11 +110,14 @@ public:
 
     [[nodiscard]] inline const SharedPtr<BaseExpression> &offset_expr() const { return offset_expr_; }
 
+    // shared with the scans below, which stop once the limit is reached
+    [[nodiscard]] inline const SharedPtr<LimitCounter> &counter() const { return counter_; }
+
 private:
     SharedPtr<BaseExpression> limit_expr_{};
     SharedPtr<BaseExpression> offset_expr_{};
 
-    UniquePtr<LimitCounter> counter_{};
+    SharedPtr<LimitCounter> counter_{};
 };
 
 } // namespace infinity
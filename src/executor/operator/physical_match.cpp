@@ -494,7 +494,7 @@ void ASSERT_FLOAT_EQ(float bar, u32 i, float a, float b) {
 }
 
 void AnalyzeFunc(const String &analyzer_name, String &&text, TermList &output_terms) {
-    UniquePtr<Analyzer> analyzer = AnalyzerPool::instance().Get(analyzer_name);
+    PooledAnalyzer analyzer = AnalyzerPool::instance().Get(analyzer_name);
     // (dynamic_cast<CommonLanguageAnalyzer*>(analyzer.get()))->SetExtractEngStem(false);
     if (analyzer.get() == nullptr) {
         RecoverableError(Status::UnexpectedError(fmt::format("Invalid analyzer: {}", analyzer_name)));
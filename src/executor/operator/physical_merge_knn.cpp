@@ -58,7 +58,11 @@ bool PhysicalMergeKnn::Execute(QueryContext *query_context, OperatorState *opera
         case kElemInvalid: {
             UnrecoverableError("Invalid elem type");
         }
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemInt8:
+        case kElemFloat16:
+        case kElemBFloat16:
+        case kElemBit: {
             switch (merge_knn_data.heap_type_) {
                 case MergeKnnHeapType::kInvalid: {
                     UnrecoverableError("Invalid heap type");
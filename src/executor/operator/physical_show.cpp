@@ -51,12 +51,14 @@ import local_file_system;
 import utility;
 import buffer_manager;
 import session_manager;
+import task_scheduler;
 import compilation_config;
 import logical_type;
 import create_index_info;
 import segment_index_entry;
 import segment_iter;
 import segment_entry;
+import term_meta_cache;
 
 namespace infinity {
 
@@ -2281,6 +2283,27 @@ void PhysicalShow::ExecuteShowConfigs(QueryContext *query_context, ShowOperatorS
         }
     }
 
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar("query_priority");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(QueryPriority2String(session_options->query_priority()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Scheduling class of the statements of this session: interactive, batch or background.");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
     output_block_ptr->Finalize();
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
@@ -2542,6 +2565,40 @@ void PhysicalShow::ExecuteShowGlobalStatus(QueryContext *query_context, ShowOper
         }
     }
 
+    {
+        auto append_status = [&](const String &name, const String &status_value) {
+            Value name_value = Value::MakeVarchar(name);
+            ValueExpression name_expr(name_value);
+            name_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            Value value = Value::MakeVarchar(status_value);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        };
+
+        TaskSchedulerMetrics metrics = query_context->scheduler()->Metrics();
+        append_status("scheduler admission limit", std::to_string(metrics.admission_limit_));
+        for (SizeT class_id = 0; class_id < QUERY_PRIORITY_COUNT; ++class_id) {
+            const PriorityClassMetrics &class_metrics = metrics.classes_[class_id];
+            String class_name = QueryPriority2String(static_cast<QueryPriority>(class_id));
+            u64 avg_wait_us = class_metrics.dispatched_task_count_ == 0 ? 0 : class_metrics.total_wait_us_ / class_metrics.dispatched_task_count_;
+            append_status(fmt::format("scheduler {} queued tasks", class_name), std::to_string(class_metrics.queued_task_count_));
+            append_status(fmt::format("scheduler {} dispatched tasks", class_name), std::to_string(class_metrics.dispatched_task_count_));
+            append_status(fmt::format("scheduler {} average task wait", class_name), fmt::format("{}us", avg_wait_us));
+            append_status(fmt::format("scheduler {} max task wait", class_name), fmt::format("{}us", class_metrics.max_wait_us_));
+            append_status(fmt::format("scheduler {} running queries", class_name), std::to_string(class_metrics.running_query_count_));
+            append_status(fmt::format("scheduler {} waiting queries", class_name), std::to_string(class_metrics.waiting_query_count_));
+            append_status(fmt::format("scheduler {} rejected queries", class_name), std::to_string(class_metrics.rejected_query_count_));
+        }
+
+        TermMetaCacheMetrics term_cache_metrics = TermMetaCache::instance().Metrics();
+        append_status("term meta cache usage",
+                      fmt::format("{}/{}", Utility::FormatByteSize(term_cache_metrics.memory_usage_), Utility::FormatByteSize(term_cache_metrics.capacity_)));
+        append_status("term meta cache entries", std::to_string(term_cache_metrics.entry_count_));
+        append_status("term meta cache hits", std::to_string(term_cache_metrics.hit_count_));
+        append_status("term meta cache misses", std::to_string(term_cache_metrics.miss_count_));
+        append_status("term meta cache hit rate", fmt::format("{:.2f}%", term_cache_metrics.HitRate() * 100));
+    }
+
     output_block_ptr->Finalize();
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
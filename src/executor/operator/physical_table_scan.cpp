@@ -42,6 +42,9 @@ import infinity_exception;
 import logical_type;
 
 import block_entry;
+import fast_rough_filter;
+import top_n_threshold;
+import physical_limit;
 
 namespace infinity {
 
@@ -137,6 +140,13 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
         table_scan_operator_state->SetComplete();
         return;
     }
+    if (limit_counter_ and limit_counter_->IsLimitOver()) {
+        // LIMIT without ORDER BY is already satisfied
+        LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}, stop after limit reached", block_ids_idx, block_ids->size()));
+        table_scan_operator_state->SetComplete();
+        output_ptr->Finalize();
+        return;
+    }
 
     TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
     SizeT &read_offset = table_scan_function_data_ptr->current_read_offset_;
@@ -151,6 +161,9 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
 
     // Here we assume output is a fresh data block, we have never written anything into it.
     auto write_capacity = output_ptr->available_capacity();
+    if (limit_row_cap_ > 0) {
+        write_capacity = std::min(write_capacity, limit_row_cap_);
+    }
     while (block_ids_idx < block_ids->size()) {
         u32 segment_id = block_ids->at(block_ids_idx).segment_id_;
         u16 block_id = block_ids->at(block_ids_idx).block_id_;
@@ -159,7 +172,8 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
         if (read_offset == 0) {
             // new block, check FastRoughFilter
             const auto &fast_rough_filter = *current_block_entry->GetFastRoughFilter();
-            if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) {
+            if ((fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) or
+                (top_n_threshold_ and !top_n_threshold_->Evaluate(begin_ts, fast_rough_filter))) {
                 // skip this block
                 LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}, skipped after apply FastRoughFilter",
                                       block_ids_idx,
@@ -31,6 +31,8 @@ import load_meta;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import top_n_threshold;
+import physical_limit;
 
 namespace infinity {
 
@@ -39,10 +41,12 @@ public:
     explicit PhysicalTableScan(u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
                                UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               SharedPtr<TopNThreshold> top_n_threshold,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = false)
         : PhysicalOperator(PhysicalOperatorType::kTableScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
-          fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)), add_row_id_(add_row_id) {}
+          fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)), top_n_threshold_(std::move(top_n_threshold)),
+          add_row_id_(add_row_id) {}
 
     ~PhysicalTableScan() override = default;
 
@@ -70,6 +74,13 @@ public:
 
     Vector<SizeT> &ColumnIDs() const;
 
+    // for LIMIT without ORDER BY: stop once the limit is reached
+    // row_cap: max rows in one output block when the limit directly consumes the scan, 0 for no cap
+    void SetLimitCounter(SharedPtr<LimitCounter> limit_counter, SizeT row_cap) {
+        limit_counter_ = std::move(limit_counter);
+        limit_row_cap_ = row_cap;
+    }
+
     bool ParallelExchange() const override { return true; }
 
     bool IsExchange() const override { return true; }
@@ -86,6 +97,11 @@ private:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
+    SharedPtr<TopNThreshold> top_n_threshold_{};
+
+    SharedPtr<LimitCounter> limit_counter_{};
+    SizeT limit_row_cap_{};
+
     bool add_row_id_;
     mutable Vector<SizeT> column_ids_;
 };
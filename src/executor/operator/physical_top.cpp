@@ -54,6 +54,8 @@ public:
         WriteToOutput(input_data_block_array, output_data_block_array);
         return size_;
     }
+    // after WriteTopResultsToOutput(): the position of the last output row
+    Pair<u32, u32> LastResult() const { return candidate_local_row_ids_[size_ - 1]; }
 
 private:
     u32 size_{};
@@ -345,6 +347,11 @@ bool PhysicalTop::Execute(QueryContext *, OperatorState *operator_state) {
     auto eval_columns = GetEvalColumns(sort_expressions_, (static_cast<TopOperatorState *>(operator_state))->expr_states_, input_data_block_array);
     TopSolver solve_top(limit_, prefer_left_function_);
     auto output_row_cnt = solve_top.WriteTopResultsToOutput(eval_columns, input_data_block_array, output_data_block_array);
+    if (top_n_threshold_ and output_row_cnt == limit_) {
+        // no row after the last one of a full result can enter the final result
+        auto [block_id, row_id] = solve_top.LastResult();
+        top_n_threshold_->Update(eval_columns[block_id][0]->GetValue(row_id));
+    }
     input_data_block_array.clear();
     HandleOutputOffset(output_row_cnt, offset_, output_data_block_array);
     if (prev_op_state->Complete()) {
@@ -35,6 +35,7 @@ import physical_limit;
 import internal_types;
 import select_statement;
 import data_type;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -72,9 +73,10 @@ public:
                          u32 offset,
                          Vector<SharedPtr<BaseExpression>> sort_expressions,
                          Vector<OrderType> order_by_types,
+                         SharedPtr<TopNThreshold> top_n_threshold,
                          SharedPtr<Vector<LoadMeta>> load_metas)
         : PhysicalOperator(PhysicalOperatorType::kTop, std::move(left), nullptr, id, load_metas), limit_(limit), offset_(offset),
-          order_by_types_(std::move(order_by_types)), sort_expressions_(std::move(sort_expressions)) {}
+          order_by_types_(std::move(order_by_types)), sort_expressions_(std::move(sort_expressions)), top_n_threshold_(std::move(top_n_threshold)) {}
 
     ~PhysicalTop() override = default;
 
@@ -122,7 +124,7 @@ private:
     Vector<OrderType> order_by_types_;                   // ASC or DESC
     Vector<SharedPtr<BaseExpression>> sort_expressions_; // expressions to sort
     CompareTwoRowAndPreferLeft prefer_left_function_;    // compare function
-    // TODO: save a common threshold value for all tasks
+    SharedPtr<TopNThreshold> top_n_threshold_;           // common threshold of all tasks, shared with the scan
 };
 
 } // namespace infinity
@@ -121,6 +121,7 @@ export struct MergeKnnOperatorState : public OperatorState {
 // Filter
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+    ConjunctionStats condition_stats_; // kept across data blocks, unlike the expression state and its scratch columns
 };
 
 // IndexScan
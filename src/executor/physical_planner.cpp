@@ -637,6 +637,30 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildSort(const SharedPtr<LogicalNo
                                     logical_operator->load_metas());
 }
 
+namespace {
+
+// let the scan below a LIMIT without ORDER BY stop once the limit is reached
+// rows_with_offset: limit + offset, caps the output blocks of a scan directly below the limit
+void PushDownLimit(PhysicalLimit *limit_op, i64 rows_with_offset) {
+    PhysicalOperator *child = limit_op->left();
+    SizeT row_cap = rows_with_offset > 0 ? rows_with_offset : 0;
+    while (child != nullptr and child->operator_type() == PhysicalOperatorType::kFilter) {
+        // filtered rows are not known before the scan
+        row_cap = 0;
+        child = child->left();
+    }
+    if (child == nullptr) {
+        return;
+    }
+    if (child->operator_type() == PhysicalOperatorType::kTableScan) {
+        static_cast<PhysicalTableScan *>(child)->SetLimitCounter(limit_op->counter(), row_cap);
+    } else if (child->operator_type() == PhysicalOperatorType::kIndexScan) {
+        static_cast<PhysicalIndexScan *>(child)->SetLimitCounter(limit_op->counter());
+    }
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalNode> &logical_operator) const {
     auto input_logical_node = logical_operator->left_node();
 
@@ -649,23 +673,25 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalN
 
     SharedPtr<LogicalLimit> logical_limit = static_pointer_cast<LogicalLimit>(logical_operator);
     UniquePtr<PhysicalOperator> input_physical_operator = BuildPhysicalOperator(input_logical_node);
+    i64 child_limit = (static_pointer_cast<ValueExpression>(logical_limit->limit_expression_))->GetValue().value_.big_int;
+    if (logical_limit->offset_expression_.get() != nullptr) {
+        child_limit += (static_pointer_cast<ValueExpression>(logical_limit->offset_expression_))->GetValue().value_.big_int;
+    }
     if (input_physical_operator->TaskletCount() <= 1) {
-        return MakeUnique<PhysicalLimit>(logical_operator->node_id(),
-                                         std::move(input_physical_operator),
-                                         logical_limit->limit_expression_,
-                                         logical_limit->offset_expression_,
-                                         logical_operator->load_metas());
+        auto limit_op = MakeUnique<PhysicalLimit>(logical_operator->node_id(),
+                                                  std::move(input_physical_operator),
+                                                  logical_limit->limit_expression_,
+                                                  logical_limit->offset_expression_,
+                                                  logical_operator->load_metas());
+        PushDownLimit(limit_op.get(), child_limit);
+        return limit_op;
     } else {
-        i64 child_limit = (static_pointer_cast<ValueExpression>(logical_limit->limit_expression_))->GetValue().value_.big_int;
-
-        if (logical_limit->offset_expression_.get() != nullptr) {
-            child_limit += (static_pointer_cast<ValueExpression>(logical_limit->offset_expression_))->GetValue().value_.big_int;
-        }
         auto child_limit_op = MakeUnique<PhysicalLimit>(logical_operator->node_id(),
                                                         std::move(input_physical_operator),
                                                         MakeShared<ValueExpression>(Value::MakeBigInt(child_limit)),
                                                         nullptr,
                                                         logical_operator->load_metas());
+        PushDownLimit(child_limit_op.get(), child_limit);
         return MakeUnique<PhysicalMergeLimit>(query_context_ptr_->GetNextNodeID(),
                                               std::move(child_limit_op),
                                               logical_limit->limit_expression_,
@@ -707,6 +733,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTop(const SharedPtr<LogicalNod
                                        merge_offset, // start from offset
                                        logical_operator_top->sort_expressions_,
                                        logical_operator_top->order_by_types_,
+                                       logical_operator_top->top_n_threshold_,
                                        logical_operator_top->load_metas());
     } else {
         // need MergeTop
@@ -716,6 +743,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTop(const SharedPtr<LogicalNod
                                                     u32{}, // start from 0
                                                     logical_operator_top->sort_expressions_,
                                                     logical_operator_top->order_by_types_,
+                                                    logical_operator_top->top_n_threshold_,
                                                     logical_operator_top->load_metas());
         return MakeUnique<PhysicalMergeTop>(query_context_ptr_->GetNextNodeID(),
                                             logical_operator_top->base_table_ref_,
@@ -795,6 +823,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
                                          std::move(logical_table_scan->fast_rough_filter_evaluator_),
+                                         logical_table_scan->top_n_threshold_,
                                          logical_operator->load_metas(),
                                          logical_table_scan->add_row_id_);
 }
@@ -807,6 +836,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<Logi
                                          std::move(logical_index_scan->column_index_map_),
                                          std::move(logical_index_scan->filter_execute_command_),
                                          std::move(logical_index_scan->fast_rough_filter_evaluator_),
+                                         std::move(logical_index_scan->scan_segment_ids_),
+                                         logical_index_scan->top_n_threshold_,
                                          logical_operator->load_metas(),
                                          logical_index_scan->add_row_id_);
 }
@@ -897,7 +928,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCommand(const SharedPtr<Logica
                                            logical_command->GetOutputNames(),
                                            logical_command->GetOutputTypes(),
                                            logical_operator->load_metas());
-    if (command_info->type() == CommandType::kCompactTable) {
+    if (command_info->type() == CommandType::kCompactTable || command_info->type() == CommandType::kAnalyzeTable) {
         ret->table_entry_ = logical_command->table_entry_;
     }
     return ret;
@@ -33,6 +33,7 @@ import internal_types;
 import embedding_info;
 import knn_expr;
 import data_type;
+import bitmask;
 
 namespace infinity {
 
@@ -42,6 +43,9 @@ struct EmbeddingTryCastToVarlen;
 template <typename SourceElemType>
 BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target);
 
+template <typename SourceElemType>
+bool TryCastColumnVectorToBitEmbedding(const SharedPtr<ColumnVector> &source, SharedPtr<ColumnVector> &target, SizeT count, CastParameters &);
+
 export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const DataType &target) {
     if (source.type() == LogicalType::kEmbedding && target.type() == LogicalType::kVarchar) {
         return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorToVarlenWithType<EmbeddingT, VarcharT, EmbeddingTryCastToVarlen>);
@@ -74,6 +78,12 @@ export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const Data
         case EmbeddingDataType::kElemDouble: {
             return BindEmbeddingCast<DoubleT>(target_info);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BindEmbeddingCast<Float16T>(target_info);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BindEmbeddingCast<BFloat16T>(target_info);
+        }
         default: {
             UnrecoverableError(fmt::format("Can't cast from {} to Embedding type", target.ToString()));
         }
@@ -84,6 +94,13 @@ export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const Data
 template <typename SourceElemType>
 inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
     switch (target->Type()) {
+        case EmbeddingDataType::kElemBit: {
+            if constexpr (std::is_integral_v<SourceElemType>) {
+                return BoundCastFunc(&TryCastColumnVectorToBitEmbedding<SourceElemType>);
+            }
+            RecoverableError(Status::NotSupport("Only integer embedding can be cast to bit embedding"));
+            break;
+        }
         case EmbeddingDataType::kElemInt8: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, TinyIntT, EmbeddingTryCastToFixlen>);
         }
@@ -102,6 +119,12 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
         case EmbeddingDataType::kElemDouble: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, DoubleT, EmbeddingTryCastToFixlen>);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, Float16T, EmbeddingTryCastToFixlen>);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, BFloat16T, EmbeddingTryCastToFixlen>);
+        }
         default: {
             UnrecoverableError(fmt::format("Can't cast from Embedding type to {}", target->ToString()));
         }
@@ -112,7 +135,26 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
 struct EmbeddingTryCastToFixlen {
     template <typename SourceElemType, typename TargetElemType>
     static inline bool Run(const SourceElemType *source, TargetElemType *target, SizeT len) {
-        if constexpr (std::is_same<SourceElemType, TinyIntT>() || std::is_same<SourceElemType, SmallIntT>() ||
+        constexpr bool source_is_half = std::is_same<SourceElemType, Float16T>() || std::is_same<SourceElemType, BFloat16T>();
+        constexpr bool target_is_half = std::is_same<TargetElemType, Float16T>() || std::is_same<TargetElemType, BFloat16T>();
+        if constexpr (target_is_half) {
+            // Narrow through float, values out of the half range become inf
+            for (SizeT i = 0; i < len; ++i) {
+                target[i] = TargetElemType(static_cast<FloatT>(source[i]));
+            }
+            return true;
+        } else if constexpr (source_is_half) {
+            // Widen to float first
+            for (SizeT i = 0; i < len; ++i) {
+                const FloatT value = static_cast<FloatT>(source[i]);
+                if constexpr (std::is_same<TargetElemType, FloatT>() || std::is_same<TargetElemType, DoubleT>()) {
+                    target[i] = value;
+                } else if (!FloatTryCastToFixlen::Run(value, target[i])) {
+                    return false;
+                }
+            }
+            return true;
+        } else if constexpr (std::is_same<SourceElemType, TinyIntT>() || std::is_same<SourceElemType, SmallIntT>() ||
                       std::is_same<SourceElemType, IntegerT>() || std::is_same<SourceElemType, BigIntT>()) {
             for (SizeT i = 0; i < len; ++i) {
                 if (!IntegerTryCastToFixlen::Run(source[i], target[i])) {
@@ -133,6 +175,54 @@ struct EmbeddingTryCastToFixlen {
     }
 };
 
+// Integer embeddings of 0 and 1 are packed into bit embeddings, the first element is the most significant bit of the first byte.
+// Rows with other values fail to convert.
+template <typename SourceElemType>
+bool TryCastColumnVectorToBitEmbedding(const SharedPtr<ColumnVector> &source, SharedPtr<ColumnVector> &target, SizeT count, CastParameters &) {
+    const auto *source_info = static_cast<const EmbeddingInfo *>(source->data_type()->type_info().get());
+    const SizeT dim = source_info->Dimension();
+    const SizeT target_size = target->data_type()->Size();
+    switch (source->vector_type()) {
+        case ColumnVectorType::kFlat: {
+            break;
+        }
+        case ColumnVectorType::kConstant: {
+            if (count != 1) {
+                UnrecoverableError("Attempting to execute more than one row of the constant column vector.");
+            }
+            break;
+        }
+        default: {
+            UnrecoverableError("Only flat or constant embedding can be cast to bit embedding.");
+        }
+    }
+
+    bool all_converted = true;
+    const auto *input_ptr = reinterpret_cast<const SourceElemType *>(source->data());
+    auto *result_ptr = reinterpret_cast<u8 *>(target->data());
+    Bitmask *result_null = target->nulls_ptr_.get();
+    result_null->DeepCopy(*source->nulls_ptr_);
+    for (SizeT row = 0; row < count; ++row) {
+        if (!result_null->IsTrue(row)) {
+            continue;
+        }
+        const SourceElemType *input = input_ptr + row * dim;
+        u8 *result = result_ptr + row * target_size;
+        std::fill_n(result, target_size, 0);
+        for (SizeT i = 0; i < dim; ++i) {
+            if (input[i] == 1) {
+                result[i / 8] |= static_cast<u8>(1u << (7 - i % 8));
+            } else if (input[i] != 0) {
+                result_null->SetFalse(row);
+                all_converted = false;
+                break;
+            }
+        }
+    }
+    target->Finalize(count);
+    return all_converted;
+}
+
 struct EmbeddingTryCastToVarlen {
     template <typename SourceType, typename TargetType>
     static inline bool Run(const SourceType &, const DataType &, TargetType &, const DataType &, ColumnVector *) {
@@ -24,6 +24,7 @@ import catalog;
 import status;
 import infinity_exception;
 import scalar_function;
+import simd_compare;
 import scalar_function_set;
 
 import third_party;
@@ -57,6 +58,8 @@ inline void BooleanEqualsFunction::Run<bool, bool, bool>(bool left, bool right,
 }
 
 struct PODTypeEqualsFunction {
+    static constexpr SIMDCompareType simd_compare_type = SIMDCompareType::kEqual;
+
     template <typename TA, typename TB, typename TC>
     static inline void Run(TA left, TB right, TC &result) {
         result.SetValue(left == right);
@@ -23,6 +23,7 @@ import catalog;
 import status;
 import infinity_exception;
 import scalar_function;
+import simd_compare;
 import scalar_function_set;
 
 import third_party;
@@ -40,6 +41,8 @@ struct GreaterFunction {
 };
 
 struct PODTypeGreaterFunction {
+    static constexpr SIMDCompareType simd_compare_type = SIMDCompareType::kGreater;
+
     template <typename TA, typename TB, typename TC>
     static inline void Run(TA left, TB right, TC &result) {
         result.SetValue(left > right);
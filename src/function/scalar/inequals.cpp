@@ -25,6 +25,7 @@ import catalog;
 import status;
 import infinity_exception;
 import scalar_function;
+import simd_compare;
 import scalar_function_set;
 
 import third_party;
@@ -59,6 +60,8 @@ inline void BooleanInEqualsFunction::Run<bool, bool, bool>(bool left, bool right
 }
 
 struct PODTypeInEqualsFunction {
+    static constexpr SIMDCompareType simd_compare_type = SIMDCompareType::kNotEqual;
+
     template <typename TA, typename TB, typename TC>
     static inline void Run(TA left, TB right, TC &result) {
         result.SetValue(left != right);
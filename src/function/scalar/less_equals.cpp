@@ -23,6 +23,7 @@ import catalog;
 import logical_type;
 import infinity_exception;
 import scalar_function;
+import simd_compare;
 import scalar_function_set;
 
 import third_party;
@@ -39,6 +40,8 @@ struct LessEqualsFunction {
 };
 
 struct PODTypeLessEqualsFunction {
+    static constexpr SIMDCompareType simd_compare_type = SIMDCompareType::kLessEqual;
+
     template <typename TA, typename TB, typename TC>
     static inline void Run(TA left, TB right, TC &result) {
         result.SetValue(left <= right);
@@ -22,6 +22,13 @@ import logical_type;
 import infinity_exception;
 import scalar_function;
 import scalar_function_set;
+import function_data;
+import like_matcher;
+import column_vector;
+import vector_buffer;
+import fix_heap;
+import data_block;
+import bitmask;
 
 import third_party;
 import internal_types;
@@ -29,114 +36,116 @@ import data_type;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
-            }
-
-            // % is the last character
-            if (right_idx == right_len) {
-                return true;
-            }
-
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
-            }
-
-            // Not matched
-            return false;
-        } else {
-            return false;
+// The matcher compiled from the pattern, kept in the expression state. The pattern is a constant in almost all queries.
+class LikeFunctionData final : public FunctionData {
+public:
+    const LikeMatcher &GetMatcher(const char *pattern, SizeT pattern_len, bool case_insensitive) {
+        std::string_view pattern_view(pattern, pattern_len);
+        if (matcher_.get() == nullptr || matcher_->pattern() != pattern_view) {
+            matcher_ = MakeUnique<LikeMatcher>(pattern_view, case_insensitive);
         }
+        return *matcher_;
     }
 
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
-    }
-
-    return left_idx == left_len && right_idx == right_len;
-}
-
-struct LikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: LikeFunction");
-    }
+private:
+    UniquePtr<LikeMatcher> matcher_{};
 };
 
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar like varchar");
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
+inline const char *VarcharData(FixHeapManager *heap_mgr, const VarcharT &varchar, Vector<char> &buffer) {
+    if (varchar.IsInlined()) {
+        return varchar.short_.data_;
+    }
+    return heap_mgr->GetVarcharData(varchar, buffer);
 }
 
-struct NotLikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: not like function");
+// Column at a time: the result bits of 64 rows are collected in one word.
+template <bool negate, bool case_insensitive>
+void LikeFunction(const DataBlock &input, SharedPtr<ColumnVector> &output, SharedPtr<FunctionData> &function_data) {
+    if (input.column_count() != 2) {
+        UnrecoverableError("Like function: input column count isn't two.");
+    }
+    if (!input.Finalized()) {
+        UnrecoverableError("Input data block is finalized");
+    }
+    if (function_data.get() == nullptr) {
+        function_data = MakeShared<LikeFunctionData>();
+    }
+    auto &like_data = static_cast<LikeFunctionData &>(*function_data);
+
+    const SharedPtr<ColumnVector> &str_column = input.column_vectors[0];
+    const SharedPtr<ColumnVector> &pattern_column = input.column_vectors[1];
+    bool str_constant = str_column->vector_type() == ColumnVectorType::kConstant;
+    bool pattern_constant = pattern_column->vector_type() == ColumnVectorType::kConstant;
+    SizeT count = (str_constant && pattern_constant) ? 1 : input.row_count();
+
+    // null if the string or the pattern is null
+    const SharedPtr<Bitmask> &str_null = str_column->nulls_ptr_;
+    const SharedPtr<Bitmask> &pattern_null = pattern_column->nulls_ptr_;
+    SharedPtr<Bitmask> &result_null = output->nulls_ptr_;
+    if ((str_constant && !(str_null->IsAllTrue())) || (pattern_constant && !(pattern_null->IsAllTrue()))) {
+        result_null->SetAllFalse();
+        output->Finalize(count);
+        return;
+    }
+    if (str_constant) {
+        result_null->DeepCopy(*pattern_null);
+    } else {
+        result_null->DeepCopy(*str_null);
+        if (!pattern_constant && !(pattern_null->IsAllTrue())) {
+            result_null->Merge(*pattern_null);
+        }
+    }
+    bool has_null = !(result_null->IsAllTrue());
+
+    const auto *strs = reinterpret_cast<const VarcharT *>(str_column->data());
+    const auto *patterns = reinterpret_cast<const VarcharT *>(pattern_column->data());
+    FixHeapManager *str_heap_mgr = str_column->buffer_->fix_heap_mgr_.get();
+    FixHeapManager *pattern_heap_mgr = pattern_column->buffer_->fix_heap_mgr_.get();
+    Vector<char> str_buffer, pattern_buffer;
+    const LikeMatcher *matcher = nullptr;
+    if (pattern_constant) {
+        matcher = &like_data.GetMatcher(VarcharData(pattern_heap_mgr, patterns[0], pattern_buffer), patterns[0].length_, case_insensitive);
     }
-};
-
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar not like varchar");
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
 
-//    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
+    auto *result_bits = reinterpret_cast<u8 *>(output->data());
+    u64 word = 0;
+    for (SizeT i = 0; i < count; ++i) {
+        if (!has_null || result_null->IsTrue(i)) {
+            const VarcharT &str = strs[str_constant ? 0 : i];
+            if (!pattern_constant) {
+                const VarcharT &pattern = patterns[i];
+                matcher = &like_data.GetMatcher(VarcharData(pattern_heap_mgr, pattern, pattern_buffer), pattern.length_, case_insensitive);
+            }
+            bool matched = matcher->Match(VarcharData(str_heap_mgr, str, str_buffer), str.length_);
+            word |= u64(matched != negate) << (i % 64);
+        }
+        if (i % 64 == 63 || i + 1 == count) {
+            SizeT word_rows = i % 64 + 1;
+            std::memcpy(result_bits + (i / 64) * 8, &word, (word_rows + 7) / 8);
+            word = 0;
+        }
+    }
+    output->Finalize(count);
 }
 
-void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
-    String func_name = "like";
-
+static void RegisterLikeFunctionSet(const UniquePtr<Catalog> &catalog_ptr, const String &func_name, ScalarFunctionWithDataType function) {
     SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
 
     ScalarFunction varchar_like_function(func_name,
                                          {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                          DataType(kBoolean),
-                                         &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, LikeFunction>);
+                                         std::move(function));
     function_set_ptr->AddFunction(varchar_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
 }
 
-void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
-    String func_name = "not_like";
+void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "like", &LikeFunction<false, false>); }
 
-    SharedPtr<ScalarFunctionSet> function_set_ptr = MakeShared<ScalarFunctionSet>(func_name);
+void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "not_like", &LikeFunction<true, false>); }
 
-    ScalarFunction varchar_not_like_function(func_name,
-                                             {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
-                                             DataType(kBoolean),
-                                             &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, NotLikeFunction>);
-    function_set_ptr->AddFunction(varchar_not_like_function);
+void RegisterILikeFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "ilike", &LikeFunction<false, true>); }
 
-    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
-}
+void RegisterNotILikeFunction(const UniquePtr<Catalog> &catalog_ptr) { RegisterLikeFunctionSet(catalog_ptr, "not_ilike", &LikeFunction<true, true>); }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -26,4 +26,8 @@ export void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr);
 
 export void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr);
 
+export void RegisterILikeFunction(const UniquePtr<Catalog> &catalog_ptr);
+
+export void RegisterNotILikeFunction(const UniquePtr<Catalog> &catalog_ptr);
+
 } // namespace infinity
@@ -0,0 +1,200 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+module like_matcher;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+constexpr i16 ANY_CHAR = -1;
+constexpr i16 ANY_SEQUENCE = -2;
+constexpr char LIKE_ESCAPE = '\\';
+
+// ILIKE folds ASCII letters only, bytes of multi-byte UTF-8 characters are compared as is.
+inline char FoldCase(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+// Length of the UTF-8 character starting with lead byte c, continuation or invalid bytes count as one.
+// A truncated character at the end of the string is cut at the string end by the callers.
+inline SizeT UTF8CharLength(char c) {
+    auto b = static_cast<u8>(c);
+    if (b < 0xC0) {
+        return 1;
+    } else if (b < 0xE0) {
+        return 2;
+    } else if (b < 0xF0) {
+        return 3;
+    }
+    return 4;
+}
+
+} // namespace
+
+SizeT LikeFindSubstring(const char *haystack, SizeT haystack_len, const char *needle, SizeT needle_len) {
+    if (needle_len == 0) {
+        return 0;
+    }
+    if (needle_len > haystack_len) {
+        return String::npos;
+    }
+    if (needle_len == 1) {
+        const void *pos = std::memchr(haystack, needle[0], haystack_len);
+        return pos == nullptr ? String::npos : static_cast<const char *>(pos) - haystack;
+    }
+    SizeT i = 0;
+#if defined(__AVX2__)
+    // Compare the first and the last needle byte against 32 candidate positions at once, then verify the middle.
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+    for (; i + needle_len - 1 + 32 <= haystack_len; i += 32) {
+        const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i));
+        const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + i + needle_len - 1));
+        u32 mask = static_cast<u32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))));
+        while (mask != 0) {
+            SizeT bit = std::countr_zero(mask);
+            if (std::memcmp(haystack + i + bit + 1, needle + 1, needle_len - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    SizeT pos = std::string_view(haystack + i, haystack_len - i).find(std::string_view(needle, needle_len));
+    return pos == String::npos ? String::npos : i + pos;
+}
+
+LikeMatcher::LikeMatcher(std::string_view pattern, bool case_insensitive) : pattern_(pattern), case_insensitive_(case_insensitive) {
+    // resolve escapes and fold the case of the literals
+    tokens_.reserve(pattern.size());
+    for (SizeT i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == LIKE_ESCAPE && i + 1 < pattern.size()) {
+            c = pattern[++i];
+        } else if (c == '%') {
+            // consecutive '%' are the same as one
+            if (tokens_.empty() || tokens_.back() != ANY_SEQUENCE) {
+                tokens_.push_back(ANY_SEQUENCE);
+            }
+            continue;
+        } else if (c == '_') {
+            tokens_.push_back(ANY_CHAR);
+            continue;
+        }
+        tokens_.push_back(static_cast<u8>(case_insensitive_ ? FoldCase(c) : c));
+    }
+
+    auto is_literal = [](i16 token) { return token >= 0; };
+    bool has_any_char = std::find(tokens_.begin(), tokens_.end(), ANY_CHAR) != tokens_.end();
+    SizeT sequence_count = std::count(tokens_.begin(), tokens_.end(), ANY_SEQUENCE);
+    bool starts_with_sequence = !tokens_.empty() && tokens_.front() == ANY_SEQUENCE;
+    bool ends_with_sequence = !tokens_.empty() && tokens_.back() == ANY_SEQUENCE;
+    if (!has_any_char) {
+        if (sequence_count == 0) {
+            type_ = LikeMatcherType::kExact;
+        } else if (sequence_count == 1 && ends_with_sequence) {
+            type_ = LikeMatcherType::kPrefix;
+        } else if (sequence_count == 1 && starts_with_sequence) {
+            type_ = LikeMatcherType::kSuffix;
+        } else if (sequence_count == 2 && starts_with_sequence && ends_with_sequence) {
+            type_ = LikeMatcherType::kContains;
+        }
+    }
+    if (type_ != LikeMatcherType::kGeneral) {
+        for (i16 token : tokens_) {
+            if (is_literal(token)) {
+                literal_.push_back(static_cast<char>(token));
+            }
+        }
+    }
+    if (!case_insensitive_) {
+        for (i16 token : tokens_) {
+            if (!is_literal(token)) {
+                break;
+            }
+            literal_prefix_.push_back(static_cast<char>(token));
+        }
+    }
+}
+
+bool LikeMatcher::Match(const char *data, SizeT len) const {
+    if (case_insensitive_) {
+        folded_.resize(len);
+        for (SizeT i = 0; i < len; ++i) {
+            folded_[i] = FoldCase(data[i]);
+        }
+        data = folded_.data();
+    }
+    switch (type_) {
+        case LikeMatcherType::kExact: {
+            return len == literal_.size() && std::memcmp(data, literal_.data(), len) == 0;
+        }
+        case LikeMatcherType::kPrefix: {
+            return len >= literal_.size() && std::memcmp(data, literal_.data(), literal_.size()) == 0;
+        }
+        case LikeMatcherType::kSuffix: {
+            return len >= literal_.size() && std::memcmp(data + len - literal_.size(), literal_.data(), literal_.size()) == 0;
+        }
+        case LikeMatcherType::kContains: {
+            return LikeFindSubstring(data, len, literal_.data(), literal_.size()) != String::npos;
+        }
+        case LikeMatcherType::kGeneral: {
+            return MatchGeneral(data, len);
+        }
+    }
+    return false;
+}
+
+// Glob automaton with one backtrack point: on a mismatch, the last '%' absorbs one more character.
+bool LikeMatcher::MatchGeneral(const char *data, SizeT len) const {
+    SizeT token_count = tokens_.size();
+    SizeT t = 0, s = 0;
+    SizeT sequence_token = String::npos, sequence_start = 0;
+    while (s < len) {
+        if (t < token_count && tokens_[t] == ANY_CHAR) {
+            ++t;
+            s = std::min(s + UTF8CharLength(data[s]), len);
+        } else if (t < token_count && tokens_[t] >= 0 && static_cast<u8>(data[s]) == tokens_[t]) {
+            ++t;
+            ++s;
+        } else if (t < token_count && tokens_[t] == ANY_SEQUENCE) {
+            sequence_token = t++;
+            sequence_start = s;
+        } else if (sequence_token != String::npos) {
+            t = sequence_token + 1;
+            sequence_start = std::min(sequence_start + UTF8CharLength(data[sequence_start]), len);
+            s = sequence_start;
+        } else {
+            return false;
+        }
+    }
+    while (t < token_count && tokens_[t] == ANY_SEQUENCE) {
+        ++t;
+    }
+    return t == token_count && s == len;
+}
+
+} // namespace infinity
@@ -0,0 +1,64 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module like_matcher;
+
+import stl;
+
+namespace infinity {
+
+// '%' matches any sequence, '_' matches one UTF-8 character and '\' escapes the next pattern character.
+export enum class LikeMatcherType : u8 {
+    kExact,    // abc
+    kPrefix,   // abc%
+    kSuffix,   // %abc
+    kContains, // %abc%
+    kGeneral,  // anything else, matched by the glob automaton
+};
+
+// A LIKE pattern compiled once and matched against many strings.
+export class LikeMatcher {
+public:
+    explicit LikeMatcher(std::string_view pattern, bool case_insensitive = false);
+
+    [[nodiscard]] bool Match(const char *data, SizeT len) const;
+
+    [[nodiscard]] LikeMatcherType type() const { return type_; }
+
+    [[nodiscard]] const String &pattern() const { return pattern_; }
+
+    // The literal bytes every matched string starts with (empty for ILIKE). Used to turn LIKE into a range scan.
+    [[nodiscard]] const String &literal_prefix() const { return literal_prefix_; }
+
+private:
+    [[nodiscard]] bool MatchGeneral(const char *data, SizeT len) const;
+
+    String pattern_;
+    bool case_insensitive_{false};
+    LikeMatcherType type_{LikeMatcherType::kGeneral};
+    // literal of the exact, prefix, suffix and contains matchers, lower case for ILIKE
+    String literal_;
+    String literal_prefix_;
+    // glob automaton input: byte value, or ANY_CHAR / ANY_SEQUENCE
+    Vector<i16> tokens_;
+    // ILIKE folds the input into this buffer before matching
+    mutable String folded_;
+};
+
+// Position of the first occurrence of needle in haystack, or String::npos.
+export SizeT LikeFindSubstring(const char *haystack, SizeT haystack_len, const char *needle, SizeT needle_len);
+
+} // namespace infinity
@@ -19,6 +19,7 @@ module scalar_function;
 
 import stl;
 import function;
+import function_data;
 
 import status;
 import infinity_exception;
@@ -33,6 +34,15 @@ ScalarFunction::ScalarFunction(String name, Vector<DataType> argument_types, Dat
     : Function(std::move(name), FunctionType::kScalar), parameter_types_(std::move(argument_types)), return_type_(std::move(return_type)),
       function_(std::move(function)) {}
 
+ScalarFunction::ScalarFunction(String name, Vector<DataType> argument_types, DataType return_type, ScalarFunctionWithDataType function)
+    : Function(std::move(name), FunctionType::kScalar), parameter_types_(std::move(argument_types)), return_type_(std::move(return_type)),
+      function_with_data_(std::move(function)) {
+    function_ = [function_with_data = function_with_data_](const DataBlock &input, SharedPtr<ColumnVector> &output) {
+        SharedPtr<FunctionData> function_data;
+        function_with_data(input, output, function_data);
+    };
+}
+
 void ScalarFunction::CastArgumentTypes(Vector<BaseExpression> &input_arguments) {
     // Check and add a cast function to cast the input arguments expression type to target type
     auto arguments_count = input_arguments.size();
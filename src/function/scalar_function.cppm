@@ -186,10 +186,15 @@ struct TernaryTryOpToVarlenWrapper {
 
 using ScalarFunctionType = std::function<void(const DataBlock &, SharedPtr<ColumnVector> &)>;
 
+// Keeps its FunctionData in the expression state across the data blocks, e.g. a compiled pattern.
+export using ScalarFunctionWithDataType = std::function<void(const DataBlock &, SharedPtr<ColumnVector> &, SharedPtr<FunctionData> &)>;
+
 export class ScalarFunction final : public Function {
 public:
     explicit ScalarFunction(String name, Vector<DataType> argument_types, DataType return_type, ScalarFunctionType function);
 
+    explicit ScalarFunction(String name, Vector<DataType> argument_types, DataType return_type, ScalarFunctionWithDataType function);
+
     void CastArgumentTypes(Vector<BaseExpression> &input_arguments);
 
     [[nodiscard]] const DataType &return_type() const { return return_type_; }
@@ -202,6 +207,9 @@ public:
 
     ScalarFunctionType function_{};
 
+    // set only for functions with data, function_ then runs it with data local to the call
+    ScalarFunctionWithDataType function_with_data_{};
+
 public:
     // Unary function
     static void NoOpFunction(const DataBlock &input, SharedPtr<ColumnVector> &output);
@@ -41,9 +41,35 @@ import expression_state;
 import internal_types;
 import data_type;
 import status;
+import hnsw_simd_func;
 
 namespace infinity {
 
+String KnnFilterStrategyToString(KnnFilterStrategy strategy) {
+    switch (strategy) {
+        case KnnFilterStrategy::kIndex: {
+            return "index";
+        }
+        case KnnFilterStrategy::kWidenedIndex: {
+            return "widened index";
+        }
+        case KnnFilterStrategy::kBruteForce: {
+            return "brute force";
+        }
+    }
+    return {};
+}
+
+f32 ParseBruteForceSelectivity(const String &value) {
+    char *end = nullptr;
+    const f32 selectivity = std::strtof(value.c_str(), &end);
+    // nan fails both comparisons
+    if (value.empty() or end != value.c_str() + value.size() or !(selectivity >= 0.0f and selectivity <= 1.0f)) {
+        RecoverableError(Status::InvalidParameterValue("brute_force_selectivity", value, "a number in [0, 1]"));
+    }
+    return selectivity;
+}
+
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
@@ -61,6 +87,81 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     }
 }
 
+namespace {
+
+f32 I8L2Distance(const i8 *x, const i8 *y, SizeT dim) { return static_cast<f32>(I8L2(x, y, dim)); }
+
+f32 I8IPDistance(const i8 *x, const i8 *y, SizeT dim) { return static_cast<f32>(I8IP(x, y, dim)); }
+
+f32 BitHammingDistance(const u8 *x, const u8 *y, SizeT dim) { return static_cast<f32>(BitHamming(x, y, dim)); }
+
+} // namespace
+
+template <>
+KnnDistance1<i8>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = I8L2Distance;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = I8IPDistance;
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support for int8 embedding.", (i32)dist_type)));
+        }
+    }
+}
+
+// half precision kernels widen to f32 in registers
+template <>
+KnnDistance1<Float16T>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = F16L2;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = F16IP;
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support for float16 embedding.", (i32)dist_type)));
+        }
+    }
+}
+
+template <>
+KnnDistance1<BFloat16T>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = BF16L2;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = BF16IP;
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support for bfloat16 embedding.", (i32)dist_type)));
+        }
+    }
+}
+
+template <>
+KnnDistance1<u8>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kHamming: {
+            dist_func_ = BitHammingDistance;
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support for bit embedding.", (i32)dist_type)));
+        }
+    }
+}
+
 // --------------------------------------------
 
 KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 current_parallel_idx)
@@ -70,6 +171,22 @@ KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 cur
             Init<f32>();
             break;
         }
+        case EmbeddingDataType::kElemInt8: {
+            Init<i8>();
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            Init<Float16T>();
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            Init<BFloat16T>();
+            break;
+        }
+        case EmbeddingDataType::kElemBit: {
+            Init<u8>();
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport(
                 fmt::format("EmbeddingDataType: {} is not support.", EmbeddingType::EmbeddingDataType2String(knn_scan_shared_data_->elem_type_))));
@@ -85,14 +202,14 @@ void KnnScanFunctionData::Init() {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeUnique<MergeKnn<DataType, CompareMax>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+            auto merge_knn_max = MakeUnique<MergeKnn<f32, CompareMax>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
             merge_knn_max->Begin();
             merge_knn_base_ = std::move(merge_knn_max);
             break;
         }
         case KnnDistanceType::kCosine:
         case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeUnique<MergeKnn<DataType, CompareMin>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+            auto merge_knn_min = MakeUnique<MergeKnn<f32, CompareMin>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
             merge_knn_min->Begin();
             merge_knn_base_ = std::move(merge_knn_min);
             break;
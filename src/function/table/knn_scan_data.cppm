@@ -33,9 +33,23 @@ import expression_state;
 import knn_expr;
 import statement_common;
 import base_table_ref;
+import default_values;
+import internal_types;
 
 namespace infinity {
 
+// How an indexed segment is searched when a filter is present.
+export enum class KnnFilterStrategy : i8 {
+    kIndex,          // no filter or a non-selective one, search the index as is
+    kWidenedIndex,   // filtered index search with ef / n_probes widened by 1/selectivity
+    kBruteForce,     // scan the rows surviving the filter without the index
+};
+
+export String KnnFilterStrategyToString(KnnFilterStrategy strategy);
+
+// Parse the brute_force_selectivity search option, raise a recoverable error when it is not a number in [0, 1].
+export f32 ParseBruteForceSelectivity(const String &value);
+
 export class KnnScanSharedData {
 public:
     KnnScanSharedData(SharedPtr<BaseTableRef> table_ref,
@@ -50,7 +64,17 @@ public:
                       KnnDistanceType knn_distance_type)
         : table_ref_(table_ref), block_column_entries_(std::move(block_column_entries)), index_entries_(std::move(index_entries)),
           opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension), query_count_(query_embedding_count),
-          query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {
+        for (const auto &opt_param : opt_params_) {
+            if (opt_param.param_name_ == "brute_force_selectivity") {
+                brute_force_selectivity_ = ParseBruteForceSelectivity(opt_param.param_value_);
+            } else if (opt_param.param_name_ == "nprobe") {
+                ivf_nprobe_ = std::max(1, std::stoi(opt_param.param_value_));
+            } else if (opt_param.param_name_ == "rerank") {
+                ivf_rerank_factor_ = std::max(1, std::stoi(opt_param.param_value_));
+            }
+        }
+    }
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -65,6 +89,9 @@ public:
     void *const query_embedding_;
     const EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
+    f32 brute_force_selectivity_{KNN_FILTER_BRUTE_FORCE_SELECTIVITY};
+    u32 ivf_nprobe_{IVF_DEFAULT_NPROBE};
+    u32 ivf_rerank_factor_{IVF_DEFAULT_RERANK_FACTOR};
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
@@ -74,21 +101,22 @@ public:
 
 export class KnnDistanceBase1 {};
 
+// Distances are f32 for every element type, int8 and bit kernels accumulate exactly in integers.
 export template <typename DataType>
 class KnnDistance1 : public KnnDistanceBase1 {
 public:
     KnnDistance1(KnnDistanceType dist_type);
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
-        Vector<DataType> res(data_count);
+    Vector<f32> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
+        Vector<f32> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             res[i] = dist_func_(query, datas + i * dim, dim);
         }
         return res;
     }
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
-        Vector<DataType> res(data_count);
+    Vector<f32> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
+        Vector<f32> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             if (bitmask.IsTrue(i)) {
                 res[i] = dist_func_(query, datas + i * dim, dim);
@@ -98,7 +126,7 @@ public:
     }
 
 public:
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    using DistFunc = f32 (*)(const DataType *, const DataType *, SizeT);
 
     DistFunc dist_func_{};
 };
@@ -106,6 +134,19 @@ public:
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type);
 
+template <>
+KnnDistance1<i8>::KnnDistance1(KnnDistanceType dist_type);
+
+template <>
+KnnDistance1<Float16T>::KnnDistance1(KnnDistanceType dist_type);
+
+template <>
+KnnDistance1<BFloat16T>::KnnDistance1(KnnDistanceType dist_type);
+
+// packed bit embedding, dim is the byte count
+template <>
+KnnDistance1<u8>::KnnDistance1(KnnDistanceType dist_type);
+
 //-------------------------------------------------------------------
 
 export class KnnScanFunctionData final : public TableFunctionData {
@@ -37,7 +37,12 @@ MergeKnnFunctionData::MergeKnnFunctionData(i64 query_count,
         case kElemInvalid: {
             UnrecoverableError("Invalid element type");
         }
-        case kElemFloat: {
+        // int8, half precision and bit embeddings are also merged by their f32 distances
+        case kElemFloat:
+        case kElemInt8:
+        case kElemFloat16:
+        case kElemBFloat16:
+        case kElemBit: {
             MergeKnnFunctionData::InitMergeKnn<f32>(knn_distance_type);
             break;
         }
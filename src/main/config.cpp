@@ -162,11 +162,14 @@ Status Config::Init(const SharedPtr<String> &config_path) {
     u64 default_cleanup_interval_sec = DEFAULT_CLEANUP_INTERVAL_SEC;
     u64 default_compact_interval_sec = DEFAULT_COMPACT_INTERVAL_SEC;
     u64 default_optimize_interval_sec = DEFAULT_OPTIMIZE_INTERVAL_SEC;
+    u64 default_analyze_interval_sec = DEFAULT_ANALYZE_INTERVAL_SEC;
     u64 default_memindex_capacity = DEFAULT_MEMINDEX_CAPACITY;
+    u64 default_memindex_memory_quota = DEFAULT_MEMINDEX_MEMORY_QUOTA;
 
     // Default buffer config
     u64 default_buffer_pool_size = 4 * 1024lu * 1024lu * 1024lu; // 4Gib
     SharedPtr<String> default_temp_dir = MakeShared<String>("/var/infinity/tmp");
+    u64 default_term_meta_cache_size = DEFAULT_TERM_META_CACHE_SIZE;
 
     // Default wal config
     u64 default_wal_size_threshold = DEFAULT_WAL_FILE_SIZE_THRESHOLD;
@@ -242,13 +245,16 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.cleanup_interval_ = std::chrono::seconds(default_cleanup_interval_sec);
             system_option_.compact_interval_ = std::chrono::seconds(default_compact_interval_sec);
             system_option_.optimize_interval_ = std::chrono::seconds(default_optimize_interval_sec);
+            system_option_.analyze_interval_ = std::chrono::seconds(default_analyze_interval_sec);
             system_option_.memindex_capacity_ = default_memindex_capacity;
+            system_option_.memindex_memory_quota_ = default_memindex_memory_quota;
         }
 
         // Buffer
         {
             system_option_.buffer_pool_size = default_buffer_pool_size; // 4Gib
             system_option_.temp_dir = MakeShared<String>(*default_temp_dir);
+            system_option_.term_meta_cache_size_ = default_term_meta_cache_size;
         }
 
         // Wal
@@ -429,7 +435,15 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.cleanup_interval_ = std::chrono::seconds(storage_config["cleanup_interval"].value_or(default_cleanup_interval_sec));
             system_option_.compact_interval_ = std::chrono::seconds(storage_config["compact_interval"].value_or(default_compact_interval_sec));
             system_option_.optimize_interval_ = std::chrono::seconds(storage_config["optimize_interval"].value_or(default_optimize_interval_sec));
+            system_option_.analyze_interval_ = std::chrono::seconds(storage_config["analyze_interval"].value_or(default_analyze_interval_sec));
             system_option_.memindex_capacity_ = storage_config["memindex_capacity"].value_or(default_memindex_capacity);
+            system_option_.memindex_memory_quota_ = default_memindex_memory_quota;
+            if (auto memindex_memory_quota_str = storage_config["memindex_memory_quota"].value<String>(); memindex_memory_quota_str.has_value()) {
+                status = ParseByteSize(*memindex_memory_quota_str, system_option_.memindex_memory_quota_);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
         }
 
         // Buffer
@@ -442,6 +456,11 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             }
 
             system_option_.temp_dir = MakeShared<String>(buffer_config["temp_dir"].value_or("invalid"));
+            String term_meta_cache_size_str = buffer_config["term_meta_cache_size"].value_or("64MB");
+            status = ParseByteSize(term_meta_cache_size_str, system_option_.term_meta_cache_size_);
+            if (!status.ok()) {
+                return status;
+            }
         }
 
         // Wal
@@ -520,11 +539,14 @@ void Config::PrintAll() const {
     fmt::print(" - cleanup_interval_sec: {}\n", system_option_.cleanup_interval_.count());
     fmt::print(" - compact_interval_sec: {}\n", system_option_.compact_interval_.count());
     fmt::print(" - optimize_interval_sec: {}\n", system_option_.optimize_interval_.count());
+    fmt::print(" - analyze_interval_sec: {}\n", system_option_.analyze_interval_.count());
     fmt::print(" - memindex_capacity: {}\n", system_option_.memindex_capacity_);
+    fmt::print(" - memindex_memory_quota: {}\n", Utility::FormatByteSize(system_option_.memindex_memory_quota_));
 
     // Buffer
     fmt::print(" - buffer_pool_size: {}\n", Utility::FormatByteSize(system_option_.buffer_pool_size));
     fmt::print(" - temp_dir: {}\n", system_option_.temp_dir->c_str());
+    fmt::print(" - term_meta_cache_size: {}\n", Utility::FormatByteSize(system_option_.term_meta_cache_size_));
 
     // Wal
     fmt::print(" - full_checkpoint_interval_sec: {}\n", system_option_.full_checkpoint_interval_sec_);
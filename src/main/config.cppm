@@ -24,6 +24,7 @@ namespace infinity {
 
 export constexpr std::string_view profile_history_capacity_name = "profile_history_capacity";
 export constexpr std::string_view enable_profiling_name = "enable_profile";
+export constexpr std::string_view query_priority_name = "query_priority";
 export constexpr std::string_view worker_cpu_limit = "cpu_count";
 export constexpr std::string_view log_level = "log_level";
 
@@ -98,13 +99,19 @@ public:
 
     [[nodiscard]] inline std::chrono::seconds optimize_interval() const { return system_option_.optimize_interval_; }
 
+    [[nodiscard]] inline std::chrono::seconds analyze_interval() const { return system_option_.analyze_interval_; }
+
     [[nodiscard]] inline SizeT memindex_capacity() const { return system_option_.memindex_capacity_; }
 
+    [[nodiscard]] inline u64 memindex_memory_quota() const { return system_option_.memindex_memory_quota_; }
+
     // Buffer
     [[nodiscard]] inline u64 buffer_pool_size() const { return system_option_.buffer_pool_size; }
 
     [[nodiscard]] inline SharedPtr<String> temp_dir() const { return system_option_.temp_dir; }
 
+    [[nodiscard]] inline u64 term_meta_cache_size() const { return system_option_.term_meta_cache_size_; }
+
     // Wal
     [[nodiscard]] inline SharedPtr<String> wal_dir() const { return system_option_.wal_dir; }
 
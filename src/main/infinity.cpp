@@ -511,6 +511,17 @@ QueryResult Infinity::Insert(const String &db_name, const String &table_name, Ve
     return result;
 }
 
+QueryResult Infinity::InsertColumnar(const String &db_name, const String &table_name, const Vector<ColumnarInsertField> &fields) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    QueryResult result = query_context_ptr->InsertColumnar(db_name, table_name, fields);
+    return result;
+}
+
 QueryResult Infinity::Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
 
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
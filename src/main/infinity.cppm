@@ -31,6 +31,7 @@ import column_def;
 import create_index_info;
 import update_statement;
 import explain_statement;
+import query_context;
 
 namespace infinity {
 
@@ -118,6 +119,8 @@ public:
 
     QueryResult Insert(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<ParsedExpr *> *> *values);
 
+    QueryResult InsertColumnar(const String &db_name, const String &table_name, const Vector<ColumnarInsertField> &fields);
+
     QueryResult Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
     QueryResult Delete(const String &db_name, const String &table_name, ParsedExpr *filter);
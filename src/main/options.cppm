@@ -27,12 +27,50 @@ export enum class FlushOption {
     kFlushPerSecond,
 };
 
+// Scheduling class of a statement, a smaller value is served first.
+export enum class QueryPriority : u8 {
+    kInteractive,
+    kBatch,
+    kBackground,
+    kInvalid,
+};
+
+export constexpr SizeT QUERY_PRIORITY_COUNT = static_cast<SizeT>(QueryPriority::kInvalid);
+
+export inline String QueryPriority2String(QueryPriority priority) {
+    switch (priority) {
+        case QueryPriority::kInteractive:
+            return "interactive";
+        case QueryPriority::kBatch:
+            return "batch";
+        case QueryPriority::kBackground:
+            return "background";
+        default:
+            return "invalid";
+    }
+}
+
+export inline QueryPriority String2QueryPriority(const String &priority_str) {
+    if (priority_str == "interactive") {
+        return QueryPriority::kInteractive;
+    }
+    if (priority_str == "batch") {
+        return QueryPriority::kBatch;
+    }
+    if (priority_str == "background") {
+        return QueryPriority::kBackground;
+    }
+    return QueryPriority::kInvalid;
+}
+
 export struct SessionOptions {
     inline bool enable_profiling() const { return enable_profiling_; }
     inline u64 profile_history_capacity() const { return profile_history_capacity_; }
+    inline QueryPriority query_priority() const { return query_priority_; }
 
     bool enable_profiling_{false};      // enable_profile
     u64 profile_history_capacity_{128}; // profile_history_capacity
+    QueryPriority query_priority_{QueryPriority::kInteractive}; // query_priority
 };
 
 export struct SystemOptions {
@@ -78,11 +116,14 @@ export struct SystemOptions {
     std::chrono::seconds cleanup_interval_{};
     std::chrono::seconds compact_interval_{};
     std::chrono::seconds optimize_interval_{};
+    std::chrono::seconds analyze_interval_{};
     SizeT memindex_capacity_{};
+    u64 memindex_memory_quota_{};
 
     // Buffer
     u64 buffer_pool_size{};
     SharedPtr<String> temp_dir{};
+    u64 term_meta_cache_size_{};
 
     // Wal
     SharedPtr<String> wal_dir{};
@@ -83,6 +83,42 @@ String OptimizerProfiler::ToString(SizeT intent) const {
     return result;
 }
 
+void StrategyProfiler::Record(const String &strategy_name, i64 elapsed) {
+    std::unique_lock<std::mutex> lk(lock_);
+    auto &[count, total_elapsed] = records_[strategy_name];
+    ++count;
+    total_elapsed += elapsed;
+}
+
+String StrategyProfiler::ToString(SizeT intent) const {
+    String result;
+    String space(intent, ' ');
+
+    std::unique_lock<std::mutex> lk(lock_);
+    for (const auto &[strategy_name, record] : records_) {
+        result.append(fmt::format("{}{}: count: {}, elapsed: {}\n",
+                                  space,
+                                  strategy_name,
+                                  record.first,
+                                  BaseProfiler::ElapsedToString(NanoSeconds(record.second))));
+    }
+    return result;
+}
+
+nlohmann::json StrategyProfiler::Serialize() const {
+    nlohmann::json json = nlohmann::json::array();
+
+    std::unique_lock<std::mutex> lk(lock_);
+    for (const auto &[strategy_name, record] : records_) {
+        nlohmann::json json_strategy;
+        json_strategy["name"] = strategy_name;
+        json_strategy["count"] = record.first;
+        json_strategy["elapsed"] = record.second;
+        json.push_back(json_strategy);
+    }
+    return json;
+}
+
 void TaskProfiler::StartOperator(const PhysicalOperator *op) {
     if (!enable_) {
         return;
@@ -257,6 +293,7 @@ String QueryProfiler::ToString() const {
         }
         if (magic_enum::enum_value<QueryPhase>(idx) == QueryPhase::kExecution) {
             ExecuteRender(ss);
+            ss << strategy_.ToString(4);
         }
     }
     return ss.str();
@@ -320,6 +357,7 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
 
         json["fragments"].push_back(json_fragments);
     }
+    json["strategies"] = profiler->strategy_.Serialize();
     json["total"] = end - start;
     json["time_unit"] = "ns";
 
@@ -138,6 +138,22 @@ private:
     Vector<BaseProfiler> profilers_;
 };
 
+// Accumulates the time spent in each execution strategy chosen at runtime by an operator,
+// e.g. the filtered KNN scan picking HNSW or brute force per segment.
+export class StrategyProfiler {
+public:
+    void Record(const String &strategy_name, i64 elapsed);
+
+    [[nodiscard]] String ToString(SizeT intent = 0) const;
+
+    [[nodiscard]] nlohmann::json Serialize() const;
+
+private:
+    mutable std::mutex lock_{};
+    // strategy name -> (count, total elapsed ns)
+    Map<String, Pair<u64, i64>> records_{};
+};
+
 class PhysicalOperator;
 class PlanFragment;
 class OperatorState;
@@ -199,6 +215,8 @@ public:
 
     OptimizerProfiler &optimizer() { return optimizer_; }
 
+    StrategyProfiler &strategy() { return strategy_; }
+
     [[nodiscard]] String ToString() const;
 
     static String QueryPhaseToString(QueryPhase phase);
@@ -212,6 +230,7 @@ private:
     HashMap<u64, HashMap<i64, Vector<TaskProfiler>>> records_{};
     Vector<BaseProfiler> profilers_{static_cast<magic_enum::underlying_type_t<QueryPhase>>(QueryPhase::kInvalid)};
     OptimizerProfiler optimizer_;
+    StrategyProfiler strategy_;
     QueryPhase current_phase_{QueryPhase::kInvalid};
 
     void ExecuteRender(std::stringstream &ss) const;
@@ -50,6 +50,14 @@ import session_manager;
 import base_statement;
 import parser_result;
 import parser_assert;
+import options;
+import defer_op;
+import logical_type;
+import table_entry;
+import data_type;
+import column_vector;
+import default_values;
+import embedding_info;
 
 namespace infinity {
 
@@ -106,6 +114,24 @@ QueryResult QueryContext::Query(const String &query) {
 
 QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     QueryResult query_result;
+    // Statements executed by the workers wait for admission before their transaction begins.
+    QueryPriority priority = TaskScheduler::StatementPriority(statement, session_ptr_->options()->query_priority());
+    bool admitted = false;
+    if (TaskScheduler::UseScheduler(statement)) {
+        Status admit_status = scheduler_->Admit(priority);
+        if (!admit_status.ok()) {
+            query_result.result_table_ = nullptr;
+            query_result.status_ = std::move(admit_status);
+            session_ptr_->IncreaseQueryCount();
+            return query_result;
+        }
+        admitted = true;
+    }
+    DeferFn release_fn([&]() {
+        if (admitted) {
+            scheduler_->Release(priority);
+        }
+    });
 //    ProfilerStart("Query");
 //    BaseProfiler profiler;
 //    profiler.Begin();
@@ -153,7 +179,7 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
         StopProfile(QueryPhase::kTaskBuild);
 //        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kExecution);
-        scheduler_->Schedule(plan_fragment.get(), statement);
+        scheduler_->Schedule(plan_fragment.get(), statement, priority);
         query_result.result_table_ = plan_fragment->GetResult();
         query_result.root_operator_type_ = logical_plan->operator_type();
         StopProfile(QueryPhase::kExecution);
@@ -197,6 +223,136 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     return query_result;
 }
 
+namespace {
+
+SizeT ColumnarFieldRowCount(const ColumnarInsertField &field, const DataType &data_type) {
+    if (data_type.type() == LogicalType::kVarchar) {
+        if (field.offsets_.size() < sizeof(u32) || field.offsets_.size() % sizeof(u32) != 0) {
+            RecoverableError(Status::SyntaxError(fmt::format("Invalid offsets of varchar column {}", field.column_name_)));
+        }
+        SizeT row_count = field.offsets_.size() / sizeof(u32) - 1;
+        const u32 *offsets = reinterpret_cast<const u32 *>(field.offsets_.data());
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (offsets[i] > offsets[i + 1]) {
+                RecoverableError(Status::SyntaxError(fmt::format("Invalid offsets of varchar column {}", field.column_name_)));
+            }
+        }
+        if (offsets[0] != 0 || offsets[row_count] > field.data_.size()) {
+            RecoverableError(Status::SyntaxError(fmt::format("Invalid offsets of varchar column {}", field.column_name_)));
+        }
+        return row_count;
+    }
+    SizeT value_size = data_type.type() == LogicalType::kBoolean ? 1 : data_type.Size();
+    if (field.data_.size() % value_size != 0) {
+        RecoverableError(
+            Status::SyntaxError(fmt::format("Column {} has {} bytes, not a multiple of {}", field.column_name_, field.data_.size(), data_type.ToString())));
+    }
+    return field.data_.size() / value_size;
+}
+
+} // namespace
+
+QueryResult QueryContext::InsertColumnar(const String &db_name, const String &table_name, const Vector<ColumnarInsertField> &fields) {
+    QueryResult query_result;
+    try {
+        this->BeginTxn();
+        Txn *txn = session_ptr_->GetTxn();
+        auto [table_entry, table_status] = txn->GetTableByName(db_name, table_name);
+        if (!table_status.ok()) {
+            RecoverableError(table_status);
+        }
+
+        SizeT column_count = table_entry->ColumnCount();
+        if (fields.size() != column_count) {
+            RecoverableError(
+                Status::ColumnCountMismatch(fmt::format("Insert {} columns into table {} with {} columns", fields.size(), table_name, column_count)));
+        }
+        // Fields are matched by name, unnamed ones by position.
+        Vector<const ColumnarInsertField *> column_fields(column_count, nullptr);
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.reserve(column_count);
+        SizeT row_count = 0;
+        for (SizeT field_idx = 0; field_idx < column_count; ++field_idx) {
+            const ColumnarInsertField &field = fields[field_idx];
+            ColumnID column_id = field.column_name_.empty() ? field_idx : table_entry->GetColumnIdByName(field.column_name_);
+            if (column_fields[column_id] != nullptr) {
+                RecoverableError(Status::DuplicateColumnName(field.column_name_));
+            }
+            const DataType &data_type = *table_entry->GetColumnDefByID(column_id)->type();
+            if (data_type.type() != field.logical_type_) {
+                RecoverableError(Status::DataTypeMismatch(data_type.ToString(), LogicalType2Str(field.logical_type_)));
+            }
+            if (data_type.type() == LogicalType::kEmbedding) {
+                // the byte size alone doesn't tell e.g. float from int32 elements
+                const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+                if (field.embedding_data_type_ == EmbeddingDataType::kElemInvalid) {
+                    RecoverableError(Status::InvalidEmbeddingDataType());
+                }
+                if (embedding_info->Type() != field.embedding_data_type_) {
+                    RecoverableError(Status::DataTypeMismatch(data_type.ToString(),
+                                                              fmt::format("{} of {}",
+                                                                          LogicalType2Str(field.logical_type_),
+                                                                          EmbeddingInfo::EmbeddingDataTypeToString(field.embedding_data_type_))));
+                }
+            }
+            SizeT field_row_count = ColumnarFieldRowCount(field, data_type);
+            if (field_idx > 0 && field_row_count != row_count) {
+                RecoverableError(Status::SyntaxError(fmt::format("Column {} has {} rows, others have {}", field.column_name_, field_row_count, row_count)));
+            }
+            row_count = field_row_count;
+            column_fields[column_id] = &field;
+        }
+        if (row_count == 0) {
+            RecoverableError(Status::InsertWithoutValues());
+        }
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            column_types.emplace_back(table_entry->GetColumnDefByID(column_id)->type());
+        }
+
+        for (SizeT row_offset = 0; row_offset < row_count; row_offset += DEFAULT_BLOCK_CAPACITY) {
+            SizeT block_row_count = std::min(DEFAULT_BLOCK_CAPACITY, row_count - row_offset);
+            SharedPtr<DataBlock> data_block = DataBlock::Make();
+            data_block->Init(column_types, block_row_count);
+            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+                const ColumnarInsertField &field = *column_fields[column_id];
+                const DataType &data_type = *column_types[column_id];
+                ColumnVector &column_vector = *data_block->column_vectors[column_id];
+                if (data_type.type() == LogicalType::kVarchar) {
+                    const u32 *offsets = reinterpret_cast<const u32 *>(field.offsets_.data());
+                    column_vector.AppendVarchar(offsets + row_offset, field.data_.data(), block_row_count);
+                } else {
+                    SizeT value_size = data_type.type() == LogicalType::kBoolean ? 1 : data_type.Size();
+                    column_vector.AppendFixedWidth(field.data_.data() + row_offset * value_size, block_row_count);
+                }
+            }
+            data_block->Finalize();
+            Status append_status = txn->Append(db_name, table_name, data_block);
+            if (!append_status.ok()) {
+                RecoverableError(append_status);
+            }
+        }
+
+        try {
+            this->CommitTxn();
+            query_result.result_table_ = DataTable::MakeEmptyResultTable();
+            query_result.result_table_->SetResultMsg(MakeUnique<String>(fmt::format("INSERTED {} Rows", row_count)));
+        } catch (RecoverableException &e) {
+            this->RollbackTxn();
+            query_result.result_table_ = nullptr;
+            query_result.status_.Init(e.ErrorCode(), e.what());
+        }
+    } catch (RecoverableException &e) {
+        this->RollbackTxn();
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    } catch (UnrecoverableException &e) {
+        LOG_CRITICAL(e.what());
+        raise(SIGUSR1);
+    }
+    session_ptr_->IncreaseQueryCount();
+    return query_result;
+}
+
 void QueryContext::BeginTxn() {
     if (session_ptr_->GetTxn() == nullptr) {
         Txn* new_txn = storage_->txn_manager()->BeginTxn();
@@ -29,6 +29,8 @@ import optimizer;
 import status;
 import query_result;
 import base_statement;
+import logical_type;
+import embedding_info;
 
 export module query_context;
 
@@ -39,6 +41,18 @@ class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
 
+// One column of a columnar insert, the buffers are borrowed from the request.
+// Fixed width values and embedding elements are stored back to back in `data_`, one byte per boolean.
+// Varchar columns carry `row_count + 1` u32 offsets in `offsets_` and the concatenated strings in `data_`.
+// Embedding columns name their element type, which has to be the one of the table column.
+export struct ColumnarInsertField {
+    String column_name_{};
+    LogicalType logical_type_{LogicalType::kInvalid};
+    EmbeddingDataType embedding_data_type_{EmbeddingDataType::kElemInvalid};
+    std::string_view data_{};
+    std::string_view offsets_{};
+};
+
 export class QueryContext {
 
 public:
@@ -65,6 +79,9 @@ public:
 
     QueryResult QueryStatement(const BaseStatement *statement);
 
+    // Decode the columns directly into data blocks and append them, without binding an expression per cell.
+    QueryResult InsertColumnar(const String &db_name, const String &table_name, const Vector<ColumnarInsertField> &fields);
+
     inline void set_current_schema(const String &current_schema) { session_ptr_->set_current_schema(current_schema); }
 
     [[nodiscard]] inline const String &schema_name() const { return session_ptr_->current_database(); }
@@ -117,6 +134,12 @@ public:
         }
     }
 
+    void RecordStrategy(const String &strategy_name, i64 elapsed) {
+        if (query_profiler_) {
+            query_profiler_->strategy().Record(strategy_name, elapsed);
+        }
+    }
+
 private:
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
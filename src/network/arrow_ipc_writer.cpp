@@ -0,0 +1,579 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+
+module arrow_ipc_writer;
+
+import stl;
+import status;
+import third_party;
+import infinity_exception;
+import data_table;
+import data_block;
+import column_vector;
+import vector_buffer;
+import fix_heap;
+import bitmask;
+import data_type;
+import logical_type;
+import internal_types;
+import embedding_info;
+
+namespace infinity {
+
+namespace {
+
+// Constants of the Arrow columnar format, see format/Message.fbs and format/Schema.fbs of the Arrow project
+constexpr i16 kMetadataVersionV5 = 4;
+constexpr u8 kMessageHeaderSchema = 1;
+constexpr u8 kMessageHeaderRecordBatch = 3;
+constexpr u8 kTypeInt = 2;
+constexpr u8 kTypeFloatingPoint = 3;
+constexpr u8 kTypeUtf8 = 5;
+constexpr u8 kTypeBool = 6;
+constexpr u8 kTypeDecimal = 7;
+constexpr u8 kTypeDate = 8;
+constexpr u8 kTypeTime = 9;
+constexpr u8 kTypeTimestamp = 10;
+constexpr u8 kTypeFixedSizeBinary = 15;
+constexpr u8 kTypeFixedSizeList = 16;
+constexpr i16 kPrecisionHalf = 0;
+constexpr i16 kPrecisionSingle = 1;
+constexpr i16 kPrecisionDouble = 2;
+constexpr i16 kDateUnitDay = 0;
+constexpr i16 kTimeUnitSecond = 0;
+constexpr i32 kDecimal128MaxPrecision = 38;
+constexpr u32 kContinuationMarker = 0xFFFFFFFF;
+constexpr SizeT kIPCAlignment = 8;
+constexpr char kPaddingBytes[kIPCAlignment]{};
+
+inline SizeT AlignUp(SizeT size) { return (size + kIPCAlignment - 1) / kIPCAlignment * kIPCAlignment; }
+
+// Minimal FlatBuffers builder, enough for the Schema and RecordBatch messages. Like the FlatBuffers library it builds
+// the buffer back to front, so an object is referenced by its distance to the end of the buffer and has to be
+// finished before the table referencing it is started.
+class FlatBufferBuilder {
+public:
+    using Offset = u32;
+
+    [[nodiscard]] Offset Size() const { return buf_.size() - head_; }
+
+    template <typename T>
+    void PushScalar(T value) {
+        Align(sizeof(T));
+        PushBytes(&value, sizeof(T));
+    }
+
+    void PushOffset(Offset offset) {
+        Align(sizeof(u32));
+        u32 relative_offset = Size() + sizeof(u32) - offset;
+        PushBytes(&relative_offset, sizeof(u32));
+    }
+
+    Offset CreateString(std::string_view str) {
+        PreAlign(str.size() + 1, sizeof(u32));
+        PushBytes("", 1);
+        PushBytes(str.data(), str.size());
+        PushScalar<u32>(str.size());
+        return Size();
+    }
+
+    Offset CreateOffsetVector(const Vector<Offset> &offsets) {
+        PreAlign(offsets.size() * sizeof(u32), sizeof(u32));
+        for (SizeT i = offsets.size(); i > 0; --i) {
+            PushOffset(offsets[i - 1]);
+        }
+        PushScalar<u32>(offsets.size());
+        return Size();
+    }
+
+    // Vector of structs made of two longs, FieldNode and Buffer are both of this shape
+    Offset CreateStructVector(const Vector<Pair<i64, i64>> &structs) {
+        PreAlign(structs.size() * 2 * sizeof(i64), sizeof(i64));
+        for (SizeT i = structs.size(); i > 0; --i) {
+            PushScalar<i64>(structs[i - 1].second);
+            PushScalar<i64>(structs[i - 1].first);
+        }
+        PushScalar<u32>(structs.size());
+        return Size();
+    }
+
+    void StartTable() {
+        table_fields_.clear();
+        table_start_ = Size();
+    }
+
+    template <typename T>
+    void AddScalar(u16 field_id, T value) {
+        PushScalar<T>(value);
+        table_fields_.emplace_back(field_id, Size());
+    }
+
+    void AddOffset(u16 field_id, Offset offset) {
+        PushOffset(offset);
+        table_fields_.emplace_back(field_id, Size());
+    }
+
+    Offset EndTable() {
+        PushScalar<i32>(0);
+        Offset table = Size();
+        u16 field_count = 0;
+        for (const auto &[field_id, location] : table_fields_) {
+            field_count = std::max<u16>(field_count, field_id + 1);
+        }
+        Vector<u16> vtable(field_count, 0);
+        for (const auto &[field_id, location] : table_fields_) {
+            vtable[field_id] = table - location;
+        }
+        for (SizeT i = field_count; i > 0; --i) {
+            PushScalar<u16>(vtable[i - 1]);
+        }
+        PushScalar<u16>(table - table_start_);
+        PushScalar<u16>((field_count + 2) * sizeof(u16));
+        // The table starts with the signed distance back to its vtable
+        i32 vtable_distance = Size() - table;
+        std::memcpy(buf_.data() + buf_.size() - table, &vtable_distance, sizeof(i32));
+        return table;
+    }
+
+    std::string_view Finish(Offset root) {
+        PreAlign(sizeof(u32), min_align_);
+        PushOffset(root);
+        return {reinterpret_cast<const char *>(buf_.data() + head_), Size()};
+    }
+
+private:
+    void Align(SizeT alignment) { PreAlign(0, alignment); }
+
+    // Pads the buffer so that it is aligned after pushing size bytes
+    void PreAlign(SizeT size, SizeT alignment) {
+        min_align_ = std::max(min_align_, alignment);
+        SizeT padding = (alignment - (Size() + size) % alignment) % alignment;
+        Reserve(padding);
+        head_ -= padding;
+        std::memset(buf_.data() + head_, 0, padding);
+    }
+
+    void PushBytes(const void *data, SizeT size) {
+        Reserve(size);
+        head_ -= size;
+        std::memcpy(buf_.data() + head_, data, size);
+    }
+
+    void Reserve(SizeT size) {
+        if (head_ >= size) {
+            return;
+        }
+        SizeT used = Size();
+        SizeT new_capacity = std::max(buf_.size() * 2, used + size + 256);
+        Vector<u8> new_buf(new_capacity);
+        std::memcpy(new_buf.data() + new_capacity - used, buf_.data() + head_, used);
+        buf_ = std::move(new_buf);
+        head_ = new_capacity - used;
+    }
+
+    Vector<u8> buf_{};
+    SizeT head_{0};
+    SizeT min_align_{1};
+    Offset table_start_{0};
+    Vector<Pair<u16, Offset>> table_fields_{};
+};
+
+using Offset = FlatBufferBuilder::Offset;
+
+Offset CreateIntType(FlatBufferBuilder &builder, i32 bit_width, bool is_signed) {
+    builder.StartTable();
+    builder.AddScalar<i32>(0, bit_width);
+    builder.AddScalar<u8>(1, is_signed);
+    return builder.EndTable();
+}
+
+Offset CreateFloatingPointType(FlatBufferBuilder &builder, i16 precision) {
+    builder.StartTable();
+    builder.AddScalar<i16>(0, precision);
+    return builder.EndTable();
+}
+
+// FixedSizeList and FixedSizeBinary, whose only field is the size
+Offset CreateFixedSizeType(FlatBufferBuilder &builder, i32 size) {
+    builder.StartTable();
+    builder.AddScalar<i32>(0, size);
+    return builder.EndTable();
+}
+
+// Date, Time and Timestamp, a unit and for Time the bit width
+Offset CreateTemporalType(FlatBufferBuilder &builder, i16 unit, i32 bit_width = 0) {
+    builder.StartTable();
+    builder.AddScalar<i16>(0, unit);
+    if (bit_width != 0) {
+        builder.AddScalar<i32>(1, bit_width);
+    }
+    return builder.EndTable();
+}
+
+Offset CreateDecimalType(FlatBufferBuilder &builder, i32 precision, i32 scale, i32 bit_width) {
+    builder.StartTable();
+    builder.AddScalar<i32>(0, precision);
+    builder.AddScalar<i32>(1, scale);
+    builder.AddScalar<i32>(2, bit_width);
+    return builder.EndTable();
+}
+
+Offset CreateEmptyType(FlatBufferBuilder &builder) {
+    builder.StartTable();
+    return builder.EndTable();
+}
+
+Offset CreateField(FlatBufferBuilder &builder, std::string_view name, u8 type_id, Offset type, const Vector<Offset> &children) {
+    Offset name_offset = builder.CreateString(name);
+    Offset children_offset = builder.CreateOffsetVector(children);
+    builder.StartTable();
+    builder.AddOffset(0, name_offset);
+    builder.AddScalar<u8>(1, true);
+    builder.AddScalar<u8>(2, type_id);
+    builder.AddOffset(3, type);
+    builder.AddOffset(5, children_offset);
+    return builder.EndTable();
+}
+
+Tuple<Offset, Status> CreateColumnField(FlatBufferBuilder &builder, const String &name, const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return {CreateField(builder, name, kTypeBool, CreateEmptyType(builder), {}), Status::OK()};
+        }
+        case LogicalType::kTinyInt: {
+            return {CreateField(builder, name, kTypeInt, CreateIntType(builder, 8, true), {}), Status::OK()};
+        }
+        case LogicalType::kSmallInt: {
+            return {CreateField(builder, name, kTypeInt, CreateIntType(builder, 16, true), {}), Status::OK()};
+        }
+        case LogicalType::kInteger: {
+            return {CreateField(builder, name, kTypeInt, CreateIntType(builder, 32, true), {}), Status::OK()};
+        }
+        case LogicalType::kBigInt: {
+            return {CreateField(builder, name, kTypeInt, CreateIntType(builder, 64, true), {}), Status::OK()};
+        }
+        case LogicalType::kHugeInt: {
+            // arrow has no 128 bit integer, a decimal of scale 0 has the same two's complement layout
+            Offset type = CreateDecimalType(builder, kDecimal128MaxPrecision, 0, 128);
+            return {CreateField(builder, name, kTypeDecimal, type, {}), Status::OK()};
+        }
+        case LogicalType::kRowID: {
+            return {CreateField(builder, name, kTypeInt, CreateIntType(builder, 64, false), {}), Status::OK()};
+        }
+        case LogicalType::kDate: {
+            return {CreateField(builder, name, kTypeDate, CreateTemporalType(builder, kDateUnitDay), {}), Status::OK()};
+        }
+        case LogicalType::kTime: {
+            return {CreateField(builder, name, kTypeTime, CreateTemporalType(builder, kTimeUnitSecond, 32), {}), Status::OK()};
+        }
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            return {CreateField(builder, name, kTypeTimestamp, CreateTemporalType(builder, kTimeUnitSecond), {}), Status::OK()};
+        }
+        case LogicalType::kFloat: {
+            return {CreateField(builder, name, kTypeFloatingPoint, CreateFloatingPointType(builder, kPrecisionSingle), {}), Status::OK()};
+        }
+        case LogicalType::kDouble: {
+            return {CreateField(builder, name, kTypeFloatingPoint, CreateFloatingPointType(builder, kPrecisionDouble), {}), Status::OK()};
+        }
+        case LogicalType::kVarchar: {
+            return {CreateField(builder, name, kTypeUtf8, CreateEmptyType(builder), {}), Status::OK()};
+        }
+        case LogicalType::kEmbedding: {
+            auto *embedding_info = static_cast<EmbeddingInfo *>(data_type.type_info().get());
+            Offset element_type{};
+            u8 element_type_id = kTypeInt;
+            switch (embedding_info->Type()) {
+                case EmbeddingDataType::kElemBit:
+                case EmbeddingDataType::kElemBFloat16: {
+                    // Bit embeddings keep their packed bytes, arrow has no bfloat16 so it is sent as raw bytes too
+                    Offset type = CreateFixedSizeType(builder, embedding_info->Size());
+                    return {CreateField(builder, name, kTypeFixedSizeBinary, type, {}), Status::OK()};
+                }
+                case EmbeddingDataType::kElemInt8: {
+                    element_type = CreateIntType(builder, 8, true);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt16: {
+                    element_type = CreateIntType(builder, 16, true);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt32: {
+                    element_type = CreateIntType(builder, 32, true);
+                    break;
+                }
+                case EmbeddingDataType::kElemInt64: {
+                    element_type = CreateIntType(builder, 64, true);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat: {
+                    element_type_id = kTypeFloatingPoint;
+                    element_type = CreateFloatingPointType(builder, kPrecisionSingle);
+                    break;
+                }
+                case EmbeddingDataType::kElemDouble: {
+                    element_type_id = kTypeFloatingPoint;
+                    element_type = CreateFloatingPointType(builder, kPrecisionDouble);
+                    break;
+                }
+                case EmbeddingDataType::kElemFloat16: {
+                    element_type_id = kTypeFloatingPoint;
+                    element_type = CreateFloatingPointType(builder, kPrecisionHalf);
+                    break;
+                }
+                case EmbeddingDataType::kElemInvalid: {
+                    UnrecoverableError("Invalid embedding element data type");
+                }
+            }
+            Offset element_field = CreateField(builder, "item", element_type_id, element_type, {});
+            Offset list_type = CreateFixedSizeType(builder, embedding_info->Dimension());
+            return {CreateField(builder, name, kTypeFixedSizeList, list_type, {element_field}), Status::OK()};
+        }
+        default: {
+            return {0, Status::NotSupport(fmt::format("Arrow format of {} column", data_type.ToString()))};
+        }
+    }
+}
+
+// Wraps a flatbuffer message: continuation marker, metadata length, metadata padded to 8 bytes
+String EncapsulateMetadata(std::string_view metadata) {
+    SizeT padded_size = AlignUp(metadata.size() + 2 * sizeof(u32)) - 2 * sizeof(u32);
+    String header(2 * sizeof(u32) + padded_size, '\0');
+    i32 metadata_length = padded_size;
+    std::memcpy(header.data(), &kContinuationMarker, sizeof(u32));
+    std::memcpy(header.data() + sizeof(u32), &metadata_length, sizeof(i32));
+    std::memcpy(header.data() + 2 * sizeof(u32), metadata.data(), metadata.size());
+    return header;
+}
+
+Offset CreateMessage(FlatBufferBuilder &builder, u8 header_type, Offset header, i64 body_length) {
+    builder.StartTable();
+    builder.AddScalar<i64>(3, body_length);
+    builder.AddOffset(2, header);
+    builder.AddScalar<i16>(0, kMetadataVersionV5);
+    builder.AddScalar<u8>(1, header_type);
+    return builder.EndTable();
+}
+
+// Collects the nodes and buffers of a record batch, buffers are laid out one after another in the body with 8 byte
+// alignment.
+struct RecordBatchBody {
+    void AddNode(SizeT length, SizeT null_count) { nodes_.emplace_back(length, null_count); }
+
+    void AddBuffer(std::string_view buffer) {
+        buffers_.emplace_back(body_length_, buffer.size());
+        if (buffer.empty()) {
+            return;
+        }
+        chunks_.emplace_back(buffer);
+        SizeT padding = AlignUp(buffer.size()) - buffer.size();
+        if (padding > 0) {
+            chunks_.emplace_back(kPaddingBytes, padding);
+        }
+        body_length_ += buffer.size() + padding;
+    }
+
+    // Validity buffer of the column, none if there is no null in it. Returns the null count.
+    SizeT AddValidity(const ColumnVector &column_vector, SizeT row_count) {
+        const Bitmask *nulls = column_vector.nulls_ptr_.get();
+        if (nulls == nullptr || nulls->IsAllTrue()) {
+            AddBuffer({});
+            return 0;
+        }
+        // Infinity bitmasks are little endian u64 words with 1 for valid rows, the same bit order as arrow
+        const u64 *words = nulls->GetData();
+        SizeT valid_count = 0;
+        for (SizeT i = 0; i < row_count / 64; ++i) {
+            valid_count += std::popcount(words[i]);
+        }
+        if (row_count % 64 != 0) {
+            valid_count += std::popcount(words[row_count / 64] & ((u64(1) << (row_count % 64)) - 1));
+        }
+        AddBuffer({reinterpret_cast<const char *>(words), (row_count + 7) / 8});
+        return row_count - valid_count;
+    }
+
+    Vector<Pair<i64, i64>> nodes_{};
+    Vector<Pair<i64, i64>> buffers_{};
+    Vector<std::string_view> chunks_{};
+    SizeT body_length_{0};
+};
+
+void AppendVarcharColumn(RecordBatchBody &body, ArrowIPCMessage &message, const ColumnVector &column_vector, SizeT row_count) {
+    const auto *varchars = reinterpret_cast<const VarcharT *>(column_vector.data());
+    String &offsets = message.owned_buffers_.emplace_back((row_count + 1) * sizeof(i32), '\0');
+    auto *offsets_ptr = reinterpret_cast<i32 *>(offsets.data());
+    offsets_ptr[0] = 0;
+    for (SizeT row = 0; row < row_count; ++row) {
+        offsets_ptr[row + 1] = offsets_ptr[row] + varchars[row].length_;
+    }
+    String &data = message.owned_buffers_.emplace_back(offsets_ptr[row_count], '\0');
+    for (SizeT row = 0; row < row_count; ++row) {
+        const VarcharT &varchar = varchars[row];
+        char *dst = data.data() + offsets_ptr[row];
+        if (varchar.IsInlined()) {
+            std::memcpy(dst, varchar.short_.data_, varchar.length_);
+        } else {
+            column_vector.buffer_->fix_heap_mgr_->ReadFromHeap(dst, varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+        }
+    }
+    body.AddBuffer(offsets);
+    body.AddBuffer(data);
+}
+
+// Rewrites each value of a fixed width column into an owned buffer of arrow values
+template <typename T, typename ArrowT, typename Convert>
+void AppendConvertedColumn(RecordBatchBody &body, ArrowIPCMessage &message, const ColumnVector &column_vector, SizeT row_count, Convert &&convert) {
+    const auto *values = reinterpret_cast<const T *>(column_vector.data());
+    String &buffer = message.owned_buffers_.emplace_back(row_count * sizeof(ArrowT), '\0');
+    auto *arrow_values = reinterpret_cast<ArrowT *>(buffer.data());
+    for (SizeT row = 0; row < row_count; ++row) {
+        arrow_values[row] = convert(values[row]);
+    }
+    body.AddBuffer(buffer);
+}
+
+void AppendColumn(RecordBatchBody &body, ArrowIPCMessage &message, const ColumnVector &column_vector, SizeT row_count) {
+    const DataType &data_type = *column_vector.data_type();
+    const char *data = reinterpret_cast<const char *>(column_vector.data());
+    SizeT node_index = body.nodes_.size();
+    body.AddNode(row_count, 0);
+    body.nodes_[node_index].second = body.AddValidity(column_vector, row_count);
+
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            // Compact bit vectors are already bit packed in arrow order
+            body.AddBuffer({data, (row_count + 7) / 8});
+            break;
+        }
+        case LogicalType::kVarchar: {
+            AppendVarcharColumn(body, message, column_vector, row_count);
+            break;
+        }
+        case LogicalType::kHugeInt: {
+            // HugeInt keeps the upper word first, a little endian decimal128 the lower one
+            AppendConvertedColumn<HugeIntT, Pair<i64, i64>>(body, message, column_vector, row_count, [](const HugeIntT &value) {
+                return Pair<i64, i64>(value.lower, value.upper);
+            });
+            break;
+        }
+        case LogicalType::kDateTime: {
+            AppendConvertedColumn<DateTimeT, i64>(body, message, column_vector, row_count, [](const DateTimeT &value) {
+                return static_cast<i64>(value.date.value) * 24 * 60 * 60 + value.time.value;
+            });
+            break;
+        }
+        case LogicalType::kTimestamp: {
+            AppendConvertedColumn<TimestampT, i64>(body, message, column_vector, row_count, [](const TimestampT &value) {
+                return static_cast<i64>(value.date.value) * 24 * 60 * 60 + value.time.value;
+            });
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            auto *embedding_info = static_cast<EmbeddingInfo *>(data_type.type_info().get());
+            if (embedding_info->Type() != EmbeddingDataType::kElemBit && embedding_info->Type() != EmbeddingDataType::kElemBFloat16) {
+                // Child array of the fixed size list, never null
+                body.AddNode(row_count * embedding_info->Dimension(), 0);
+                body.AddBuffer({});
+            }
+            body.AddBuffer({data, row_count * data_type.Size()});
+            break;
+        }
+        default: {
+            body.AddBuffer({data, row_count * data_type.Size()});
+            break;
+        }
+    }
+}
+
+} // namespace
+
+SizeT ArrowIPCMessage::ByteSize() const {
+    SizeT byte_size = 0;
+    for (const auto &chunk : chunks_) {
+        byte_size += chunk.size();
+    }
+    return byte_size;
+}
+
+void ArrowIPCMessage::AppendTo(String &dst) const {
+    dst.reserve(dst.size() + ByteSize());
+    for (const auto &chunk : chunks_) {
+        dst.append(chunk);
+    }
+}
+
+Tuple<UniquePtr<ArrowIPCMessage>, Status> ArrowIPCWriter::SchemaMessage() const {
+    FlatBufferBuilder builder;
+    SizeT column_count = result_table_->ColumnCount();
+    Vector<Offset> fields;
+    fields.reserve(column_count);
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        auto [field, status] = CreateColumnField(builder, result_table_->GetColumnNameById(column_id), *result_table_->GetColumnTypeById(column_id));
+        if (!status.ok()) {
+            return {nullptr, status};
+        }
+        fields.emplace_back(field);
+    }
+    Offset fields_offset = builder.CreateOffsetVector(fields);
+    builder.StartTable();
+    builder.AddOffset(1, fields_offset);
+    // little endian
+    builder.AddScalar<i16>(0, 0);
+    Offset schema = builder.EndTable();
+    Offset message_offset = CreateMessage(builder, kMessageHeaderSchema, schema, 0);
+
+    auto message = MakeUnique<ArrowIPCMessage>();
+    message->chunks_.emplace_back(message->owned_buffers_.emplace_back(EncapsulateMetadata(builder.Finish(message_offset))));
+    return {std::move(message), Status::OK()};
+}
+
+UniquePtr<ArrowIPCMessage> ArrowIPCWriter::RecordBatchMessage(SizeT block_id) const {
+    const SharedPtr<DataBlock> &data_block = result_table_->GetDataBlockById(block_id);
+    SizeT row_count = data_block->row_count();
+    auto message = MakeUnique<ArrowIPCMessage>();
+    RecordBatchBody body;
+    for (const auto &column_vector : data_block->column_vectors) {
+        AppendColumn(body, *message, *column_vector, row_count);
+    }
+
+    FlatBufferBuilder builder;
+    Offset nodes = builder.CreateStructVector(body.nodes_);
+    Offset buffers = builder.CreateStructVector(body.buffers_);
+    builder.StartTable();
+    builder.AddScalar<i64>(0, row_count);
+    builder.AddOffset(1, nodes);
+    builder.AddOffset(2, buffers);
+    Offset record_batch = builder.EndTable();
+    Offset message_offset = CreateMessage(builder, kMessageHeaderRecordBatch, record_batch, body.body_length_);
+
+    message->chunks_.reserve(body.chunks_.size() + 1);
+    message->chunks_.emplace_back(message->owned_buffers_.emplace_back(EncapsulateMetadata(builder.Finish(message_offset))));
+    message->chunks_.insert(message->chunks_.end(), body.chunks_.begin(), body.chunks_.end());
+    return message;
+}
+
+UniquePtr<ArrowIPCMessage> ArrowIPCWriter::EndOfStreamMessage() {
+    auto message = MakeUnique<ArrowIPCMessage>();
+    String &end_of_stream = message->owned_buffers_.emplace_back(2 * sizeof(u32), '\0');
+    std::memcpy(end_of_stream.data(), &kContinuationMarker, sizeof(u32));
+    message->chunks_.emplace_back(end_of_stream);
+    return message;
+}
+
+} // namespace infinity
@@ -0,0 +1,56 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module arrow_ipc_writer;
+
+import stl;
+import status;
+import data_table;
+
+namespace infinity {
+
+// One encapsulated Arrow IPC message, as a list of chunks to be written in order.
+// Message headers and buffers which have to be converted (varchar, hugeint, datetime, timestamp) are owned by the message,
+// other fixed width and embedding columns are referenced in place, so the result table has to outlive the message.
+export struct ArrowIPCMessage {
+    [[nodiscard]] SizeT ByteSize() const;
+
+    void AppendTo(String &dst) const;
+
+    Deque<String> owned_buffers_{};
+    Vector<std::string_view> chunks_{};
+};
+
+// Writes a query result as an Arrow IPC stream: the schema message, one record batch per data block and the
+// end-of-stream marker. Messages are produced one by one, so the caller can send each one before building the next.
+export class ArrowIPCWriter {
+public:
+    explicit ArrowIPCWriter(SharedPtr<DataTable> result_table) : result_table_(std::move(result_table)) {}
+
+    [[nodiscard]] SizeT BatchCount() const { return result_table_->DataBlockCount(); }
+
+    [[nodiscard]] Tuple<UniquePtr<ArrowIPCMessage>, Status> SchemaMessage() const;
+
+    // Only valid after SchemaMessage() succeeded
+    [[nodiscard]] UniquePtr<ArrowIPCMessage> RecordBatchMessage(SizeT block_id) const;
+
+    [[nodiscard]] static UniquePtr<ArrowIPCMessage> EndOfStreamMessage();
+
+private:
+    SharedPtr<DataTable> result_table_{};
+};
+
+} // namespace infinity
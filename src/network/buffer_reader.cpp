@@ -15,7 +15,8 @@
 module;
 
 #include <arpa/inet.h>
-#include <boost/asio/read.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <cstring>
 
 import stl;
 import third_party;
@@ -147,42 +148,76 @@ void BufferReader::receive_more(SizeT bytes) {
         // Current data in buffer is enough for reading.
         return;
     }
+    fill_from_overflow();
+    if (size() < bytes) {
+        LOG_WARN("Malformed PG message: it is shorter than its length");
+        RecoverableError(Status::ClientClose());
+    }
+}
 
-    // Get the available size of the buffer;
-    const auto available_size = max_capacity() - size();
+SizeT BufferReader::contiguous_free() const { return std::min<SizeT>(PG_MSG_BUFFER_SIZE - current_pos_.position_, max_capacity() - size()); }
 
-    SizeT bytes_read{0};
+void BufferReader::fill_from_overflow() {
+    while (overflow_pos_ < overflow_.size() && !full()) {
+        const SizeT copy_size = std::min(contiguous_free(), overflow_.size() - overflow_pos_);
+        std::memcpy(current_pos_.position_addr(), overflow_.data() + overflow_pos_, copy_size);
+        current_pos_.increment(copy_size);
+        overflow_pos_ += copy_size;
+    }
+    if (overflow_pos_ == overflow_.size()) {
+        overflow_.clear();
+        overflow_pos_ = 0;
+    }
+}
 
-    boost::system::error_code boost_error;
+u32 BufferReader::peek_value_u32(SizeT offset) const {
+    RingBufferIterator value_pos = start_pos_;
+    value_pos.increment(offset);
+    u32 network_value{0};
 
-    if ((RingBufferIterator::Distance(start_pos_, current_pos_) < 0) || (start_pos_.position_ == 0)) {
-        bytes_read = boost::asio::read(*socket_,
-                                       boost::asio::buffer(current_pos_.position_addr(), available_size),
-                                       boost::asio::transfer_at_least(bytes - size()),
-                                       boost_error);
-    } else {
-        bytes_read = boost::asio::read(
-            *socket_,
-            std::array<boost::asio::mutable_buffer, 2>{boost::asio::buffer(current_pos_.position_addr(), PG_MSG_BUFFER_SIZE - current_pos_.position_),
-                                                       boost::asio::buffer(&data_[0], start_pos_.position_ - 1)},
-            boost::asio::transfer_at_least(bytes - size()),
-            boost_error);
-    }
+    RingBufferIterator::CopyN(value_pos, sizeof(u32), reinterpret_cast<char *>(&network_value));
+    return ntohl(network_value);
+}
 
-    if (boost_error == boost::asio::error::broken_pipe || boost_error == boost::asio::error::connection_reset) {
-        UnrecoverableError(fmt::format("Client close the connection: {}", boost_error.message()));
+void BufferReader::async_receive(std::function<void(SizeT)> handler) {
+    if (!overflow_.empty() || full()) {
+        // A message larger than the ring buffer, its next bytes wait after the ones already waiting
+        overflow_.erase(0, overflow_pos_);
+        overflow_pos_ = 0;
+        const SizeT old_size = overflow_.size();
+        overflow_.resize(old_size + PG_MSG_OVERFLOW_READ_SIZE);
+        socket_->async_read_some(boost::asio::buffer(overflow_.data() + old_size, PG_MSG_OVERFLOW_READ_SIZE),
+                                 [this, old_size, handler = std::move(handler)](const boost::system::error_code &boost_error, SizeT bytes_read) {
+                                     overflow_.resize(old_size + (boost_error ? 0 : bytes_read));
+                                     if (boost_error) {
+                                         LOG_TRACE(fmt::format("Client is disconnected: {}", boost_error.message()));
+                                         handler(0);
+                                         return;
+                                     }
+                                     handler(bytes_read);
+                                 });
+        return;
     }
 
-    if(bytes_read == 0) {
-        LOG_TRACE("Client is disconnected.");
-        RecoverableError(Status::ClientClose());
-    }
+    auto on_receive = [this, handler = std::move(handler)](const boost::system::error_code &boost_error, SizeT bytes_read) {
+        if (boost_error) {
+            LOG_TRACE(fmt::format("Client is disconnected: {}", boost_error.message()));
+            handler(0);
+            return;
+        }
+        current_pos_.increment(bytes_read);
+        handler(bytes_read);
+    };
 
-    if (boost_error) {
-        UnrecoverableError(boost_error.message());
+    const auto available_size = max_capacity() - size();
+    if ((RingBufferIterator::Distance(start_pos_, current_pos_) < 0) || (start_pos_.position_ == 0)) {
+        socket_->async_read_some(boost::asio::buffer(current_pos_.position_addr(), available_size), std::move(on_receive));
+    } else {
+        socket_->async_read_some(
+            std::array<boost::asio::mutable_buffer, 2>{boost::asio::buffer(current_pos_.position_addr(), PG_MSG_BUFFER_SIZE - current_pos_.position_),
+                                                       boost::asio::buffer(&data_[0], start_pos_.position_ - 1)},
+            std::move(on_receive));
     }
-
-    current_pos_.increment(bytes_read);
 }
 
 } // namespace infinity
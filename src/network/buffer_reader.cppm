@@ -34,6 +34,12 @@ public:
 
     [[nodiscard]] inline bool full() const { return size() == max_capacity(); }
 
+    // Bytes received but not read yet, including those of a large message waiting for room in the ring buffer
+    [[nodiscard]] inline SizeT buffered_size() const { return size() + overflow_.size() - overflow_pos_; }
+
+    // Moves the bytes waiting for room into the ring buffer
+    void fill_from_overflow();
+
     i8 read_value_i8();
 
     u8 read_value_u8();
@@ -50,13 +56,29 @@ public:
 
     String read_string();
 
+    // Reads a value of the buffered bytes without consuming it, the caller checks that enough bytes are buffered
+    [[nodiscard]] u32 peek_value_u32(SizeT offset) const;
+
+    // Receives whatever the socket has without blocking the calling thread. The handler gets the number of bytes
+    // received, 0 if the client is gone. Once the ring buffer is full the bytes go to the overflow buffer.
+    void async_receive(std::function<void(SizeT)> handler);
+
 private:
+    // Messages are read once they are completely received, so this never waits for the socket:
+    // running out of received bytes means the message is shorter than its length field.
     void receive_more(SizeT more_bytes = 1);
 
+    // Free space of the ring buffer from the current position without wrapping
+    [[nodiscard]] SizeT contiguous_free() const;
+
     Array<char, PG_MSG_BUFFER_SIZE> data_{};
     RingBufferIterator start_pos_{data_};
     RingBufferIterator current_pos_{data_};
 
+    // Received bytes after the ring buffer content, only used by messages larger than the ring buffer
+    String overflow_{};
+    SizeT overflow_pos_{0};
+
     SharedPtr<boost::asio::ip::tcp::socket> socket_;
 };
 
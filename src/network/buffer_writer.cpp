@@ -59,6 +59,25 @@ void BufferWriter::send_string(const String &value, NullTerminator null_terminat
     }
 }
 
+void BufferWriter::send_bytes(const char *data, SizeT length) {
+    if (length >= max_capacity()) {
+        if (size() > 0) {
+            flush();
+        }
+        boost::system::error_code boost_error;
+        boost::asio::write(*socket_, boost::asio::buffer(data, length), boost_error);
+        if (boost_error) {
+            UnrecoverableError(boost_error.message());
+        }
+        return;
+    }
+    if (length > max_capacity() - size()) {
+        flush();
+    }
+    RingBufferIterator::CopyN(data, length, current_pos_);
+    current_pos_.increment(length);
+}
+
 void BufferWriter::send_value_i8(i8 host_value) {
     try_flush(sizeof(i8));
 
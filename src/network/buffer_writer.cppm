@@ -48,6 +48,9 @@ public:
 
     void send_string(const String &value, NullTerminator null_terminator = NullTerminator::kYes);
 
+    // Bulk write of already encoded messages, data larger than the buffer is written to the socket directly
+    void send_bytes(const char *data, SizeT length);
+
     // 0 means flush whole buffer.
     void flush(SizeT bytes = 0);
 
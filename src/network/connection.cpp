@@ -38,11 +38,13 @@ import type_info;
 import logical_type;
 import embedding_info;
 import data_type;
+import pg_result_encoder;
+import default_values;
 
 namespace infinity {
 
-Connection::Connection(boost::asio::io_service &io_service)
-    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
+Connection::Connection(boost::asio::io_service &io_service, ThreadPool &worker_pool)
+    : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), worker_pool_(worker_pool), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
 
 Connection::~Connection() {
     if (session_ == nullptr) {
@@ -50,27 +52,69 @@ Connection::~Connection() {
         return;
     }
     SessionManager *session_mgr = InfinityContext::instance().session_manager();
+    if (session_mgr == nullptr) {
+        // Idle connections are released with the io_service of the PG server, after the shutdown
+        return;
+    }
     session_mgr->RemoveSessionByID(session_->session_id());
 }
 
-void Connection::Run() {
+void Connection::Start() {
     // Disable Nagle's algorithm to reduce TCP latency, but will reduce the throughput.
     socket_->set_option(boost::asio::ip::tcp::no_delay(true));
 
     SessionManager *session_manager = InfinityContext::instance().session_manager();
     session_ = session_manager->CreateRemoteSession();
 
-    HandleConnection();
+    ReceiveMore();
+}
+
+void Connection::ReceiveMore() {
+    // The callback keeps the connection alive while it waits for the client
+    pg_handler_->AsyncReceive([connection = shared_from_this()](SizeT bytes_read) { connection->OnReceive(bytes_read); });
+}
+
+void Connection::OnReceive(SizeT bytes_read) {
+    if (bytes_read == 0) {
+        LOG_TRACE("Client is disconnected.");
+        return;
+    }
 
-    session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
+    bool message_buffered = false;
+    try {
+        message_buffered = pg_handler_->MessageBuffered(startup_);
+    } catch (const infinity::RecoverableException &e) {
+        LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
+        boost::system::error_code error;
+        socket_->close(error);
+        return;
+    }
+    if (!message_buffered) {
+        // Part of a message, wait for the rest without holding the io thread
+        ReceiveMore();
+        return;
+    }
+    worker_pool_.push([connection = shared_from_this()](int) { connection->HandleBufferedMessages(); });
+}
 
+void Connection::HandleBufferedMessages() {
     while (!terminate_connection_) {
         try {
-            HandleRequest();
+            if (!pg_handler_->MessageBuffered(startup_)) {
+                break;
+            }
+            if (startup_) {
+                if (HandleConnection()) {
+                    session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
+                    startup_ = false;
+                }
+            } else {
+                HandleRequest();
+            }
         } catch (const infinity::RecoverableException &e) {
             LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
-            return ;
-        } catch (const infinity::UnrecoverableException& e) {
+            terminate_connection_ = true;
+        } catch (const infinity::UnrecoverableException &e) {
             HashMap<PGMessageType, String> error_message_map;
             error_message_map[PGMessageType::kHumanReadableError] = e.what();
             LOG_ERROR(e.what());
@@ -84,23 +128,49 @@ void Connection::Run() {
             pg_handler_->send_ready_for_query();
         }
     }
+
+    if (terminate_connection_) {
+        boost::system::error_code error;
+        socket_->close(error);
+        return;
+    }
+    ReceiveMore();
 }
 
-void Connection::HandleConnection() {
+bool Connection::HandleConnection() {
     const auto body_length = pg_handler_->read_startup_header();
+    if (!body_length.has_value()) {
+        return false;
+    }
 
-    pg_handler_->read_startup_body(body_length);
+    pg_handler_->read_startup_body(*body_length);
     pg_handler_->send_authentication();
     pg_handler_->send_parameter("server_version", "14");
     pg_handler_->send_parameter("server_encoding", "UTF8");
     pg_handler_->send_parameter("client_encoding", "UTF8");
     pg_handler_->send_parameter("DateStyle", "IOS, DMY");
     pg_handler_->send_ready_for_query();
+    return true;
 }
 
 void Connection::HandleRequest() {
     const auto cmd_type = pg_handler_->read_command_type();
 
+    if (skip_until_sync_ && cmd_type != PGMessageType::kSyncCommand && cmd_type != PGMessageType::kTerminateCommand) {
+        pg_handler_->SkipMessage();
+        return;
+    }
+
+    try {
+        HandleCommand(cmd_type);
+    } catch (const infinity::UnrecoverableException &e) {
+        HandleCommandError(cmd_type, e.what());
+    } catch (const std::exception &e) {
+        HandleCommandError(cmd_type, e.what());
+    }
+}
+
+void Connection::HandleCommand(PGMessageType cmd_type) {
     // FIXME
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -112,18 +182,33 @@ void Connection::HandleRequest() {
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
             LOG_TRACE("BindCommand");
+            HandleBind();
             break;
         }
         case PGMessageType::kDescribeCommand: {
             LOG_TRACE("DescribeCommand");
+            HandleDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
             LOG_TRACE("ExecuteCommand");
+            HandleExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
             LOG_TRACE("ParseCommand");
+            HandleParse();
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            LOG_TRACE("CloseCommand");
+            HandleClose();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            LOG_TRACE("FlushCommand");
+            pg_handler_->SkipMessage();
+            pg_handler_->Flush();
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -132,6 +217,7 @@ void Connection::HandleRequest() {
         }
         case PGMessageType::kSyncCommand: {
             LOG_TRACE("SyncCommand");
+            HandleSync();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -139,11 +225,26 @@ void Connection::HandleRequest() {
             break;
         }
         default: {
-            UnrecoverableError("Unknown PG command type");
+            UnrecoverableError(fmt::format("Unknown PG command type {}", static_cast<char>(cmd_type)));
         }
     }
 }
 
+void Connection::HandleCommandError(PGMessageType cmd_type, const String &message) {
+    LOG_ERROR(message);
+    // The rest of the failed message must not be read as the next message
+    pg_handler_->DiscardMessageBody();
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = message;
+    pg_handler_->send_error_response(error_message_map);
+    if (cmd_type == PGMessageType::kSimpleQueryCommand || cmd_type == PGMessageType::kSyncCommand) {
+        skip_until_sync_ = false;
+        pg_handler_->send_ready_for_query();
+    } else {
+        skip_until_sync_ = true;
+    }
+}
+
 void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     const String &query = pg_handler_->read_command_body();
     LOG_TRACE(fmt::format("Query: {}", query));
@@ -157,15 +258,140 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
         error_message_map[PGMessageType::kHumanReadableError] = result.status_.message();
         pg_handler_->send_error_response(error_message_map);
     } else {
-        // Have result
-        SendTableDescription(result.result_table_);
-        SendQueryResponse(result);
+        // Have result, always in text format
+        PGResultEncoder encoder(*result.result_table_, {});
+        SendTableDescription(result.result_table_, encoder.FormatCodes());
+        SizeT block_id = 0;
+        SizeT row_id = 0;
+        SendDataRows(encoder, *result.result_table_, block_id, row_id, 0);
+        pg_handler_->SendComplete(CompleteMessage(result));
     }
 
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleParse() {
+    PGParseMessage parse_message = pg_handler_->ReadParse();
+    LOG_TRACE(fmt::format("Parse statement \"{}\": {}", parse_message.statement_name_, parse_message.query_));
+    prepared_statements_[parse_message.statement_name_] = std::move(parse_message.query_);
+    pg_handler_->SendParseComplete();
+}
+
+void Connection::HandleBind() {
+    PGBindMessage bind_message = pg_handler_->ReadBind();
+    auto iter = prepared_statements_.find(bind_message.statement_name_);
+    if (iter == prepared_statements_.end()) {
+        SendExtendedQueryError(fmt::format("Prepared statement \"{}\" does not exist", bind_message.statement_name_));
+        return;
+    }
+    if (!bind_message.parameters_.empty()) {
+        SendExtendedQueryError("Bind parameters are not supported");
+        return;
+    }
+    PGPortal &portal = portals_[bind_message.portal_name_];
+    portal = PGPortal();
+    portal.query_ = iter->second;
+    portal.result_formats_ = std::move(bind_message.result_formats_);
+    pg_handler_->SendBindComplete();
+}
+
+void Connection::HandleDescribe(QueryContext *query_context) {
+    PGDescribeMessage describe_message = pg_handler_->ReadDescribe();
+    if (describe_message.object_type_ == PGObjectType::kStatement) {
+        if (!prepared_statements_.contains(describe_message.name_)) {
+            SendExtendedQueryError(fmt::format("Prepared statement \"{}\" does not exist", describe_message.name_));
+            return;
+        }
+        // The columns are only known once the query ran, which happens at Execute.
+        pg_handler_->SendParameterDescription({});
+        pg_handler_->SendNoData();
+        return;
+    }
+
+    auto iter = portals_.find(describe_message.name_);
+    if (iter == portals_.end()) {
+        SendExtendedQueryError(fmt::format("Portal \"{}\" does not exist", describe_message.name_));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    if (!RunPortal(query_context, portal)) {
+        return;
+    }
+    if (portal.result_ == nullptr || !SendTableDescription(portal.result_->result_table_, portal.encoder_->FormatCodes())) {
+        pg_handler_->SendNoData();
+    }
+}
+
+void Connection::HandleExecute(QueryContext *query_context) {
+    PGExecuteMessage execute_message = pg_handler_->ReadExecute();
+    auto iter = portals_.find(execute_message.portal_name_);
+    if (iter == portals_.end()) {
+        SendExtendedQueryError(fmt::format("Portal \"{}\" does not exist", execute_message.portal_name_));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    if (!RunPortal(query_context, portal)) {
+        return;
+    }
+    if (portal.result_ == nullptr) {
+        pg_handler_->SendEmptyQueryResponse();
+        return;
+    }
+    SizeT max_rows = execute_message.max_rows_ > 0 ? execute_message.max_rows_ : 0;
+    if (SendDataRows(*portal.encoder_, *portal.result_->result_table_, portal.block_id_, portal.row_id_, max_rows)) {
+        pg_handler_->SendComplete(CompleteMessage(*portal.result_));
+    } else {
+        pg_handler_->SendPortalSuspended();
+    }
+}
+
+void Connection::HandleClose() {
+    PGCloseMessage close_message = pg_handler_->ReadClose();
+    if (close_message.object_type_ == PGObjectType::kStatement) {
+        prepared_statements_.erase(close_message.name_);
+    } else {
+        portals_.erase(close_message.name_);
+    }
+    pg_handler_->SendCloseComplete();
+}
+
+void Connection::HandleSync() {
+    pg_handler_->SkipMessage();
+    skip_until_sync_ = false;
+    // The unnamed portal only lives until the end of the transaction
+    portals_.erase(String());
+    pg_handler_->send_ready_for_query();
+}
+
+bool Connection::RunPortal(QueryContext *query_context, PGPortal &portal) {
+    if (portal.encoder_ != nullptr || portal.query_.find_first_not_of(" \t\n\r;") == String::npos) {
+        // Already ran, or an empty query which has no result
+        return true;
+    }
+    LOG_TRACE(fmt::format("Query: {}", portal.query_));
+    auto result = MakeUnique<QueryResult>(query_context->Query(portal.query_));
+    if (result->result_table_.get() == nullptr) {
+        SendExtendedQueryError(result->status_.message());
+        return false;
+    }
+    SizeT column_count = result->result_table_->ColumnCount();
+    if (portal.result_formats_.size() > 1 && portal.result_formats_.size() != column_count) {
+        SendExtendedQueryError(fmt::format("Bind has {} result format codes for {} columns", portal.result_formats_.size(), column_count));
+        return false;
+    }
+    portal.encoder_ = MakeUnique<PGResultEncoder>(*result->result_table_, portal.result_formats_);
+    portal.result_ = std::move(result);
+    return true;
+}
+
+void Connection::SendExtendedQueryError(const String &message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = message;
+    pg_handler_->send_error_response(error_message_map);
+    skip_until_sync_ = true;
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &format_codes) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -174,180 +400,65 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
     for (SizeT idx = 0; idx < column_count; ++idx) {
-        SharedPtr<DataType> column_type = result_table->GetColumnTypeById(idx);
-
-        u32 object_id = 0;
-        i16 object_width = 0;
-
-        switch (column_type->type()) {
-            case LogicalType::kBoolean: {
-                object_id = 16;
-                object_width = 1;
-                break;
-            }
-            case LogicalType::kTinyInt: {
-                object_id = 18; // char
-                object_width = 1;
-                break;
-            }
-            case LogicalType::kSmallInt: {
-                object_id = 21;
-                object_width = 2;
-                break;
-            }
-            case LogicalType::kInteger: {
-                object_id = 23;
-                object_width = 4;
-                break;
-            }
-            case LogicalType::kBigInt: {
-                object_id = 20;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kFloat: {
-                object_id = 700;
-                object_width = 4;
-                break;
-            }
-            case LogicalType::kDouble: {
-                object_id = 701;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kVarchar: {
-                object_id = 25;
-                object_width = -1;
-                break;
-            }
-            case LogicalType::kDate: {
-                object_id = 1082;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kTime: {
-                object_id = 1083;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kDateTime: {
-                object_id = 1114;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kTimestamp: {
-                object_id = 1114;
-                object_width = 8;
-                break;
-            }
-            case LogicalType::kInterval: {
-                object_id = 1186;
-                object_width = 16;
-                break;
-            }
-            case LogicalType::kEmbedding: {
-                if (column_type->type_info()->type() != TypeInfoType::kEmbedding) {
-                    UnrecoverableError("Not embedding type");
-                }
+        PGColumnType column_type = PGResultEncoder::ColumnType(*result_table->GetColumnTypeById(idx));
+        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), column_type.object_id_, column_type.width_, format_codes[idx]);
+    }
+    return true;
+}
 
-                EmbeddingInfo *embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
-                switch (embedding_info->Type()) {
-
-                    case kElemBit: {
-                        object_id = 1000;
-                        object_width = 1;
-                        break;
-                    }
-                    case kElemInt8: {
-                        object_id = 1002;
-                        object_width = 1;
-                        break;
-                    }
-                    case kElemInt16: {
-                        object_id = 1005;
-                        object_width = 2;
-                        break;
-                    }
-                    case kElemInt32: {
-                        object_id = 1007;
-                        object_width = 4;
-                        break;
-                    }
-                    case kElemInt64: {
-                        object_id = 1016;
-                        object_width = 8;
-                        break;
-                    }
-                    case kElemFloat: {
-                        object_id = 1021;
-                        object_width = 4;
-                        break;
-                    }
-                    case kElemDouble: {
-                        object_id = 1022;
-                        object_width = 8;
-                        break;
-                    }
-                    case kElemInvalid: {
-                        UnrecoverableError("Invalid embedding data type");
-                    }
+bool Connection::SendDataRows(PGResultEncoder &encoder, DataTable &result_table, SizeT &block_id, SizeT &row_id, SizeT max_rows) {
+    // Rows are encoded a few hundreds at a time and written once the batch is large enough, instead of a message at a time
+    String batch;
+    SizeT sent_rows = 0;
+    bool exhausted = true;
+    SizeT block_count = result_table.DataBlockCount();
+    for (; block_id < block_count; ++block_id, row_id = 0) {
+        const SharedPtr<DataBlock> &data_block = result_table.GetDataBlockById(block_id);
+        SizeT row_count = data_block->row_count();
+        while (row_id < row_count) {
+            SizeT encode_rows = std::min(PG_RESULT_ENCODE_ROWS, row_count - row_id);
+            if (max_rows != 0) {
+                if (sent_rows == max_rows) {
+                    exhausted = false;
+                    break;
                 }
-                break;
+                encode_rows = std::min(encode_rows, max_rows - sent_rows);
             }
-            default: {
-                UnrecoverableError("Unexpected type");
+            encoder.EncodeRows(*data_block, row_id, row_id + encode_rows, batch);
+            row_id += encode_rows;
+            sent_rows += encode_rows;
+            if (batch.size() >= PG_RESULT_BATCH_SIZE) {
+                pg_handler_->SendBytes(batch);
+                batch.clear();
             }
         }
-
-        pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
-    }
-}
-
-void Connection::SendQueryResponse(const QueryResult &query_result) {
-
-    const SharedPtr<DataTable> &result_table = query_result.result_table_;
-    SizeT column_count = result_table->ColumnCount();
-    auto values_as_strings = Vector<Optional<String>>(column_count);
-    SizeT block_count = result_table->DataBlockCount();
-    for (SizeT idx = 0; idx < block_count; ++idx) {
-        auto block = result_table->GetDataBlockById(idx);
-        SizeT row_count = block->row_count();
-
-        for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-            SizeT string_length_sum = 0;
-
-            // iterate each column_vector of the block
-            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-                auto &column_vector = block->column_vectors[column_id];
-                const String string_value = column_vector->ToString(row_id);
-                values_as_strings[column_id] = string_value;
-                string_length_sum += string_value.size();
-            }
-            pg_handler_->SendData(values_as_strings, string_length_sum);
+        if (!exhausted) {
+            break;
         }
     }
+    if (!batch.empty()) {
+        pg_handler_->SendBytes(batch);
+    }
+    return exhausted;
+}
 
-    String message;
+String Connection::CompleteMessage(const QueryResult &query_result) {
     switch (query_result.root_operator_type_) {
         case LogicalNodeType::kInsert: {
-            message = query_result.ToString();
-            break;
+            return query_result.ToString();
         }
         case LogicalNodeType::kImport: {
-            message = *query_result.result_table_->result_msg();
-            break;
+            return *query_result.result_table_->result_msg();
         }
         default: {
-            message = fmt::format("SELECT {}", std::to_string(query_result.result_table_->row_count()));
+            return fmt::format("SELECT {}", std::to_string(query_result.result_table_->row_count()));
         }
     }
-
-    pg_handler_->SendComplete(message);
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
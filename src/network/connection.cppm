@@ -23,38 +23,102 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import pg_message;
+import pg_result_encoder;
 
 namespace infinity {
 
-export class Connection {
+// A bound statement of the extended query protocol, the query runs at the first Describe or Execute of the portal
+struct PGPortal {
+    String query_{};
+    Vector<PGFormatCode> result_formats_{};
+    UniquePtr<QueryResult> result_{};
+    UniquePtr<PGResultEncoder> encoder_{};
+    // Position of the next row to send, Execute may ask for a limited number of rows
+    SizeT block_id_{0};
+    SizeT row_id_{0};
+};
+
+// A PG client connection. It does not own a thread: it waits for the client with asynchronous reads on the io_service
+// until a whole message is received, then its messages are handled on the worker pool, which re-arms the read after them.
+// A client sending a message slowly only keeps its pending read, neither an io thread nor a worker.
+export class Connection : public EnableSharedFromThis<Connection> {
 public:
-    explicit Connection(boost::asio::io_service &io_service);
+    Connection(boost::asio::io_service &io_service, ThreadPool &worker_pool);
 
     ~Connection();
 
-    void Run();
+    // Called on an io thread once the socket is accepted
+    void Start();
 
     inline SharedPtr<boost::asio::ip::tcp::socket> socket() { return socket_; }
 
 private:
-    void HandleConnection();
+    void ReceiveMore();
+
+    void OnReceive(SizeT bytes_read);
+
+    // Handles all the buffered messages on a worker, then waits for the client again
+    void HandleBufferedMessages();
+
+    // Returns false for an SSL request, the client sends its startup message next
+    bool HandleConnection();
 
     void HandleRequest();
 
+    void HandleCommand(PGMessageType cmd_type);
+
+    // Sends the error of a failed message. In the extended query protocol the messages up to the next Sync are discarded.
+    void HandleCommandError(PGMessageType cmd_type, const String &message);
+
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    void HandleParse();
+
+    void HandleBind();
+
+    void HandleDescribe(QueryContext *query_context);
+
+    void HandleExecute(QueryContext *query_context);
+
+    void HandleClose();
 
-    void SendQueryResponse(const QueryResult &query_result);
+    void HandleSync();
+
+    // Runs the query of the portal if not yet done, returns false and sends the error if it failed
+    bool RunPortal(QueryContext *query_context, PGPortal &portal);
+
+    void SendExtendedQueryError(const String &message);
+
+    // Returns false if there is no output column
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table, const Vector<PGFormatCode> &format_codes);
+
+    // Sends up to max_rows rows from the position, 0 means all of them. Returns true when the result is exhausted.
+    bool SendDataRows(PGResultEncoder &encoder, DataTable &result_table, SizeT &block_id, SizeT &row_id, SizeT max_rows);
+
+    static String CompleteMessage(const QueryResult &query_result);
 
 private:
     const SharedPtr<boost::asio::ip::tcp::socket> socket_{};
 
+    ThreadPool &worker_pool_;
+
     const SharedPtr<PGProtocolHandler> pg_handler_{};
 
     bool terminate_connection_ = false;
 
+    // Waiting for the startup message
+    bool startup_ = true;
+
     SharedPtr<RemoteSession> session_{};
+
+    // Prepared statements of the extended query protocol by name, the unnamed one is ""
+    HashMap<String, String> prepared_statements_{};
+
+    HashMap<String, PGPortal> portals_{};
+
+    // After an error in the extended query protocol, the messages are discarded until the next Sync
+    bool skip_until_sync_{false};
 };
 
 } // namespace infinity
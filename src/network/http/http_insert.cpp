@@ -0,0 +1,216 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "simdjson.h"
+#include <cstring>
+
+module http_insert;
+
+import stl;
+import status;
+import third_party;
+import parsed_expr;
+import constant_expr;
+
+namespace infinity {
+
+namespace {
+
+// Returns nullptr, with the error in response, if the value can't be inserted
+ConstantExpr *ParseValue(const simdjson::dom::element &value, nlohmann::json &response) {
+    switch (value.type()) {
+        case simdjson::dom::element_type::BOOL: {
+            auto *const_expr = new ConstantExpr(LiteralType::kBoolean);
+            const_expr->bool_value_ = bool(value);
+            return const_expr;
+        }
+        case simdjson::dom::element_type::INT64: {
+            auto *const_expr = new ConstantExpr(LiteralType::kInteger);
+            const_expr->integer_value_ = i64(value);
+            return const_expr;
+        }
+        case simdjson::dom::element_type::UINT64: {
+            auto *const_expr = new ConstantExpr(LiteralType::kInteger);
+            const_expr->integer_value_ = u64(value);
+            return const_expr;
+        }
+        case simdjson::dom::element_type::DOUBLE: {
+            auto *const_expr = new ConstantExpr(LiteralType::kDouble);
+            const_expr->double_value_ = f64(value);
+            return const_expr;
+        }
+        case simdjson::dom::element_type::STRING: {
+            std::string_view string_value(value);
+            auto *const_expr = new ConstantExpr(LiteralType::kString);
+            const_expr->str_value_ = strndup(string_value.data(), string_value.size());
+            return const_expr;
+        }
+        case simdjson::dom::element_type::ARRAY: {
+            simdjson::dom::array array(value);
+            SizeT dimension = array.size();
+            if (dimension == 0) {
+                response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+                response["error_message"] = fmt::format("Empty embedding data: {}", simdjson::minify(value));
+                return nullptr;
+            }
+            auto first_elem_type = (*array.begin()).type();
+            if (first_elem_type == simdjson::dom::element_type::INT64 or first_elem_type == simdjson::dom::element_type::UINT64) {
+                auto const_expr = MakeUnique<ConstantExpr>(LiteralType::kIntegerArray);
+                const_expr->long_array_.reserve(dimension);
+                for (simdjson::dom::element element : array) {
+                    switch (element.type()) {
+                        case simdjson::dom::element_type::INT64: {
+                            const_expr->long_array_.emplace_back(i64(element));
+                            break;
+                        }
+                        case simdjson::dom::element_type::UINT64: {
+                            const_expr->long_array_.emplace_back(u64(element));
+                            break;
+                        }
+                        default: {
+                            response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+                            response["error_message"] = fmt::format("Embedding element type should be integer");
+                            return nullptr;
+                        }
+                    }
+                }
+                return const_expr.release();
+            }
+            if (first_elem_type == simdjson::dom::element_type::DOUBLE) {
+                auto const_expr = MakeUnique<ConstantExpr>(LiteralType::kDoubleArray);
+                const_expr->double_array_.reserve(dimension);
+                for (simdjson::dom::element element : array) {
+                    if (element.type() != simdjson::dom::element_type::DOUBLE) {
+                        response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+                        response["error_message"] = fmt::format("Embedding element type should be float");
+                        return nullptr;
+                    }
+                    const_expr->double_array_.emplace_back(f64(element));
+                }
+                return const_expr.release();
+            }
+            response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+            response["error_message"] = fmt::format("Embedding element type can only be integer or float");
+            return nullptr;
+        }
+        case simdjson::dom::element_type::OBJECT:
+        case simdjson::dom::element_type::NULL_VALUE: {
+            response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+            response["error_message"] = fmt::format("Embedding element type can only be integer or float");
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+// The scalar type name in the error of a mismatching row, arrays are not checked
+const char *ScalarTypeName(LiteralType literal_type) {
+    switch (literal_type) {
+        case LiteralType::kBoolean: {
+            return "BOOL";
+        }
+        case LiteralType::kInteger: {
+            return "INTEGER";
+        }
+        case LiteralType::kDouble: {
+            return "FLOAT";
+        }
+        case LiteralType::kString: {
+            return "STRING";
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+} // namespace
+
+bool HTTPInsert::ParseBody(const String &body, Vector<String> &columns, Vector<Vector<ParsedExpr *> *> &values, nlohmann::json &response) {
+    // The parser keeps its buffers between the requests of a thread
+    thread_local simdjson::dom::parser parser;
+    simdjson::dom::element body_json;
+    if (auto error = parser.parse(body).get(body_json); error) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = simdjson::error_message(error);
+        return false;
+    }
+    simdjson::dom::array rows;
+    if (body_json.get_array().get(rows) || rows.size() == 0) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = fmt::format("Invalid json format: {}", body);
+        return false;
+    }
+
+    // Column id and literal type by name
+    HashMap<String, Pair<SizeT, LiteralType>> column_map;
+    values.reserve(rows.size());
+    bool first_row = true;
+    for (simdjson::dom::element row_json : rows) {
+        simdjson::dom::object row_object;
+        if (row_json.get_object().get(row_object)) {
+            response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            response["error_message"] = fmt::format("Invalid json format: {}", simdjson::minify(row_json));
+            return false;
+        }
+        auto *values_row = values.emplace_back(new Vector<ParsedExpr *>());
+        if (!first_row) {
+            values_row->resize(columns.size());
+        }
+
+        for (simdjson::dom::key_value_pair field : row_object) {
+            String key(field.key);
+            ConstantExpr *const_expr = ParseValue(field.value, response);
+            if (const_expr == nullptr) {
+                return false;
+            }
+
+            if (first_row) {
+                if (!column_map.emplace(key, MakePair(columns.size(), const_expr->literal_type_)).second) {
+                    delete const_expr;
+                    response["error_code"] = ErrorCode::kDuplicateColumnName;
+                    response["error_message"] = fmt::format("Duplicated column name: {}", key);
+                    return false;
+                }
+                columns.emplace_back(std::move(key));
+                values_row->emplace_back(const_expr);
+                continue;
+            }
+
+            auto iter = column_map.find(key);
+            if (iter == column_map.end()) {
+                delete const_expr;
+                response["error_code"] = ErrorCode::kColumnNotExist;
+                response["error_message"] = fmt::format("Not existed column name: {}", key);
+                return false;
+            }
+            auto [column_id, column_type] = iter->second;
+            const char *type_name = ScalarTypeName(column_type);
+            if (ScalarTypeName(const_expr->literal_type_) != nullptr && const_expr->literal_type_ != column_type) {
+                delete const_expr;
+                response["error_code"] = ErrorCode::kDataTypeMismatch;
+                response["error_message"] = fmt::format("Column: {} expect type {}", key, type_name == nullptr ? "ARRAY" : type_name);
+                return false;
+            }
+            delete (*values_row)[column_id];
+            (*values_row)[column_id] = const_expr;
+        }
+        first_row = false;
+    }
+    return true;
+}
+
+} // namespace infinity
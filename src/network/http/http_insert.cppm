@@ -0,0 +1,33 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module http_insert;
+
+import stl;
+import third_party;
+import parsed_expr;
+
+namespace infinity {
+
+export class HTTPInsert {
+public:
+    // Parses the body of an insert request, an array of rows which are objects of column name to value, with simdjson
+    // instead of building a json tree. The columns and their types come from the first row.
+    // Returns false, with the error in response, if the body is invalid. The rows parsed so far are in values either way.
+    static bool ParseBody(const String &body, Vector<String> &columns, Vector<Vector<ParsedExpr *> *> &values, nlohmann::json &response);
+};
+
+} // namespace infinity
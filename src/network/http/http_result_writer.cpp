@@ -0,0 +1,362 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module http_result_writer;
+
+import stl;
+import data_table;
+import data_block;
+import column_vector;
+import vector_buffer;
+import fix_heap;
+import bitmask;
+import data_type;
+import logical_type;
+import internal_types;
+import embedding_info;
+import value;
+import default_values;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+void AppendJsonString(String &output, std::string_view value) {
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    output.push_back('"');
+    SizeT plain_begin = 0;
+    for (SizeT i = 0; i < value.size(); ++i) {
+        const auto c = static_cast<u8>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        output.append(value.data() + plain_begin, i - plain_begin);
+        plain_begin = i + 1;
+        switch (c) {
+            case '"': {
+                output.append("\\\"");
+                break;
+            }
+            case '\\': {
+                output.append("\\\\");
+                break;
+            }
+            case '\n': {
+                output.append("\\n");
+                break;
+            }
+            case '\r': {
+                output.append("\\r");
+                break;
+            }
+            case '\t': {
+                output.append("\\t");
+                break;
+            }
+            default: {
+                output.append("\\u00");
+                output.push_back(kHexDigits[c >> 4]);
+                output.push_back(kHexDigits[c & 0xF]);
+            }
+        }
+    }
+    output.append(value.data() + plain_begin, value.size() - plain_begin);
+    output.push_back('"');
+}
+
+// Same text as std::to_string(), without the temporary string
+template <typename T>
+void AppendNumber(String &output, T value) {
+    char buffer[64];
+    if constexpr (std::is_floating_point_v<T>) {
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+        if (error != std::errc()) {
+            // Doubles with more than 50 integer digits
+            output.append(std::to_string(value));
+            return;
+        }
+        output.append(buffer, end - buffer);
+    } else {
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        output.append(buffer, end - buffer);
+    }
+}
+
+// Marks a null row in value_ends before its value is encoded
+constexpr SizeT kNullValue = std::numeric_limits<SizeT>::max();
+
+bool AppendNull(String &values, SizeT value_end) {
+    if (value_end != kNullValue) {
+        return false;
+    }
+    values.append("null");
+    return true;
+}
+
+template <typename T>
+void EncodeNumbers(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<SizeT> &value_ends) {
+    const auto *data = reinterpret_cast<const T *>(column_vector.data());
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        SizeT &value_end = value_ends[row - row_begin];
+        if (!AppendNull(values, value_end)) {
+            values.push_back('"');
+            AppendNumber(values, data[row]);
+            values.push_back('"');
+        }
+        value_end = values.size();
+    }
+}
+
+// Elements separated by ", " like EmbeddingValueInfo::GetString()
+template <typename T>
+void EncodeEmbeddings(const ColumnVector &column_vector, SizeT dimension, SizeT row_begin, SizeT row_end, String &values, Vector<SizeT> &value_ends) {
+    const auto *data = reinterpret_cast<const T *>(column_vector.data());
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        SizeT &value_end = value_ends[row - row_begin];
+        if (!AppendNull(values, value_end)) {
+            const T *embedding = data + row * dimension;
+            values.push_back('"');
+            for (SizeT i = 0; i < dimension; ++i) {
+                if (i != 0) {
+                    values.append(", ");
+                }
+                if constexpr (std::is_same_v<T, Float16T> || std::is_same_v<T, BFloat16T>) {
+                    AppendNumber(values, static_cast<f32>(embedding[i]));
+                } else {
+                    AppendNumber(values, embedding[i]);
+                }
+            }
+            values.push_back('"');
+        }
+        value_end = values.size();
+    }
+}
+
+void EncodeEmbeddingColumn(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<SizeT> &value_ends) {
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+    const SizeT dimension = embedding_info->Dimension();
+    switch (embedding_info->Type()) {
+        case kElemInt8: {
+            // Formatted as numbers, not characters
+            EncodeEmbeddings<i8>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemInt16: {
+            EncodeEmbeddings<i16>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemInt32: {
+            EncodeEmbeddings<i32>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemInt64: {
+            EncodeEmbeddings<i64>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemFloat: {
+            EncodeEmbeddings<f32>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemDouble: {
+            EncodeEmbeddings<f64>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemFloat16: {
+            EncodeEmbeddings<Float16T>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case kElemBFloat16: {
+            EncodeEmbeddings<BFloat16T>(column_vector, dimension, row_begin, row_end, values, value_ends);
+            break;
+        }
+        default: {
+            UnrecoverableError("Not supported embedding data type.");
+        }
+    }
+}
+
+void EncodeVarchars(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<SizeT> &value_ends) {
+    const auto *varchars = reinterpret_cast<const VarcharT *>(column_vector.data());
+    String heap_value;
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        SizeT &value_end = value_ends[row - row_begin];
+        if (!AppendNull(values, value_end)) {
+            const VarcharT &varchar = varchars[row];
+            if (varchar.IsInlined()) {
+                AppendJsonString(values, std::string_view(varchar.short_.data_, varchar.length_));
+            } else {
+                heap_value.resize(varchar.length_);
+                column_vector.buffer_->fix_heap_mgr_->ReadFromHeap(heap_value.data(), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+                AppendJsonString(values, heap_value);
+            }
+        }
+        value_end = values.size();
+    }
+}
+
+} // namespace
+
+HTTPResultWriter::HTTPResultWriter(SharedPtr<DataTable> result_table) : result_table_(std::move(result_table)) {
+    Map<String, SizeT> column_by_name;
+    SizeT column_count = result_table_->ColumnCount();
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        column_by_name[result_table_->GetColumnNameById(column_id)] = column_id;
+    }
+    for (const auto &[column_name, column_id] : column_by_name) {
+        output_columns_.emplace_back(column_id);
+        String &key = keys_.emplace_back();
+        AppendJsonString(key, column_name);
+        key.push_back(':');
+    }
+    encoded_values_.resize(output_columns_.size());
+    encoded_value_ends_.resize(output_columns_.size());
+}
+
+bool HTTPResultWriter::Next(String &output) {
+    if (finished_) {
+        return false;
+    }
+    if (!started_) {
+        output.push_back('{');
+        started_ = true;
+    }
+
+    SizeT block_count = result_table_->DataBlockCount();
+    for (; block_id_ < block_count; ++block_id_, row_id_ = 0) {
+        const SharedPtr<DataBlock> &data_block = result_table_->GetDataBlockById(block_id_);
+        SizeT row_count = data_block->row_count();
+        if (row_id_ < row_count) {
+            SizeT row_end = std::min(row_id_ + HTTP_RESULT_ENCODE_ROWS, row_count);
+            output.append(has_rows_ ? "," : "\"output\":[");
+            has_rows_ = true;
+            EncodeRows(*data_block, row_id_, row_end, output);
+            row_id_ = row_end;
+            return true;
+        }
+    }
+
+    if (has_rows_) {
+        output.append("],");
+    }
+    output.append("\"error_code\":0}");
+    finished_ = true;
+    return true;
+}
+
+void HTTPResultWriter::EncodeRows(const DataBlock &data_block, SizeT row_begin, SizeT row_end, String &output) {
+    // Column at a time, then the values are interleaved into the row objects
+    SizeT output_column_count = output_columns_.size();
+    SizeT encoded_size = 0;
+    for (SizeT idx = 0; idx < output_column_count; ++idx) {
+        EncodeColumn(data_block, output_columns_[idx], row_begin, row_end, encoded_values_[idx], encoded_value_ends_[idx]);
+        encoded_size += encoded_values_[idx].size() + (row_end - row_begin) * (keys_[idx].size() + 1);
+    }
+    output.reserve(output.size() + encoded_size + (row_end - row_begin) * 3);
+
+    for (SizeT row = 0; row < row_end - row_begin; ++row) {
+        if (row != 0) {
+            output.push_back(',');
+        }
+        output.push_back('{');
+        for (SizeT idx = 0; idx < output_column_count; ++idx) {
+            if (idx != 0) {
+                output.push_back(',');
+            }
+            output.append(keys_[idx]);
+            const Vector<SizeT> &value_ends = encoded_value_ends_[idx];
+            SizeT value_begin = row == 0 ? 0 : value_ends[row - 1];
+            output.append(encoded_values_[idx], value_begin, value_ends[row] - value_begin);
+        }
+        output.push_back('}');
+    }
+}
+
+void HTTPResultWriter::EncodeColumn(const DataBlock &data_block,
+                                   SizeT column_id,
+                                   SizeT row_begin,
+                                   SizeT row_end,
+                                   String &values,
+                                   Vector<SizeT> &value_ends) {
+    const ColumnVector &column_vector = *data_block.column_vectors[column_id];
+    values.clear();
+    value_ends.assign(row_end - row_begin, 0);
+    const Bitmask *nulls = column_vector.nulls_ptr_.get();
+    if (nulls != nullptr && !nulls->IsAllTrue()) {
+        for (SizeT row = row_begin; row < row_end; ++row) {
+            if (!nulls->IsTrue(row)) {
+                value_ends[row - row_begin] = kNullValue;
+            }
+        }
+    }
+
+    switch (column_vector.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            for (SizeT row = row_begin; row < row_end; ++row) {
+                SizeT &value_end = value_ends[row - row_begin];
+                if (!AppendNull(values, value_end)) {
+                    values.append(column_vector.buffer_->GetCompactBit(row) ? "\"true\"" : "\"false\"");
+                }
+                value_end = values.size();
+            }
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            EncodeNumbers<TinyIntT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            EncodeNumbers<SmallIntT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kInteger: {
+            EncodeNumbers<IntegerT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            EncodeNumbers<BigIntT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kFloat: {
+            EncodeNumbers<FloatT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kDouble: {
+            EncodeNumbers<DoubleT>(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            EncodeVarchars(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            EncodeEmbeddingColumn(column_vector, row_begin, row_end, values, value_ends);
+            break;
+        }
+        default: {
+            // Less common types go through Value
+            for (SizeT row = row_begin; row < row_end; ++row) {
+                SizeT &value_end = value_ends[row - row_begin];
+                if (!AppendNull(values, value_end)) {
+                    AppendJsonString(values, data_block.GetValue(column_id, row).ToString());
+                }
+                value_end = values.size();
+            }
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,56 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module http_result_writer;
+
+import stl;
+import data_table;
+import data_block;
+
+namespace infinity {
+
+// Serializes a search result as the JSON body of the HTTP API, {"output":[{"column":"value",...},...],"error_code":0},
+// straight from the column vectors and a few hundred rows at a time, so the body can be streamed while it is built.
+// Values are strings formatted like Value::ToString(), nulls are null. As with a json object, the keys of a row are
+// sorted and a duplicated column name keeps its last column.
+export class HTTPResultWriter {
+public:
+    explicit HTTPResultWriter(SharedPtr<DataTable> result_table);
+
+    // Appends the next part of the body to output, returns false once the whole body was written
+    bool Next(String &output);
+
+private:
+    void EncodeRows(const DataBlock &data_block, SizeT row_begin, SizeT row_end, String &output);
+
+    void EncodeColumn(const DataBlock &data_block, SizeT column_id, SizeT row_begin, SizeT row_end, String &values, Vector<SizeT> &value_ends);
+
+    SharedPtr<DataTable> result_table_{};
+    // Column ids in the key order, and the "key": prefix of each
+    Vector<SizeT> output_columns_{};
+    Vector<String> keys_{};
+
+    SizeT block_id_{0};
+    SizeT row_id_{0};
+    bool started_{false};
+    bool has_rows_{false};
+    bool finished_{false};
+
+    Vector<String> encoded_values_{};
+    Vector<Vector<SizeT>> encoded_value_ends_{};
+};
+
+} // namespace infinity
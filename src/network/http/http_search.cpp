@@ -36,12 +36,13 @@ import value;
 
 namespace infinity {
 
-void HTTPSearch::Process(Infinity *infinity_ptr,
-                         const String &db_name,
-                         const String &table_name,
-                         const String &input_json_str,
-                         HTTPStatus &http_status,
-                         nlohmann::json &response) {
+bool HTTPSearch::Search(Infinity *infinity_ptr,
+                        const String &db_name,
+                        const String &table_name,
+                        const String &input_json_str,
+                        HTTPStatus &http_status,
+                        nlohmann::json &response,
+                        QueryResult &result) {
     http_status = HTTPStatus::CODE_500;
     try {
         nlohmann::json input_json = nlohmann::json::parse(input_json_str);
@@ -104,44 +105,44 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                 if (output_columns != nullptr) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] = "More than one output field.";
-                    return;
+                    return false;
                 }
                 auto &output_list = elem.value();
                 if (!output_list.is_array()) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] = "Output field should be array";
-                    return;
+                    return false;
                 }
 
                 output_columns = ParseOutput(output_list, http_status, response);
                 if (output_columns == nullptr) {
-                    return;
+                    return false;
                 }
             } else if (IsEqual(key, "filter")) {
 
                 if (filter != nullptr) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] = "More than one output field.";
-                    return;
+                    return false;
                 }
 
                 auto &filter_json = elem.value();
                 if (!filter_json.is_string()) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] = "Filter field should be string";
-                    return;
+                    return false;
                 }
 
                 filter = ParseFilter(filter_json, http_status, response);
                 if (filter == nullptr) {
-                    return;
+                    return false;
                 }
             } else if (IsEqual(key, "fusion")) {
                 if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] =
                         "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
+                    return false;
                 }
                 search_expr = new SearchExpr();
                 auto &fusion_children = elem.value();
@@ -154,11 +155,11 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                         if (!knn_json.is_object()) {
                             response["error_code"] = ErrorCode::kInvalidExpression;
                             response["error_message"] = "KNN field should be object";
-                            return;
+                            return false;
                         }
                         knn_expr = ParseKnn(knn_json, http_status, response);
                         if (knn_expr == nullptr) {
-                            return;
+                            return false;
                         }
                         search_exprs->push_back(knn_expr);
                         knn_expr = nullptr;
@@ -166,7 +167,7 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                         auto &match_json = expression.value();
                         match_expr = ParseMatch(match_json, http_status, response);
                         if (match_expr == nullptr) {
-                            return;
+                            return false;
                         }
                         search_exprs->push_back(match_expr);
                         match_expr = nullptr;
@@ -174,7 +175,7 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                         if (fusion_expr != nullptr && !fusion_expr->method_.empty()) {
                             response["error_code"] = ErrorCode::kInvalidExpression;
                             response["error_message"] = "Method is already given";
-                            return;
+                            return false;
                         }
                         fusion_expr = new FusionExpr();
                         fusion_expr->method_ = expression.value();
@@ -183,7 +184,7 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                     } else {
                         response["error_code"] = ErrorCode::kInvalidExpression;
                         response["error_message"] = "Error fusion clause";
-                        return;
+                        return false;
                     }
                 }
             } else if (IsEqual(key, "knn")) {
@@ -192,17 +193,17 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] =
                         "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
+                    return false;
                 }
                 auto &knn_json = elem.value();
                 if (!knn_json.is_object()) {
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] = "KNN field should be object";
-                    return;
+                    return false;
                 }
                 knn_expr = ParseKnn(knn_json, http_status, response);
                 if (knn_expr == nullptr) {
-                    return;
+                    return false;
                 }
                 search_exprs->push_back(knn_expr);
                 knn_expr = nullptr;
@@ -211,19 +212,19 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                     response["error_code"] = ErrorCode::kInvalidExpression;
                     response["error_message"] =
                         "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
+                    return false;
                 }
                 auto &match_json = elem.value();
                 match_expr = ParseMatch(match_json, http_status, response);
                 if (match_expr == nullptr) {
-                    return;
+                    return false;
                 }
                 search_exprs->push_back(match_expr);
                 match_expr = nullptr;
             } else {
                 response["error_code"] = ErrorCode::kInvalidExpression;
                 response["error_message"] = "Unknown expression: " + key;
-                return;
+                return false;
             }
         }
 
@@ -232,42 +233,17 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
             search_exprs = nullptr;
         }
 
-        const QueryResult result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns);
+        result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns);
 
         output_columns = nullptr;
         filter = nullptr;
         search_expr = nullptr;
-        if (result.IsOk()) {
-            SizeT block_rows = result.result_table_->DataBlockCount();
-            for (SizeT block_id = 0; block_id < block_rows; ++block_id) {
-                DataBlock *data_block = result.result_table_->GetDataBlockById(block_id).get();
-                auto row_count = data_block->row_count();
-                auto column_cnt = result.result_table_->ColumnCount();
-
-                for (int row = 0; row < row_count; ++row) {
-                    nlohmann::json json_result_row;
-                    for (SizeT col = 0; col < column_cnt; ++col) {
-                        Value value = data_block->GetValue(col, row);
-                        const String &column_name = result.result_table_->GetColumnNameById(col);
-                        const String &column_value = value.ToString();
-                        json_result_row[column_name] = column_value;
-                    }
-                    response["output"].push_back(json_result_row);
-                }
-            }
-
-            response["error_code"] = 0;
-            http_status = HTTPStatus::CODE_200;
-        } else {
-            response["error_code"] = result.ErrorCode();
-            response["error_message"] = result.ErrorMsg();
-            http_status = HTTPStatus::CODE_500;
-        }
+        return true;
     } catch (nlohmann::json::exception &e) {
         response["error_code"] = ErrorCode::kInvalidJsonFormat;
         response["error_message"] = e.what();
     }
-    return;
+    return false;
 }
 
 ParsedExpr *HTTPSearch::ParseFilter(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response) {
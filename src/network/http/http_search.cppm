@@ -23,17 +23,20 @@ import parsed_expr;
 import knn_expr;
 import match_expr;
 import infinity;
+import query_result;
 
 namespace infinity {
 
 export class HTTPSearch {
 public:
-    static void Process(Infinity *infinity_ptr,
-                        const String &db_name,
-                        const String &table_name,
-                        const String &input_json,
-                        HTTPStatus &http_status,
-                        nlohmann::json &response);
+    // Parses the search request and runs it. Returns false, with the error in response, if the request is invalid.
+    static bool Search(Infinity *infinity_ptr,
+                       const String &db_name,
+                       const String &table_name,
+                       const String &input_json,
+                       HTTPStatus &http_status,
+                       nlohmann::json &response,
+                       QueryResult &result);
 
     static ParsedExpr *ParseFilter(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response);
     static Vector<ParsedExpr *> *ParseOutput(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response);
@@ -45,6 +45,9 @@ import statement_common;
 import extra_ddl_info;
 import update_statement;
 import http_search;
+import arrow_ipc_writer;
+import http_insert;
+import http_result_writer;
 import knn_expr;
 import type_info;
 import logical_type;
@@ -57,6 +60,89 @@ namespace {
 
 using namespace infinity;
 
+constexpr const char *kArrowStreamContentType = "application/vnd.apache.arrow.stream";
+
+// Streams a search result as an arrow IPC stream, record batches are built one data block at a time while the client
+// reads the body
+class ArrowStreamReadCallback final : public HttpReadCallback {
+public:
+    ArrowStreamReadCallback(SharedPtr<DataTable> result_table, UniquePtr<ArrowIPCMessage> schema_message)
+        : writer_(std::move(result_table)), message_(std::move(schema_message)) {}
+
+    HttpIOSize read(void *buffer, HttpBuffSize count, HttpAsyncAction &) final {
+        char *dst = static_cast<char *>(buffer);
+        HttpIOSize written = 0;
+        while (written < count && message_.get() != nullptr) {
+            if (chunk_id_ == message_->chunks_.size()) {
+                NextMessage();
+                continue;
+            }
+            std::string_view chunk = message_->chunks_[chunk_id_];
+            SizeT size = std::min<SizeT>(chunk.size() - chunk_offset_, count - written);
+            std::memcpy(dst + written, chunk.data() + chunk_offset_, size);
+            written += size;
+            chunk_offset_ += size;
+            if (chunk_offset_ == chunk.size()) {
+                ++chunk_id_;
+                chunk_offset_ = 0;
+            }
+        }
+        return written;
+    }
+
+private:
+    void NextMessage() {
+        chunk_id_ = 0;
+        chunk_offset_ = 0;
+        if (next_block_id_ < writer_.BatchCount()) {
+            message_ = writer_.RecordBatchMessage(next_block_id_++);
+        } else if (!end_of_stream_) {
+            message_ = ArrowIPCWriter::EndOfStreamMessage();
+            end_of_stream_ = true;
+        } else {
+            message_.reset();
+        }
+    }
+
+    ArrowIPCWriter writer_;
+    UniquePtr<ArrowIPCMessage> message_{};
+    SizeT chunk_id_{0};
+    SizeT chunk_offset_{0};
+    SizeT next_block_id_{0};
+    bool end_of_stream_{false};
+};
+
+// Streams a search result as the JSON body, with chunked transfer encoding. The rows are serialized a few hundreds at a
+// time while the client reads the body, instead of building a json tree of the whole result.
+class JsonResultReadCallback final : public HttpReadCallback {
+public:
+    explicit JsonResultReadCallback(SharedPtr<DataTable> result_table) : writer_(std::move(result_table)) {}
+
+    HttpIOSize read(void *buffer, HttpBuffSize count, HttpAsyncAction &) final {
+        char *dst = static_cast<char *>(buffer);
+        HttpIOSize written = 0;
+        while (written < count) {
+            if (offset_ == chunk_.size()) {
+                chunk_.clear();
+                offset_ = 0;
+                if (!writer_.Next(chunk_)) {
+                    break;
+                }
+            }
+            SizeT size = std::min<SizeT>(chunk_.size() - offset_, count - written);
+            std::memcpy(dst + written, chunk_.data() + offset_, size);
+            written += size;
+            offset_ += size;
+        }
+        return written;
+    }
+
+private:
+    HTTPResultWriter writer_;
+    String chunk_{};
+    SizeT offset_{0};
+};
+
 class ListDatabaseHandler final : public HttpRequestHandler {
 public:
     SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
@@ -322,6 +408,10 @@ public:
                     e_data_type = EmbeddingDataType::kElemFloat;
                 } else if (etype == "double") {
                     e_data_type = EmbeddingDataType::kElemDouble;
+                } else if (etype == "float16") {
+                    e_data_type = EmbeddingDataType::kElemFloat16;
+                } else if (etype == "bfloat16") {
+                    e_data_type = EmbeddingDataType::kElemBFloat16;
                 } else {
                     e_data_type = EmbeddingDataType::kElemInvalid;
                 }
@@ -653,443 +743,46 @@ public:
         HTTPStatus http_status = HTTPStatus::CODE_500;
 
         String data_body = request->readBodyToString();
-        try {
-            nlohmann::json http_body_json = nlohmann::json::parse(data_body);
-
-            SizeT row_count = http_body_json.size();
-            if (http_body_json.is_array() && row_count > 0) {
-
-                // First row
-                const auto &first_row_json = http_body_json[0];
-                SizeT column_count = first_row_json.size();
-
-                // Used for the column type validation
-                HashMap<String, LiteralType> column_type_map;
-                HashMap<String, u64> column_name_id_map;
-
-                // inserted columns
-                Vector<Vector<ParsedExpr *> *> *column_values = new Vector<Vector<infinity::ParsedExpr *> *>();
-                column_values->reserve(row_count);
-                DeferFn defer_free_column_values([&]() {
-                    if (column_values != nullptr) {
-                        for (auto &value_array : *column_values) {
-                            for (auto &value_ptr : *value_array) {
-                                delete value_ptr;
-                                value_ptr = nullptr;
-                            }
-                            delete value_array;
-                            value_array = nullptr;
-                        }
-                        delete column_values;
-                        column_values = nullptr;
-                    }
-                });
-
-                Vector<String> *columns = new Vector<String>();
-                column_type_map.reserve(column_count);
-                column_name_id_map.reserve(column_count);
-                columns->reserve(column_count);
-                DeferFn defer_free_columns([&]() {
-                    if (columns != nullptr) {
-                        delete columns;
-                        columns = nullptr;
-                    }
-                });
-
-                // First row
-                {
-                    Vector<ParsedExpr *> *values_row = new Vector<infinity::ParsedExpr *>();
-                    DeferFn defer_free_value_row([&]() {
-                        if (values_row != nullptr) {
-                            for (auto &value_ptr : *values_row) {
-                                delete value_ptr;
-                                value_ptr = nullptr;
-                            }
-                            delete values_row;
-                            values_row = nullptr;
-                        }
-                    });
-
-                    for (const auto &item : first_row_json.items()) {
-                        const auto &key = item.key();
-                        auto iter = column_type_map.find(key);
-                        if (iter != column_type_map.end()) {
-                            json_response["error_code"] = ErrorCode::kDuplicateColumnName;
-                            json_response["error_message"] = fmt::format("Duplicated column name: {}", key);
-                            return ResponseFactory::createResponse(http_status, json_response.dump());
-                        }
-                        column_name_id_map.emplace(key, columns->size());
-                        columns->emplace_back(key);
-
-                        const auto &value = item.value();
-                        switch (value.type()) {
-                            case nlohmann::json::value_t::boolean: {
-                                auto bool_value = value.template get<bool>();
-                                column_type_map.emplace(key, LiteralType::kBoolean);
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kBoolean);
-                                const_expr->bool_value_ = bool_value;
-                                values_row->emplace_back(const_expr);
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_integer: {
-                                auto integer_value = value.template get<i64>();
-                                column_type_map.emplace(key, LiteralType::kInteger);
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kInteger);
-                                const_expr->integer_value_ = integer_value;
-                                values_row->emplace_back(const_expr);
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_unsigned: {
-                                auto integer_value = value.template get<u64>();
-                                column_type_map.emplace(key, LiteralType::kInteger);
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kInteger);
-                                const_expr->integer_value_ = integer_value;
-                                values_row->emplace_back(const_expr);
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_float: {
-                                auto float_value = value.template get<f64>();
-                                column_type_map.emplace(key, LiteralType::kDouble);
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kDouble);
-                                const_expr->double_value_ = float_value;
-                                values_row->emplace_back(const_expr);
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::array: {
-                                SizeT dimension = value.size();
-                                if (dimension == 0) {
-                                    json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                    json_response["error_message"] = fmt::format("Empty embedding data: {}", value);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                auto first_elem = value[0];
-                                auto first_elem_type = first_elem.type();
-                                if (first_elem_type == nlohmann::json::value_t::number_integer or
-                                    first_elem_type == nlohmann::json::value_t::number_unsigned) {
-
-                                    // Generate constant expression
-                                    infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kIntegerArray);
-                                    DeferFn defer_free_integer_array([&]() {
-                                        if (const_expr != nullptr) {
-                                            delete const_expr;
-                                            const_expr = nullptr;
-                                        }
-                                    });
-
-                                    column_type_map.emplace(key, LiteralType::kIntegerArray);
-
-                                    for (SizeT idx = 0; idx < dimension; ++idx) {
-                                        const auto &value_ref = value[idx];
-                                        const auto &value_type = value_ref.type();
-
-                                        switch (value_type) {
-                                            case nlohmann::json::value_t::number_integer: {
-                                                const_expr->long_array_.emplace_back(value_ref.template get<i64>());
-                                                break;
-                                            }
-                                            case nlohmann::json::value_t::number_unsigned: {
-                                                const_expr->long_array_.emplace_back(value_ref.template get<u64>());
-                                                break;
-                                            }
-                                            default: {
-                                                json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                                json_response["error_message"] = fmt::format("Embedding element type should be integer");
-                                                return ResponseFactory::createResponse(http_status, json_response.dump());
-                                            }
-                                        }
-                                    }
-
-                                    values_row->emplace_back(const_expr);
-                                    const_expr = nullptr;
-
-                                } else if (first_elem_type == nlohmann::json::value_t::number_float) {
-
-                                    // Generate constant expression
-                                    infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kDoubleArray);
-                                    DeferFn defer_free_double_array([&]() {
-                                        if (const_expr != nullptr) {
-                                            delete const_expr;
-                                            const_expr = nullptr;
-                                        }
-                                    });
-
-                                    column_type_map.emplace(key, LiteralType::kDoubleArray);
-
-                                    for (SizeT idx = 0; idx < dimension; ++idx) {
-                                        const auto &value_ref = value[idx];
-                                        const auto &value_type = value_ref.type();
-                                        if (value_type != nlohmann::json::value_t::number_float) {
-                                            json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                            json_response["error_message"] = fmt::format("Embedding element type should be float");
-                                            return ResponseFactory::createResponse(http_status, json_response.dump());
-                                        }
-
-                                        const_expr->double_array_.emplace_back(value_ref.template get<double>());
-                                    }
-                                    values_row->emplace_back(const_expr);
-                                    const_expr = nullptr;
-
-                                } else {
-                                    json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                    json_response["error_message"] = fmt::format("Embedding element type can only be integer or float");
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                break;
-                            }
-                            case nlohmann::json::value_t::string: {
-                                auto string_value = value.template get<String>();
-                                column_type_map.emplace(key, LiteralType::kString);
-
-                                ConstantExpr *const_expr = new ConstantExpr(LiteralType::kString);
-                                const_expr->str_value_ = strdup(string_value.c_str());
-                                values_row->emplace_back(const_expr);
-                                break;
-                            }
-                            case nlohmann::json::value_t::object:
-                            case nlohmann::json::value_t::binary:
-                            case nlohmann::json::value_t::null:
-                            case nlohmann::json::value_t::discarded: {
-                                json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                json_response["error_message"] = fmt::format("Embedding element type can only be integer or float");
-                                return ResponseFactory::createResponse(http_status, json_response.dump());
-                            }
-                        }
-
-                        //                    std::cout << key << " " << value.is_string() << std::endl;
-                    }
-                    column_values->emplace_back(values_row);
-                    values_row = nullptr;
-                }
-
-                // Other rows except the first
-                for (SizeT row_id = 1; row_id < row_count; ++row_id) {
-                    const auto &row_json = http_body_json[row_id];
-
-                    Vector<ParsedExpr *> *values_row = new Vector<infinity::ParsedExpr *>();
-                    DeferFn defer_free_value_row([&]() {
-                        if (values_row != nullptr) {
-                            for (auto &value_ptr : *values_row) {
-                                delete value_ptr;
-                                value_ptr = nullptr;
-                            }
-                            delete values_row;
-                            values_row = nullptr;
-                        }
-                    });
-                    values_row->resize(column_count);
-
-                    for (const auto &item : row_json.items()) {
-                        const auto &key = item.key();
-                        auto type_iter = column_type_map.find(key);
-                        auto id_iter = column_name_id_map.find(key);
-                        if (type_iter == column_type_map.end() || id_iter == column_name_id_map.end()) {
-                            json_response["error_code"] = ErrorCode::kColumnNotExist;
-                            json_response["error_message"] = fmt::format("Not existed column name: {}", key);
-                            return ResponseFactory::createResponse(http_status, json_response.dump());
-                        }
-
-                        u64 column_id = id_iter->second;
-                        const auto &value = item.value();
-                        switch (value.type()) {
-                            case nlohmann::json::value_t::boolean: {
-                                if (type_iter->second != LiteralType::kBoolean) {
-                                    json_response["error_code"] = ErrorCode::kDataTypeMismatch;
-                                    json_response["error_message"] = fmt::format("Column: {} expect type BOOL", key);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kBoolean);
-                                const_expr->bool_value_ = value.template get<bool>();
-                                (*values_row)[column_id] = const_expr;
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_integer: {
-                                if (type_iter->second != LiteralType::kInteger) {
-                                    json_response["error_code"] = ErrorCode::kDataTypeMismatch;
-                                    json_response["error_message"] = fmt::format("Column: {} expect type INTEGER", key);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kInteger);
-                                const_expr->integer_value_ = value.template get<i64>();
-                                (*values_row)[column_id] = const_expr;
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_unsigned: {
-                                if (type_iter->second != LiteralType::kInteger) {
-                                    json_response["error_code"] = ErrorCode::kDataTypeMismatch;
-                                    json_response["error_message"] = fmt::format("Column: {} expect type INTEGER", key);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kInteger);
-                                const_expr->integer_value_ = value.template get<u64>();
-                                (*values_row)[column_id] = const_expr;
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::number_float: {
-                                if (type_iter->second != LiteralType::kDouble) {
-                                    json_response["error_code"] = ErrorCode::kDataTypeMismatch;
-                                    json_response["error_message"] = fmt::format("Column: {} expect type FLOAT", key);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                // Generate constant expression
-                                infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kDouble);
-                                const_expr->double_value_ = value.template get<f64>();
-                                (*values_row)[column_id] = const_expr;
-                                const_expr = nullptr;
-                                break;
-                            }
-                            case nlohmann::json::value_t::array: {
-                                SizeT dimension = value.size();
-                                if (dimension == 0) {
-                                    json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                    json_response["error_message"] = fmt::format("Empty embedding data: {}", value);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                auto first_elem = value[0];
-                                auto first_elem_type = first_elem.type();
-                                if (first_elem_type == nlohmann::json::value_t::number_integer or
-                                    first_elem_type == nlohmann::json::value_t::number_unsigned) {
-
-                                    // Generate constant expression
-                                    infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kIntegerArray);
-                                    DeferFn defer_free_integer_array([&]() {
-                                        if (const_expr != nullptr) {
-                                            delete const_expr;
-                                            const_expr = nullptr;
-                                        }
-                                    });
-
-                                    for (SizeT idx = 0; idx < dimension; ++idx) {
-                                        const auto &value_ref = value[idx];
-                                        const auto &value_type = value_ref.type();
-
-                                        switch (value_type) {
-                                            case nlohmann::json::value_t::number_integer: {
-                                                const_expr->long_array_.emplace_back(value_ref.template get<i64>());
-                                                break;
-                                            }
-                                            case nlohmann::json::value_t::number_unsigned: {
-                                                const_expr->long_array_.emplace_back(value_ref.template get<u64>());
-                                                break;
-                                            }
-                                            default: {
-                                                json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                                json_response["error_message"] = fmt::format("Embedding element type should be integer");
-                                                return ResponseFactory::createResponse(http_status, json_response.dump());
-                                            }
-                                        }
-                                    }
-
-                                    (*values_row)[column_id] = const_expr;
-                                    const_expr = nullptr;
-                                } else if (first_elem_type == nlohmann::json::value_t::number_float) {
-
-                                    // Generate constant expression
-                                    infinity::ConstantExpr *const_expr = new ConstantExpr(LiteralType::kDoubleArray);
-                                    DeferFn defer_free_double_array([&]() {
-                                        if (const_expr != nullptr) {
-                                            delete const_expr;
-                                            const_expr = nullptr;
-                                        }
-                                    });
-
-                                    for (SizeT idx = 0; idx < dimension; ++idx) {
-                                        const auto &value_ref = value[idx];
-                                        const auto &value_type = value_ref.type();
-                                        if (value_type != nlohmann::json::value_t::number_float) {
-                                            json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                            json_response["error_message"] = fmt::format("Embedding element type should be float");
-                                            return ResponseFactory::createResponse(http_status, json_response.dump());
-                                        }
-
-                                        const_expr->double_array_.emplace_back(value_ref.template get<double>());
-                                    }
 
-                                    (*values_row)[column_id] = const_expr;
-                                    const_expr = nullptr;
-                                } else {
-                                    json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                    json_response["error_message"] = fmt::format("Embedding element type can only be integer or float");
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                break;
-                            }
-                            case nlohmann::json::value_t::string: {
-                                if (type_iter->second != LiteralType::kString) {
-                                    json_response["error_code"] = ErrorCode::kDataTypeMismatch;
-                                    json_response["error_message"] = fmt::format("Column: {} expect type STRING", key);
-                                    return ResponseFactory::createResponse(http_status, json_response.dump());
-                                }
-
-                                auto string_value = value.template get<String>();
-
-                                ConstantExpr *const_expr = new ConstantExpr(LiteralType::kString);
-                                const_expr->str_value_ = strdup(string_value.c_str());
-                                (*values_row)[column_id] = const_expr;
-
-                                break;
-                            }
-                            case nlohmann::json::value_t::object:
-                            case nlohmann::json::value_t::binary:
-                            case nlohmann::json::value_t::null:
-                            case nlohmann::json::value_t::discarded: {
-                                json_response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
-                                json_response["error_message"] = fmt::format("Embedding element type can only be integer or float");
-                                return ResponseFactory::createResponse(http_status, json_response.dump());
-                            }
-                        }
+        // inserted columns
+        Vector<Vector<ParsedExpr *> *> *column_values = new Vector<Vector<infinity::ParsedExpr *> *>();
+        DeferFn defer_free_column_values([&]() {
+            if (column_values != nullptr) {
+                for (auto &value_array : *column_values) {
+                    for (auto &value_ptr : *value_array) {
+                        delete value_ptr;
+                        value_ptr = nullptr;
                     }
-                    column_values->emplace_back(values_row);
-                    values_row = nullptr;
+                    delete value_array;
+                    value_array = nullptr;
                 }
+                delete column_values;
+                column_values = nullptr;
+            }
+        });
 
-                auto database_name = request->getPathVariable("database_name");
-                auto table_name = request->getPathVariable("table_name");
-                auto result = infinity->Insert(database_name, table_name, columns, column_values);
+        Vector<String> *columns = new Vector<String>();
+        DeferFn defer_free_columns([&]() {
+            if (columns != nullptr) {
+                delete columns;
                 columns = nullptr;
-                column_values = nullptr;
-                if (result.IsOk()) {
-                    json_response["error_code"] = 0;
-                    http_status = HTTPStatus::CODE_200;
-                } else {
-                    json_response["error_code"] = result.ErrorCode();
-                    json_response["error_message"] = result.ErrorMsg();
-                    http_status = HTTPStatus::CODE_500;
-                }
+            }
+        });
 
+        if (HTTPInsert::ParseBody(data_body, *columns, *column_values, json_response)) {
+            auto database_name = request->getPathVariable("database_name");
+            auto table_name = request->getPathVariable("table_name");
+            auto result = infinity->Insert(database_name, table_name, columns, column_values);
+            columns = nullptr;
+            column_values = nullptr;
+            if (result.IsOk()) {
+                json_response["error_code"] = 0;
+                http_status = HTTPStatus::CODE_200;
             } else {
-                json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
-                json_response["error_message"] = fmt::format("Invalid json format: {}", data_body);
+                json_response["error_code"] = result.ErrorCode();
+                json_response["error_message"] = result.ErrorMsg();
+                http_status = HTTPStatus::CODE_500;
             }
-
-        } catch (nlohmann::json::exception &e) {
-            json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
-            json_response["error_message"] = e.what();
         }
 
         return ResponseFactory::createResponse(http_status, json_response.dump());
@@ -1367,7 +1060,42 @@ public:
         nlohmann::json json_response;
         HTTPStatus http_status;
 
-        HTTPSearch::Process(infinity.get(), database_name, table_name, data_body, http_status, json_response);
+        auto accept = request->getHeader("Accept");
+        if (accept != nullptr && accept->find(kArrowStreamContentType) != String::npos) {
+            QueryResult result;
+            if (HTTPSearch::Search(infinity.get(), database_name, table_name, data_body, http_status, json_response, result)) {
+                if (result.IsOk()) {
+                    ArrowIPCWriter writer(result.result_table_);
+                    auto [schema_message, status] = writer.SchemaMessage();
+                    if (status.ok()) {
+                        auto read_callback = MakeShared<ArrowStreamReadCallback>(result.result_table_, std::move(schema_message));
+                        auto response = MakeShared<OutgoingResponse>(HTTPStatus::CODE_200, MakeShared<HttpStreamingBody>(read_callback));
+                        response->putHeader("Content-Type", kArrowStreamContentType);
+                        return response;
+                    }
+                    json_response["error_code"] = status.code();
+                    json_response["error_message"] = status.message();
+                } else {
+                    json_response["error_code"] = result.ErrorCode();
+                    json_response["error_message"] = result.ErrorMsg();
+                }
+                http_status = HTTPStatus::CODE_500;
+            }
+            return ResponseFactory::createResponse(http_status, json_response.dump());
+        }
+
+        QueryResult result;
+        if (HTTPSearch::Search(infinity.get(), database_name, table_name, data_body, http_status, json_response, result)) {
+            if (result.IsOk()) {
+                auto read_callback = MakeShared<JsonResultReadCallback>(result.result_table_);
+                auto response = MakeShared<OutgoingResponse>(HTTPStatus::CODE_200, MakeShared<HttpStreamingBody>(read_callback));
+                response->putHeader("Content-Type", "application/json");
+                return response;
+            }
+            json_response["error_code"] = result.ErrorCode();
+            json_response["error_message"] = result.ErrorMsg();
+            http_status = HTTPStatus::CODE_500;
+        }
 
         return ResponseFactory::createResponse(http_status, json_response.dump());
     }
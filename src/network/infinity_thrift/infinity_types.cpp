@@ -4052,6 +4052,11 @@ void ColumnField::__set_column_vectors(const std::vector<std::string> & val) {
 void ColumnField::__set_column_name(const std::string& val) {
   this->column_name = val;
 }
+
+void ColumnField::__set_element_type(const ElementType::type val) {
+  this->element_type = val;
+__isset.element_type = true;
+}
 std::ostream& operator<<(std::ostream& out, const ColumnField& obj)
 {
   obj.printTo(out);
@@ -4118,6 +4123,16 @@ uint32_t ColumnField::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast158_4;
+          xfer += iprot->readI32(ecast158_4);
+          this->element_type = static_cast<ElementType::type>(ecast158_4);
+          this->__isset.element_type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4155,6 +4170,11 @@ uint32_t ColumnField::write(::apache::thrift::protocol::TProtocol* oprot) const
   xfer += oprot->writeString(this->column_name);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.element_type) {
+    xfer += oprot->writeFieldBegin("element_type", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(static_cast<int32_t>(this->element_type));
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -4165,6 +4185,7 @@ void swap(ColumnField &a, ColumnField &b) {
   swap(a.column_type, b.column_type);
   swap(a.column_vectors, b.column_vectors);
   swap(a.column_name, b.column_name);
+  swap(a.element_type, b.element_type);
   swap(a.__isset, b.__isset);
 }
 
@@ -4172,12 +4193,14 @@ ColumnField::ColumnField(const ColumnField& other165) {
   column_type = other165.column_type;
   column_vectors = other165.column_vectors;
   column_name = other165.column_name;
+  element_type = other165.element_type;
   __isset = other165.__isset;
 }
 ColumnField& ColumnField::operator=(const ColumnField& other166) {
   column_type = other166.column_type;
   column_vectors = other166.column_vectors;
   column_name = other166.column_name;
+  element_type = other166.element_type;
   __isset = other166.__isset;
   return *this;
 }
@@ -4187,6 +4210,7 @@ void ColumnField::printTo(std::ostream& out) const {
   out << "column_type=" << to_string(column_type);
   out << ", " << "column_vectors=" << to_string(column_vectors);
   out << ", " << "column_name=" << to_string(column_name);
+  out << ", " << "element_type="; (__isset.element_type ? (out << to_string(element_type)) : (out << "<null>"));
   out << ")";
 }
 
@@ -8018,6 +8042,10 @@ void InsertRequest::__set_fields(const std::vector<Field> & val) {
 void InsertRequest::__set_session_id(const int64_t val) {
   this->session_id = val;
 }
+
+void InsertRequest::__set_column_fields(const std::vector<ColumnField> & val) {
+  this->column_fields = val;
+}
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj)
 {
   obj.printTo(out);
@@ -8110,6 +8138,26 @@ uint32_t InsertRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->column_fields.clear();
+            uint32_t _size370;
+            ::apache::thrift::protocol::TType _etype373;
+            xfer += iprot->readListBegin(_etype373, _size370);
+            this->column_fields.resize(_size370);
+            uint32_t _i374;
+            for (_i374 = 0; _i374 < _size370; ++_i374)
+            {
+              xfer += this->column_fields[_i374].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.column_fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -8163,6 +8211,18 @@ uint32_t InsertRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeI64(this->session_id);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 6);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
+    std::vector<ColumnField> ::const_iterator _iter375;
+    for (_iter375 = this->column_fields.begin(); _iter375 != this->column_fields.end(); ++_iter375)
+    {
+      xfer += (*_iter375).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -8175,6 +8235,7 @@ void swap(InsertRequest &a, InsertRequest &b) {
   swap(a.column_names, b.column_names);
   swap(a.fields, b.fields);
   swap(a.session_id, b.session_id);
+  swap(a.column_fields, b.column_fields);
   swap(a.__isset, b.__isset);
 }
 
@@ -8184,6 +8245,7 @@ InsertRequest::InsertRequest(const InsertRequest& other267) {
   column_names = other267.column_names;
   fields = other267.fields;
   session_id = other267.session_id;
+  column_fields = other267.column_fields;
   __isset = other267.__isset;
 }
 InsertRequest& InsertRequest::operator=(const InsertRequest& other268) {
@@ -8192,6 +8254,7 @@ InsertRequest& InsertRequest::operator=(const InsertRequest& other268) {
   column_names = other268.column_names;
   fields = other268.fields;
   session_id = other268.session_id;
+  column_fields = other268.column_fields;
   __isset = other268.__isset;
   return *this;
 }
@@ -8203,6 +8266,7 @@ void InsertRequest::printTo(std::ostream& out) const {
   out << ", " << "column_names=" << to_string(column_names);
   out << ", " << "fields=" << to_string(fields);
   out << ", " << "session_id=" << to_string(session_id);
+  out << ", " << "column_fields=" << to_string(column_fields);
   out << ")";
 }
 
@@ -9033,6 +9097,11 @@ void SelectRequest::__set_order_by_list(const std::vector<OrderByExpr> & val) {
   this->order_by_list = val;
 __isset.order_by_list = true;
 }
+
+void SelectRequest::__set_arrow_format(const bool val) {
+  this->arrow_format = val;
+__isset.arrow_format = true;
+}
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj)
 {
   obj.printTo(out);
@@ -9185,6 +9254,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 12:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->arrow_format);
+          this->__isset.arrow_format = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -9277,6 +9354,11 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     }
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.arrow_format) {
+    xfer += oprot->writeFieldBegin("arrow_format", ::apache::thrift::protocol::T_BOOL, 12);
+    xfer += oprot->writeBool(this->arrow_format);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -9295,6 +9377,7 @@ void swap(SelectRequest &a, SelectRequest &b) {
   swap(a.limit_expr, b.limit_expr);
   swap(a.offset_expr, b.offset_expr);
   swap(a.order_by_list, b.order_by_list);
+  swap(a.arrow_format, b.arrow_format);
   swap(a.__isset, b.__isset);
 }
 
@@ -9310,6 +9393,7 @@ SelectRequest::SelectRequest(const SelectRequest& other324) {
   limit_expr = other324.limit_expr;
   offset_expr = other324.offset_expr;
   order_by_list = other324.order_by_list;
+  arrow_format = other324.arrow_format;
   __isset = other324.__isset;
 }
 SelectRequest& SelectRequest::operator=(const SelectRequest& other325) {
@@ -9324,6 +9408,7 @@ SelectRequest& SelectRequest::operator=(const SelectRequest& other325) {
   limit_expr = other325.limit_expr;
   offset_expr = other325.offset_expr;
   order_by_list = other325.order_by_list;
+  arrow_format = other325.arrow_format;
   __isset = other325.__isset;
   return *this;
 }
@@ -9341,6 +9426,7 @@ void SelectRequest::printTo(std::ostream& out) const {
   out << ", " << "limit_expr="; (__isset.limit_expr ? (out << to_string(limit_expr)) : (out << "<null>"));
   out << ", " << "offset_expr="; (__isset.offset_expr ? (out << to_string(offset_expr)) : (out << "<null>"));
   out << ", " << "order_by_list="; (__isset.order_by_list ? (out << to_string(order_by_list)) : (out << "<null>"));
+  out << ", " << "arrow_format="; (__isset.arrow_format ? (out << to_string(arrow_format)) : (out << "<null>"));
   out << ")";
 }
 
@@ -9364,6 +9450,10 @@ void SelectResponse::__set_column_defs(const std::vector<ColumnDef> & val) {
 void SelectResponse::__set_column_fields(const std::vector<ColumnField> & val) {
   this->column_fields = val;
 }
+
+void SelectResponse::__set_arrow_batches(const std::vector<std::string> & val) {
+  this->arrow_batches = val;
+}
 std::ostream& operator<<(std::ostream& out, const SelectResponse& obj)
 {
   obj.printTo(out);
@@ -9448,6 +9538,26 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->arrow_batches.clear();
+            uint32_t _size376;
+            ::apache::thrift::protocol::TType _etype379;
+            xfer += iprot->readListBegin(_etype379, _size376);
+            this->arrow_batches.resize(_size376);
+            uint32_t _i380;
+            for (_i380 = 0; _i380 < _size376; ++_i380)
+            {
+              xfer += iprot->readBinary(this->arrow_batches[_i380]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.arrow_batches = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -9497,6 +9607,18 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("arrow_batches", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->arrow_batches.size()));
+    std::vector<std::string> ::const_iterator _iter381;
+    for (_iter381 = this->arrow_batches.begin(); _iter381 != this->arrow_batches.end(); ++_iter381)
+    {
+      xfer += oprot->writeBinary((*_iter381));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -9508,6 +9630,7 @@ void swap(SelectResponse &a, SelectResponse &b) {
   swap(a.error_msg, b.error_msg);
   swap(a.column_defs, b.column_defs);
   swap(a.column_fields, b.column_fields);
+  swap(a.arrow_batches, b.arrow_batches);
   swap(a.__isset, b.__isset);
 }
 
@@ -9516,6 +9639,7 @@ SelectResponse::SelectResponse(const SelectResponse& other338) {
   error_msg = other338.error_msg;
   column_defs = other338.column_defs;
   column_fields = other338.column_fields;
+  arrow_batches = other338.arrow_batches;
   __isset = other338.__isset;
 }
 SelectResponse& SelectResponse::operator=(const SelectResponse& other339) {
@@ -9523,6 +9647,7 @@ SelectResponse& SelectResponse::operator=(const SelectResponse& other339) {
   error_msg = other339.error_msg;
   column_defs = other339.column_defs;
   column_fields = other339.column_fields;
+  arrow_batches = other339.arrow_batches;
   __isset = other339.__isset;
   return *this;
 }
@@ -9533,6 +9658,7 @@ void SelectResponse::printTo(std::ostream& out) const {
   out << ", " << "error_msg=" << to_string(error_msg);
   out << ", " << "column_defs=" << to_string(column_defs);
   out << ", " << "column_fields=" << to_string(column_fields);
+  out << ", " << "arrow_batches=" << to_string(arrow_batches);
   out << ")";
 }
 
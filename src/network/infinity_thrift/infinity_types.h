@@ -1736,10 +1736,11 @@ void swap(Field &a, Field &b);
 std::ostream& operator<<(std::ostream& out, const Field& obj);
 
 typedef struct _ColumnField__isset {
-  _ColumnField__isset() : column_type(false), column_vectors(true), column_name(false) {}
+  _ColumnField__isset() : column_type(false), column_vectors(true), column_name(false), element_type(false) {}
   bool column_type :1;
   bool column_vectors :1;
   bool column_name :1;
+  bool element_type :1;
 } _ColumnField__isset;
 
 class ColumnField : public virtual ::apache::thrift::TBase {
@@ -1749,7 +1750,8 @@ class ColumnField : public virtual ::apache::thrift::TBase {
   ColumnField& operator=(const ColumnField&);
   ColumnField() noexcept
               : column_type(static_cast<ColumnType::type>(0)),
-                column_name() {
+                column_name(),
+                element_type(static_cast<ElementType::type>(0)) {
 
   }
 
@@ -1761,6 +1763,11 @@ class ColumnField : public virtual ::apache::thrift::TBase {
   ColumnType::type column_type;
   std::vector<std::string>  column_vectors;
   std::string column_name;
+  /**
+   * 
+   * @see ElementType
+   */
+  ElementType::type element_type;
 
   _ColumnField__isset __isset;
 
@@ -1770,6 +1777,8 @@ class ColumnField : public virtual ::apache::thrift::TBase {
 
   void __set_column_name(const std::string& val);
 
+  void __set_element_type(const ElementType::type val);
+
   bool operator == (const ColumnField & rhs) const
   {
     if (!(column_type == rhs.column_type))
@@ -1778,6 +1787,10 @@ class ColumnField : public virtual ::apache::thrift::TBase {
       return false;
     if (!(column_name == rhs.column_name))
       return false;
+    if (__isset.element_type != rhs.__isset.element_type)
+      return false;
+    else if (__isset.element_type && !(element_type == rhs.element_type))
+      return false;
     return true;
   }
   bool operator != (const ColumnField &rhs) const {
@@ -3357,12 +3370,13 @@ void swap(DropTableRequest &a, DropTableRequest &b);
 std::ostream& operator<<(std::ostream& out, const DropTableRequest& obj);
 
 typedef struct _InsertRequest__isset {
-  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false) {}
+  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false), column_fields(true) {}
   bool db_name :1;
   bool table_name :1;
   bool column_names :1;
   bool fields :1;
   bool session_id :1;
+  bool column_fields :1;
 } _InsertRequest__isset;
 
 class InsertRequest : public virtual ::apache::thrift::TBase {
@@ -3384,6 +3398,7 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
   std::vector<std::string>  column_names;
   std::vector<Field>  fields;
   int64_t session_id;
+  std::vector<ColumnField>  column_fields;
 
   _InsertRequest__isset __isset;
 
@@ -3397,6 +3412,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
 
   void __set_session_id(const int64_t val);
 
+  void __set_column_fields(const std::vector<ColumnField> & val);
+
   bool operator == (const InsertRequest & rhs) const
   {
     if (!(db_name == rhs.db_name))
@@ -3409,6 +3426,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
       return false;
     if (!(session_id == rhs.session_id))
       return false;
+    if (!(column_fields == rhs.column_fields))
+      return false;
     return true;
   }
   bool operator != (const InsertRequest &rhs) const {
@@ -3702,7 +3721,7 @@ void swap(ExplainResponse &a, ExplainResponse &b);
 std::ostream& operator<<(std::ostream& out, const ExplainResponse& obj);
 
 typedef struct _SelectRequest__isset {
-  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true) {}
+  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true), arrow_format(false) {}
   bool session_id :1;
   bool db_name :1;
   bool table_name :1;
@@ -3714,6 +3733,7 @@ typedef struct _SelectRequest__isset {
   bool limit_expr :1;
   bool offset_expr :1;
   bool order_by_list :1;
+  bool arrow_format :1;
 } _SelectRequest__isset;
 
 class SelectRequest : public virtual ::apache::thrift::TBase {
@@ -3724,7 +3744,8 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   SelectRequest() noexcept
                 : session_id(0),
                   db_name(),
-                  table_name() {
+                  table_name(),
+                  arrow_format(false) {
 
 
 
@@ -3742,6 +3763,7 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   ParsedExpr limit_expr;
   ParsedExpr offset_expr;
   std::vector<OrderByExpr>  order_by_list;
+  bool arrow_format;
 
   _SelectRequest__isset __isset;
 
@@ -3767,6 +3789,8 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
 
   void __set_order_by_list(const std::vector<OrderByExpr> & val);
 
+  void __set_arrow_format(const bool val);
+
   bool operator == (const SelectRequest & rhs) const
   {
     if (!(session_id == rhs.session_id))
@@ -3805,6 +3829,10 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.order_by_list && !(order_by_list == rhs.order_by_list))
       return false;
+    if (__isset.arrow_format != rhs.__isset.arrow_format)
+      return false;
+    else if (__isset.arrow_format && !(arrow_format == rhs.arrow_format))
+      return false;
     return true;
   }
   bool operator != (const SelectRequest &rhs) const {
@@ -3824,11 +3852,12 @@ void swap(SelectRequest &a, SelectRequest &b);
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj);
 
 typedef struct _SelectResponse__isset {
-  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true) {}
+  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true), arrow_batches(true) {}
   bool error_code :1;
   bool error_msg :1;
   bool column_defs :1;
   bool column_fields :1;
+  bool arrow_batches :1;
 } _SelectResponse__isset;
 
 class SelectResponse : public virtual ::apache::thrift::TBase {
@@ -3848,6 +3877,7 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   std::string error_msg;
   std::vector<ColumnDef>  column_defs;
   std::vector<ColumnField>  column_fields;
+  std::vector<std::string>  arrow_batches;
 
   _SelectResponse__isset __isset;
 
@@ -3859,6 +3889,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
 
   void __set_column_fields(const std::vector<ColumnField> & val);
 
+  void __set_arrow_batches(const std::vector<std::string> & val);
+
   bool operator == (const SelectResponse & rhs) const
   {
     if (!(error_code == rhs.error_code))
@@ -3869,6 +3901,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
       return false;
     if (!(column_fields == rhs.column_fields))
       return false;
+    if (!(arrow_batches == rhs.arrow_batches))
+      return false;
     return true;
   }
   bool operator != (const SelectResponse &rhs) const {
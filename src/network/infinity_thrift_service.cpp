@@ -57,6 +57,7 @@ import extra_ddl_info;
 
 import column_vector;
 import query_result;
+import arrow_ipc_writer;
 
 namespace infinity {
 
@@ -223,6 +224,18 @@ void InfinityThriftService::Insert(infinity_thrift_rpc::CommonResponse &response
         return;
     }
 
+    if (!request.column_fields.empty()) {
+        Vector<ColumnarInsertField> fields;
+        Status field_status = GetColumnarInsertFields(request, fields);
+        if (!field_status.ok()) {
+            ProcessStatus(response, field_status);
+            return;
+        }
+        auto result = infinity->InsertColumnar(request.db_name, request.table_name, fields);
+        ProcessQueryResult(response, result);
+        return;
+    }
+
     if (request.fields.empty()) {
         ProcessStatus(response, Status::InsertWithoutValues());
         return;
@@ -284,6 +297,40 @@ void InfinityThriftService::Insert(infinity_thrift_rpc::CommonResponse &response
     ProcessQueryResult(response, result);
 }
 
+Status InfinityThriftService::GetColumnarInsertFields(const infinity_thrift_rpc::InsertRequest &request, Vector<ColumnarInsertField> &fields) {
+    fields.reserve(request.column_fields.size());
+    for (const auto &column_field : request.column_fields) {
+        ColumnarInsertField field;
+        field.column_name_ = column_field.column_name;
+        field.logical_type_ = ProtoColumnTypeToLogicalType(column_field.column_type);
+        if (field.logical_type_ == LogicalType::kInvalid) {
+            return Status::InvalidDataType();
+        }
+        SizeT buffer_count = field.logical_type_ == LogicalType::kVarchar ? 2 : 1;
+        if (column_field.column_vectors.size() != buffer_count) {
+            return Status::SyntaxError(
+                fmt::format("Column {} expects {} buffers, got {}", column_field.column_name, buffer_count, column_field.column_vectors.size()));
+        }
+        if (field.logical_type_ == LogicalType::kEmbedding) {
+            if (!column_field.__isset.element_type) {
+                return Status::SyntaxError(fmt::format("Embedding column {} has no element type", column_field.column_name));
+            }
+            field.embedding_data_type_ = GetEmbeddingDataTypeFromProto(column_field.element_type);
+            if (field.embedding_data_type_ == EmbeddingDataType::kElemInvalid) {
+                return Status::InvalidEmbeddingDataType();
+            }
+        }
+        if (field.logical_type_ == LogicalType::kVarchar) {
+            field.offsets_ = column_field.column_vectors[0];
+            field.data_ = column_field.column_vectors[1];
+        } else {
+            field.data_ = column_field.column_vectors[0];
+        }
+        fields.emplace_back(std::move(field));
+    }
+    return Status::OK();
+}
+
 Tuple<CopyFileType, Status> InfinityThriftService::GetCopyFileType(infinity_thrift_rpc::CopyFileType::type copy_file_type) {
     switch (copy_file_type) {
         case infinity_thrift_rpc::CopyFileType::CSV:
@@ -488,9 +535,13 @@ void InfinityThriftService::Select(infinity_thrift_rpc::SelectResponse &response
     // auto start4 = std::chrono::steady_clock::now();
 
     if (result.IsOk()) {
-        auto &columns = response.column_fields;
-        columns.resize(result.result_table_->ColumnCount());
-        ProcessDataBlocks(result, response, columns);
+        if (request.__isset.arrow_format and request.arrow_format) {
+            ProcessArrowBatches(result, response);
+        } else {
+            auto &columns = response.column_fields;
+            columns.resize(result.result_table_->ColumnCount());
+            ProcessDataBlocks(result, response, columns);
+        }
     } else {
         ProcessQueryResult(response, result);
     }
@@ -1741,6 +1792,31 @@ infinity_thrift_rpc::ColumnType::type InfinityThriftService::DataTypeToProtoColu
     return infinity_thrift_rpc::ColumnType::ColumnInvalid;
 }
 
+LogicalType InfinityThriftService::ProtoColumnTypeToLogicalType(infinity_thrift_rpc::ColumnType::type column_type) {
+    switch (column_type) {
+        case infinity_thrift_rpc::ColumnType::ColumnBool:
+            return LogicalType::kBoolean;
+        case infinity_thrift_rpc::ColumnType::ColumnInt8:
+            return LogicalType::kTinyInt;
+        case infinity_thrift_rpc::ColumnType::ColumnInt16:
+            return LogicalType::kSmallInt;
+        case infinity_thrift_rpc::ColumnType::ColumnInt32:
+            return LogicalType::kInteger;
+        case infinity_thrift_rpc::ColumnType::ColumnInt64:
+            return LogicalType::kBigInt;
+        case infinity_thrift_rpc::ColumnType::ColumnFloat32:
+            return LogicalType::kFloat;
+        case infinity_thrift_rpc::ColumnType::ColumnFloat64:
+            return LogicalType::kDouble;
+        case infinity_thrift_rpc::ColumnType::ColumnVarchar:
+            return LogicalType::kVarchar;
+        case infinity_thrift_rpc::ColumnType::ColumnEmbedding:
+            return LogicalType::kEmbedding;
+        default:
+            return LogicalType::kInvalid;
+    }
+}
+
 UniquePtr<infinity_thrift_rpc::DataType> InfinityThriftService::DataTypeToProtoDataType(const SharedPtr<DataType> &data_type) {
     switch (data_type->type()) {
         case LogicalType::kBoolean: {
@@ -1823,6 +1899,10 @@ infinity_thrift_rpc::ElementType::type InfinityThriftService::EmbeddingDataTypeT
             return infinity_thrift_rpc::ElementType::ElementFloat32;
         case EmbeddingDataType::kElemDouble:
             return infinity_thrift_rpc::ElementType::ElementFloat64;
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16:
+            // the protocol has no half precision element, the data is widened in HandleEmbeddingType
+            return infinity_thrift_rpc::ElementType::ElementFloat32;
         case EmbeddingDataType::kElemInvalid: {
             UnrecoverableError("Invalid embedding element data type");
         }
@@ -1845,6 +1925,24 @@ void InfinityThriftService::ProcessDataBlocks(const QueryResult &result,
     HandleColumnDef(response, result.result_table_->ColumnCount(), result.result_table_->definition_ptr_, columns);
 }
 
+// The concatenation of the arrow batches is an arrow IPC stream: schema, one record batch per data block, end of stream
+void InfinityThriftService::ProcessArrowBatches(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response) {
+    ArrowIPCWriter writer(result.result_table_);
+    auto [schema_message, status] = writer.SchemaMessage();
+    if (!status.ok()) {
+        ProcessStatus(response, status);
+        return;
+    }
+    auto &arrow_batches = response.arrow_batches;
+    arrow_batches.reserve(writer.BatchCount() + 2);
+    schema_message->AppendTo(arrow_batches.emplace_back());
+    for (SizeT block_id = 0; block_id < writer.BatchCount(); ++block_id) {
+        writer.RecordBatchMessage(block_id)->AppendTo(arrow_batches.emplace_back());
+    }
+    ArrowIPCWriter::EndOfStreamMessage()->AppendTo(arrow_batches.emplace_back());
+    response.__set_error_code((i64)(ErrorCode::kOk));
+}
+
 Status
 InfinityThriftService::ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<infinity_thrift_rpc::ColumnField> &columns) {
     auto row_count = data_block->row_count();
@@ -1965,11 +2063,35 @@ void InfinityThriftService::HandleVarcharType(infinity_thrift_rpc::ColumnField &
 void InfinityThriftService::HandleEmbeddingType(infinity_thrift_rpc::ColumnField &output_column_field,
                                                 SizeT row_count,
                                                 const SharedPtr<ColumnVector> &column_vector) {
-    auto size = column_vector->data_type()->Size() * row_count;
-    String dst;
-    dst.resize(size);
-    std::memcpy(dst.data(), column_vector->data(), size);
-    output_column_field.column_vectors.emplace_back(std::move(dst));
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_vector->data_type()->type_info().get());
+    auto widen = [&]<typename HalfType>() {
+        SizeT element_count = embedding_info->Dimension() * row_count;
+        String dst;
+        dst.resize(element_count * sizeof(f32));
+        const auto *src = reinterpret_cast<const HalfType *>(column_vector->data());
+        auto *dst_ptr = reinterpret_cast<f32 *>(dst.data());
+        for (SizeT i = 0; i < element_count; ++i) {
+            dst_ptr[i] = static_cast<f32>(src[i]);
+        }
+        output_column_field.column_vectors.emplace_back(std::move(dst));
+    };
+    switch (embedding_info->Type()) {
+        case EmbeddingDataType::kElemFloat16: {
+            widen.template operator()<Float16T>();
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            widen.template operator()<BFloat16T>();
+            break;
+        }
+        default: {
+            auto size = column_vector->data_type()->Size() * row_count;
+            String dst;
+            dst.resize(size);
+            std::memcpy(dst.data(), column_vector->data(), size);
+            output_column_field.column_vectors.emplace_back(std::move(dst));
+        }
+    }
     output_column_field.__set_column_type(DataTypeToProtoColumnType(column_vector->data_type()));
 }
 
@@ -41,6 +41,8 @@ import table_def;
 
 import column_vector;
 import query_result;
+import query_context;
+import logical_type;
 
 namespace infinity {
 
@@ -162,6 +164,11 @@ private:
 
     static infinity_thrift_rpc::ColumnType::type DataTypeToProtoColumnType(const SharedPtr<DataType> &data_type);
 
+    static LogicalType ProtoColumnTypeToLogicalType(infinity_thrift_rpc::ColumnType::type column_type);
+
+    // Columnar inserts carry one buffer per column, varchar columns have offsets and bytes.
+    static Status GetColumnarInsertFields(const infinity_thrift_rpc::InsertRequest &request, Vector<ColumnarInsertField> &fields);
+
     UniquePtr<infinity_thrift_rpc::DataType> DataTypeToProtoDataType(const SharedPtr<DataType> &data_type);
 
     infinity_thrift_rpc::ElementType::type EmbeddingDataTypeToProtoElementType(const EmbeddingInfo &embedding_info);
@@ -171,6 +178,8 @@ private:
 
     Status ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<infinity_thrift_rpc::ColumnField> &columns);
 
+    void ProcessArrowBatches(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response);
+
     void HandleColumnDef(infinity_thrift_rpc::SelectResponse &response,
                          SizeT column_count,
                          SharedPtr<TableDef> table_def,
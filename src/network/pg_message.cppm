@@ -40,6 +40,13 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
+    kPortalSuspended = 's',
+    kEmptyQueryResponse = 'I',
 
     // Errors
     kHumanReadableError = 'M',
@@ -60,6 +67,18 @@ enum class PGMessageType : unsigned char {
     kCloseCommand = 'C',
 };
 
+// Format code of a parameter or result column, from the Bind message
+enum class PGFormatCode : i16 {
+    kText = 0,
+    kBinary = 1,
+};
+
+// Target of the Describe and Close messages
+enum class PGObjectType : char {
+    kStatement = 'S',
+    kPortal = 'P',
+};
+
 enum class TransactionStateType : unsigned char {
     kIDLE = 'I',  // Not in a transaction block
     kBlock = 'T', // In a transaction block
@@ -17,13 +17,81 @@ module;
 import boost;
 import stl;
 import pg_message;
+import third_party;
+import infinity_exception;
+import default_values;
+import logger;
+import status;
 module pg_protocol_handler;
 
 namespace infinity {
 
+namespace {
+
+// Reads the fields of a message body, integers are in network byte order
+class PGMessageBody {
+public:
+    explicit PGMessageBody(String body) : body_(std::move(body)) {}
+
+    String ReadString() {
+        SizeT end = body_.find(NULL_END, position_);
+        if (end == String::npos) {
+            UnrecoverableError("Malformed PG message: unterminated string");
+        }
+        String result = body_.substr(position_, end - position_);
+        position_ = end + 1;
+        return result;
+    }
+
+    String ReadBytes(SizeT length) {
+        CheckRemaining(length);
+        String result = body_.substr(position_, length);
+        position_ += length;
+        return result;
+    }
+
+    char ReadChar() {
+        CheckRemaining(sizeof(char));
+        return body_[position_++];
+    }
+
+    i16 ReadI16() { return static_cast<i16>(ReadUnsigned(sizeof(i16))); }
+
+    i32 ReadI32() { return static_cast<i32>(ReadUnsigned(sizeof(i32))); }
+
+private:
+    u32 ReadUnsigned(SizeT size) {
+        CheckRemaining(size);
+        u32 value = 0;
+        for (SizeT i = 0; i < size; ++i) {
+            value = (value << 8) | static_cast<u8>(body_[position_ + i]);
+        }
+        position_ += size;
+        return value;
+    }
+
+    void CheckRemaining(SizeT size) const {
+        if (position_ + size > body_.size()) {
+            UnrecoverableError(fmt::format("Malformed PG message: {} bytes needed, {} left", size, body_.size() - position_));
+        }
+    }
+
+    String body_;
+    SizeT position_{0};
+};
+
+PGObjectType ToObjectType(char object_type) {
+    if (object_type != static_cast<char>(PGObjectType::kStatement) && object_type != static_cast<char>(PGObjectType::kPortal)) {
+        UnrecoverableError(fmt::format("Malformed PG message: unknown object type {}", object_type));
+    }
+    return static_cast<PGObjectType>(object_type);
+}
+
+} // namespace
+
 PGProtocolHandler::PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : buffer_reader_(socket), buffer_writer_(socket) {}
 
-u32 PGProtocolHandler::read_startup_header() {
+Optional<u32> PGProtocolHandler::read_startup_header() {
     constexpr u32 SSL_MESSAGE_VERSION = 80877103u;
     const auto length = buffer_reader_.read_value_u32();
     const auto version = buffer_reader_.read_value_u32();
@@ -32,7 +100,7 @@ u32 PGProtocolHandler::read_startup_header() {
         // Now we said not support ssl
         buffer_writer_.send_value_u8(static_cast<unsigned char>(PGMessageType::kSSLNo));
         buffer_writer_.flush();
-        return read_startup_header();
+        return None;
     } else {
         return length - 2 * LENGTH_FIELD_SIZE;
     }
@@ -70,10 +138,15 @@ void PGProtocolHandler::send_ready_for_query() {
     buffer_writer_.flush();
 }
 
-PGMessageType PGProtocolHandler::read_command_type() { return static_cast<PGMessageType>(buffer_reader_.read_value_i8()); }
+PGMessageType PGProtocolHandler::read_command_type() {
+    auto cmd_type = static_cast<PGMessageType>(buffer_reader_.read_value_i8());
+    body_pending_ = true;
+    return cmd_type;
+}
 
 String PGProtocolHandler::read_command_body() {
     const auto command_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    body_pending_ = false;
     return buffer_reader_.read_string(command_length);
 }
 
@@ -112,7 +185,7 @@ void PGProtocolHandler::SendDescriptionHeader(u32 total_column_name_length, u32
     buffer_writer_.send_value_u16(column_count);
 }
 
-void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width) {
+void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format_code) {
     buffer_writer_.send_string(column_name);
 
     buffer_writer_.send_value_u32(0); // No OID for the table;
@@ -121,7 +194,7 @@ void PGProtocolHandler::SendDescription(const String &column_name, u32 object_id
     buffer_writer_.send_value_u32(object_id); // OID of the type
     buffer_writer_.send_value_u16(width);     // Type width
     buffer_writer_.send_value_i32(-1);        // No modifier
-    buffer_writer_.send_value_i16(0);         // Text format
+    buffer_writer_.send_value_i16(static_cast<i16>(format_code));
 }
 
 void PGProtocolHandler::SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum) {
@@ -163,4 +236,143 @@ void PGProtocolHandler::SendComplete(const String &complete_message) {
     buffer_writer_.send_string(complete_message);
 }
 
+void PGProtocolHandler::SendBytes(const String &messages) { buffer_writer_.send_bytes(messages.data(), messages.size()); }
+
+String PGProtocolHandler::read_message_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    body_pending_ = false;
+    return buffer_reader_.read_string(body_length, NullTerminator::kNo);
+}
+
+PGParseMessage PGProtocolHandler::ReadParse() {
+    PGMessageBody body(read_message_body());
+    PGParseMessage message;
+    message.statement_name_ = body.ReadString();
+    message.query_ = body.ReadString();
+    i16 parameter_count = body.ReadI16();
+    for (i16 idx = 0; idx < parameter_count; ++idx) {
+        message.parameter_types_.emplace_back(body.ReadI32());
+    }
+    return message;
+}
+
+PGBindMessage PGProtocolHandler::ReadBind() {
+    PGMessageBody body(read_message_body());
+    PGBindMessage message;
+    message.portal_name_ = body.ReadString();
+    message.statement_name_ = body.ReadString();
+    // Parameter format codes are skipped, parameters are not supported by the SQL parser anyway
+    i16 parameter_format_count = body.ReadI16();
+    for (i16 idx = 0; idx < parameter_format_count; ++idx) {
+        body.ReadI16();
+    }
+    i16 parameter_count = body.ReadI16();
+    for (i16 idx = 0; idx < parameter_count; ++idx) {
+        i32 parameter_length = body.ReadI32();
+        if (parameter_length < 0) {
+            message.parameters_.emplace_back(None);
+        } else {
+            message.parameters_.emplace_back(body.ReadBytes(parameter_length));
+        }
+    }
+    i16 result_format_count = body.ReadI16();
+    for (i16 idx = 0; idx < result_format_count; ++idx) {
+        i16 format_code = body.ReadI16();
+        if (format_code != static_cast<i16>(PGFormatCode::kText) && format_code != static_cast<i16>(PGFormatCode::kBinary)) {
+            UnrecoverableError(fmt::format("Malformed PG message: unknown format code {}", format_code));
+        }
+        message.result_formats_.emplace_back(static_cast<PGFormatCode>(format_code));
+    }
+    return message;
+}
+
+PGDescribeMessage PGProtocolHandler::ReadDescribe() {
+    PGMessageBody body(read_message_body());
+    PGDescribeMessage message;
+    message.object_type_ = ToObjectType(body.ReadChar());
+    message.name_ = body.ReadString();
+    return message;
+}
+
+PGExecuteMessage PGProtocolHandler::ReadExecute() {
+    PGMessageBody body(read_message_body());
+    PGExecuteMessage message;
+    message.portal_name_ = body.ReadString();
+    message.max_rows_ = body.ReadI32();
+    return message;
+}
+
+PGCloseMessage PGProtocolHandler::ReadClose() {
+    PGMessageBody body(read_message_body());
+    PGCloseMessage message;
+    message.object_type_ = ToObjectType(body.ReadChar());
+    message.name_ = body.ReadString();
+    return message;
+}
+
+void PGProtocolHandler::SkipMessage() { read_message_body(); }
+
+void PGProtocolHandler::DiscardMessageBody() {
+    if (body_pending_) {
+        read_message_body();
+    }
+}
+
+void PGProtocolHandler::SendParseComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParseComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendBindComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kBindComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendCloseComplete() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kCloseComplete));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendParameterDescription(const Vector<u32> &parameter_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_types.size());
+    for (u32 parameter_type : parameter_types) {
+        buffer_writer_.send_value_u32(parameter_type);
+    }
+}
+
+void PGProtocolHandler::SendNoData() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kNoData));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendPortalSuspended() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kPortalSuspended));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::SendEmptyQueryResponse() {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kEmptyQueryResponse));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::Flush() { buffer_writer_.flush(); }
+
+bool PGProtocolHandler::MessageBuffered(bool startup) {
+    // The startup message has no type byte before its length
+    const SizeT length_offset = startup ? 0 : sizeof(u8);
+    buffer_reader_.fill_from_overflow();
+    if (buffer_reader_.size() < length_offset + LENGTH_FIELD_SIZE) {
+        return false;
+    }
+    const u32 length = buffer_reader_.peek_value_u32(length_offset);
+    const u32 min_length = startup ? 2 * LENGTH_FIELD_SIZE : LENGTH_FIELD_SIZE;
+    if (length < min_length || length > PG_MAX_MESSAGE_SIZE) {
+        LOG_WARN(fmt::format("Malformed PG message: length {}", length));
+        RecoverableError(Status::ClientClose());
+    }
+    return buffer_reader_.buffered_size() >= length_offset + length;
+}
+
 } // namespace infinity
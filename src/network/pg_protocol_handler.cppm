@@ -23,11 +23,42 @@ export module pg_protocol_handler;
 
 namespace infinity {
 
+// Messages of the extended query protocol, https://www.postgresql.org/docs/14/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
+export struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    Vector<u32> parameter_types_{};
+};
+
+export struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    Vector<Optional<String>> parameters_{};
+    Vector<PGFormatCode> result_formats_{};
+};
+
+export struct PGDescribeMessage {
+    PGObjectType object_type_{PGObjectType::kStatement};
+    String name_{};
+};
+
+export struct PGExecuteMessage {
+    String portal_name_{};
+    // 0 means no limit
+    i32 max_rows_{0};
+};
+
+export struct PGCloseMessage {
+    PGObjectType object_type_{PGObjectType::kStatement};
+    String name_{};
+};
+
 export class PGProtocolHandler {
 public:
     explicit PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket);
 
-    u32 read_startup_header();
+    // Returns the length of the startup body, or None for an SSL request, which is answered and followed by another startup message
+    Optional<u32> read_startup_header();
 
     void read_startup_body(u32 body_size);
 
@@ -47,11 +78,52 @@ public:
 
     void SendDescriptionHeader(u32 total_column_name_length, u32 column_count);
 
-    void SendDescription(const String &column_name, u32 object_id, u16 width);
+    void SendDescription(const String &column_name, u32 object_id, u16 width, PGFormatCode format_code = PGFormatCode::kText);
 
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
+    // Already encoded messages, e.g. a batch of DataRow
+    void SendBytes(const String &messages);
+
     void SendComplete(const String &complete_message);
+
+    PGParseMessage ReadParse();
+
+    PGBindMessage ReadBind();
+
+    PGDescribeMessage ReadDescribe();
+
+    PGExecuteMessage ReadExecute();
+
+    PGCloseMessage ReadClose();
+
+    // Sync, Flush and the messages skipped after an error until the next Sync
+    void SkipMessage();
+
+    // Skips the body of the current message if it is not read yet, after the message failed
+    void DiscardMessageBody();
+
+    void SendParseComplete();
+
+    void SendBindComplete();
+
+    void SendCloseComplete();
+
+    void SendParameterDescription(const Vector<u32> &parameter_types);
+
+    void SendNoData();
+
+    void SendPortalSuspended();
+
+    void SendEmptyQueryResponse();
+
+    void Flush();
+
+    // Whether the next message, or the startup message, is completely received so it can be handled without waiting
+    // for the client. A length field out of range closes the connection.
+    [[nodiscard]] bool MessageBuffered(bool startup);
+
+    void AsyncReceive(std::function<void(SizeT)> handler) { buffer_reader_.async_receive(std::move(handler)); }
     //
     //    pair<String, String> read_parse_packet();
     //    void read_sync_packet();
@@ -61,8 +133,13 @@ public:
     //    void force_flush() { buffer_writer_.flush(); }
 
 private:
+    String read_message_body();
+
     BufferReader buffer_reader_;
     BufferWriter buffer_writer_;
+
+    // The type of the current message is read but its body is not
+    bool body_pending_{false};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,406 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module pg_result_encoder;
+
+import stl;
+import pg_message;
+import third_party;
+import infinity_exception;
+import status;
+import data_table;
+import data_block;
+import column_vector;
+import vector_buffer;
+import fix_heap;
+import bitmask;
+import data_type;
+import logical_type;
+import internal_types;
+import type_info;
+import embedding_info;
+
+namespace infinity {
+
+namespace {
+
+// Binary values are in network byte order
+template <typename T>
+void AppendBigEndian(String &output, T value) {
+    if constexpr (sizeof(T) == 1) {
+        output.push_back(static_cast<char>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        u16 network_value = __builtin_bswap16(std::bit_cast<u16>(value));
+        output.append(reinterpret_cast<const char *>(&network_value), sizeof(network_value));
+    } else if constexpr (sizeof(T) == 4) {
+        u32 network_value = __builtin_bswap32(std::bit_cast<u32>(value));
+        output.append(reinterpret_cast<const char *>(&network_value), sizeof(network_value));
+    } else {
+        static_assert(sizeof(T) == 8);
+        u64 network_value = __builtin_bswap64(std::bit_cast<u64>(value));
+        output.append(reinterpret_cast<const char *>(&network_value), sizeof(network_value));
+    }
+}
+
+template <typename T>
+void EncodeFixedWidth(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<i32> &lengths) {
+    const auto *data = reinterpret_cast<const T *>(column_vector.data());
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        if (lengths[row - row_begin] < 0) {
+            continue;
+        }
+        AppendBigEndian(values, data[row]);
+        lengths[row - row_begin] = sizeof(T);
+    }
+}
+
+// One dimensional array: ndim, has null flag, element type, dimension and lower bound, then length and value of each
+// element, https://github.com/postgres/postgres/blob/REL_14_STABLE/src/backend/utils/adt/arrayfuncs.c array_send
+template <typename T>
+void EncodeEmbedding(const ColumnVector &column_vector,
+                     SizeT row_begin,
+                     SizeT row_end,
+                     u32 element_object_id,
+                     SizeT dimension,
+                     String &values,
+                     Vector<i32> &lengths) {
+    const auto *data = reinterpret_cast<const T *>(column_vector.data());
+    constexpr SizeT header_length = 5 * sizeof(i32);
+    const i32 array_length = header_length + dimension * (sizeof(i32) + sizeof(T));
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        if (lengths[row - row_begin] < 0) {
+            continue;
+        }
+        AppendBigEndian<i32>(values, 1);
+        AppendBigEndian<i32>(values, 0);
+        AppendBigEndian<u32>(values, element_object_id);
+        AppendBigEndian<i32>(values, dimension);
+        AppendBigEndian<i32>(values, 1);
+        const T *embedding = data + row * dimension;
+        for (SizeT i = 0; i < dimension; ++i) {
+            AppendBigEndian<i32>(values, sizeof(T));
+            AppendBigEndian(values, embedding[i]);
+        }
+        lengths[row - row_begin] = array_length;
+    }
+}
+
+void EncodeVarchar(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<i32> &lengths) {
+    const auto *varchars = reinterpret_cast<const VarcharT *>(column_vector.data());
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        if (lengths[row - row_begin] < 0) {
+            continue;
+        }
+        const VarcharT &varchar = varchars[row];
+        if (varchar.IsInlined()) {
+            values.append(varchar.short_.data_, varchar.length_);
+        } else {
+            SizeT offset = values.size();
+            values.resize(offset + varchar.length_);
+            column_vector.buffer_->fix_heap_mgr_->ReadFromHeap(values.data() + offset,
+                                                               varchar.vector_.chunk_id_,
+                                                               varchar.vector_.chunk_offset_,
+                                                               varchar.length_);
+        }
+        lengths[row - row_begin] = varchar.length_;
+    }
+}
+
+void EncodeBinaryEmbedding(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<i32> &lengths) {
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+    const SizeT dimension = embedding_info->Dimension();
+    switch (embedding_info->Type()) {
+        case kElemInt8: {
+            EncodeEmbedding<TinyIntT>(column_vector, row_begin, row_end, 18, dimension, values, lengths);
+            break;
+        }
+        case kElemInt16: {
+            EncodeEmbedding<SmallIntT>(column_vector, row_begin, row_end, 21, dimension, values, lengths);
+            break;
+        }
+        case kElemInt32: {
+            EncodeEmbedding<IntegerT>(column_vector, row_begin, row_end, 23, dimension, values, lengths);
+            break;
+        }
+        case kElemInt64: {
+            EncodeEmbedding<BigIntT>(column_vector, row_begin, row_end, 20, dimension, values, lengths);
+            break;
+        }
+        case kElemFloat: {
+            EncodeEmbedding<FloatT>(column_vector, row_begin, row_end, 700, dimension, values, lengths);
+            break;
+        }
+        case kElemDouble: {
+            EncodeEmbedding<DoubleT>(column_vector, row_begin, row_end, 701, dimension, values, lengths);
+            break;
+        }
+        default: {
+            UnrecoverableError("Unexpected embedding type for binary format");
+        }
+    }
+}
+
+void EncodeBinary(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<i32> &lengths) {
+    switch (column_vector.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            for (SizeT row = row_begin; row < row_end; ++row) {
+                if (lengths[row - row_begin] < 0) {
+                    continue;
+                }
+                values.push_back(column_vector.buffer_->GetCompactBit(row) ? 1 : 0);
+                lengths[row - row_begin] = 1;
+            }
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            EncodeFixedWidth<TinyIntT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            EncodeFixedWidth<SmallIntT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kInteger: {
+            EncodeFixedWidth<IntegerT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            EncodeFixedWidth<BigIntT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kFloat: {
+            EncodeFixedWidth<FloatT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kDouble: {
+            EncodeFixedWidth<DoubleT>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kRowID: {
+            EncodeFixedWidth<u64>(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            EncodeVarchar(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            EncodeBinaryEmbedding(column_vector, row_begin, row_end, values, lengths);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("No PG binary format for {}", column_vector.data_type()->ToString()));
+        }
+    }
+}
+
+void EncodeText(const ColumnVector &column_vector, SizeT row_begin, SizeT row_end, String &values, Vector<i32> &lengths) {
+    for (SizeT row = row_begin; row < row_end; ++row) {
+        if (lengths[row - row_begin] < 0) {
+            continue;
+        }
+        const String value = column_vector.ToString(row);
+        values.append(value);
+        lengths[row - row_begin] = value.size();
+    }
+}
+
+} // namespace
+
+PGResultEncoder::PGResultEncoder(const DataTable &result_table, const Vector<PGFormatCode> &result_formats) {
+    SizeT column_count = result_table.ColumnCount();
+    if (result_formats.size() > 1 && result_formats.size() != column_count) {
+        RecoverableError(Status::InvalidParameterValue("result format codes",
+                                                       std::to_string(result_formats.size()),
+                                                       fmt::format("{} or less format codes", column_count)));
+    }
+    format_codes_.reserve(column_count);
+    for (SizeT idx = 0; idx < column_count; ++idx) {
+        PGFormatCode format_code = PGFormatCode::kText;
+        if (!result_formats.empty()) {
+            format_code = result_formats.size() == 1 ? result_formats[0] : result_formats[idx];
+        }
+        if (format_code == PGFormatCode::kBinary && !SupportBinary(*result_table.GetColumnTypeById(idx))) {
+            format_code = PGFormatCode::kText;
+        }
+        format_codes_.emplace_back(format_code);
+    }
+    encoded_columns_.resize(column_count);
+}
+
+PGColumnType PGResultEncoder::ColumnType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return {16, 1};
+        }
+        case LogicalType::kTinyInt: {
+            return {18, 1}; // char
+        }
+        case LogicalType::kSmallInt: {
+            return {21, 2};
+        }
+        case LogicalType::kInteger: {
+            return {23, 4};
+        }
+        case LogicalType::kBigInt:
+        case LogicalType::kRowID: {
+            return {20, 8};
+        }
+        case LogicalType::kFloat: {
+            return {700, 4};
+        }
+        case LogicalType::kDouble: {
+            return {701, 8};
+        }
+        case LogicalType::kVarchar: {
+            return {25, -1};
+        }
+        case LogicalType::kDate: {
+            return {1082, 8};
+        }
+        case LogicalType::kTime: {
+            return {1083, 8};
+        }
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            return {1114, 8};
+        }
+        case LogicalType::kInterval: {
+            return {1186, 16};
+        }
+        case LogicalType::kEmbedding: {
+            if (data_type.type_info()->type() != TypeInfoType::kEmbedding) {
+                UnrecoverableError("Not embedding type");
+            }
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+            switch (embedding_info->Type()) {
+                case kElemBit: {
+                    return {1000, 1};
+                }
+                case kElemInt8: {
+                    return {1002, 1};
+                }
+                case kElemInt16: {
+                    return {1005, 2};
+                }
+                case kElemInt32: {
+                    return {1007, 4};
+                }
+                case kElemInt64: {
+                    return {1016, 8};
+                }
+                case kElemFloat: {
+                    return {1021, 4};
+                }
+                case kElemDouble: {
+                    return {1022, 8};
+                }
+                case kElemFloat16:
+                case kElemBFloat16: {
+                    // sent as text float4[]
+                    return {1021, 4};
+                }
+                case kElemInvalid: {
+                    UnrecoverableError("Invalid embedding data type");
+                }
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    UnrecoverableError("Unexpected type");
+    return {};
+}
+
+bool PGResultEncoder::SupportBinary(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kRowID:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        case LogicalType::kEmbedding: {
+            // Bit embeddings are sent as text, a bool[] would be eight times larger than the bitmap.
+            // Half precision embeddings have no postgres element type and are sent as text too.
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type.type_info().get());
+            return embedding_info->Type() != kElemBit && embedding_info->Type() != kElemFloat16 && embedding_info->Type() != kElemBFloat16;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void PGResultEncoder::EncodeRows(const DataBlock &data_block, SizeT row_begin, SizeT row_end, String &output) {
+    const SizeT column_count = encoded_columns_.size();
+    const SizeT row_count = row_end - row_begin;
+
+    // Column at a time
+    SizeT message_length_sum = 0;
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        const ColumnVector &column_vector = *data_block.column_vectors[column_id];
+        EncodedColumn &encoded_column = encoded_columns_[column_id];
+        encoded_column.values_.clear();
+        encoded_column.lengths_.assign(row_count, 0);
+        const Bitmask *nulls = column_vector.nulls_ptr_.get();
+        if (nulls != nullptr && !nulls->IsAllTrue()) {
+            for (SizeT row = row_begin; row < row_end; ++row) {
+                if (!nulls->IsTrue(row)) {
+                    encoded_column.lengths_[row - row_begin] = -1;
+                }
+            }
+        }
+        if (format_codes_[column_id] == PGFormatCode::kBinary) {
+            EncodeBinary(column_vector, row_begin, row_end, encoded_column.values_, encoded_column.lengths_);
+        } else {
+            EncodeText(column_vector, row_begin, row_end, encoded_column.values_, encoded_column.lengths_);
+        }
+        message_length_sum += encoded_column.values_.size();
+    }
+
+    // Then interleave the columns into DataRow messages, https://www.postgresql.org/docs/14/protocol-message-formats.html
+    message_length_sum += row_count * (sizeof(u8) + LENGTH_FIELD_SIZE + sizeof(u16) + column_count * sizeof(i32));
+    output.reserve(output.size() + message_length_sum);
+    Vector<SizeT> value_offsets(column_count, 0);
+    for (SizeT row = 0; row < row_count; ++row) {
+        u32 message_length = LENGTH_FIELD_SIZE + sizeof(u16) + column_count * sizeof(i32);
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            message_length += std::max(encoded_columns_[column_id].lengths_[row], 0);
+        }
+        output.push_back(static_cast<char>(PGMessageType::kData));
+        AppendBigEndian<u32>(output, message_length);
+        AppendBigEndian<u16>(output, column_count);
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            const EncodedColumn &encoded_column = encoded_columns_[column_id];
+            i32 length = encoded_column.lengths_[row];
+            AppendBigEndian<i32>(output, length);
+            if (length > 0) {
+                output.append(encoded_column.values_, value_offsets[column_id], length);
+                value_offsets[column_id] += length;
+            }
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,61 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module pg_result_encoder;
+
+import stl;
+import pg_message;
+import data_table;
+import data_block;
+import data_type;
+
+namespace infinity {
+
+export struct PGColumnType {
+    u32 object_id_{0};
+    i16 width_{0};
+};
+
+// Encodes the rows of a result table into DataRow messages.
+// Each column is encoded on its own over a range of rows, so the type dispatch happens once per column and not once per
+// cell, then the cells are interleaved into the row messages.
+export class PGResultEncoder {
+public:
+    // Follows the result format codes of Bind: none means all text, a single one applies to all the columns.
+    // Columns without a binary encoding fall back to text, the client sees it in the RowDescription.
+    PGResultEncoder(const DataTable &result_table, const Vector<PGFormatCode> &result_formats);
+
+    static PGColumnType ColumnType(const DataType &data_type);
+
+    static bool SupportBinary(const DataType &data_type);
+
+    [[nodiscard]] const Vector<PGFormatCode> &FormatCodes() const { return format_codes_; }
+
+    // Appends the DataRow messages of rows [row_begin, row_end) of the block to output
+    void EncodeRows(const DataBlock &data_block, SizeT row_begin, SizeT row_end, String &output);
+
+private:
+    struct EncodedColumn {
+        String values_{};
+        // -1 for null
+        Vector<i32> lengths_{};
+    };
+
+    Vector<PGFormatCode> format_codes_{};
+    Vector<EncodedColumn> encoded_columns_{};
+};
+
+} // namespace infinity
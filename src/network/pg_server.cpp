@@ -14,7 +14,7 @@
 
 module;
 
-#include <boost/bind.hpp>
+#include <boost/asio/ip/tcp.hpp>
 #include <thread>
 
 module pg_server;
@@ -25,6 +25,8 @@ import stl;
 import boost;
 import third_party;
 import infinity_exception;
+import logger;
+import default_values;
 
 import connection;
 
@@ -51,43 +53,74 @@ void PGServer::Run() {
     acceptor_ptr_ = MakeUnique<boost::asio::ip::tcp::acceptor>(io_service_, boost::asio::ip::tcp::endpoint(address, pg_port));
     CreateConnection();
 
-    fmt::print("Run 'psql -h {} -p {}' to connect to the server (SQL is only for test).\n", pg_listen_addr, pg_port);
-
+    SizeT io_thread_count = std::max<SizeT>(Thread::hardware_concurrency(), PG_MIN_IO_THREAD_COUNT);
+    SizeT worker_thread_count = std::max<SizeT>(Thread::hardware_concurrency(), PG_MIN_WORKER_THREAD_COUNT);
+    worker_pool_.resize(worker_thread_count);
+    fmt::print("Run 'psql -h {} -p {}' to connect to the server (SQL is only for test), {} io threads, {} workers.\n",
+               pg_listen_addr,
+               pg_port,
+               io_thread_count,
+               worker_thread_count);
+
+    io_threads_.reserve(io_thread_count - 1);
+    for (SizeT idx = 1; idx < io_thread_count; ++idx) {
+        io_threads_.emplace_back([this] { io_service_.run(); });
+    }
     io_service_.run();
 }
 
 void PGServer::Shutdown() {
-
     initialized_ = false;
 
-    while (running_connection_count_ > 0) {
-        // Running connection exists.
-        std::this_thread::yield();
-    }
-
+    // Requests being handled finish first and the queued ones are dropped. Stopping the io_service leaves the accepted
+    // sockets open, they are closed once no io thread nor worker uses them anymore.
     io_service_.stop();
-    acceptor_ptr_->close();
+    for (auto &io_thread : io_threads_) {
+        io_thread.join();
+    }
+    io_threads_.clear();
+    worker_pool_.stop();
+    CloseConnections();
+    if (acceptor_ptr_.get() != nullptr) {
+        acceptor_ptr_->close();
+    }
 }
 
-void PGServer::CreateConnection() {
-    SharedPtr<Connection> connection_ptr = MakeShared<Connection>(io_service_);
-    acceptor_ptr_->async_accept(*(connection_ptr->socket()), boost::bind(&PGServer::StartConnection, this, connection_ptr));
+void PGServer::AddConnection(const SharedPtr<Connection> &connection_ptr) {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    // drop the connections already released
+    connections_.erase(std::remove_if(connections_.begin(),
+                                      connections_.end(),
+                                      [](const WeakPtr<Connection> &connection) { return connection.expired(); }),
+                       connections_.end());
+    connections_.emplace_back(connection_ptr);
 }
 
-void PGServer::StartConnection(SharedPtr<Connection> &connection) {
-    Thread connection_thread([connection = connection, &num_running_connections = this->running_connection_count_, initialized = this->initialized_]() mutable {
-        if(initialized) {
-            ++num_running_connections;
-            connection->Run();
+void PGServer::CloseConnections() {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    for (auto &connection : connections_) {
+        if (SharedPtr<Connection> connection_ptr = connection.lock(); connection_ptr.get() != nullptr) {
+            boost::system::error_code error;
+            connection_ptr->socket()->close(error);
+        }
+    }
+    connections_.clear();
+}
 
-            // User disconnected
-            connection.reset();
-            --num_running_connections;
+void PGServer::CreateConnection() {
+    SharedPtr<Connection> connection_ptr = MakeShared<Connection>(io_service_, worker_pool_);
+    acceptor_ptr_->async_accept(*(connection_ptr->socket()), [this, connection_ptr](const boost::system::error_code &error) {
+        if (!initialized_) {
+            return;
         }
+        if (error) {
+            LOG_WARN(fmt::format("Fail to accept PG connection: {}", error.message()));
+        } else {
+            AddConnection(connection_ptr);
+            connection_ptr->Start();
+        }
+        CreateConnection();
     });
-
-    connection_thread.detach();
-    CreateConnection();
 }
 
 } // namespace infinity
@@ -27,8 +27,12 @@ export struct StartupParameter {
     SharedPtr<String> config_path{};
 };
 
+// Connections are served by a fixed pool of io threads running the io_service, an idle connection only costs its
+// pending read and buffers. Requests are handled on a separate worker pool once they are completely received, so slow
+// clients or long queries never hold the io threads, and at most worker pool size PG requests run at once.
 export class PGServer {
 public:
+    // Blocks the calling thread, which is one of the io threads, until Shutdown()
     void Run();
 
     void Shutdown();
@@ -36,12 +40,18 @@ public:
 private:
     void CreateConnection();
 
-    void StartConnection(SharedPtr<Connection> &connection);
+    // Keeps track of the accepted connections so that Shutdown() can close their sockets
+    void AddConnection(const SharedPtr<Connection> &connection_ptr);
 
-    bool initialized_{false};
-    atomic_u64 running_connection_count_{0};
+    void CloseConnections();
+
+    atomic_bool initialized_{false};
     boost::asio::io_service io_service_{};
     UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_ptr_{};
+    Vector<Thread> io_threads_{};
+    ThreadPool worker_pool_{};
+    std::mutex connections_mutex_{};
+    Vector<WeakPtr<Connection>> connections_{};
 };
 
 }
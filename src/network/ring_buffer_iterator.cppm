@@ -87,9 +87,10 @@ public:
     }
 
     static inline void CopyN(const char *src, SizeT len, RingBufferIterator &result_iter) {
-        for (SizeT str_idx = 0, array_idx = result_iter.position_; str_idx < len; ++str_idx, array_idx = (array_idx + 1) % PG_MSG_BUFFER_SIZE) {
-            result_iter.data_[array_idx] = src[str_idx];
-        }
+        // At most two contiguous pieces: up to the end of the array, then from its beginning
+        SizeT first_len = std::min<SizeT>(len, PG_MSG_BUFFER_SIZE - result_iter.position_);
+        std::memcpy(result_iter.data_.data() + result_iter.position_, src, first_len);
+        std::memcpy(result_iter.data_.data(), src + first_len, len - first_len);
     }
 
     Array<char, PG_MSG_BUFFER_SIZE> &data_;
@@ -152,36 +152,37 @@ void PoolThriftServer::Start() { server->serve(); }
 
 void PoolThriftServer::Shutdown() { server->stop(); }
 
+// Clients have to use the framed transport. A few io threads poll all the connections and hand the complete requests to
+// the worker pool, so idle connections don't hold a thread.
 void NonBlockPoolThriftServer::Init(i32 port_no, i32 pool_size) {
 
     SharedPtr<ThreadFactory> thread_factory = MakeShared<ThreadFactory>();
     service_handler_ = MakeShared<InfinityThriftService>();
     SharedPtr<infinity_thrift_rpc::InfinityServiceProcessor> service_processor =
         MakeShared<infinity_thrift_rpc::InfinityServiceProcessor>(service_handler_);
-    SharedPtr<TProtocolFactory> protocol_factory = MakeShared<TBinaryProtocolFactory>();
+    SharedPtr<TBinaryProtocolFactory> protocol_factory = MakeShared<TBinaryProtocolFactory>();
+    protocol_factory->setStrict(true, true);
 
     SharedPtr<ThreadManager> threadManager = ThreadManager::newSimpleThreadManager(pool_size);
     threadManager->threadFactory(thread_factory);
     threadManager->start();
 
-    std::cout << "Non-block API server listen on: 0.0.0.0:" << port_no << ", thread pool: " << pool_size << std::endl;
+    SizeT io_thread_count = std::max(std::thread::hardware_concurrency() / 4, 1u);
+    std::cout << "Non-block API server listen on: 0.0.0.0:" << port_no << ", thread pool: " << pool_size << ", io threads: " << io_thread_count
+              << std::endl;
 
     SharedPtr<TNonblockingServerSocket> non_block_socket = MakeShared<TNonblockingServerSocket>(port_no);
 
-    //    server_thread_ = thread_factory->newThread(std::shared_ptr<TServer>(
-    //        new TNonblockingServer(serviceProcessor, protocolFactory, nbSocket1, threadManager)));
-
-    server_thread_ = thread_factory->newThread(MakeShared<TNonblockingServer>(service_processor, protocol_factory, non_block_socket, threadManager));
-
-    //    server = MakeUnique<TThreadPoolServer>(MakeShared<InfinityServiceProcessorFactory>(MakeShared<InfinityServiceCloneFactory>()),
-    //                                           MakeShared<TServerSocket>(port_no),
-    //                                           MakeShared<TBufferedTransportFactory>(),
-    //                                           MakeShared<TBinaryProtocolFactory>(),
-    //                                           threadManager);
+    server_ = MakeShared<TNonblockingServer>(service_processor, protocol_factory, non_block_socket, threadManager);
+    server_->setNumIOThreads(io_thread_count);
+    server_thread_ = thread_factory->newThread(server_);
 }
 
 void NonBlockPoolThriftServer::Start() { server_thread_->start(); }
 
-void NonBlockPoolThriftServer::Shutdown() { server_thread_->join(); }
+void NonBlockPoolThriftServer::Shutdown() {
+    server_->stop();
+    server_thread_->join();
+}
 
 } // namespace infinity
@@ -61,7 +61,7 @@ public:
     void Shutdown();
 
 private:
-    //    UniquePtr<TServer> server{nullptr};
+    SharedPtr<apache::thrift::server::TNonblockingServer> server_{};
     SharedPtr<InfinityThriftService> service_handler_{};
     SharedPtr<apache::thrift::concurrency::Thread> server_thread_{};
 };
@@ -53,6 +53,8 @@ KnnExpr::~KnnExpr() {
                 delete[] data_ptr;
                 break;
             }
+            case EmbeddingDataType::kElemFloat16:
+            case EmbeddingDataType::kElemBFloat16:
             case EmbeddingDataType::kElemInt16: {
                 int16_t *data_ptr = reinterpret_cast<int16_t *>(embedding_data_ptr_);
                 delete[] data_ptr;
@@ -652,16 +652,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  73
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   349
+#define YYLAST   386
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  179
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  22
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  128
+#define YYNRULES  130
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  265
+#define YYNSTATES  273
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   419
@@ -734,11 +734,12 @@ static const yytype_int16 yyrline[] =
      484,   492,   498,   506,   507,   508,   509,   510,   511,   512,
      513,   514,   515,   516,   517,   518,   519,   520,   521,   522,
      523,   524,   527,   529,   530,   531,   532,   535,   536,   537,
-     538,   539,   540,   541,   542,   543,   544,   545,   546,   547,
-     548,   549,   550,   552,   576,   583,   590,   595,   605,   610,
-     615,   620,   625,   630,   635,   640,   645,   650,   653,   656,
-     659,   663,   667,   672,   677,   681,   686,   691,   697,   703,
-     709,   715,   721,   727,   733,   739,   745,   751,   757
+     538,   539,   540,   541,   542,   543,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   584,   608,   615,   622,   627,
+     637,   642,   647,   652,   657,   662,   667,   672,   677,   682,
+     685,   688,   691,   695,   699,   704,   709,   713,   718,   723,
+     729,   735,   741,   747,   753,   759,   765,   771,   777,   783,
+     789
 };
 #endif
 
@@ -793,7 +794,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-169)
+#define YYPACT_NINF (-168)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -807,33 +808,34 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      13,  -148,  -169,  -169,   207,    13,  -133,    26,    41,    46,
-      60,  -169,  -169,    59,  -102,   -91,   -84,   -64,    13,    13,
-    -169,    29,    13,   117,   -55,  -169,   -50,   112,  -169,  -169,
-    -169,  -169,  -169,  -169,  -169,  -169,   -59,  -169,  -169,  -146,
-    -169,  -145,  -169,    -3,  -169,  -169,  -169,  -169,  -169,  -169,
-    -169,  -169,  -169,  -169,  -169,  -169,   -62,    13,  -169,  -169,
-    -169,  -169,   207,  -169,   122,   123,   124,   125,  -123,  -123,
-    -169,  -169,  -130,  -169,    13,   127,    13,    13,   -60,   -43,
-     -52,    13,    13,    13,    13,    13,    13,    13,    13,    13,
-      13,    13,    13,    13,    13,     1,  -169,   119,  -169,   128,
-      13,  -169,  -168,   -11,   -41,    63,   -40,  -156,  -107,  -169,
-    -169,  -169,  -169,    -2,   -33,    13,    13,    42,  -169,  -114,
-    -114,    69,    69,   121,  -114,  -114,    69,    69,  -123,  -123,
-    -169,  -169,  -169,  -169,  -169,  -169,  -169,  -104,  -169,   206,
-      13,   157,  -169,   159,  -169,   160,    13,  -114,   -89,  -169,
-      13,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,
-    -169,  -169,  -169,    -7,  -169,  -169,  -169,  -169,  -169,  -169,
-    -169,  -169,  -169,  -169,    -6,     3,     4,    58,   -88,     8,
-      15,   -82,  -169,   -62,   183,   -53,   233,  -169,  -169,  -169,
-     188,  -169,  -169,  -169,   -54,    21,    22,    23,    27,    28,
-      32,    33,    35,    36,    37,    38,    39,    40,    43,    44,
-      53,    17,  -169,   198,   201,   213,   214,   226,   237,   238,
-     239,   240,   241,   242,   248,   249,   250,   256,   258,   259,
-    -169,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   109,   139,   140,   142,   143,   151,   152,  -169,  -169,
-    -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,
-    -169,  -169,  -169,  -169,  -169
+      13,  -144,  -168,  -168,   202,    13,  -127,    57,    59,    65,
+      67,  -168,  -168,    68,  -103,  -102,  -100,   -98,    13,    13,
+    -168,    45,    13,    78,   -95,  -168,   -50,   134,  -168,  -168,
+    -168,  -168,  -168,  -168,  -168,  -168,   -93,  -168,  -168,  -167,
+    -168,  -145,  -168,    -3,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168,  -168,  -168,  -168,   176,    13,  -168,  -168,
+    -168,  -168,   202,  -168,    81,    83,    84,    85,  -150,  -150,
+    -168,  -168,  -108,  -168,    13,    87,    13,    13,   -69,   -84,
+     -60,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+      13,    13,    13,    13,    13,     1,  -168,    88,  -168,    91,
+      13,  -168,  -164,   -38,   -32,    41,   -56,  -148,  -140,  -168,
+    -168,  -168,  -168,   -24,   -52,    13,    13,     4,  -168,  -113,
+    -113,   186,   186,   124,  -113,  -113,   186,   186,  -150,  -150,
+    -168,  -168,  -168,  -168,  -168,  -168,  -168,  -139,  -168,   271,
+      13,   121,  -168,   122,  -168,   123,    13,  -113,  -136,  -168,
+      13,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168,   -46,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168,  -168,   -45,   -44,   -43,    66,  -135,   -42,
+     -36,  -132,  -168,   176,   126,    12,   103,  -168,  -168,  -168,
+     138,  -168,  -168,  -168,  -129,   -40,   -17,   -16,   -15,   -14,
+     -10,    -9,     0,     2,     6,     7,    11,    20,    23,    30,
+      32,    35,    36,     3,  -168,   184,   185,   209,   210,   211,
+     212,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,   233,   234,  -168,    70,    71,    72,    74,    75,
+      76,    77,    80,    82,    89,    92,    94,   100,   101,   102,
+     104,   105,   106,   107,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -841,41 +843,42 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,    94,    98,   101,   102,     0,     0,     0,     0,     0,
-       0,    99,   100,     0,     0,     0,     0,     0,     0,     0,
-      96,     0,     0,     0,     2,     3,     6,     7,    16,    17,
-      18,    14,    10,     9,     8,    15,    13,    12,   109,     0,
-     110,     0,   108,     0,   118,   117,   120,   119,   122,   121,
-     124,   123,   126,   125,   128,   127,    30,     0,   103,   104,
-     105,   106,     0,   107,     0,     0,     0,     0,    32,    31,
-     115,   112,     0,     1,     0,     0,     0,     0,     0,     0,
+       0,    96,   100,   103,   104,     0,     0,     0,     0,     0,
+       0,   101,   102,     0,     0,     0,     0,     0,     0,     0,
+      98,     0,     0,     0,     2,     3,     6,     7,    16,    17,
+      18,    14,    10,     9,     8,    15,    13,    12,   111,     0,
+     112,     0,   110,     0,   120,   119,   122,   121,   124,   123,
+     126,   125,   128,   127,   130,   129,    30,     0,   105,   106,
+     107,   108,     0,   109,     0,     0,     0,     0,    32,    31,
+     117,   114,     0,     1,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   111,     0,   114,     0,
+       0,     0,     0,     0,     0,     0,   113,     0,   116,     0,
        0,    25,     0,     0,     0,     0,     0,     0,     0,    11,
        4,     5,    48,    49,     0,     0,     0,     0,    29,    39,
       40,    43,    44,     0,    46,    38,    41,    42,    34,    33,
-      35,    36,    37,    95,    97,   113,   116,     0,    26,     0,
+      35,    36,    37,    97,    99,   115,   118,     0,    26,     0,
        0,     0,    21,     0,    23,     0,     0,    47,     0,    28,
        0,    27,    53,    56,    57,    54,    55,    58,    59,    73,
       60,    62,    61,    76,    63,    64,    65,    66,    67,    68,
       69,    70,    71,    72,     0,     0,     0,     0,     0,     0,
-       0,     0,    51,    50,     0,     0,     0,    93,    45,    19,
+       0,     0,    51,    50,     0,     0,     0,    95,    45,    19,
        0,    22,    24,    52,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    75,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      20,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    74,    80,
-      81,    78,    79,    82,    83,    84,    77,    88,    89,    86,
-      87,    90,    91,    92,    85
+       0,     0,     0,     0,    20,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    74,    85,    80,    81,    78,    79,
+      82,    83,    84,    77,    94,    89,    90,    87,    88,    91,
+      92,    93,    86
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -169,  -169,   -34,   257,   -16,    62,  -169,  -169,  -169,  -169,
-    -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,  -169,
-    -169,   331
+    -168,  -168,   -34,   167,   -12,    62,  -168,  -168,  -168,  -168,
+    -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,  -168,
+    -168,   230
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
@@ -891,80 +894,88 @@ static const yytype_uint8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-       1,     2,     3,     4,   133,    75,    72,    80,   138,   102,
-      74,   103,    76,    77,   139,   114,     1,     2,     3,     4,
-     142,   117,   143,    -1,    -1,    83,    84,    43,    96,    98,
-      58,    -1,    97,    99,    70,    71,   195,   196,   197,   198,
-     199,   104,    57,   200,   201,    59,   109,    92,    93,    94,
-      60,    -1,    88,    89,    90,    91,    92,    93,    94,    80,
-     112,   113,   100,   202,    61,    62,   137,    56,   118,   144,
-       5,   145,   151,    64,    74,    81,    82,    83,    84,     6,
-      68,    69,   148,    86,    65,   115,     5,   182,   189,    74,
-     190,    66,    76,    77,   193,     6,    74,     7,     8,     9,
-      10,    76,    77,    87,    88,    89,    90,    91,    92,    93,
-      94,    67,   181,     7,     8,     9,    10,    73,    95,    11,
-      12,    13,   212,    74,   213,   135,   105,   106,   107,   108,
-     111,   103,   116,   136,   115,    11,    12,    13,   141,   140,
-      76,    14,   146,   119,   120,   121,   122,   123,   124,   125,
+       1,     2,     3,     4,   133,    75,   114,    96,    80,   102,
+      72,    97,   138,   117,    74,   195,     1,     2,     3,     4,
+      92,    93,    94,   139,    -1,    -1,    83,    84,   142,    98,
+     143,    43,    -1,    99,    76,    77,   144,   151,   145,    74,
+     182,   189,    74,   190,   193,   104,    74,   214,    57,   215,
+      70,    71,    -1,    88,    89,    90,    91,    92,    93,    94,
+     118,    58,   100,    59,   112,   113,   137,    56,   109,    60,
+       5,    61,    64,    65,    62,    66,   115,    67,    73,     6,
+      68,    69,   148,    74,    95,   105,     5,   106,   107,   108,
+     111,   116,    76,    77,   135,     6,   136,     7,     8,     9,
+      10,   196,   197,   198,   199,   200,   204,   115,   201,   202,
+      76,    77,   181,     7,     8,     9,    10,   140,    76,    11,
+      12,    13,   141,   146,   149,   178,   179,   180,   203,   184,
+     185,   186,   194,   187,   191,    11,    12,    13,   216,   103,
+     192,    14,   213,   119,   120,   121,   122,   123,   124,   125,
      126,   127,   128,   129,   130,   131,   132,    14,    15,    16,
-      17,   178,   149,   179,   180,    18,    19,    20,   184,   185,
-      21,   134,    22,   101,    15,    16,    17,   147,   186,    80,
-     187,    18,    19,    20,   191,    78,    21,    79,    22,   194,
-      80,   192,   211,   230,   103,    81,    82,    83,    84,   214,
-     215,   216,   177,    86,   231,   217,   218,   232,    -1,    -1,
-     219,   220,   183,   221,   222,   223,   224,   225,   226,   233,
-     234,   227,   228,    87,    88,    89,    90,    91,    92,    93,
-      94,   229,   235,    80,   188,    -1,    -1,    90,    91,    92,
-      93,    94,    80,   236,   237,   238,   239,   240,   241,    81,
-      82,    83,    84,    85,   242,   243,   244,    86,    81,    82,
-      83,    84,   245,   150,   246,   247,    86,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,    87,    88,    89,
-      90,    91,    92,    93,    94,   258,    87,    88,    89,    90,
-      91,    92,    93,    94,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,   171,   172,   259,   260,   173,   261,   262,
-     174,   175,   203,   204,   205,   206,   207,   263,   264,   208,
-     209,   110,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    63,     0,     0,     0,     0,   210
+      17,   217,   218,   219,   220,    18,    19,    20,   221,   222,
+      21,   134,    22,   101,    15,    16,    17,   147,   223,   234,
+     224,    18,    19,    20,   225,   226,    21,    80,    22,   227,
+     235,   236,   205,   206,   207,   208,   209,   103,   228,   210,
+     211,   229,   177,    81,    82,    83,    84,    78,   230,    79,
+     231,    86,   183,   232,   233,   237,   238,   239,   240,   212,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,    87,    88,    89,    90,    91,    92,    93,    94,   252,
+     253,   110,   188,    63,     0,    80,   254,   255,   256,   103,
+     257,   258,   259,   260,     0,    80,   261,     0,   262,     0,
+       0,    81,    82,    83,    84,   263,   150,     0,   264,    86,
+     265,    81,    82,    83,    84,    85,   266,   267,   268,    86,
+     269,   270,   271,   272,     0,     0,     0,     0,     0,    87,
+      88,    89,    90,    91,    92,    93,    94,    80,     0,    87,
+      88,    89,    90,    91,    92,    93,    94,    80,     0,     0,
+       0,     0,     0,    81,    82,    83,    84,     0,     0,     0,
+       0,    86,     0,     0,     0,    -1,    -1,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,     0,
+       0,    87,    88,    89,    90,    91,    92,    93,    94,     0,
+       0,     0,    -1,    -1,    90,    91,    92,    93,    94,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+       0,     0,   173,     0,     0,   174,   175
 };
 
 static const yytype_int16 yycheck[] =
 {
-       3,     4,     5,     6,     3,    55,    22,   121,   176,    43,
-     178,    73,   142,   143,    55,    75,     3,     4,     5,     6,
-     176,    73,   178,   137,   138,   139,   140,   175,   174,   174,
-       4,   145,   178,   178,     5,     6,    89,    90,    91,    92,
-      93,    57,   175,    96,    97,     4,   176,   170,   171,   172,
-       4,   165,   166,   167,   168,   169,   170,   171,   172,   121,
-      76,    77,    65,   116,     4,     6,   100,     5,   120,   176,
-      73,   178,   176,   175,   178,   137,   138,   139,   140,    82,
-      18,    19,   116,   145,   175,   145,    73,   176,   176,   178,
-     178,   175,   142,   143,   176,    82,   178,   100,   101,   102,
-     103,   142,   143,   165,   166,   167,   168,   169,   170,   171,
-     172,   175,   146,   100,   101,   102,   103,     0,   177,   122,
-     123,   124,   176,   178,   178,     6,     4,     4,     4,     4,
-       3,    73,   175,     5,   145,   122,   123,   124,   178,    76,
-     142,   144,   175,    81,    82,    83,    84,    85,    86,    87,
+       3,     4,     5,     6,     3,    55,    75,   174,   121,    43,
+      22,   178,   176,    73,   178,     3,     3,     4,     5,     6,
+     170,   171,   172,    55,   137,   138,   139,   140,   176,   174,
+     178,   175,   145,   178,   142,   143,   176,   176,   178,   178,
+     176,   176,   178,   178,   176,    57,   178,   176,   175,   178,
+       5,     6,   165,   166,   167,   168,   169,   170,   171,   172,
+     120,     4,    65,     4,    76,    77,   100,     5,   176,     4,
+      73,     4,   175,   175,     6,   175,   145,   175,     0,    82,
+      18,    19,   116,   178,   177,     4,    73,     4,     4,     4,
+       3,   175,   142,   143,     6,    82,     5,   100,   101,   102,
+     103,    89,    90,    91,    92,    93,     3,   145,    96,    97,
+     142,   143,   146,   100,   101,   102,   103,    76,   142,   122,
+     123,   124,   178,   175,   120,     4,     4,     4,   116,   175,
+     175,   175,     6,   176,   176,   122,   123,   124,   178,    73,
+     176,   144,     4,    81,    82,    83,    84,    85,    86,    87,
       88,    89,    90,    91,    92,    93,    94,   144,   161,   162,
-     163,     4,   120,     4,     4,   168,   169,   170,   175,   175,
-     173,   170,   175,   176,   161,   162,   163,   115,   175,   121,
-     176,   168,   169,   170,   176,    73,   173,    75,   175,     6,
-     121,   176,     4,   176,    73,   137,   138,   139,   140,   178,
-     178,   178,   140,   145,     6,   178,   178,     6,   139,   140,
-     178,   178,   150,   178,   178,   178,   178,   178,   178,     6,
-       6,   178,   178,   165,   166,   167,   168,   169,   170,   171,
-     172,   178,     6,   121,   176,   166,   167,   168,   169,   170,
-     171,   172,   121,     6,     6,     6,     6,     6,     6,   137,
-     138,   139,   140,   141,     6,     6,     6,   145,   137,   138,
-     139,   140,     6,   142,     6,     6,   145,   176,   176,   176,
-     176,   176,   176,   176,   176,   176,   176,   165,   166,   167,
-     168,   169,   170,   171,   172,   176,   165,   166,   167,   168,
-     169,   170,   171,   172,    88,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   176,   176,   111,   176,   176,
-     114,   115,    89,    90,    91,    92,    93,   176,   176,    96,
-      97,    74,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,    13,    -1,    -1,    -1,    -1,   116
+     163,   178,   178,   178,   178,   168,   169,   170,   178,   178,
+     173,   170,   175,   176,   161,   162,   163,   115,   178,   176,
+     178,   168,   169,   170,   178,   178,   173,   121,   175,   178,
+       6,     6,    89,    90,    91,    92,    93,    73,   178,    96,
+      97,   178,   140,   137,   138,   139,   140,    73,   178,    75,
+     178,   145,   150,   178,   178,     6,     6,     6,     6,   116,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,   165,   166,   167,   168,   169,   170,   171,   172,     6,
+       6,    74,   176,    13,    -1,   121,   176,   176,   176,    73,
+     176,   176,   176,   176,    -1,   121,   176,    -1,   176,    -1,
+      -1,   137,   138,   139,   140,   176,   142,    -1,   176,   145,
+     176,   137,   138,   139,   140,   141,   176,   176,   176,   145,
+     176,   176,   176,   176,    -1,    -1,    -1,    -1,    -1,   165,
+     166,   167,   168,   169,   170,   171,   172,   121,    -1,   165,
+     166,   167,   168,   169,   170,   171,   172,   121,    -1,    -1,
+      -1,    -1,    -1,   137,   138,   139,   140,    -1,    -1,    -1,
+      -1,   145,    -1,    -1,    -1,   139,   140,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,    -1,
+      -1,   165,   166,   167,   168,   169,   170,   171,   172,    -1,
+      -1,    -1,   166,   167,   168,   169,   170,   171,   172,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+      -1,    -1,   111,    -1,    -1,   114,   115
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -990,14 +1001,15 @@ static const yytype_uint8 yystos[] =
       96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
      106,   107,   108,   111,   114,   115,   192,   184,     4,     4,
        4,   181,   176,   184,   175,   175,   175,   176,   176,   176,
-     178,   176,   176,   176,     6,    89,    90,    91,    92,    93,
-      96,    97,   116,    89,    90,    91,    92,    93,    96,    97,
-     116,     4,   176,   178,   178,   178,   178,   178,   178,   178,
+     178,   176,   176,   176,     6,     3,    89,    90,    91,    92,
+      93,    96,    97,   116,     3,    89,    90,    91,    92,    93,
+      96,    97,   116,     4,   176,   178,   178,   178,   178,   178,
      178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
-     176,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,   176,   176,
+     178,   178,   178,   178,   176,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,   176,   176,   176,   176,   176,   176,
      176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,   176,   176
+     176,   176,   176
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1012,10 +1024,11 @@ static const yytype_uint8 yyr1[] =
      192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
      192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
      192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
-     192,   192,   192,   193,   194,   194,   194,   194,   195,   195,
+     192,   192,   192,   192,   192,   193,   194,   194,   194,   194,
      195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   196,   197,   197,   198,   199,   199,   200,   200,   200,
-     200,   200,   200,   200,   200,   200,   200,   200,   200
+     195,   195,   195,   196,   197,   197,   198,   199,   199,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
+     200
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1030,10 +1043,11 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     6,     4,     1,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     1,     3,     1,     3,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     1,     1,
-       1,     2,     2,     3,     2,     2,     3,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2
+       6,     6,     6,     6,     6,     6,     1,     3,     1,     3,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       1,     1,     1,     2,     2,     3,     2,     2,     3,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2
 };
 
 
@@ -1607,7 +1621,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 1611 "expression_parser.cpp"
+#line 1625 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -1615,7 +1629,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1619 "expression_parser.cpp"
+#line 1633 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -1623,7 +1637,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1627 "expression_parser.cpp"
+#line 1641 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -1631,7 +1645,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1635 "expression_parser.cpp"
+#line 1649 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_match_expr: /* match_expr  */
@@ -1639,7 +1653,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1643 "expression_parser.cpp"
+#line 1657 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -1647,7 +1661,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1651 "expression_parser.cpp"
+#line 1665 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -1655,7 +1669,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1659 "expression_parser.cpp"
+#line 1673 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -1663,7 +1677,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1667 "expression_parser.cpp"
+#line 1681 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -1671,7 +1685,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1675 "expression_parser.cpp"
+#line 1689 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -1679,7 +1693,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1683 "expression_parser.cpp"
+#line 1697 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -1687,7 +1701,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1691 "expression_parser.cpp"
+#line 1705 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -1695,7 +1709,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1699 "expression_parser.cpp"
+#line 1713 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -1703,7 +1717,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 1707 "expression_parser.cpp"
+#line 1721 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -1711,7 +1725,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1715 "expression_parser.cpp"
+#line 1729 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -1719,7 +1733,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1723 "expression_parser.cpp"
+#line 1737 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -1727,7 +1741,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1731 "expression_parser.cpp"
+#line 1745 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -1735,7 +1749,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1739 "expression_parser.cpp"
+#line 1753 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -1743,7 +1757,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1747 "expression_parser.cpp"
+#line 1761 "expression_parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -1751,7 +1765,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 1755 "expression_parser.cpp"
+#line 1769 "expression_parser.cpp"
         break;
 
       default:
@@ -1859,7 +1873,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 1863 "expression_parser.cpp"
+#line 1877 "expression_parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -2074,7 +2088,7 @@ yyreduce:
                            {
     result->exprs_ptr_ = (yyvsp[0].expr_array_t);
 }
-#line 2078 "expression_parser.cpp"
+#line 2092 "expression_parser.cpp"
     break;
 
   case 3: /* expr_array: expr_alias  */
@@ -2083,7 +2097,7 @@ yyreduce:
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 2087 "expression_parser.cpp"
+#line 2101 "expression_parser.cpp"
     break;
 
   case 4: /* expr_array: expr_array ',' expr_alias  */
@@ -2092,7 +2106,7 @@ yyreduce:
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 2096 "expression_parser.cpp"
+#line 2110 "expression_parser.cpp"
     break;
 
   case 5: /* expr_alias: expr AS IDENTIFIER  */
@@ -2103,7 +2117,7 @@ yyreduce:
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 2107 "expression_parser.cpp"
+#line 2121 "expression_parser.cpp"
     break;
 
   case 6: /* expr_alias: expr  */
@@ -2111,7 +2125,7 @@ yyreduce:
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 2115 "expression_parser.cpp"
+#line 2129 "expression_parser.cpp"
     break;
 
   case 11: /* operand: '(' expr ')'  */
@@ -2119,7 +2133,7 @@ yyreduce:
                       {
    (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 2123 "expression_parser.cpp"
+#line 2137 "expression_parser.cpp"
     break;
 
   case 12: /* operand: constant_expr  */
@@ -2127,7 +2141,7 @@ yyreduce:
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 2131 "expression_parser.cpp"
+#line 2145 "expression_parser.cpp"
     break;
 
   case 19: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
@@ -2140,7 +2154,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 2144 "expression_parser.cpp"
+#line 2158 "expression_parser.cpp"
     break;
 
   case 20: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
@@ -2155,7 +2169,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 2159 "expression_parser.cpp"
+#line 2173 "expression_parser.cpp"
     break;
 
   case 21: /* query_expr: QUERY '(' STRING ')'  */
@@ -2166,7 +2180,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 2170 "expression_parser.cpp"
+#line 2184 "expression_parser.cpp"
     break;
 
   case 22: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
@@ -2179,7 +2193,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 2183 "expression_parser.cpp"
+#line 2197 "expression_parser.cpp"
     break;
 
   case 23: /* fusion_expr: FUSION '(' STRING ')'  */
@@ -2190,7 +2204,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 2194 "expression_parser.cpp"
+#line 2208 "expression_parser.cpp"
     break;
 
   case 24: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
@@ -2203,7 +2217,7 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 2207 "expression_parser.cpp"
+#line 2221 "expression_parser.cpp"
     break;
 
   case 25: /* function_expr: IDENTIFIER '(' ')'  */
@@ -2216,7 +2230,7 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 2220 "expression_parser.cpp"
+#line 2234 "expression_parser.cpp"
     break;
 
   case 26: /* function_expr: IDENTIFIER '(' expr_array ')'  */
@@ -2229,7 +2243,7 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 2233 "expression_parser.cpp"
+#line 2247 "expression_parser.cpp"
     break;
 
   case 27: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
@@ -2243,7 +2257,7 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 2247 "expression_parser.cpp"
+#line 2261 "expression_parser.cpp"
     break;
 
   case 28: /* function_expr: operand IS NOT NULLABLE  */
@@ -2255,7 +2269,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2259 "expression_parser.cpp"
+#line 2273 "expression_parser.cpp"
     break;
 
   case 29: /* function_expr: operand IS NULLABLE  */
@@ -2267,7 +2281,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2271 "expression_parser.cpp"
+#line 2285 "expression_parser.cpp"
     break;
 
   case 30: /* function_expr: NOT operand  */
@@ -2279,7 +2293,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2283 "expression_parser.cpp"
+#line 2297 "expression_parser.cpp"
     break;
 
   case 31: /* function_expr: '-' operand  */
@@ -2291,7 +2305,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2295 "expression_parser.cpp"
+#line 2309 "expression_parser.cpp"
     break;
 
   case 32: /* function_expr: '+' operand  */
@@ -2303,7 +2317,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2307 "expression_parser.cpp"
+#line 2321 "expression_parser.cpp"
     break;
 
   case 33: /* function_expr: operand '-' operand  */
@@ -2316,7 +2330,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2320 "expression_parser.cpp"
+#line 2334 "expression_parser.cpp"
     break;
 
   case 34: /* function_expr: operand '+' operand  */
@@ -2329,7 +2343,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2333 "expression_parser.cpp"
+#line 2347 "expression_parser.cpp"
     break;
 
   case 35: /* function_expr: operand '*' operand  */
@@ -2342,7 +2356,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2346 "expression_parser.cpp"
+#line 2360 "expression_parser.cpp"
     break;
 
   case 36: /* function_expr: operand '/' operand  */
@@ -2355,7 +2369,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2359 "expression_parser.cpp"
+#line 2373 "expression_parser.cpp"
     break;
 
   case 37: /* function_expr: operand '%' operand  */
@@ -2368,7 +2382,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2372 "expression_parser.cpp"
+#line 2386 "expression_parser.cpp"
     break;
 
   case 38: /* function_expr: operand '=' operand  */
@@ -2381,7 +2395,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2385 "expression_parser.cpp"
+#line 2399 "expression_parser.cpp"
     break;
 
   case 39: /* function_expr: operand EQUAL operand  */
@@ -2394,7 +2408,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2398 "expression_parser.cpp"
+#line 2412 "expression_parser.cpp"
     break;
 
   case 40: /* function_expr: operand NOT_EQ operand  */
@@ -2407,7 +2421,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2411 "expression_parser.cpp"
+#line 2425 "expression_parser.cpp"
     break;
 
   case 41: /* function_expr: operand '<' operand  */
@@ -2420,7 +2434,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2424 "expression_parser.cpp"
+#line 2438 "expression_parser.cpp"
     break;
 
   case 42: /* function_expr: operand '>' operand  */
@@ -2433,7 +2447,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2437 "expression_parser.cpp"
+#line 2451 "expression_parser.cpp"
     break;
 
   case 43: /* function_expr: operand LESS_EQ operand  */
@@ -2446,7 +2460,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2450 "expression_parser.cpp"
+#line 2464 "expression_parser.cpp"
     break;
 
   case 44: /* function_expr: operand GREATER_EQ operand  */
@@ -2459,7 +2473,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2463 "expression_parser.cpp"
+#line 2477 "expression_parser.cpp"
     break;
 
   case 45: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
@@ -2494,7 +2508,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2498 "expression_parser.cpp"
+#line 2512 "expression_parser.cpp"
     break;
 
   case 46: /* function_expr: operand LIKE operand  */
@@ -2507,7 +2521,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2511 "expression_parser.cpp"
+#line 2525 "expression_parser.cpp"
     break;
 
   case 47: /* function_expr: operand NOT LIKE operand  */
@@ -2520,7 +2534,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2524 "expression_parser.cpp"
+#line 2538 "expression_parser.cpp"
     break;
 
   case 48: /* conjunction_expr: expr AND expr  */
@@ -2533,7 +2547,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2537 "expression_parser.cpp"
+#line 2551 "expression_parser.cpp"
     break;
 
   case 49: /* conjunction_expr: expr OR expr  */
@@ -2546,7 +2560,7 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 2550 "expression_parser.cpp"
+#line 2564 "expression_parser.cpp"
     break;
 
   case 50: /* between_expr: operand BETWEEN operand AND operand  */
@@ -2558,7 +2572,7 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 2562 "expression_parser.cpp"
+#line 2576 "expression_parser.cpp"
     break;
 
   case 51: /* in_expr: operand IN '(' expr_array ')'  */
@@ -2569,7 +2583,7 @@ yyreduce:
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 2573 "expression_parser.cpp"
+#line 2587 "expression_parser.cpp"
     break;
 
   case 52: /* in_expr: operand NOT IN '(' expr_array ')'  */
@@ -2580,251 +2594,293 @@ yyreduce:
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 2584 "expression_parser.cpp"
+#line 2598 "expression_parser.cpp"
     break;
 
   case 53: /* column_type: BOOLEAN  */
 #line 506 "expression_parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2590 "expression_parser.cpp"
+#line 2604 "expression_parser.cpp"
     break;
 
   case 54: /* column_type: TINYINT  */
 #line 507 "expression_parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2596 "expression_parser.cpp"
+#line 2610 "expression_parser.cpp"
     break;
 
   case 55: /* column_type: SMALLINT  */
 #line 508 "expression_parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2602 "expression_parser.cpp"
+#line 2616 "expression_parser.cpp"
     break;
 
   case 56: /* column_type: INTEGER  */
 #line 509 "expression_parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2608 "expression_parser.cpp"
+#line 2622 "expression_parser.cpp"
     break;
 
   case 57: /* column_type: INT  */
 #line 510 "expression_parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2614 "expression_parser.cpp"
+#line 2628 "expression_parser.cpp"
     break;
 
   case 58: /* column_type: BIGINT  */
 #line 511 "expression_parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2620 "expression_parser.cpp"
+#line 2634 "expression_parser.cpp"
     break;
 
   case 59: /* column_type: HUGEINT  */
 #line 512 "expression_parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2626 "expression_parser.cpp"
+#line 2640 "expression_parser.cpp"
     break;
 
   case 60: /* column_type: FLOAT  */
 #line 513 "expression_parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2632 "expression_parser.cpp"
+#line 2646 "expression_parser.cpp"
     break;
 
   case 61: /* column_type: REAL  */
 #line 514 "expression_parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2638 "expression_parser.cpp"
+#line 2652 "expression_parser.cpp"
     break;
 
   case 62: /* column_type: DOUBLE  */
 #line 515 "expression_parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2644 "expression_parser.cpp"
+#line 2658 "expression_parser.cpp"
     break;
 
   case 63: /* column_type: DATE  */
 #line 516 "expression_parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2650 "expression_parser.cpp"
+#line 2664 "expression_parser.cpp"
     break;
 
   case 64: /* column_type: TIME  */
 #line 517 "expression_parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2656 "expression_parser.cpp"
+#line 2670 "expression_parser.cpp"
     break;
 
   case 65: /* column_type: DATETIME  */
 #line 518 "expression_parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2662 "expression_parser.cpp"
+#line 2676 "expression_parser.cpp"
     break;
 
   case 66: /* column_type: TIMESTAMP  */
 #line 519 "expression_parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2668 "expression_parser.cpp"
+#line 2682 "expression_parser.cpp"
     break;
 
   case 67: /* column_type: UUID  */
 #line 520 "expression_parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2674 "expression_parser.cpp"
+#line 2688 "expression_parser.cpp"
     break;
 
   case 68: /* column_type: POINT  */
 #line 521 "expression_parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2680 "expression_parser.cpp"
+#line 2694 "expression_parser.cpp"
     break;
 
   case 69: /* column_type: LINE  */
 #line 522 "expression_parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2686 "expression_parser.cpp"
+#line 2700 "expression_parser.cpp"
     break;
 
   case 70: /* column_type: LSEG  */
 #line 523 "expression_parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2692 "expression_parser.cpp"
+#line 2706 "expression_parser.cpp"
     break;
 
   case 71: /* column_type: BOX  */
 #line 524 "expression_parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2698 "expression_parser.cpp"
+#line 2712 "expression_parser.cpp"
     break;
 
   case 72: /* column_type: CIRCLE  */
 #line 527 "expression_parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2704 "expression_parser.cpp"
+#line 2718 "expression_parser.cpp"
     break;
 
   case 73: /* column_type: VARCHAR  */
 #line 529 "expression_parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2710 "expression_parser.cpp"
+#line 2724 "expression_parser.cpp"
     break;
 
   case 74: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 530 "expression_parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2716 "expression_parser.cpp"
+#line 2730 "expression_parser.cpp"
     break;
 
   case 75: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 531 "expression_parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2722 "expression_parser.cpp"
+#line 2736 "expression_parser.cpp"
     break;
 
   case 76: /* column_type: DECIMAL  */
 #line 532 "expression_parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 2728 "expression_parser.cpp"
+#line 2742 "expression_parser.cpp"
     break;
 
   case 77: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 535 "expression_parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 2734 "expression_parser.cpp"
+#line 2748 "expression_parser.cpp"
     break;
 
   case 78: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 536 "expression_parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 2740 "expression_parser.cpp"
+#line 2754 "expression_parser.cpp"
     break;
 
   case 79: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 537 "expression_parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 2746 "expression_parser.cpp"
+#line 2760 "expression_parser.cpp"
     break;
 
   case 80: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 538 "expression_parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 2752 "expression_parser.cpp"
+#line 2766 "expression_parser.cpp"
     break;
 
   case 81: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 539 "expression_parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 2758 "expression_parser.cpp"
+#line 2772 "expression_parser.cpp"
     break;
 
   case 82: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 540 "expression_parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 2764 "expression_parser.cpp"
+#line 2778 "expression_parser.cpp"
     break;
 
   case 83: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 541 "expression_parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 2770 "expression_parser.cpp"
+#line 2784 "expression_parser.cpp"
     break;
 
   case 84: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 542 "expression_parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 2776 "expression_parser.cpp"
+#line 2790 "expression_parser.cpp"
     break;
 
-  case 85: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+  case 85: /* column_type: EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')'  */
 #line 543 "expression_parser.y"
+                                              {
+    // half precision element types are not keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "float16") == 0 or strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        expressionerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 2811 "expression_parser.cpp"
+    break;
+
+  case 86: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 559 "expression_parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 2782 "expression_parser.cpp"
+#line 2817 "expression_parser.cpp"
     break;
 
-  case 86: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 544 "expression_parser.y"
+  case 87: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 560 "expression_parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 2788 "expression_parser.cpp"
+#line 2823 "expression_parser.cpp"
     break;
 
-  case 87: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 545 "expression_parser.y"
+  case 88: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 561 "expression_parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 2794 "expression_parser.cpp"
+#line 2829 "expression_parser.cpp"
     break;
 
-  case 88: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 546 "expression_parser.y"
+  case 89: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 562 "expression_parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 2800 "expression_parser.cpp"
+#line 2835 "expression_parser.cpp"
     break;
 
-  case 89: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 547 "expression_parser.y"
+  case 90: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 563 "expression_parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 2806 "expression_parser.cpp"
+#line 2841 "expression_parser.cpp"
     break;
 
-  case 90: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 548 "expression_parser.y"
+  case 91: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 564 "expression_parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 2812 "expression_parser.cpp"
+#line 2847 "expression_parser.cpp"
     break;
 
-  case 91: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 549 "expression_parser.y"
+  case 92: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 565 "expression_parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 2818 "expression_parser.cpp"
+#line 2853 "expression_parser.cpp"
     break;
 
-  case 92: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 550 "expression_parser.y"
+  case 93: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 566 "expression_parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 2824 "expression_parser.cpp"
+#line 2859 "expression_parser.cpp"
     break;
 
-  case 93: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 552 "expression_parser.y"
+  case 94: /* column_type: VECTOR '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 567 "expression_parser.y"
+                                           {
+    // half precision element types are not keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "float16") == 0 or strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        expressionerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 2880 "expression_parser.cpp"
+    break;
+
+  case 95: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 584 "expression_parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -2848,11 +2904,11 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 2852 "expression_parser.cpp"
+#line 2908 "expression_parser.cpp"
     break;
 
-  case 94: /* column_expr: IDENTIFIER  */
-#line 576 "expression_parser.y"
+  case 96: /* column_expr: IDENTIFIER  */
+#line 608 "expression_parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -2860,11 +2916,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 2864 "expression_parser.cpp"
+#line 2920 "expression_parser.cpp"
     break;
 
-  case 95: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 583 "expression_parser.y"
+  case 97: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 615 "expression_parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -2872,21 +2928,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 2876 "expression_parser.cpp"
+#line 2932 "expression_parser.cpp"
     break;
 
-  case 96: /* column_expr: '*'  */
-#line 590 "expression_parser.y"
+  case 98: /* column_expr: '*'  */
+#line 622 "expression_parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 2886 "expression_parser.cpp"
+#line 2942 "expression_parser.cpp"
     break;
 
-  case 97: /* column_expr: column_expr '.' '*'  */
-#line 595 "expression_parser.y"
+  case 99: /* column_expr: column_expr '.' '*'  */
+#line 627 "expression_parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -2896,319 +2952,319 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 2900 "expression_parser.cpp"
+#line 2956 "expression_parser.cpp"
     break;
 
-  case 98: /* constant_expr: STRING  */
-#line 605 "expression_parser.y"
+  case 100: /* constant_expr: STRING  */
+#line 637 "expression_parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2910 "expression_parser.cpp"
+#line 2966 "expression_parser.cpp"
     break;
 
-  case 99: /* constant_expr: TRUE  */
-#line 610 "expression_parser.y"
+  case 101: /* constant_expr: TRUE  */
+#line 642 "expression_parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 2920 "expression_parser.cpp"
+#line 2976 "expression_parser.cpp"
     break;
 
-  case 100: /* constant_expr: FALSE  */
-#line 615 "expression_parser.y"
+  case 102: /* constant_expr: FALSE  */
+#line 647 "expression_parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 2930 "expression_parser.cpp"
+#line 2986 "expression_parser.cpp"
     break;
 
-  case 101: /* constant_expr: DOUBLE_VALUE  */
-#line 620 "expression_parser.y"
+  case 103: /* constant_expr: DOUBLE_VALUE  */
+#line 652 "expression_parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2940 "expression_parser.cpp"
+#line 2996 "expression_parser.cpp"
     break;
 
-  case 102: /* constant_expr: LONG_VALUE  */
-#line 625 "expression_parser.y"
+  case 104: /* constant_expr: LONG_VALUE  */
+#line 657 "expression_parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2950 "expression_parser.cpp"
+#line 3006 "expression_parser.cpp"
     break;
 
-  case 103: /* constant_expr: DATE STRING  */
-#line 630 "expression_parser.y"
+  case 105: /* constant_expr: DATE STRING  */
+#line 662 "expression_parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2960 "expression_parser.cpp"
+#line 3016 "expression_parser.cpp"
     break;
 
-  case 104: /* constant_expr: TIME STRING  */
-#line 635 "expression_parser.y"
+  case 106: /* constant_expr: TIME STRING  */
+#line 667 "expression_parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2970 "expression_parser.cpp"
+#line 3026 "expression_parser.cpp"
     break;
 
-  case 105: /* constant_expr: DATETIME STRING  */
-#line 640 "expression_parser.y"
+  case 107: /* constant_expr: DATETIME STRING  */
+#line 672 "expression_parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2980 "expression_parser.cpp"
+#line 3036 "expression_parser.cpp"
     break;
 
-  case 106: /* constant_expr: TIMESTAMP STRING  */
-#line 645 "expression_parser.y"
+  case 108: /* constant_expr: TIMESTAMP STRING  */
+#line 677 "expression_parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 2990 "expression_parser.cpp"
+#line 3046 "expression_parser.cpp"
     break;
 
-  case 107: /* constant_expr: INTERVAL interval_expr  */
-#line 650 "expression_parser.y"
+  case 109: /* constant_expr: INTERVAL interval_expr  */
+#line 682 "expression_parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 2998 "expression_parser.cpp"
+#line 3054 "expression_parser.cpp"
     break;
 
-  case 108: /* constant_expr: interval_expr  */
-#line 653 "expression_parser.y"
+  case 110: /* constant_expr: interval_expr  */
+#line 685 "expression_parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 3006 "expression_parser.cpp"
+#line 3062 "expression_parser.cpp"
     break;
 
-  case 109: /* constant_expr: long_array_expr  */
-#line 656 "expression_parser.y"
+  case 111: /* constant_expr: long_array_expr  */
+#line 688 "expression_parser.y"
                   {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 3014 "expression_parser.cpp"
+#line 3070 "expression_parser.cpp"
     break;
 
-  case 110: /* constant_expr: double_array_expr  */
-#line 659 "expression_parser.y"
+  case 112: /* constant_expr: double_array_expr  */
+#line 691 "expression_parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 3022 "expression_parser.cpp"
+#line 3078 "expression_parser.cpp"
     break;
 
-  case 111: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 663 "expression_parser.y"
+  case 113: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 695 "expression_parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 3030 "expression_parser.cpp"
+#line 3086 "expression_parser.cpp"
     break;
 
-  case 112: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 667 "expression_parser.y"
+  case 114: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 699 "expression_parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 3040 "expression_parser.cpp"
+#line 3096 "expression_parser.cpp"
     break;
 
-  case 113: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 672 "expression_parser.y"
+  case 115: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 704 "expression_parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 3049 "expression_parser.cpp"
+#line 3105 "expression_parser.cpp"
     break;
 
-  case 114: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 677 "expression_parser.y"
+  case 116: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 709 "expression_parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 3057 "expression_parser.cpp"
+#line 3113 "expression_parser.cpp"
     break;
 
-  case 115: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 681 "expression_parser.y"
+  case 117: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 713 "expression_parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 3067 "expression_parser.cpp"
+#line 3123 "expression_parser.cpp"
     break;
 
-  case 116: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 686 "expression_parser.y"
+  case 118: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 718 "expression_parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 3076 "expression_parser.cpp"
+#line 3132 "expression_parser.cpp"
     break;
 
-  case 117: /* interval_expr: LONG_VALUE SECONDS  */
-#line 691 "expression_parser.y"
+  case 119: /* interval_expr: LONG_VALUE SECONDS  */
+#line 723 "expression_parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3087 "expression_parser.cpp"
+#line 3143 "expression_parser.cpp"
     break;
 
-  case 118: /* interval_expr: LONG_VALUE SECOND  */
-#line 697 "expression_parser.y"
+  case 120: /* interval_expr: LONG_VALUE SECOND  */
+#line 729 "expression_parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3098 "expression_parser.cpp"
+#line 3154 "expression_parser.cpp"
     break;
 
-  case 119: /* interval_expr: LONG_VALUE MINUTES  */
-#line 703 "expression_parser.y"
+  case 121: /* interval_expr: LONG_VALUE MINUTES  */
+#line 735 "expression_parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3109 "expression_parser.cpp"
+#line 3165 "expression_parser.cpp"
     break;
 
-  case 120: /* interval_expr: LONG_VALUE MINUTE  */
-#line 709 "expression_parser.y"
+  case 122: /* interval_expr: LONG_VALUE MINUTE  */
+#line 741 "expression_parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3120 "expression_parser.cpp"
+#line 3176 "expression_parser.cpp"
     break;
 
-  case 121: /* interval_expr: LONG_VALUE HOURS  */
-#line 715 "expression_parser.y"
+  case 123: /* interval_expr: LONG_VALUE HOURS  */
+#line 747 "expression_parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3131 "expression_parser.cpp"
+#line 3187 "expression_parser.cpp"
     break;
 
-  case 122: /* interval_expr: LONG_VALUE HOUR  */
-#line 721 "expression_parser.y"
+  case 124: /* interval_expr: LONG_VALUE HOUR  */
+#line 753 "expression_parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3142 "expression_parser.cpp"
+#line 3198 "expression_parser.cpp"
     break;
 
-  case 123: /* interval_expr: LONG_VALUE DAYS  */
-#line 727 "expression_parser.y"
+  case 125: /* interval_expr: LONG_VALUE DAYS  */
+#line 759 "expression_parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3153 "expression_parser.cpp"
+#line 3209 "expression_parser.cpp"
     break;
 
-  case 124: /* interval_expr: LONG_VALUE DAY  */
-#line 733 "expression_parser.y"
+  case 126: /* interval_expr: LONG_VALUE DAY  */
+#line 765 "expression_parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3164 "expression_parser.cpp"
+#line 3220 "expression_parser.cpp"
     break;
 
-  case 125: /* interval_expr: LONG_VALUE MONTHS  */
-#line 739 "expression_parser.y"
+  case 127: /* interval_expr: LONG_VALUE MONTHS  */
+#line 771 "expression_parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3175 "expression_parser.cpp"
+#line 3231 "expression_parser.cpp"
     break;
 
-  case 126: /* interval_expr: LONG_VALUE MONTH  */
-#line 745 "expression_parser.y"
+  case 128: /* interval_expr: LONG_VALUE MONTH  */
+#line 777 "expression_parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3186 "expression_parser.cpp"
+#line 3242 "expression_parser.cpp"
     break;
 
-  case 127: /* interval_expr: LONG_VALUE YEARS  */
-#line 751 "expression_parser.y"
+  case 129: /* interval_expr: LONG_VALUE YEARS  */
+#line 783 "expression_parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3197 "expression_parser.cpp"
+#line 3253 "expression_parser.cpp"
     break;
 
-  case 128: /* interval_expr: LONG_VALUE YEAR  */
-#line 757 "expression_parser.y"
+  case 130: /* interval_expr: LONG_VALUE YEAR  */
+#line 789 "expression_parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 3208 "expression_parser.cpp"
+#line 3264 "expression_parser.cpp"
     break;
 
 
-#line 3212 "expression_parser.cpp"
+#line 3268 "expression_parser.cpp"
 
       default: break;
     }
@@ -3437,7 +3493,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 764 "expression_parser.y"
+#line 796 "expression_parser.y"
 
 
 void
@@ -540,6 +540,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | EMBEDDING '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | EMBEDDING '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | EMBEDDING '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types are not keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "float16") == 0 or strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        expressionerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 | VECTOR '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemBit}; }
 | VECTOR '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt8}; }
 | VECTOR '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt16}; }
@@ -548,6 +564,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | VECTOR '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | VECTOR '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | VECTOR '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| VECTOR '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types are not keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "float16") == 0 or strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        expressionerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 
 cast_expr: CAST '(' expr AS column_type ')' {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
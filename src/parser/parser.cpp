@@ -726,18 +726,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  82
+#define YYFINAL  96
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   893
+#define YYLAST   944
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  182
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  96
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  356
+#define YYNRULES  359
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  692
+#define YYNSTATES  703
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   421
@@ -810,35 +810,35 @@ static const yytype_int16 yyrline[] =
      737,   738,   739,   740,   741,   742,   743,   744,   745,   746,
      747,   748,   749,   750,   751,   752,   753,   754,   755,   758,
      760,   761,   762,   763,   766,   767,   768,   769,   770,   771,
-     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
-     800,   804,   814,   817,   820,   823,   827,   830,   835,   840,
-     847,   853,   863,   879,   913,   926,   929,   936,   942,   945,
-     948,   951,   954,   957,   960,   963,   970,   983,   987,   992,
-    1005,  1018,  1033,  1048,  1063,  1086,  1127,  1172,  1175,  1178,
-    1187,  1197,  1200,  1204,  1209,  1231,  1234,  1239,  1255,  1258,
-    1262,  1266,  1271,  1277,  1280,  1283,  1287,  1291,  1293,  1297,
-    1299,  1302,  1306,  1309,  1313,  1318,  1322,  1325,  1329,  1332,
-    1336,  1339,  1343,  1346,  1349,  1352,  1360,  1363,  1378,  1378,
-    1380,  1394,  1403,  1408,  1417,  1422,  1427,  1433,  1440,  1443,
-    1447,  1450,  1455,  1467,  1474,  1488,  1491,  1494,  1497,  1500,
-    1503,  1506,  1512,  1516,  1520,  1524,  1528,  1532,  1536,  1540,
-    1547,  1553,  1564,  1575,  1586,  1598,  1610,  1623,  1637,  1648,
-    1666,  1670,  1674,  1682,  1696,  1702,  1707,  1713,  1719,  1727,
-    1733,  1739,  1745,  1751,  1759,  1765,  1771,  1787,  1791,  1796,
-    1800,  1827,  1833,  1837,  1838,  1839,  1840,  1841,  1843,  1846,
-    1852,  1855,  1856,  1857,  1858,  1859,  1860,  1861,  1862,  1864,
-    2031,  2039,  2050,  2056,  2065,  2071,  2081,  2085,  2089,  2093,
-    2097,  2101,  2105,  2109,  2114,  2122,  2130,  2139,  2146,  2153,
-    2160,  2167,  2174,  2182,  2190,  2198,  2206,  2214,  2222,  2230,
-    2238,  2246,  2254,  2262,  2270,  2300,  2308,  2317,  2325,  2334,
-    2342,  2348,  2355,  2361,  2368,  2373,  2380,  2387,  2395,  2419,
-    2425,  2431,  2438,  2446,  2453,  2460,  2465,  2475,  2480,  2485,
-    2490,  2495,  2500,  2505,  2510,  2515,  2520,  2523,  2526,  2529,
-    2533,  2536,  2540,  2544,  2549,  2554,  2558,  2563,  2568,  2574,
-    2580,  2586,  2592,  2598,  2604,  2610,  2616,  2622,  2628,  2634,
-    2645,  2649,  2654,  2676,  2686,  2692,  2696,  2697,  2699,  2700,
-    2702,  2703,  2715,  2723,  2727,  2730,  2734,  2737,  2741,  2745,
-    2750,  2755,  2763,  2770,  2781,  2829,  2878
+     772,   773,   774,   790,   791,   792,   793,   794,   795,   796,
+     797,   798,   832,   836,   846,   849,   852,   855,   859,   862,
+     867,   872,   879,   885,   895,   911,   945,   958,   961,   968,
+     973,   979,   982,   985,   988,   991,   994,   997,  1004,  1017,
+    1021,  1026,  1039,  1052,  1067,  1082,  1097,  1120,  1161,  1206,
+    1209,  1212,  1221,  1231,  1234,  1238,  1243,  1265,  1268,  1273,
+    1289,  1292,  1296,  1300,  1305,  1311,  1314,  1317,  1321,  1325,
+    1327,  1331,  1333,  1336,  1340,  1343,  1347,  1352,  1356,  1359,
+    1363,  1366,  1370,  1373,  1377,  1380,  1383,  1386,  1394,  1397,
+    1412,  1412,  1414,  1428,  1437,  1442,  1451,  1456,  1461,  1467,
+    1474,  1477,  1481,  1484,  1489,  1501,  1508,  1522,  1525,  1528,
+    1531,  1534,  1537,  1540,  1546,  1550,  1554,  1558,  1562,  1566,
+    1570,  1574,  1581,  1587,  1598,  1609,  1620,  1632,  1644,  1657,
+    1671,  1682,  1700,  1704,  1708,  1716,  1730,  1736,  1741,  1747,
+    1753,  1761,  1767,  1773,  1779,  1785,  1793,  1799,  1805,  1816,
+    1832,  1836,  1841,  1845,  1872,  1878,  1882,  1883,  1884,  1885,
+    1886,  1888,  1891,  1897,  1900,  1901,  1902,  1903,  1904,  1905,
+    1906,  1907,  1909,  2095,  2103,  2114,  2120,  2129,  2135,  2145,
+    2149,  2153,  2157,  2161,  2165,  2169,  2173,  2178,  2186,  2194,
+    2203,  2210,  2217,  2224,  2231,  2238,  2246,  2254,  2262,  2270,
+    2278,  2286,  2294,  2302,  2310,  2318,  2326,  2334,  2364,  2372,
+    2381,  2389,  2398,  2406,  2412,  2419,  2425,  2432,  2437,  2444,
+    2451,  2459,  2483,  2489,  2495,  2502,  2510,  2517,  2524,  2529,
+    2539,  2544,  2549,  2554,  2559,  2564,  2569,  2574,  2579,  2584,
+    2587,  2590,  2593,  2597,  2600,  2604,  2608,  2613,  2618,  2622,
+    2627,  2632,  2638,  2644,  2650,  2656,  2662,  2668,  2674,  2680,
+    2686,  2692,  2698,  2709,  2713,  2718,  2740,  2750,  2756,  2760,
+    2761,  2763,  2764,  2766,  2767,  2779,  2787,  2791,  2794,  2798,
+    2801,  2805,  2809,  2814,  2819,  2827,  2834,  2845,  2893,  2942
 };
 #endif
 
@@ -921,7 +921,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-344)
+#define YYTABLE_NINF (-347)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -930,76 +930,77 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     201,   307,    -2,   340,    37,   -31,    37,   -30,   477,   237,
-      23,    56,    58,    37,    62,   -86,   -68,    82,   -70,  -629,
-    -629,  -629,  -629,  -629,  -629,  -629,  -629,   176,  -629,  -629,
-     108,  -629,  -629,  -629,  -629,    68,    68,    68,    68,   -21,
-      37,    86,    86,    86,    86,    86,   -18,   154,    37,   211,
-     196,   220,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   407,
-     227,    37,  -629,  -629,  -629,    59,    77,  -629,  -629,   238,
-      37,  -629,  -629,  -629,  -629,  -629,   198,    64,  -629,   253,
-      83,    87,  -629,   164,  -629,   263,  -629,  -629,     8,   233,
-    -629,   240,   236,   309,    37,    37,    37,   327,   276,   168,
-     283,   360,    37,    37,    37,   376,   408,   410,   355,   423,
-     423,    54,    63,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
-     176,  -629,  -629,  -629,  -629,  -629,   304,  -629,  -629,  -629,
-    -629,   252,    62,   423,  -629,  -629,  -629,  -629,     8,  -629,
-    -629,  -629,   436,   382,   383,   398,  -629,   -47,  -629,   168,
-    -629,    37,   455,    22,  -629,  -629,  -629,  -629,  -629,   411,
-    -629,   315,   -43,  -629,   436,  -629,  -629,   388,   406,  -629,
-    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   485,
-     503,  -629,  -629,  -629,   108,  -629,  -629,   312,   348,   341,
-    -629,  -629,   364,   519,   350,   358,   300,   532,   543,   548,
-     549,  -629,  -629,   558,   389,   394,   395,   400,   401,   553,
-     553,  -629,   387,   404,   -59,  -629,   -26,   566,  -629,  -629,
-    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   386,
-    -629,  -629,  -104,  -629,   -11,  -629,   436,   436,   510,  -629,
-     -68,    11,   527,   409,  -629,  -103,   414,  -629,    37,   436,
-     410,  -629,   255,   415,   418,  -629,   357,   419,  -629,  -629,
-     189,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
-    -629,  -629,  -629,   553,   421,   619,   506,   436,   436,    18,
-     156,  -629,  -629,  -629,  -629,   364,  -629,   592,   436,   599,
-     601,   605,   271,   271,  -629,  -629,   432,   -97,     4,   436,
-     450,   611,   436,   436,   -56,   438,   -23,   553,   553,   553,
-     553,   553,   553,   553,   553,   553,   553,   553,   553,   553,
-     553,    14,  -629,   610,  -629,   612,   437,  -629,   -17,   255,
-     436,  -629,   176,   746,   500,   447,    97,  -629,  -629,  -629,
-     -68,   455,   448,  -629,   623,   436,   449,  -629,   255,  -629,
-     508,   508,   622,  -629,  -629,   436,  -629,    98,   506,   482,
-     453,   -24,   -52,   223,  -629,   436,   436,   555,   -81,   452,
-     138,   140,  -629,  -629,   -68,   454,   484,  -629,    24,  -629,
-    -629,   122,   355,  -629,  -629,   490,   460,   553,   404,   518,
-    -629,   660,   660,    79,    79,   607,   660,   660,    79,    79,
-     271,   271,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   436,
-    -629,  -629,  -629,   255,  -629,  -629,  -629,  -629,  -629,  -629,
-    -629,  -629,  -629,  -629,  -629,   464,  -629,  -629,  -629,  -629,
-    -629,  -629,  -629,  -629,  -629,  -629,   469,   470,   -33,   471,
-     455,   621,    11,   176,   153,   455,  -629,   166,   473,   647,
-     649,  -629,   184,  -629,   195,   603,   199,  -629,   480,  -629,
-     746,   436,  -629,   436,   -61,   -48,   553,   486,   655,  -629,
-     656,  -629,   658,   -12,     4,   606,  -629,  -629,  -629,  -629,
-    -629,  -629,   608,  -629,   664,  -629,  -629,  -629,  -629,  -629,
-     487,   616,   404,   660,   493,   206,  -629,   553,  -629,   657,
-     141,   363,   551,   554,  -629,  -629,    32,   -33,  -629,  -629,
-     455,   208,   497,  -629,  -629,   523,   216,  -629,   436,  -629,
-    -629,  -629,   508,  -629,   670,  -629,  -629,   502,   255,   -50,
-    -629,   436,   155,   504,  -629,  -629,   234,   509,   514,    24,
-     484,     4,     4,   520,   122,   632,   640,   522,   250,  -629,
-    -629,   619,   257,   517,   521,   529,   530,   531,   533,   534,
-     538,   539,   540,   541,   545,   546,   550,   561,   562,  -629,
-    -629,  -629,  -629,  -629,   281,  -629,   698,   700,   580,   288,
-    -629,  -629,  -629,  -629,   255,  -629,   740,  -629,   741,  -629,
-    -629,  -629,  -629,   687,   455,  -629,  -629,  -629,  -629,   436,
-     436,  -629,  -629,  -629,  -629,   747,   749,   750,   751,   756,
-     757,   758,   759,   761,   762,   763,   764,   765,   766,   767,
-     777,   778,  -629,   585,   303,  -629,   706,   791,  -629,   614,
-     618,   436,   373,   617,   255,   625,   626,   627,   628,   630,
-     631,   633,   634,   635,   636,   637,   638,   639,   641,   642,
-     643,   644,   265,  -629,   698,   620,  -629,   706,   806,  -629,
-     255,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
+     699,   214,     0,   262,    37,   -35,    37,    67,   628,   181,
+      23,   335,    52,    37,    37,    73,   -93,   -54,   122,   -46,
+    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   147,  -629,
+    -629,   152,  -629,  -629,  -629,  -629,   191,   191,   191,   191,
+     110,    37,   193,   193,   193,   193,   193,    78,   245,    37,
+     130,   267,   269,  -629,  -629,  -629,  -629,  -629,  -629,    37,
+    -629,  -629,  -629,  -629,   721,  -629,  -629,  -629,   147,  -629,
+    -629,  -629,  -629,   283,    37,  -629,  -629,  -629,   149,   153,
+    -629,  -629,   291,    37,  -629,  -629,  -629,  -629,  -629,  -629,
+     275,   143,  -629,   332,   167,   194,  -629,    56,  -629,   369,
+    -629,  -629,    -2,   336,  -629,   333,   334,   403,    37,    37,
+      37,   411,   352,   252,   355,   438,    37,    37,    37,   449,
+     450,   456,   393,   462,   462,    15,    26,  -629,  -629,   301,
+    -629,  -629,  -629,  -629,   295,    73,   462,  -629,  -629,  -629,
+    -629,    -2,  -629,  -629,  -629,   407,   423,   417,   405,  -629,
+     -19,  -629,   252,  -629,    37,   488,    59,  -629,  -629,  -629,
+    -629,  -629,   430,  -629,   331,   -49,  -629,   407,  -629,  -629,
+     418,   421,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
+    -629,  -629,   509,   507,  -629,  -629,  -629,   152,  -629,  -629,
+     339,   340,   337,  -629,  -629,   639,   441,   342,   343,   292,
+     517,   518,   519,   521,  -629,  -629,   528,   358,   359,   360,
+     361,   362,   524,   524,  -629,   314,   324,   -50,  -629,   -20,
+     675,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
+    -629,  -629,   367,  -629,  -629,    33,  -629,    54,  -629,   407,
+     407,   470,  -629,   -54,     9,   485,   379,  -629,    19,   380,
+    -629,    37,   407,   456,  -629,   215,   382,   383,  -629,   230,
+     384,  -629,  -629,   186,  -629,  -629,  -629,  -629,  -629,  -629,
+    -629,  -629,  -629,  -629,  -629,  -629,   524,   386,   732,   482,
+     407,   407,   -60,   162,  -629,  -629,  -629,  -629,   639,  -629,
+     560,   407,   564,   565,   569,   330,   330,  -629,  -629,   396,
+      61,     5,   407,   413,   573,   407,   407,   -53,   404,   -13,
+     524,   524,   524,   524,   524,   524,   524,   524,   524,   524,
+     524,   524,   524,   524,     7,  -629,   574,  -629,   578,   408,
+    -629,    20,   215,   407,  -629,   147,   828,   466,   409,    87,
+    -629,  -629,  -629,   -54,   488,   414,  -629,   585,   407,   412,
+    -629,   215,  -629,   425,   425,   584,  -629,  -629,   407,  -629,
+     184,   482,   447,   419,    -8,   -27,   165,  -629,   407,   407,
+     522,    57,   415,   190,   195,  -629,  -629,   -54,   420,   490,
+    -629,    32,  -629,  -629,    77,   393,  -629,  -629,   451,   426,
+     524,   324,   479,  -629,   742,   742,   263,   263,   689,   742,
+     742,   263,   263,   330,   330,  -629,  -629,  -629,  -629,  -629,
+    -629,  -629,   407,  -629,  -629,  -629,   215,  -629,  -629,  -629,
+    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   431,  -629,
+    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,   433,
+     437,   111,   440,   488,   587,     9,   147,   200,   488,  -629,
+     201,   442,   598,   617,  -629,   205,  -629,   206,   571,   210,
+    -629,   444,  -629,   828,   407,  -629,   407,   -41,    43,   524,
+     448,   620,  -629,   625,  -629,   626,     2,     5,   575,  -629,
+    -629,  -629,  -629,  -629,  -629,   576,  -629,   629,  -629,  -629,
+    -629,  -629,  -629,   455,   590,   324,   742,   453,   211,  -629,
+     524,  -629,   640,   183,   224,   526,   533,  -629,  -629,    92,
+     111,  -629,  -629,   488,   219,   468,  -629,  -629,   504,   241,
+    -629,   407,  -629,  -629,  -629,   425,  -629,   651,  -629,  -629,
+     480,   215,    17,  -629,   407,   618,   478,  -629,  -629,   242,
+     483,   484,    32,   490,     5,     5,   492,    77,   606,   619,
+     494,   243,  -629,  -629,   732,   261,   495,   496,   497,   498,
+     499,   500,   501,   502,   503,   505,   510,   512,   516,   523,
+     535,   536,   537,   538,  -629,  -629,  -629,  -629,  -629,   273,
+    -629,   670,   682,   546,   280,  -629,  -629,  -629,  -629,   215,
+    -629,   686,  -629,   696,  -629,  -629,  -629,  -629,   642,   488,
+    -629,  -629,  -629,  -629,   407,   407,  -629,  -629,  -629,  -629,
+     697,   714,   715,   717,   723,   730,   733,   735,   737,   739,
+     744,   746,   747,   748,   749,   750,   755,   756,   773,  -629,
+     613,   287,  -629,   623,   724,  -629,   557,   603,   407,   293,
+     601,   215,   605,   615,   616,   621,   624,   630,   631,   632,
+     634,   635,   641,   643,   645,   646,   647,   648,   649,   654,
+     656,   320,  -629,   670,   627,  -629,   623,   791,  -629,   215,
     -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
-    -629,  -629,  -629,   698,  -629,   645,   392,   812,  -629,   646,
-     706,  -629
+    -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,  -629,
+    -629,  -629,  -629,  -629,   670,  -629,   622,   298,   792,  -629,
+     657,   623,  -629
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1007,106 +1008,107 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     169,     0,     0,     0,     0,     0,     0,     0,   105,     0,
-       0,     0,     0,     0,     0,     0,   169,     0,   341,     3,
-       5,    10,    12,    13,    11,     6,     7,     9,   118,   117,
-       0,     8,    14,    15,    16,   339,   339,   339,   339,   339,
-       0,   337,   337,   337,   337,   337,   162,     0,     0,     0,
-       0,     0,    99,   103,   100,   101,   102,   104,    98,   169,
-       0,     0,   183,   184,   182,     0,     0,   185,   186,     0,
-       0,   200,   201,   202,   204,   203,     0,   168,   170,     0,
-       0,     0,     1,   169,     2,   152,   154,   155,     0,   141,
-     123,   129,     0,     0,     0,     0,     0,     0,     0,    96,
-       0,     0,     0,     0,     0,     0,     0,     0,   147,     0,
-       0,     0,     0,    97,    17,    22,    24,    23,    18,    19,
-      21,    20,    25,    26,    27,   190,   191,   187,   188,   189,
-     216,     0,     0,     0,   122,   121,     4,   153,     0,   119,
-     120,   140,     0,     0,   137,     0,    28,     0,    29,    96,
-     342,     0,     0,   169,   336,   110,   112,   111,   113,     0,
-     163,     0,   147,   107,     0,    92,   335,     0,     0,   208,
-     210,   209,   206,   207,   213,   215,   214,   211,   212,     0,
-       0,   193,   192,   198,     0,   171,   205,     0,     0,   293,
-     297,   300,   301,     0,     0,     0,     0,     0,     0,     0,
-       0,   298,   299,     0,     0,     0,     0,     0,     0,     0,
-       0,   295,     0,   169,   143,   217,   222,   223,   235,   236,
-     237,   238,   232,   227,   226,   225,   233,   234,   224,   231,
-     230,   308,     0,   309,     0,   307,     0,     0,   139,   338,
-     169,     0,     0,     0,    90,     0,     0,    94,     0,     0,
-       0,   106,   146,     0,     0,   199,   194,     0,   126,   125,
-       0,   319,   318,   321,   320,   323,   322,   325,   324,   327,
-     326,   329,   328,     0,     0,   259,   169,     0,     0,     0,
-       0,   302,   303,   304,   305,     0,   306,     0,     0,     0,
-       0,     0,   261,   260,   316,   313,     0,     0,     0,     0,
-     145,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     171,     0,     0,     0,     0,     0,     0,     0,   171,     0,
+       0,     0,     0,     0,     0,     0,     0,   171,     0,   344,
+       3,     5,    10,    12,    13,    11,     6,     7,     9,   120,
+     119,     0,     8,    14,    15,    16,   342,   342,   342,   342,
+     342,     0,   340,   340,   340,   340,   340,   164,     0,     0,
+       0,     0,     0,   102,   106,   103,   104,   105,   107,   101,
+     100,    17,    22,    24,   171,    23,    18,    19,    21,    20,
+      25,    26,    27,     0,     0,   185,   186,   184,     0,     0,
+     187,   188,     0,     0,   202,   203,   204,   206,   205,   219,
+       0,   170,   172,     0,     0,     0,     1,   171,     2,   154,
+     156,   157,     0,   143,   125,   131,     0,     0,     0,     0,
+       0,     0,     0,    98,     0,     0,     0,     0,     0,     0,
+       0,     0,   149,     0,     0,     0,     0,    99,   192,   193,
+     189,   190,   191,   218,     0,     0,     0,   124,   123,     4,
+     155,     0,   121,   122,   142,     0,     0,   139,     0,    28,
+       0,    29,    98,   345,     0,     0,   171,   339,   112,   114,
+     113,   115,     0,   165,     0,   149,   109,     0,    94,   338,
+       0,     0,   210,   212,   211,   208,   209,   215,   217,   216,
+     213,   214,     0,     0,   195,   194,   200,     0,   173,   207,
+       0,     0,   296,   300,   303,   304,     0,     0,     0,     0,
+       0,     0,     0,     0,   301,   302,     0,     0,     0,     0,
+       0,     0,     0,     0,   298,     0,   171,   145,   220,   225,
+     226,   238,   239,   240,   241,   235,   230,   229,   228,   236,
+     237,   227,   234,   233,   311,     0,   312,     0,   310,     0,
+       0,   141,   341,   171,     0,     0,     0,    92,     0,     0,
+      96,     0,     0,     0,   108,   148,     0,     0,   201,   196,
+       0,   128,   127,     0,   322,   321,   324,   323,   326,   325,
+     328,   327,   330,   329,   332,   331,     0,     0,   262,   171,
+       0,     0,     0,     0,   305,   306,   307,   308,     0,   309,
+       0,     0,     0,     0,     0,   264,   263,   319,   316,     0,
+       0,     0,     0,   147,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   315,     0,   318,     0,   130,
+     132,   137,   138,     0,   126,    31,     0,     0,     0,     0,
+      34,    36,    37,   171,     0,    33,    97,     0,     0,    95,
+     116,   111,   110,     0,     0,     0,   197,   174,     0,   257,
+       0,   171,     0,     0,     0,     0,     0,   287,     0,     0,
+       0,     0,     0,     0,     0,   232,   231,   171,   144,   158,
+     160,   169,   161,   221,     0,   149,   224,   280,   281,     0,
+       0,   171,     0,   261,   271,   272,   275,   276,     0,   278,
+     270,   273,   274,   266,   265,   267,   268,   269,   297,   299,
+     317,   320,     0,   135,   136,   134,   140,    40,    43,    44,
+      41,    42,    45,    46,    60,    47,    49,    48,    63,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,     0,
+       0,    89,     0,     0,   350,     0,    32,     0,     0,    93,
+       0,     0,     0,     0,   337,     0,   333,     0,   198,     0,
+     258,     0,   292,     0,     0,   285,     0,     0,     0,     0,
+       0,     0,   245,     0,   247,     0,     0,     0,     0,   178,
+     179,   180,   181,   177,   182,     0,   167,     0,   162,   249,
+     250,   251,   252,   146,   153,   171,   279,     0,     0,   260,
+       0,   133,     0,     0,     0,     0,     0,    85,    86,     0,
+      89,    82,    38,     0,     0,     0,    30,    35,   359,     0,
+     222,     0,   336,   335,   118,     0,   117,     0,   259,   293,
+       0,   289,     0,   288,     0,     0,     0,   313,   314,     0,
+       0,     0,   169,   159,     0,     0,   166,     0,     0,   151,
+       0,     0,   294,   283,   282,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   312,     0,   315,     0,   128,   130,   135,   136,
-       0,   124,    31,     0,     0,     0,     0,    34,    36,    37,
-     169,     0,    33,    95,     0,     0,    93,   114,   109,   108,
-       0,     0,     0,   195,   172,     0,   254,     0,   169,     0,
-       0,     0,     0,     0,   284,     0,     0,     0,     0,     0,
-       0,     0,   229,   228,   169,   142,   156,   158,   167,   159,
-     218,     0,   147,   221,   277,   278,     0,     0,   169,     0,
-     258,   268,   269,   272,   273,     0,   275,   267,   270,   271,
-     263,   262,   264,   265,   266,   294,   296,   314,   317,     0,
-     133,   134,   132,   138,    40,    43,    44,    41,    42,    45,
-      46,    60,    47,    49,    48,    63,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,     0,     0,    87,     0,
-       0,   347,     0,    32,     0,     0,    91,     0,     0,     0,
-       0,   334,     0,   330,     0,   196,     0,   255,     0,   289,
-       0,     0,   282,     0,     0,     0,     0,     0,     0,   242,
-       0,   244,     0,     0,     0,     0,   176,   177,   178,   179,
-     175,   180,     0,   165,     0,   160,   246,   247,   248,   249,
-     144,   151,   169,   276,     0,     0,   257,     0,   131,     0,
-       0,     0,     0,     0,    83,    84,     0,    87,    80,    38,
-       0,     0,     0,    30,    35,   356,     0,   219,     0,   333,
-     332,   116,     0,   115,     0,   256,   290,     0,   286,     0,
-     285,     0,     0,     0,   310,   311,     0,     0,     0,   167,
-     157,     0,     0,   164,     0,     0,   149,     0,     0,   291,
-     280,   279,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    85,
-      82,    86,    81,    39,     0,    89,     0,     0,     0,     0,
-     331,   197,   288,   283,   287,   274,     0,   240,     0,   243,
-     245,   161,   173,     0,     0,   250,   251,   252,   253,     0,
-       0,   127,   292,   281,    62,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,    84,    88,    83,    39,     0,
+      91,     0,     0,     0,     0,   334,   199,   291,   286,   290,
+     277,     0,   243,     0,   246,   248,   163,   175,     0,     0,
+     253,   254,   255,   256,     0,     0,   129,   295,   284,    62,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    88,   350,     0,   348,   345,     0,   220,     0,
-       0,     0,     0,   150,   148,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    90,
+     353,     0,   351,   348,     0,   223,     0,     0,     0,     0,
+     152,   150,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   346,     0,     0,   354,   345,     0,   241,
-     174,   166,    61,    67,    68,    65,    66,    69,    70,    71,
-      64,    75,    76,    73,    74,    77,    78,    79,    72,   351,
-     353,   352,   349,     0,   355,     0,     0,     0,   344,     0,
-     345,   239
+       0,     0,   349,     0,     0,   357,   348,     0,   244,   176,
+     168,    61,    72,    67,    68,    65,    66,    69,    70,    71,
+      64,    81,    76,    77,    74,    75,    78,    79,    80,    73,
+     354,   356,   355,   352,     0,   358,     0,     0,     0,   347,
+       0,   348,   242
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -629,  -629,  -629,   742,  -629,   797,  -629,   381,  -629,   397,
-    -629,   352,   353,  -629,  -338,   804,   805,   716,  -629,  -629,
-     807,  -629,   624,   808,   809,   -57,   853,   -16,   686,   733,
-     -62,  -629,  -629,   463,  -629,  -629,  -629,  -629,  -629,  -629,
-    -157,  -629,  -629,  -629,  -629,   399,   -38,     9,   336,  -629,
-    -629,   744,  -629,  -629,   818,   819,   820,   821,  -256,  -629,
-     582,  -163,  -165,  -375,  -362,  -360,  -356,  -629,  -629,  -629,
-    -629,  -629,  -629,   604,  -629,  -629,  -629,   378,  -629,   420,
-    -629,   422,  -629,   679,   535,   366,   -67,   405,   495,  -629,
-    -629,  -628,  -629,   202,   239,  -629
+    -629,  -629,  -629,   704,   743,    31,  -629,   375,  -629,   374,
+    -629,   328,   329,  -629,  -341,    41,    42,   688,  -629,  -629,
+      46,  -629,   588,    50,   120,    -7,   833,   -17,   664,   711,
+     -61,  -629,  -629,   454,  -629,  -629,  -629,  -629,  -629,  -629,
+    -161,  -629,  -629,  -629,  -629,   376,  -190,     3,   323,  -629,
+    -629,   734,  -629,  -629,   134,   151,   155,   158,  -258,  -629,
+     566,  -165,  -167,  -373,  -371,  -370,  -369,  -629,  -629,  -629,
+    -629,  -629,  -629,   593,  -629,  -629,  -629,   371,  -629,   397,
+    -629,   400,  -629,   672,   531,   363,   -77,   239,   268,  -629,
+    -629,  -628,  -629,   192,   227,  -629
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    17,    18,    19,   113,    20,   336,   337,   338,   438,
-     507,   508,   509,   339,   245,    21,    22,   153,    23,    59,
-      24,   162,   163,    25,    26,    27,    28,    29,    90,   139,
-      91,   144,   326,   327,   412,   238,   331,   142,   300,   382,
-     165,   601,   546,    88,   375,   376,   377,   378,   485,    30,
-      77,    78,   379,   482,    31,    32,    33,    34,   214,   346,
-     215,   216,   217,   218,   219,   220,   221,   490,   222,   223,
-     224,   225,   226,   280,   227,   228,   229,   230,   533,   231,
-     232,   233,   234,   235,   452,   453,   167,   101,    93,    84,
-      98,   656,   513,   624,   625,   342
+       0,    18,    19,    20,    60,    21,   339,   340,   341,   441,
+     510,   511,   512,   342,   248,    22,    23,   156,    24,    64,
+      25,   165,   166,    26,    27,    28,    29,    30,   104,   142,
+     105,   147,   329,   330,   415,   241,   334,   145,   303,   385,
+     168,   606,   549,   102,   378,   379,   380,   381,   488,    31,
+      91,    92,   382,   485,    32,    33,    34,    35,   217,   349,
+     218,   219,   220,   221,   222,   223,   224,   493,   225,   226,
+     227,   228,   229,   283,   230,   231,   232,   233,   536,   234,
+     235,   236,   237,   238,   455,   456,   170,   115,   107,    98,
+     112,   665,   516,   631,   632,   345
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1114,190 +1116,200 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      81,   252,   120,   444,   357,   251,   486,    46,    85,   240,
-      86,    14,    87,    47,   333,    49,    89,   405,   298,   487,
-     386,   488,    75,   530,   164,   489,   140,   483,   275,   684,
-     301,    40,   460,   279,   583,   461,   190,   191,   192,   531,
-      46,   502,  -343,   168,   292,   293,    48,   302,   303,    99,
-     297,   389,    92,    70,   410,   411,   246,   108,   169,   170,
-     171,    74,   691,   302,   303,    76,   186,   174,   175,   176,
-     126,    79,   322,   328,   329,   343,   188,   323,   344,   130,
-     484,   373,    82,   302,   303,   503,   348,   504,   505,   447,
-     506,   387,   302,   303,   302,   303,   302,   303,   390,   456,
-     467,    14,   511,   147,   148,   149,   278,   516,   275,    16,
-      83,   156,   157,   158,   361,   362,    89,   172,   302,   303,
-     302,   303,   299,    50,    51,   368,   177,   302,   303,   334,
-     241,   335,   495,   197,   198,   199,   200,   247,   250,   384,
-     385,    92,   391,   392,   393,   394,   395,   396,   397,   398,
-     399,   400,   401,   402,   403,   404,   201,   202,   203,   100,
-     243,   106,   302,   303,  -340,   324,   539,   413,   107,   595,
-     325,     1,   574,     2,     3,     4,     5,     6,     7,     8,
-       9,   374,   596,   332,   597,   138,   406,    10,   598,    11,
-      12,    13,   189,   190,   191,   192,    85,   296,    86,   111,
-      87,   306,   464,   465,    71,    72,    73,   212,     1,   173,
-       2,     3,     4,     5,     6,     7,     8,     9,   178,   127,
-    -344,  -344,   493,   112,    10,   491,    11,    12,    13,   359,
-     125,   553,   554,   555,   556,   557,   548,   128,   558,   559,
-     364,   129,   365,    14,   366,   132,   328,  -344,  -344,   316,
-     317,   318,   319,   320,   131,   355,   632,   347,   560,   133,
-     360,   134,   579,   193,   194,   135,    60,    61,   679,    62,
-     680,   681,   195,   205,   196,   441,   457,   306,   442,   299,
-      14,    63,    64,   443,   137,   206,   207,   208,   109,   110,
-     197,   198,   199,   200,   307,   308,   309,   310,   528,   141,
-     529,   532,   312,   189,   190,   191,   192,   462,   143,   463,
-     145,   366,   146,   201,   202,   203,   469,   473,   471,   470,
-      15,   472,   313,   314,   315,   316,   317,   318,   319,   320,
-     150,   515,   551,   585,   344,   204,    35,    36,    37,   151,
-     205,    16,   458,   633,   517,   152,   179,   299,    38,    39,
-     180,   181,   206,   207,   208,   182,   183,    15,   154,   209,
-     210,   211,   521,   155,   212,   522,   213,   356,   584,    41,
-      42,    43,   494,   523,   193,   194,   522,   525,    16,   159,
-     299,    44,    45,   195,   550,   196,   575,   299,   278,   344,
-      65,    66,   294,   295,   578,    67,    68,   344,    69,   302,
-     303,   197,   198,   199,   200,   352,   353,   189,   190,   191,
-     192,   160,   587,   161,     1,   588,     2,     3,     4,     5,
-       6,     7,   164,     9,   201,   202,   203,   166,   603,   184,
-      10,   299,    11,    12,    13,   604,   236,   634,   605,   189,
-     190,   191,   192,   318,   319,   320,   204,   102,   103,   104,
-     105,   205,   237,   561,   562,   563,   564,   565,   244,   622,
-     566,   567,   344,   206,   207,   208,   628,   253,   660,   299,
-     209,   210,   211,   239,   248,   212,   547,   213,   193,   194,
-     568,   653,   249,    14,   654,   254,    14,   195,   255,   196,
-     258,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-     270,   271,   272,   592,   593,   197,   198,   199,   200,   256,
-     193,   194,    52,    53,    54,    55,    56,    57,   260,   195,
-      58,   196,   189,   190,   191,   192,   259,   276,   201,   202,
-     203,    94,    95,    96,    97,   277,   281,   197,   198,   199,
-     200,   475,  -181,   476,   477,   478,   479,   282,   480,   481,
-     204,   661,   283,   284,   344,   205,   189,   190,   191,   192,
-     201,   202,   203,    15,   285,   321,   287,   206,   207,   208,
-     688,   288,   289,   654,   209,   210,   211,   290,   291,   212,
-     330,   213,   204,   340,    16,    14,   341,   205,   449,   450,
-     451,   345,   350,   273,   274,   351,   367,   354,   358,   206,
-     207,   208,   195,   369,   196,   370,   209,   210,   211,   371,
-     372,   212,   381,   213,   383,   388,   407,   408,   409,   439,
-     197,   198,   199,   200,   440,   445,   446,   273,   455,   387,
-     448,   459,   466,   468,   302,   474,   195,   492,   196,   496,
-     304,   499,   305,   201,   202,   203,   500,   501,   510,   512,
-     518,   519,   520,   524,   197,   198,   199,   200,   526,   536,
-     537,   212,   538,   552,   541,   204,   542,   543,   544,   545,
-     205,   549,   569,   570,   576,   577,   581,   201,   202,   203,
-     582,   359,   206,   207,   208,   586,   599,   589,   306,   209,
-     210,   211,   590,   359,   212,   600,   213,   594,   606,   204,
-     602,   623,   607,   626,   205,   307,   308,   309,   310,   311,
-     608,   609,   610,   312,   611,   612,   206,   207,   208,   613,
-     614,   615,   616,   209,   210,   211,   617,   618,   212,   306,
-     213,   619,   627,   313,   314,   315,   316,   317,   318,   319,
-     320,   306,   620,   621,   629,   630,   307,   308,   309,   310,
-     631,   497,   652,   635,   312,   636,   637,   638,   307,   308,
-     309,   310,   639,   640,   641,   642,   312,   643,   644,   645,
-     646,   647,   648,   649,   313,   314,   315,   316,   317,   318,
-     319,   320,   306,   650,   651,   655,   313,   314,   315,   316,
-     317,   318,   319,   320,   657,   658,   659,   683,   299,  -344,
-    -344,   309,   310,   662,   663,   664,   665,  -344,   666,   667,
-     685,   668,   669,   670,   671,   672,   673,   674,   689,   675,
-     676,   677,   678,   514,   690,   136,   687,  -344,   314,   315,
-     316,   317,   318,   319,   320,   414,   415,   416,   417,   418,
-     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
-     429,   430,   431,   432,   433,   434,   114,   527,   435,   572,
-     573,   436,   437,   115,   116,   242,   117,   118,   119,    80,
-     257,   187,   498,   540,   349,   591,   185,   121,   122,   123,
-     124,   380,   286,   363,   571,   686,   454,   534,   580,   535,
-       0,     0,     0,   682
+      95,    68,   255,   447,   254,   360,   103,    48,    47,    50,
+     408,   489,   336,   490,   491,   492,    88,    89,   167,   172,
+     173,   174,    99,   389,   100,    15,   101,   301,   281,   278,
+     177,   178,   179,    41,   282,   486,   304,   243,   695,    61,
+      47,   143,    49,   533,   113,   295,   296,   171,   463,    62,
+      63,   300,   122,    83,    65,    87,  -343,    68,    66,   189,
+     464,   392,    89,     1,    93,     2,     3,     4,     5,     6,
+       7,     8,     9,   702,   331,   332,    90,   129,   175,    10,
+     191,    11,    12,    13,   305,   306,   133,   351,   487,   180,
+     450,   413,   414,   249,   390,    61,   193,   194,   195,    14,
+     459,   588,   514,   305,   306,    62,    63,   519,   393,   278,
+      65,   150,   151,   152,    66,   364,   365,   305,   306,   159,
+     160,   161,    96,    17,   305,   306,   371,   337,    67,   338,
+     534,   302,   253,   498,    97,    15,   305,   306,    15,   250,
+     387,   388,    69,   394,   395,   396,   397,   398,   399,   400,
+     401,   402,   403,   404,   405,   406,   407,   246,   244,    70,
+     103,   305,   306,    71,   305,   306,    72,    99,   416,   100,
+     176,   101,   579,  -346,   600,   141,   601,   602,   603,   409,
+     542,   181,   377,   106,    67,   505,   556,   305,   306,   192,
+     193,   194,   195,   200,   201,   202,   203,   346,    69,   299,
+     347,   305,   306,   467,   468,   305,   306,   123,   124,   325,
+      73,    74,    16,    75,   326,    70,   204,   205,   206,    71,
+      51,    52,    72,   496,   494,    76,    77,   565,   208,   506,
+     327,   507,   508,    17,   509,   328,   335,   551,   470,   376,
+     209,   210,   211,    36,    37,    38,   367,   331,   368,   465,
+     369,   466,   358,   369,   350,    39,    40,   120,   639,   121,
+     196,   197,   363,   584,   106,   444,   114,   215,   445,   198,
+     125,   199,   126,   557,   558,   559,   560,   561,   355,   356,
+     562,   563,   116,   117,   118,   119,   128,   200,   201,   202,
+     203,    42,    43,    44,   132,   192,   193,   194,   195,   531,
+     564,   532,   535,    45,    46,   108,   109,   110,   111,   130,
+     204,   205,   206,   131,   566,   567,   568,   569,   570,   297,
+     298,   571,   572,   690,   135,   691,   692,   192,   193,   194,
+     195,   134,   207,   554,    78,    79,   446,   208,   136,    80,
+      81,   573,    82,   182,   461,   137,   640,   183,   184,   209,
+     210,   211,   185,   186,   597,   598,   212,   213,   214,   305,
+     306,   215,   460,   216,   359,   302,   196,   197,   472,   589,
+     476,   473,   138,   474,   497,   198,   475,   199,   518,   520,
+     281,   347,   302,   524,   526,   309,   525,   525,   528,   553,
+     140,   302,   302,   200,   201,   202,   203,   580,   196,   197,
+     347,   146,   144,    15,  -347,  -347,   149,   198,   148,   199,
+     192,   193,   194,   195,   153,   154,   204,   205,   206,   583,
+     592,   608,   347,   593,   302,   200,   201,   202,   203,   155,
+     157,  -347,  -347,   319,   320,   321,   322,   323,   207,   609,
+     641,   158,   610,   208,   192,   193,   194,   195,   204,   205,
+     206,   629,   162,   163,   347,   209,   210,   211,   635,   164,
+     167,   302,   212,   213,   214,   662,   169,   215,   663,   216,
+     207,   670,   187,   669,   347,   208,   699,   239,   550,   663,
+     242,   196,   197,    84,    85,    86,   240,   209,   210,   211,
+     198,   247,   199,   251,   212,   213,   214,   256,   252,   215,
+     257,   216,   321,   322,   323,   452,   453,   454,   200,   201,
+     202,   203,   258,   259,   263,   276,   277,   261,   262,   279,
+     280,   284,   285,   286,   198,   287,   199,   192,   193,   194,
+     195,   204,   205,   206,   288,   290,   291,   292,   293,   294,
+     333,   343,   200,   201,   202,   203,   324,   478,  -183,   479,
+     480,   481,   482,   207,   483,   484,   344,   348,   208,   353,
+     354,    15,   357,   361,   370,   204,   205,   206,   372,   373,
+     209,   210,   211,   374,   375,   384,   386,   212,   213,   214,
+     410,   391,   215,   411,   216,   442,   443,   207,   449,   412,
+     458,   448,   208,   451,   390,   305,   471,   462,   276,   469,
+     499,   477,   522,   495,   209,   210,   211,   198,   502,   199,
+     503,   212,   213,   214,   504,   515,   215,   513,   216,   521,
+     523,   527,   529,   215,   539,   200,   201,   202,   203,   540,
+     541,   552,   546,   544,   545,     1,   547,     2,     3,     4,
+       5,     6,     7,   548,     9,   581,   555,   574,   204,   205,
+     206,    10,   575,    11,    12,    13,   582,   586,   587,   591,
+     604,   594,   595,    53,    54,    55,    56,    57,    58,   599,
+     207,    59,   607,   630,   605,   208,   611,   612,   613,   614,
+     615,   616,   617,   618,   619,   633,   620,   209,   210,   211,
+     636,   621,   362,   622,   212,   213,   214,   623,   634,   215,
+     637,   216,   664,   642,   624,   638,     1,    15,     2,     3,
+       4,     5,     6,     7,     8,     9,   625,   626,   627,   628,
+     643,   644,    10,   645,    11,    12,    13,   666,     1,   646,
+       2,     3,     4,     5,     6,     7,   647,     9,   667,   648,
+     309,   649,    14,   650,    10,   651,    11,    12,    13,   307,
+     652,   308,   653,   654,   655,   656,   657,   310,   311,   312,
+     313,   658,   659,   362,    14,   315,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,    15,   660,
+     661,   668,   302,   671,    16,   316,   317,   318,   319,   320,
+     321,   322,   323,   672,   673,   696,   590,   309,   700,   674,
+      15,   139,   675,   698,   694,    17,   362,   127,   676,   677,
+     678,   309,   679,   680,   310,   311,   312,   313,   314,   681,
+     517,   682,   315,   683,   684,   685,   686,   687,   310,   311,
+     312,   313,   688,   500,   689,   701,   315,   530,   577,   578,
+     245,   352,   316,   317,   318,   319,   320,   321,   322,   323,
+      94,   260,   190,   543,   309,    16,   316,   317,   318,   319,
+     320,   321,   322,   323,   309,   596,   501,   537,   383,   188,
+     538,   310,   311,   312,   313,   366,    17,    16,   289,   315,
+     576,  -347,  -347,   312,   313,   457,   697,     0,   585,  -347,
+     693,     0,     0,     0,     0,     0,     0,     0,    17,   316,
+     317,   318,   319,   320,   321,   322,   323,     0,     0,  -347,
+     317,   318,   319,   320,   321,   322,   323,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,     0,     0,
+     438,     0,     0,   439,   440
 };
 
 static const yytype_int16 yycheck[] =
 {
-      16,   164,    59,   341,   260,   162,   381,     3,    20,    56,
-      22,    79,    24,     4,     3,     6,     8,     3,    77,   381,
-      76,   381,    13,    84,    67,   381,    88,     3,   193,   657,
-      56,    33,    56,   196,    84,    87,     4,     5,     6,    87,
-       3,    74,    63,   110,   209,   210,    77,   144,   145,    40,
-     213,    74,    73,    30,    71,    72,    34,    48,     4,     5,
-       6,     3,   690,   144,   145,     3,   133,     4,     5,     6,
-      61,   157,   176,   236,   237,   178,   138,   181,   181,    70,
-      56,   178,     0,   144,   145,   118,   249,   120,   121,   345,
-     123,   147,   144,   145,   144,   145,   144,   145,   121,   355,
-     181,    79,   440,    94,    95,    96,    88,   445,   273,   177,
-     180,   102,   103,   104,   277,   278,     8,    63,   144,   145,
-     144,   145,   181,   153,   154,   288,    63,   144,   145,   118,
-     177,   120,   388,   101,   102,   103,   104,   153,   181,   302,
-     303,    73,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   124,   125,   126,    73,
-     151,   179,   144,   145,     0,   176,   178,   330,    14,   544,
-     181,     7,   510,     9,    10,    11,    12,    13,    14,    15,
-      16,   177,   544,   240,   544,   177,   172,    23,   544,    25,
-      26,    27,     3,     4,     5,     6,    20,   213,    22,     3,
-      24,   122,   365,   366,   148,   149,   150,   175,     7,   155,
-       9,    10,    11,    12,    13,    14,    15,    16,   155,   160,
-     141,   142,   387,     3,    23,   382,    25,    26,    27,    74,
-       3,    90,    91,    92,    93,    94,   492,   160,    97,    98,
-      84,     3,    86,    79,    88,   181,   409,   168,   169,   170,
-     171,   172,   173,   174,    56,    66,   594,   248,   117,     6,
-     276,   178,   518,    74,    75,   178,    29,    30,     3,    32,
-       5,     6,    83,   151,    85,   178,   178,   122,   181,   181,
-      79,    44,    45,   340,    21,   163,   164,   165,    77,    78,
-     101,   102,   103,   104,   139,   140,   141,   142,   461,    66,
-     463,   466,   147,     3,     4,     5,     6,    84,    68,    86,
-      74,    88,     3,   124,   125,   126,   178,   374,   178,   181,
-     156,   181,   167,   168,   169,   170,   171,   172,   173,   174,
-       3,   178,   497,   178,   181,   146,    29,    30,    31,    63,
-     151,   177,   358,   599,   178,   177,    42,   181,    41,    42,
-      46,    47,   163,   164,   165,    51,    52,   156,    75,   170,
-     171,   172,   178,     3,   175,   181,   177,   178,   531,    29,
-      30,    31,   388,   178,    74,    75,   181,   178,   177,     3,
-     181,    41,    42,    83,   178,    85,   178,   181,    88,   181,
-     153,   154,     5,     6,   178,   158,   159,   181,   161,   144,
-     145,   101,   102,   103,   104,    48,    49,     3,     4,     5,
-       6,     3,   178,     3,     7,   181,     9,    10,    11,    12,
-      13,    14,    67,    16,   124,   125,   126,     4,   178,   177,
-      23,   181,    25,    26,    27,   178,    54,   600,   181,     3,
-       4,     5,     6,   172,   173,   174,   146,    42,    43,    44,
-      45,   151,    69,    90,    91,    92,    93,    94,     3,   178,
-      97,    98,   181,   163,   164,   165,   178,    79,   631,   181,
-     170,   171,   172,    75,    63,   175,   492,   177,    74,    75,
-     117,   178,   167,    79,   181,    79,    79,    83,     3,    85,
-     178,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,   541,   542,   101,   102,   103,   104,     6,
-      74,    75,    35,    36,    37,    38,    39,    40,   177,    83,
-      43,    85,     3,     4,     5,     6,   178,   177,   124,   125,
-     126,    36,    37,    38,    39,   177,     4,   101,   102,   103,
-     104,    57,    58,    59,    60,    61,    62,     4,    64,    65,
-     146,   178,     4,     4,   181,   151,     3,     4,     5,     6,
-     124,   125,   126,   156,     6,   179,   177,   163,   164,   165,
-     178,   177,   177,   181,   170,   171,   172,   177,   177,   175,
-      70,   177,   146,    56,   177,    79,   177,   151,    80,    81,
-      82,   177,   177,    74,    75,   177,     4,   178,   177,   163,
-     164,   165,    83,     4,    85,     4,   170,   171,   172,     4,
-     178,   175,   162,   177,     3,   177,     6,     5,   181,   119,
-     101,   102,   103,   104,   177,   177,     3,    74,     6,   147,
-     181,   178,    77,   181,   144,   181,    83,   177,    85,   121,
-      74,   177,    76,   124,   125,   126,   177,   177,   177,    28,
-     177,     4,     3,    50,   101,   102,   103,   104,   178,     4,
-       4,   175,     4,     6,    58,   146,    58,     3,   181,    53,
-     151,   178,   121,   119,   177,   152,     6,   124,   125,   126,
-     178,    74,   163,   164,   165,   181,    54,   178,   122,   170,
-     171,   172,   178,    74,   175,    55,   177,   177,   181,   146,
-     178,     3,   181,     3,   151,   139,   140,   141,   142,   143,
-     181,   181,   181,   147,   181,   181,   163,   164,   165,   181,
-     181,   181,   181,   170,   171,   172,   181,   181,   175,   122,
-     177,   181,   152,   167,   168,   169,   170,   171,   172,   173,
-     174,   122,   181,   181,     4,     4,   139,   140,   141,   142,
-      63,   144,   167,     6,   147,     6,     6,     6,   139,   140,
-     141,   142,     6,     6,     6,     6,   147,     6,     6,     6,
-       6,     6,     6,     6,   167,   168,   169,   170,   171,   172,
-     173,   174,   122,     6,     6,    79,   167,   168,   169,   170,
-     171,   172,   173,   174,     3,   181,   178,   177,   181,   139,
-     140,   141,   142,   178,   178,   178,   178,   147,   178,   178,
-       4,   178,   178,   178,   178,   178,   178,   178,     6,   178,
-     178,   178,   178,   442,   178,    83,   181,   167,   168,   169,
-     170,   171,   172,   173,   174,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,    59,   460,   112,   507,
-     507,   115,   116,    59,    59,   149,    59,    59,    59,    16,
-     184,   138,   409,   474,   250,   539,   132,    59,    59,    59,
-      59,   299,   203,   279,   506,   683,   351,   467,   522,   467,
-      -1,    -1,    -1,   654
+      17,     8,   167,   344,   165,   263,     8,     4,     3,     6,
+       3,   384,     3,   384,   384,   384,    13,    14,    67,     4,
+       5,     6,    20,    76,    22,    79,    24,    77,    88,   196,
+       4,     5,     6,    33,   199,     3,    56,    56,   666,     8,
+       3,   102,    77,    84,    41,   212,   213,   124,    56,     8,
+       8,   216,    49,    30,     8,     3,     0,    64,     8,   136,
+      87,    74,    59,     7,   157,     9,    10,    11,    12,    13,
+      14,    15,    16,   701,   239,   240,     3,    74,    63,    23,
+     141,    25,    26,    27,   144,   145,    83,   252,    56,    63,
+     348,    71,    72,    34,   147,    64,     4,     5,     6,    43,
+     358,    84,   443,   144,   145,    64,    64,   448,   121,   276,
+      64,   108,   109,   110,    64,   280,   281,   144,   145,   116,
+     117,   118,     0,   177,   144,   145,   291,   118,     8,   120,
+      87,   181,   181,   391,   180,    79,   144,   145,    79,   156,
+     305,   306,     8,   310,   311,   312,   313,   314,   315,   316,
+     317,   318,   319,   320,   321,   322,   323,   154,   177,     8,
+       8,   144,   145,     8,   144,   145,     8,    20,   333,    22,
+     155,    24,   513,    63,   547,   177,   547,   547,   547,   172,
+     178,   155,   177,    73,    64,    74,     3,   144,   145,     3,
+       4,     5,     6,   101,   102,   103,   104,   178,    64,   216,
+     181,   144,   145,   368,   369,   144,   145,    77,    78,   176,
+      29,    30,   156,    32,   181,    64,   124,   125,   126,    64,
+     153,   154,    64,   390,   385,    44,    45,     3,   151,   118,
+     176,   120,   121,   177,   123,   181,   243,   495,   181,   178,
+     163,   164,   165,    29,    30,    31,    84,   412,    86,    84,
+      88,    86,    66,    88,   251,    41,    42,   179,   599,    14,
+      74,    75,   279,   521,    73,   178,    73,   175,   181,    83,
+       3,    85,     3,    90,    91,    92,    93,    94,    48,    49,
+      97,    98,    43,    44,    45,    46,     3,   101,   102,   103,
+     104,    29,    30,    31,     3,     3,     4,     5,     6,   464,
+     117,   466,   469,    41,    42,    37,    38,    39,    40,   160,
+     124,   125,   126,   160,    90,    91,    92,    93,    94,     5,
+       6,    97,    98,     3,   181,     5,     6,     3,     4,     5,
+       6,    56,   146,   500,   153,   154,   343,   151,     6,   158,
+     159,   117,   161,    42,   361,   178,   604,    46,    47,   163,
+     164,   165,    51,    52,   544,   545,   170,   171,   172,   144,
+     145,   175,   178,   177,   178,   181,    74,    75,   178,   534,
+     377,   181,   178,   178,   391,    83,   181,    85,   178,   178,
+      88,   181,   181,   178,   178,   122,   181,   181,   178,   178,
+      21,   181,   181,   101,   102,   103,   104,   178,    74,    75,
+     181,    68,    66,    79,   141,   142,     3,    83,    74,    85,
+       3,     4,     5,     6,     3,    63,   124,   125,   126,   178,
+     178,   178,   181,   181,   181,   101,   102,   103,   104,   177,
+      75,   168,   169,   170,   171,   172,   173,   174,   146,   178,
+     605,     3,   181,   151,     3,     4,     5,     6,   124,   125,
+     126,   178,     3,     3,   181,   163,   164,   165,   178,     3,
+      67,   181,   170,   171,   172,   178,     4,   175,   181,   177,
+     146,   178,   177,   638,   181,   151,   178,    54,   495,   181,
+      75,    74,    75,   148,   149,   150,    69,   163,   164,   165,
+      83,     3,    85,    63,   170,   171,   172,    79,   167,   175,
+      79,   177,   172,   173,   174,    80,    81,    82,   101,   102,
+     103,   104,     3,     6,   177,    74,    75,   178,   178,   177,
+     177,     4,     4,     4,    83,     4,    85,     3,     4,     5,
+       6,   124,   125,   126,     6,   177,   177,   177,   177,   177,
+      70,    56,   101,   102,   103,   104,   179,    57,    58,    59,
+      60,    61,    62,   146,    64,    65,   177,   177,   151,   177,
+     177,    79,   178,   177,     4,   124,   125,   126,     4,     4,
+     163,   164,   165,     4,   178,   162,     3,   170,   171,   172,
+       6,   177,   175,     5,   177,   119,   177,   146,     3,   181,
+       6,   177,   151,   181,   147,   144,   181,   178,    74,    77,
+     121,   181,     4,   177,   163,   164,   165,    83,   177,    85,
+     177,   170,   171,   172,   177,    28,   175,   177,   177,   177,
+       3,    50,   178,   175,     4,   101,   102,   103,   104,     4,
+       4,   178,     3,    58,    58,     7,   181,     9,    10,    11,
+      12,    13,    14,    53,    16,   177,     6,   121,   124,   125,
+     126,    23,   119,    25,    26,    27,   152,     6,   178,   181,
+      54,   178,   178,    35,    36,    37,    38,    39,    40,   177,
+     146,    43,   178,     3,    55,   151,   181,   181,   181,   181,
+     181,   181,   181,   181,   181,     3,   181,   163,   164,   165,
+       4,   181,    74,   181,   170,   171,   172,   181,   152,   175,
+       4,   177,    79,     6,   181,    63,     7,    79,     9,    10,
+      11,    12,    13,    14,    15,    16,   181,   181,   181,   181,
+       6,     6,    23,     6,    25,    26,    27,     3,     7,     6,
+       9,    10,    11,    12,    13,    14,     6,    16,   181,     6,
+     122,     6,    43,     6,    23,     6,    25,    26,    27,    74,
+       6,    76,     6,     6,     6,     6,     6,   139,   140,   141,
+     142,     6,     6,    74,    43,   147,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,    79,     6,
+     167,   178,   181,   178,   156,   167,   168,   169,   170,   171,
+     172,   173,   174,   178,   178,     4,   178,   122,     6,   178,
+      79,    97,   178,   181,   177,   177,    74,    64,   178,   178,
+     178,   122,   178,   178,   139,   140,   141,   142,   143,   178,
+     445,   178,   147,   178,   178,   178,   178,   178,   139,   140,
+     141,   142,   178,   144,   178,   178,   147,   463,   510,   510,
+     152,   253,   167,   168,   169,   170,   171,   172,   173,   174,
+      17,   187,   141,   477,   122,   156,   167,   168,   169,   170,
+     171,   172,   173,   174,   122,   542,   412,   470,   302,   135,
+     470,   139,   140,   141,   142,   282,   177,   156,   206,   147,
+     509,   139,   140,   141,   142,   354,   694,    -1,   525,   147,
+     663,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   177,   167,
+     168,   169,   170,   171,   172,   173,   174,    -1,    -1,   167,
+     168,   169,   170,   171,   172,   173,   174,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,    -1,    -1,
+     112,    -1,    -1,   115,   116
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1305,75 +1317,76 @@ static const yytype_int16 yycheck[] =
 static const yytype_int16 yystos[] =
 {
        0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
-      23,    25,    26,    27,    79,   156,   177,   183,   184,   185,
-     187,   197,   198,   200,   202,   205,   206,   207,   208,   209,
-     231,   236,   237,   238,   239,    29,    30,    31,    41,    42,
-      33,    29,    30,    31,    41,    42,     3,   229,    77,   229,
-     153,   154,    35,    36,    37,    38,    39,    40,    43,   201,
-      29,    30,    32,    44,    45,   153,   154,   158,   159,   161,
-      30,   148,   149,   150,     3,   229,     3,   232,   233,   157,
-     208,   209,     0,   180,   271,    20,    22,    24,   225,     8,
-     210,   212,    73,   270,   270,   270,   270,   270,   272,   229,
-      73,   269,   269,   269,   269,   269,   179,    14,   229,    77,
-      78,     3,     3,   186,   187,   197,   198,   202,   205,   206,
-     207,   236,   237,   238,   239,     3,   229,   160,   160,     3,
-     229,    56,   181,     6,   178,   178,   185,    21,   177,   211,
-     212,    66,   219,    68,   213,    74,     3,   229,   229,   229,
-       3,    63,   177,   199,    75,     3,   229,   229,   229,     3,
-       3,     3,   203,   204,    67,   222,     4,   268,   268,     4,
-       5,     6,    63,   155,     4,     5,     6,    63,   155,    42,
-      46,    47,    51,    52,   177,   233,   268,   211,   212,     3,
-       4,     5,     6,    74,    75,    83,    85,   101,   102,   103,
-     104,   124,   125,   126,   146,   151,   163,   164,   165,   170,
-     171,   172,   175,   177,   240,   242,   243,   244,   245,   246,
-     247,   248,   250,   251,   252,   253,   254,   256,   257,   258,
-     259,   261,   262,   263,   264,   265,    54,    69,   217,    75,
-      56,   177,   199,   229,     3,   196,    34,   209,    63,   167,
-     181,   222,   243,    79,    79,     3,     6,   210,   178,   178,
-     177,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,    74,    75,   244,   177,   177,    88,   243,
-     255,     4,     4,     4,     4,     6,   265,   177,   177,   177,
-     177,   177,   244,   244,     5,     6,   209,   243,    77,   181,
-     220,    56,   144,   145,    74,    76,   122,   139,   140,   141,
-     142,   143,   147,   167,   168,   169,   170,   171,   172,   173,
-     174,   179,   176,   181,   176,   181,   214,   215,   243,   243,
-      70,   218,   207,     3,   118,   120,   188,   189,   190,   195,
-      56,   177,   277,   178,   181,   177,   241,   229,   243,   204,
-     177,   177,    48,    49,   178,    66,   178,   240,   177,    74,
-     209,   243,   243,   255,    84,    86,    88,     4,   243,     4,
-       4,     4,   178,   178,   177,   226,   227,   228,   229,   234,
-     242,   162,   221,     3,   243,   243,    76,   147,   177,    74,
-     121,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,     3,   172,     6,     5,   181,
-      71,    72,   216,   243,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   112,   115,   116,   191,   119,
-     177,   178,   181,   207,   196,   177,     3,   240,   181,    80,
-      81,    82,   266,   267,   266,     6,   240,   178,   209,   178,
-      56,    87,    84,    86,   243,   243,    77,   181,   181,   178,
-     181,   178,   181,   207,   181,    57,    59,    60,    61,    62,
-      64,    65,   235,     3,    56,   230,   245,   246,   247,   248,
-     249,   222,   177,   244,   209,   240,   121,   144,   215,   177,
-     177,   177,    74,   118,   120,   121,   123,   192,   193,   194,
-     177,   196,    28,   274,   189,   178,   196,   178,   177,     4,
-       3,   178,   181,   178,    50,   178,   178,   191,   243,   243,
-      84,    87,   244,   260,   261,   263,     4,     4,     4,   178,
-     227,    58,    58,     3,   181,    53,   224,   209,   240,   178,
-     178,   244,     6,    90,    91,    92,    93,    94,    97,    98,
-     117,    90,    91,    92,    93,    94,    97,    98,   117,   121,
-     119,   259,   193,   194,   196,   178,   177,   152,   178,   240,
-     267,     6,   178,    84,   243,   178,   181,   178,   181,   178,
-     178,   230,   228,   228,   177,   245,   246,   247,   248,    54,
-      55,   223,   178,   178,   178,   181,   181,   181,   181,   181,
+      23,    25,    26,    27,    43,    79,   156,   177,   183,   184,
+     185,   187,   197,   198,   200,   202,   205,   206,   207,   208,
+     209,   231,   236,   237,   238,   239,    29,    30,    31,    41,
+      42,    33,    29,    30,    31,    41,    42,     3,   229,    77,
+     229,   153,   154,    35,    36,    37,    38,    39,    40,    43,
+     186,   187,   197,   198,   201,   202,   205,   206,   207,   236,
+     237,   238,   239,    29,    30,    32,    44,    45,   153,   154,
+     158,   159,   161,    30,   148,   149,   150,     3,   229,   229,
+       3,   232,   233,   157,   208,   209,     0,   180,   271,    20,
+      22,    24,   225,     8,   210,   212,    73,   270,   270,   270,
+     270,   270,   272,   229,    73,   269,   269,   269,   269,   269,
+     179,    14,   229,    77,    78,     3,     3,   186,     3,   229,
+     160,   160,     3,   229,    56,   181,     6,   178,   178,   185,
+      21,   177,   211,   212,    66,   219,    68,   213,    74,     3,
+     229,   229,   229,     3,    63,   177,   199,    75,     3,   229,
+     229,   229,     3,     3,     3,   203,   204,    67,   222,     4,
+     268,   268,     4,     5,     6,    63,   155,     4,     5,     6,
+      63,   155,    42,    46,    47,    51,    52,   177,   233,   268,
+     211,   212,     3,     4,     5,     6,    74,    75,    83,    85,
+     101,   102,   103,   104,   124,   125,   126,   146,   151,   163,
+     164,   165,   170,   171,   172,   175,   177,   240,   242,   243,
+     244,   245,   246,   247,   248,   250,   251,   252,   253,   254,
+     256,   257,   258,   259,   261,   262,   263,   264,   265,    54,
+      69,   217,    75,    56,   177,   199,   229,     3,   196,    34,
+     209,    63,   167,   181,   222,   243,    79,    79,     3,     6,
+     210,   178,   178,   177,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,    74,    75,   244,   177,
+     177,    88,   243,   255,     4,     4,     4,     4,     6,   265,
+     177,   177,   177,   177,   177,   244,   244,     5,     6,   209,
+     243,    77,   181,   220,    56,   144,   145,    74,    76,   122,
+     139,   140,   141,   142,   143,   147,   167,   168,   169,   170,
+     171,   172,   173,   174,   179,   176,   181,   176,   181,   214,
+     215,   243,   243,    70,   218,   207,     3,   118,   120,   188,
+     189,   190,   195,    56,   177,   277,   178,   181,   177,   241,
+     229,   243,   204,   177,   177,    48,    49,   178,    66,   178,
+     240,   177,    74,   209,   243,   243,   255,    84,    86,    88,
+       4,   243,     4,     4,     4,   178,   178,   177,   226,   227,
+     228,   229,   234,   242,   162,   221,     3,   243,   243,    76,
+     147,   177,    74,   121,   244,   244,   244,   244,   244,   244,
+     244,   244,   244,   244,   244,   244,   244,   244,     3,   172,
+       6,     5,   181,    71,    72,   216,   243,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   112,   115,
+     116,   191,   119,   177,   178,   181,   207,   196,   177,     3,
+     240,   181,    80,    81,    82,   266,   267,   266,     6,   240,
+     178,   209,   178,    56,    87,    84,    86,   243,   243,    77,
+     181,   181,   178,   181,   178,   181,   207,   181,    57,    59,
+      60,    61,    62,    64,    65,   235,     3,    56,   230,   245,
+     246,   247,   248,   249,   222,   177,   244,   209,   240,   121,
+     144,   215,   177,   177,   177,    74,   118,   120,   121,   123,
+     192,   193,   194,   177,   196,    28,   274,   189,   178,   196,
+     178,   177,     4,     3,   178,   181,   178,    50,   178,   178,
+     191,   243,   243,    84,    87,   244,   260,   261,   263,     4,
+       4,     4,   178,   227,    58,    58,     3,   181,    53,   224,
+     209,   240,   178,   178,   244,     6,     3,    90,    91,    92,
+      93,    94,    97,    98,   117,     3,    90,    91,    92,    93,
+      94,    97,    98,   117,   121,   119,   259,   193,   194,   196,
+     178,   177,   152,   178,   240,   267,     6,   178,    84,   243,
+     178,   181,   178,   181,   178,   178,   230,   228,   228,   177,
+     245,   246,   247,   248,    54,    55,   223,   178,   178,   178,
      181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
-     181,   181,   178,     3,   275,   276,     3,   152,   178,     4,
-       4,    63,   196,   240,   243,     6,     6,     6,     6,     6,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   178,
+       3,   275,   276,     3,   152,   178,     4,     4,    63,   196,
+     240,   243,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,   167,   178,   181,    79,   273,     3,   181,   178,
-     243,   178,   178,   178,   178,   178,   178,   178,   178,   178,
-     178,   178,   178,   178,   178,   178,   178,   178,   178,     3,
-       5,     6,   276,   177,   273,     4,   275,   181,   178,     6,
-     178,   273
+       6,   167,   178,   181,    79,   273,     3,   181,   178,   243,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+       3,     5,     6,   276,   177,   273,     4,   275,   181,   178,
+       6,   178,   273
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1387,34 +1400,34 @@ static const yytype_int16 yyr1[] =
      191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
      191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
      191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     192,   192,   193,   193,   193,   193,   194,   194,   195,   195,
-     196,   196,   197,   198,   198,   199,   199,   200,   201,   201,
-     201,   201,   201,   201,   201,   201,   202,   203,   203,   204,
-     205,   205,   205,   205,   205,   206,   206,   207,   207,   207,
-     207,   208,   208,   209,   210,   211,   211,   212,   213,   213,
-     214,   214,   215,   216,   216,   216,   217,   217,   218,   218,
-     219,   219,   220,   220,   221,   221,   222,   222,   223,   223,
-     224,   224,   225,   225,   225,   225,   226,   226,   227,   227,
-     228,   228,   229,   229,   230,   230,   230,   230,   231,   231,
-     232,   232,   233,   234,   234,   235,   235,   235,   235,   235,
-     235,   235,   236,   236,   236,   236,   236,   236,   236,   236,
+     191,   191,   192,   192,   193,   193,   193,   193,   194,   194,
+     195,   195,   196,   196,   197,   198,   198,   199,   199,   200,
+     200,   201,   201,   201,   201,   201,   201,   201,   202,   203,
+     203,   204,   205,   205,   205,   205,   205,   206,   206,   207,
+     207,   207,   207,   208,   208,   209,   210,   211,   211,   212,
+     213,   213,   214,   214,   215,   216,   216,   216,   217,   217,
+     218,   218,   219,   219,   220,   220,   221,   221,   222,   222,
+     223,   223,   224,   224,   225,   225,   225,   225,   226,   226,
+     227,   227,   228,   228,   229,   229,   230,   230,   230,   230,
+     231,   231,   232,   232,   233,   234,   234,   235,   235,   235,
+     235,   235,   235,   235,   236,   236,   236,   236,   236,   236,
      236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     237,   237,   237,   238,   239,   239,   239,   239,   239,   239,
-     239,   239,   239,   239,   239,   239,   239,   240,   240,   241,
-     241,   242,   242,   243,   243,   243,   243,   243,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   245,
-     246,   246,   247,   247,   248,   248,   249,   249,   249,   249,
-     249,   249,   249,   249,   250,   250,   250,   250,   250,   250,
+     236,   236,   237,   237,   237,   238,   239,   239,   239,   239,
+     239,   239,   239,   239,   239,   239,   239,   239,   239,   239,
+     240,   240,   241,   241,   242,   242,   243,   243,   243,   243,
+     243,   244,   244,   244,   244,   244,   244,   244,   244,   244,
+     244,   244,   245,   246,   246,   247,   247,   248,   248,   249,
+     249,   249,   249,   249,   249,   249,   249,   250,   250,   250,
      250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   251,   251,   252,
-     253,   253,   254,   254,   254,   254,   255,   255,   256,   257,
-     257,   257,   257,   258,   258,   258,   258,   259,   259,   259,
+     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
+     251,   251,   252,   253,   253,   254,   254,   254,   254,   255,
+     255,   256,   257,   257,   257,   257,   258,   258,   258,   258,
      259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     260,   260,   261,   262,   262,   263,   264,   264,   265,   265,
-     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
-     266,   266,   267,   267,   267,   268,   269,   269,   270,   270,
-     271,   271,   272,   272,   273,   273,   274,   274,   275,   275,
-     276,   276,   276,   276,   277,   277,   277
+     259,   259,   259,   260,   260,   261,   262,   262,   263,   264,
+     264,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   266,   266,   267,   267,   267,   268,   269,
+     269,   270,   270,   271,   271,   272,   272,   273,   273,   274,
+     274,   275,   275,   276,   276,   276,   276,   277,   277,   277
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1428,34 +1441,34 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     6,     4,     1,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       1,     2,     2,     1,     1,     2,     2,     0,     5,     4,
-       1,     3,     4,     6,     5,     3,     0,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     5,     1,     3,     3,
-       4,     4,     4,     4,     6,     8,     8,     1,     1,     3,
-       3,     3,     3,     2,     4,     3,     3,     8,     3,     0,
-       1,     3,     2,     1,     1,     0,     2,     0,     2,     0,
-       1,     0,     2,     0,     2,     0,     2,     0,     2,     0,
-       3,     0,     1,     2,     1,     1,     1,     3,     1,     1,
-       2,     4,     1,     3,     2,     1,     5,     0,     2,     0,
-       1,     3,     5,     4,     6,     1,     1,     1,     1,     1,
-       1,     0,     2,     2,     2,     2,     2,     3,     3,     3,
-       3,     3,     4,     4,     5,     6,     7,     9,     4,     5,
-       2,     2,     2,     2,     2,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     3,     1,     3,     3,
-       5,     3,     1,     1,     1,     1,     1,     1,     3,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,    13,
-       6,     8,     4,     6,     4,     6,     1,     1,     1,     1,
-       3,     3,     3,     3,     3,     4,     5,     4,     3,     2,
-       2,     2,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     6,     3,     4,     3,     3,     5,
-       5,     6,     4,     6,     3,     5,     4,     5,     6,     4,
-       5,     5,     6,     1,     3,     1,     3,     1,     1,     1,
-       1,     1,     2,     2,     2,     2,     2,     1,     1,     1,
-       1,     1,     2,     2,     3,     2,     2,     3,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       1,     3,     2,     2,     1,     1,     2,     0,     3,     0,
-       1,     0,     2,     0,     4,     0,     4,     0,     1,     3,
-       1,     3,     3,     3,     6,     7,     3
+       6,     6,     1,     2,     2,     1,     1,     2,     2,     0,
+       5,     4,     1,     3,     4,     6,     5,     3,     0,     3,
+       2,     1,     1,     1,     1,     1,     1,     1,     5,     1,
+       3,     3,     4,     4,     4,     4,     6,     8,     8,     1,
+       1,     3,     3,     3,     3,     2,     4,     3,     3,     8,
+       3,     0,     1,     3,     2,     1,     1,     0,     2,     0,
+       2,     0,     1,     0,     2,     0,     2,     0,     2,     0,
+       2,     0,     3,     0,     1,     2,     1,     1,     1,     3,
+       1,     1,     2,     4,     1,     3,     2,     1,     5,     0,
+       2,     0,     1,     3,     5,     4,     6,     1,     1,     1,
+       1,     1,     1,     0,     2,     2,     2,     2,     2,     3,
+       3,     3,     3,     3,     4,     4,     5,     6,     7,     9,
+       4,     5,     2,     2,     2,     2,     2,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     3,     2,
+       1,     3,     3,     5,     3,     1,     1,     1,     1,     1,
+       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,    13,     6,     8,     4,     6,     4,     6,     1,
+       1,     1,     1,     3,     3,     3,     3,     3,     4,     5,
+       4,     3,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     6,     3,     4,
+       3,     3,     5,     5,     6,     4,     6,     3,     5,     4,
+       5,     6,     4,     5,     5,     6,     1,     3,     1,     3,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       1,     1,     1,     1,     1,     2,     2,     3,     2,     2,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     3,     2,     2,     1,     1,     2,
+       0,     3,     0,     1,     0,     2,     0,     4,     0,     4,
+       0,     1,     3,     1,     3,     3,     3,     6,     7,     3
 };
 
 
@@ -2023,7 +2036,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2027 "parser.cpp"
+#line 2040 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2031,7 +2044,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2035 "parser.cpp"
+#line 2048 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2045,7 +2058,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2049 "parser.cpp"
+#line 2062 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2059,7 +2072,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2063 "parser.cpp"
+#line 2076 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2070,7 +2083,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2074 "parser.cpp"
+#line 2087 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2078,7 +2091,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2082 "parser.cpp"
+#line 2095 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2087,7 +2100,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2091 "parser.cpp"
+#line 2104 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2096,7 +2109,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2100 "parser.cpp"
+#line 2113 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2110,7 +2123,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2114 "parser.cpp"
+#line 2127 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2121,7 +2134,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2125 "parser.cpp"
+#line 2138 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2131,7 +2144,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2135 "parser.cpp"
+#line 2148 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2141,7 +2154,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2145 "parser.cpp"
+#line 2158 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2151,7 +2164,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2155 "parser.cpp"
+#line 2168 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2161,7 +2174,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2165 "parser.cpp"
+#line 2178 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2171,7 +2184,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2175 "parser.cpp"
+#line 2188 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2181,7 +2194,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2185 "parser.cpp"
+#line 2198 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2195,7 +2208,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2199 "parser.cpp"
+#line 2212 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2209,7 +2222,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2213 "parser.cpp"
+#line 2226 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2219,7 +2232,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2223 "parser.cpp"
+#line 2236 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2227,7 +2240,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2231 "parser.cpp"
+#line 2244 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2235,7 +2248,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2239 "parser.cpp"
+#line 2252 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2244,7 +2257,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2248 "parser.cpp"
+#line 2261 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2252,7 +2265,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2256 "parser.cpp"
+#line 2269 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2260,7 +2273,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2264 "parser.cpp"
+#line 2277 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2268,7 +2281,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2272 "parser.cpp"
+#line 2285 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2282,7 +2295,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2286 "parser.cpp"
+#line 2299 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2291,7 +2304,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2295 "parser.cpp"
+#line 2308 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2300,7 +2313,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2304 "parser.cpp"
+#line 2317 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2309,7 +2322,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2313 "parser.cpp"
+#line 2326 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2322,7 +2335,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2326 "parser.cpp"
+#line 2339 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2331,7 +2344,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2335 "parser.cpp"
+#line 2348 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2345,7 +2358,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2349 "parser.cpp"
+#line 2362 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2359,7 +2372,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2363 "parser.cpp"
+#line 2376 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2369,7 +2382,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2373 "parser.cpp"
+#line 2386 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2378,7 +2391,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2382 "parser.cpp"
+#line 2395 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2392,7 +2405,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2396 "parser.cpp"
+#line 2409 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2409,7 +2422,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2413 "parser.cpp"
+#line 2426 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2417,7 +2430,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2421 "parser.cpp"
+#line 2434 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2425,7 +2438,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2429 "parser.cpp"
+#line 2442 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2433,7 +2446,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2437 "parser.cpp"
+#line 2450 "parser.cpp"
         break;
 
     case YYSYMBOL_knn_expr: /* knn_expr  */
@@ -2441,7 +2454,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2445 "parser.cpp"
+#line 2458 "parser.cpp"
         break;
 
     case YYSYMBOL_match_expr: /* match_expr  */
@@ -2449,7 +2462,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2453 "parser.cpp"
+#line 2466 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2457,7 +2470,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2461 "parser.cpp"
+#line 2474 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2465,7 +2478,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2469 "parser.cpp"
+#line 2482 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2479,7 +2492,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2483 "parser.cpp"
+#line 2496 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2487,7 +2500,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2491 "parser.cpp"
+#line 2504 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2495,7 +2508,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2499 "parser.cpp"
+#line 2512 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2503,7 +2516,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2507 "parser.cpp"
+#line 2520 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2511,7 +2524,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2515 "parser.cpp"
+#line 2528 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2519,7 +2532,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2523 "parser.cpp"
+#line 2536 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2532,7 +2545,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2536 "parser.cpp"
+#line 2549 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2540,7 +2553,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2544 "parser.cpp"
+#line 2557 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2548,7 +2561,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2552 "parser.cpp"
+#line 2565 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2556,7 +2569,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2560 "parser.cpp"
+#line 2573 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2564,7 +2577,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2568 "parser.cpp"
+#line 2581 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2572,7 +2585,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2576 "parser.cpp"
+#line 2589 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2580,7 +2593,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2584 "parser.cpp"
+#line 2597 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2588,7 +2601,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2592 "parser.cpp"
+#line 2605 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2596,7 +2609,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2600 "parser.cpp"
+#line 2613 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2604,7 +2617,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2608 "parser.cpp"
+#line 2621 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2612,7 +2625,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2616 "parser.cpp"
+#line 2629 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2620,7 +2633,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2624 "parser.cpp"
+#line 2637 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2631,7 +2644,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2635 "parser.cpp"
+#line 2648 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2645,7 +2658,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2649 "parser.cpp"
+#line 2662 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -2659,7 +2672,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2663 "parser.cpp"
+#line 2676 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2673,7 +2686,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2677 "parser.cpp"
+#line 2690 "parser.cpp"
         break;
 
       default:
@@ -2781,7 +2794,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2785 "parser.cpp"
+#line 2798 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -2996,7 +3009,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3000 "parser.cpp"
+#line 3013 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -3007,7 +3020,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3011 "parser.cpp"
+#line 3024 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -3018,145 +3031,145 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3022 "parser.cpp"
+#line 3035 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 490 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3028 "parser.cpp"
+#line 3041 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 491 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3034 "parser.cpp"
+#line 3047 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 492 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3040 "parser.cpp"
+#line 3053 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 493 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3046 "parser.cpp"
+#line 3059 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 494 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3052 "parser.cpp"
+#line 3065 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 495 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3058 "parser.cpp"
+#line 3071 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 496 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3064 "parser.cpp"
+#line 3077 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 497 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3070 "parser.cpp"
+#line 3083 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 498 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3076 "parser.cpp"
+#line 3089 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 499 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3082 "parser.cpp"
+#line 3095 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 500 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3088 "parser.cpp"
+#line 3101 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 501 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3094 "parser.cpp"
+#line 3107 "parser.cpp"
     break;
 
   case 17: /* explainable_statement: create_statement  */
 #line 503 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3100 "parser.cpp"
+#line 3113 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: drop_statement  */
 #line 504 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3106 "parser.cpp"
+#line 3119 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: copy_statement  */
 #line 505 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3112 "parser.cpp"
+#line 3125 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: show_statement  */
 #line 506 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3118 "parser.cpp"
+#line 3131 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: select_statement  */
 #line 507 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3124 "parser.cpp"
+#line 3137 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: delete_statement  */
 #line 508 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3130 "parser.cpp"
+#line 3143 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: update_statement  */
 #line 509 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3136 "parser.cpp"
+#line 3149 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: insert_statement  */
 #line 510 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3142 "parser.cpp"
+#line 3155 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: flush_statement  */
 #line 511 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3148 "parser.cpp"
+#line 3161 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: optimize_statement  */
 #line 512 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3154 "parser.cpp"
+#line 3167 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: command_statement  */
 #line 513 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3160 "parser.cpp"
+#line 3173 "parser.cpp"
     break;
 
   case 28: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3176,7 +3189,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3180 "parser.cpp"
+#line 3193 "parser.cpp"
     break;
 
   case 29: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3194,7 +3207,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3198 "parser.cpp"
+#line 3211 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3227,7 +3240,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3231 "parser.cpp"
+#line 3244 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3247,7 +3260,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3251 "parser.cpp"
+#line 3264 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3268,7 +3281,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3272 "parser.cpp"
+#line 3285 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
@@ -3301,7 +3314,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3305 "parser.cpp"
+#line 3318 "parser.cpp"
     break;
 
   case 34: /* table_element_array: table_element  */
@@ -3310,7 +3323,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3314 "parser.cpp"
+#line 3327 "parser.cpp"
     break;
 
   case 35: /* table_element_array: table_element_array ',' table_element  */
@@ -3319,7 +3332,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3323 "parser.cpp"
+#line 3336 "parser.cpp"
     break;
 
   case 36: /* table_element: table_column  */
@@ -3327,7 +3340,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3331 "parser.cpp"
+#line 3344 "parser.cpp"
     break;
 
   case 37: /* table_element: table_constraint  */
@@ -3335,7 +3348,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3339 "parser.cpp"
+#line 3352 "parser.cpp"
     break;
 
   case 38: /* table_column: IDENTIFIER column_type default_expr  */
@@ -3377,7 +3390,7 @@ yyreduce:
     }
     */
 }
-#line 3381 "parser.cpp"
+#line 3394 "parser.cpp"
     break;
 
   case 39: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
@@ -3416,260 +3429,302 @@ yyreduce:
     }
     */
 }
-#line 3420 "parser.cpp"
+#line 3433 "parser.cpp"
     break;
 
   case 40: /* column_type: BOOLEAN  */
 #line 737 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3426 "parser.cpp"
+#line 3439 "parser.cpp"
     break;
 
   case 41: /* column_type: TINYINT  */
 #line 738 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3432 "parser.cpp"
+#line 3445 "parser.cpp"
     break;
 
   case 42: /* column_type: SMALLINT  */
 #line 739 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3438 "parser.cpp"
+#line 3451 "parser.cpp"
     break;
 
   case 43: /* column_type: INTEGER  */
 #line 740 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3444 "parser.cpp"
+#line 3457 "parser.cpp"
     break;
 
   case 44: /* column_type: INT  */
 #line 741 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3450 "parser.cpp"
+#line 3463 "parser.cpp"
     break;
 
   case 45: /* column_type: BIGINT  */
 #line 742 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3456 "parser.cpp"
+#line 3469 "parser.cpp"
     break;
 
   case 46: /* column_type: HUGEINT  */
 #line 743 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3462 "parser.cpp"
+#line 3475 "parser.cpp"
     break;
 
   case 47: /* column_type: FLOAT  */
 #line 744 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3468 "parser.cpp"
+#line 3481 "parser.cpp"
     break;
 
   case 48: /* column_type: REAL  */
 #line 745 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3474 "parser.cpp"
+#line 3487 "parser.cpp"
     break;
 
   case 49: /* column_type: DOUBLE  */
 #line 746 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3480 "parser.cpp"
+#line 3493 "parser.cpp"
     break;
 
   case 50: /* column_type: DATE  */
 #line 747 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3486 "parser.cpp"
+#line 3499 "parser.cpp"
     break;
 
   case 51: /* column_type: TIME  */
 #line 748 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3492 "parser.cpp"
+#line 3505 "parser.cpp"
     break;
 
   case 52: /* column_type: DATETIME  */
 #line 749 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3498 "parser.cpp"
+#line 3511 "parser.cpp"
     break;
 
   case 53: /* column_type: TIMESTAMP  */
 #line 750 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3504 "parser.cpp"
+#line 3517 "parser.cpp"
     break;
 
   case 54: /* column_type: UUID  */
 #line 751 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3510 "parser.cpp"
+#line 3523 "parser.cpp"
     break;
 
   case 55: /* column_type: POINT  */
 #line 752 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3516 "parser.cpp"
+#line 3529 "parser.cpp"
     break;
 
   case 56: /* column_type: LINE  */
 #line 753 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3522 "parser.cpp"
+#line 3535 "parser.cpp"
     break;
 
   case 57: /* column_type: LSEG  */
 #line 754 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3528 "parser.cpp"
+#line 3541 "parser.cpp"
     break;
 
   case 58: /* column_type: BOX  */
 #line 755 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3534 "parser.cpp"
+#line 3547 "parser.cpp"
     break;
 
   case 59: /* column_type: CIRCLE  */
 #line 758 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3540 "parser.cpp"
+#line 3553 "parser.cpp"
     break;
 
   case 60: /* column_type: VARCHAR  */
 #line 760 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3546 "parser.cpp"
+#line 3559 "parser.cpp"
     break;
 
   case 61: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 761 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3552 "parser.cpp"
+#line 3565 "parser.cpp"
     break;
 
   case 62: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 762 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3558 "parser.cpp"
+#line 3571 "parser.cpp"
     break;
 
   case 63: /* column_type: DECIMAL  */
 #line 763 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3564 "parser.cpp"
+#line 3577 "parser.cpp"
     break;
 
   case 64: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 766 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3570 "parser.cpp"
+#line 3583 "parser.cpp"
     break;
 
   case 65: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 767 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3576 "parser.cpp"
+#line 3589 "parser.cpp"
     break;
 
   case 66: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 768 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3582 "parser.cpp"
+#line 3595 "parser.cpp"
     break;
 
   case 67: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 769 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3588 "parser.cpp"
+#line 3601 "parser.cpp"
     break;
 
   case 68: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 770 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3594 "parser.cpp"
+#line 3607 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 771 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3600 "parser.cpp"
+#line 3613 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 772 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3606 "parser.cpp"
+#line 3619 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 773 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3612 "parser.cpp"
+#line 3625 "parser.cpp"
     break;
 
-  case 72: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+  case 72: /* column_type: EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')'  */
 #line 774 "parser.y"
+                                              {
+    // half precision element types are not keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "float16") == 0 or strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 3646 "parser.cpp"
+    break;
+
+  case 73: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 790 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3618 "parser.cpp"
+#line 3652 "parser.cpp"
     break;
 
-  case 73: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 775 "parser.y"
+  case 74: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 791 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3624 "parser.cpp"
+#line 3658 "parser.cpp"
     break;
 
-  case 74: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 776 "parser.y"
+  case 75: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 792 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3630 "parser.cpp"
+#line 3664 "parser.cpp"
     break;
 
-  case 75: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 777 "parser.y"
+  case 76: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 793 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3636 "parser.cpp"
+#line 3670 "parser.cpp"
     break;
 
-  case 76: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 778 "parser.y"
+  case 77: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 794 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3642 "parser.cpp"
+#line 3676 "parser.cpp"
     break;
 
-  case 77: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 779 "parser.y"
+  case 78: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 795 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3648 "parser.cpp"
+#line 3682 "parser.cpp"
     break;
 
-  case 78: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 780 "parser.y"
+  case 79: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 796 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3654 "parser.cpp"
+#line 3688 "parser.cpp"
     break;
 
-  case 79: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 781 "parser.y"
+  case 80: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 797 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3660 "parser.cpp"
+#line 3694 "parser.cpp"
+    break;
+
+  case 81: /* column_type: VECTOR '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 798 "parser.y"
+                                           {
+    // half precision element types are not keywords
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "float16") == 0 or strcmp((yyvsp[-3].str_value), "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 3715 "parser.cpp"
     break;
 
-  case 80: /* column_constraints: column_constraint  */
-#line 800 "parser.y"
+  case 82: /* column_constraints: column_constraint  */
+#line 832 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::unordered_set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3669 "parser.cpp"
+#line 3724 "parser.cpp"
     break;
 
-  case 81: /* column_constraints: column_constraints column_constraint  */
-#line 804 "parser.y"
+  case 83: /* column_constraints: column_constraints column_constraint  */
+#line 836 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -3679,101 +3734,101 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 3683 "parser.cpp"
+#line 3738 "parser.cpp"
     break;
 
-  case 82: /* column_constraint: PRIMARY KEY  */
-#line 814 "parser.y"
+  case 84: /* column_constraint: PRIMARY KEY  */
+#line 846 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3691 "parser.cpp"
+#line 3746 "parser.cpp"
     break;
 
-  case 83: /* column_constraint: UNIQUE  */
-#line 817 "parser.y"
+  case 85: /* column_constraint: UNIQUE  */
+#line 849 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 3699 "parser.cpp"
+#line 3754 "parser.cpp"
     break;
 
-  case 84: /* column_constraint: NULLABLE  */
-#line 820 "parser.y"
+  case 86: /* column_constraint: NULLABLE  */
+#line 852 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 3707 "parser.cpp"
+#line 3762 "parser.cpp"
     break;
 
-  case 85: /* column_constraint: NOT NULLABLE  */
-#line 823 "parser.y"
+  case 87: /* column_constraint: NOT NULLABLE  */
+#line 855 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 3715 "parser.cpp"
+#line 3770 "parser.cpp"
     break;
 
-  case 86: /* default_expr: DEFAULT constant_expr  */
-#line 827 "parser.y"
+  case 88: /* default_expr: DEFAULT constant_expr  */
+#line 859 "parser.y"
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 3723 "parser.cpp"
+#line 3778 "parser.cpp"
     break;
 
-  case 87: /* default_expr: %empty  */
-#line 830 "parser.y"
+  case 89: /* default_expr: %empty  */
+#line 862 "parser.y"
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 3731 "parser.cpp"
+#line 3786 "parser.cpp"
     break;
 
-  case 88: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 835 "parser.y"
+  case 90: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 867 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3741 "parser.cpp"
+#line 3796 "parser.cpp"
     break;
 
-  case 89: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 840 "parser.y"
+  case 91: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 872 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 3751 "parser.cpp"
+#line 3806 "parser.cpp"
     break;
 
-  case 90: /* identifier_array: IDENTIFIER  */
-#line 847 "parser.y"
+  case 92: /* identifier_array: IDENTIFIER  */
+#line 879 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 3762 "parser.cpp"
+#line 3817 "parser.cpp"
     break;
 
-  case 91: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 853 "parser.y"
+  case 93: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 885 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 3773 "parser.cpp"
+#line 3828 "parser.cpp"
     break;
 
-  case 92: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 863 "parser.y"
+  case 94: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 895 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -3786,11 +3841,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 3790 "parser.cpp"
+#line 3845 "parser.cpp"
     break;
 
-  case 93: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 879 "parser.y"
+  case 95: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 911 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -3825,11 +3880,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 3829 "parser.cpp"
+#line 3884 "parser.cpp"
     break;
 
-  case 94: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 913 "parser.y"
+  case 96: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 945 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3842,101 +3897,103 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 3846 "parser.cpp"
+#line 3901 "parser.cpp"
     break;
 
-  case 95: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 926 "parser.y"
+  case 97: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 958 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 3854 "parser.cpp"
+#line 3909 "parser.cpp"
     break;
 
-  case 96: /* optional_identifier_array: %empty  */
-#line 929 "parser.y"
+  case 98: /* optional_identifier_array: %empty  */
+#line 961 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 3862 "parser.cpp"
+#line 3917 "parser.cpp"
     break;
 
-  case 97: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 936 "parser.y"
+  case 99: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 968 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 3872 "parser.cpp"
+#line 3927 "parser.cpp"
     break;
 
-  case 98: /* explain_type: ANALYZE  */
-#line 942 "parser.y"
+  case 100: /* explain_statement: EXPLAIN explainable_statement  */
+#line 973 "parser.y"
+                                {
+    (yyval.explain_stmt) = new infinity::ExplainStatement();
+    (yyval.explain_stmt)->type_ = infinity::ExplainType::kPhysical;
+    (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
+}
+#line 3937 "parser.cpp"
+    break;
+
+  case 101: /* explain_type: ANALYZE  */
+#line 979 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 3880 "parser.cpp"
+#line 3945 "parser.cpp"
     break;
 
-  case 99: /* explain_type: AST  */
-#line 945 "parser.y"
+  case 102: /* explain_type: AST  */
+#line 982 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 3888 "parser.cpp"
+#line 3953 "parser.cpp"
     break;
 
-  case 100: /* explain_type: RAW  */
-#line 948 "parser.y"
+  case 103: /* explain_type: RAW  */
+#line 985 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 3896 "parser.cpp"
+#line 3961 "parser.cpp"
     break;
 
-  case 101: /* explain_type: LOGICAL  */
-#line 951 "parser.y"
+  case 104: /* explain_type: LOGICAL  */
+#line 988 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 3904 "parser.cpp"
+#line 3969 "parser.cpp"
     break;
 
-  case 102: /* explain_type: PHYSICAL  */
-#line 954 "parser.y"
+  case 105: /* explain_type: PHYSICAL  */
+#line 991 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3912 "parser.cpp"
+#line 3977 "parser.cpp"
     break;
 
-  case 103: /* explain_type: PIPELINE  */
-#line 957 "parser.y"
+  case 106: /* explain_type: PIPELINE  */
+#line 994 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 3920 "parser.cpp"
+#line 3985 "parser.cpp"
     break;
 
-  case 104: /* explain_type: FRAGMENT  */
-#line 960 "parser.y"
+  case 107: /* explain_type: FRAGMENT  */
+#line 997 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 3928 "parser.cpp"
-    break;
-
-  case 105: /* explain_type: %empty  */
-#line 963 "parser.y"
-  {
-    (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
-}
-#line 3936 "parser.cpp"
+#line 3993 "parser.cpp"
     break;
 
-  case 106: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 970 "parser.y"
+  case 108: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 1004 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3949,29 +4006,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 3953 "parser.cpp"
+#line 4010 "parser.cpp"
     break;
 
-  case 107: /* update_expr_array: update_expr  */
-#line 983 "parser.y"
+  case 109: /* update_expr_array: update_expr  */
+#line 1017 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 3962 "parser.cpp"
+#line 4019 "parser.cpp"
     break;
 
-  case 108: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 987 "parser.y"
+  case 110: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 1021 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 3971 "parser.cpp"
+#line 4028 "parser.cpp"
     break;
 
-  case 109: /* update_expr: IDENTIFIER '=' expr  */
-#line 992 "parser.y"
+  case 111: /* update_expr: IDENTIFIER '=' expr  */
+#line 1026 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -3979,11 +4036,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 3983 "parser.cpp"
+#line 4040 "parser.cpp"
     break;
 
-  case 110: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 1005 "parser.y"
+  case 112: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1039 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -3995,11 +4052,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3999 "parser.cpp"
+#line 4056 "parser.cpp"
     break;
 
-  case 111: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 1018 "parser.y"
+  case 113: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1052 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -4013,11 +4070,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4017 "parser.cpp"
+#line 4074 "parser.cpp"
     break;
 
-  case 112: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1033 "parser.y"
+  case 114: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1067 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -4031,11 +4088,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4035 "parser.cpp"
+#line 4092 "parser.cpp"
     break;
 
-  case 113: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1048 "parser.y"
+  case 115: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1082 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -4049,11 +4106,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4053 "parser.cpp"
+#line 4110 "parser.cpp"
     break;
 
-  case 114: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1063 "parser.y"
+  case 116: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1097 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -4072,11 +4129,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4076 "parser.cpp"
+#line 4133 "parser.cpp"
     break;
 
-  case 115: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1086 "parser.y"
+  case 117: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1120 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4118,11 +4175,11 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4122 "parser.cpp"
+#line 4179 "parser.cpp"
     break;
 
-  case 116: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1127 "parser.y"
+  case 118: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1161 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4164,27 +4221,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4168 "parser.cpp"
+#line 4225 "parser.cpp"
     break;
 
-  case 117: /* select_statement: select_without_paren  */
-#line 1172 "parser.y"
+  case 119: /* select_statement: select_without_paren  */
+#line 1206 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4176 "parser.cpp"
+#line 4233 "parser.cpp"
     break;
 
-  case 118: /* select_statement: select_with_paren  */
-#line 1175 "parser.y"
+  case 120: /* select_statement: select_with_paren  */
+#line 1209 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4184 "parser.cpp"
+#line 4241 "parser.cpp"
     break;
 
-  case 119: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1178 "parser.y"
+  case 121: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1212 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4194,11 +4251,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4198 "parser.cpp"
+#line 4255 "parser.cpp"
     break;
 
-  case 120: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1187 "parser.y"
+  case 122: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1221 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4208,36 +4265,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4212 "parser.cpp"
+#line 4269 "parser.cpp"
     break;
 
-  case 121: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1197 "parser.y"
+  case 123: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1231 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4220 "parser.cpp"
+#line 4277 "parser.cpp"
     break;
 
-  case 122: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1200 "parser.y"
+  case 124: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1234 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4228 "parser.cpp"
+#line 4285 "parser.cpp"
     break;
 
-  case 123: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1204 "parser.y"
+  case 125: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1238 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4237 "parser.cpp"
+#line 4294 "parser.cpp"
     break;
 
-  case 124: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1209 "parser.y"
+  case 126: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1243 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -4259,27 +4316,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4263 "parser.cpp"
+#line 4320 "parser.cpp"
     break;
 
-  case 125: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1231 "parser.y"
+  case 127: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1265 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4271 "parser.cpp"
+#line 4328 "parser.cpp"
     break;
 
-  case 126: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1234 "parser.y"
+  case 128: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1268 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4279 "parser.cpp"
+#line 4336 "parser.cpp"
     break;
 
-  case 127: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1239 "parser.y"
+  case 129: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1273 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -4295,245 +4352,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4299 "parser.cpp"
+#line 4356 "parser.cpp"
     break;
 
-  case 128: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1255 "parser.y"
+  case 130: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1289 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4307 "parser.cpp"
+#line 4364 "parser.cpp"
     break;
 
-  case 129: /* order_by_clause: %empty  */
-#line 1258 "parser.y"
+  case 131: /* order_by_clause: %empty  */
+#line 1292 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4315 "parser.cpp"
+#line 4372 "parser.cpp"
     break;
 
-  case 130: /* order_by_expr_list: order_by_expr  */
-#line 1262 "parser.y"
+  case 132: /* order_by_expr_list: order_by_expr  */
+#line 1296 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4324 "parser.cpp"
+#line 4381 "parser.cpp"
     break;
 
-  case 131: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1266 "parser.y"
+  case 133: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1300 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4333 "parser.cpp"
+#line 4390 "parser.cpp"
     break;
 
-  case 132: /* order_by_expr: expr order_by_type  */
-#line 1271 "parser.y"
+  case 134: /* order_by_expr: expr order_by_type  */
+#line 1305 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4343 "parser.cpp"
+#line 4400 "parser.cpp"
     break;
 
-  case 133: /* order_by_type: ASC  */
-#line 1277 "parser.y"
+  case 135: /* order_by_type: ASC  */
+#line 1311 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4351 "parser.cpp"
+#line 4408 "parser.cpp"
     break;
 
-  case 134: /* order_by_type: DESC  */
-#line 1280 "parser.y"
+  case 136: /* order_by_type: DESC  */
+#line 1314 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4359 "parser.cpp"
+#line 4416 "parser.cpp"
     break;
 
-  case 135: /* order_by_type: %empty  */
-#line 1283 "parser.y"
+  case 137: /* order_by_type: %empty  */
+#line 1317 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4367 "parser.cpp"
+#line 4424 "parser.cpp"
     break;
 
-  case 136: /* limit_expr: LIMIT expr  */
-#line 1287 "parser.y"
+  case 138: /* limit_expr: LIMIT expr  */
+#line 1321 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4375 "parser.cpp"
+#line 4432 "parser.cpp"
     break;
 
-  case 137: /* limit_expr: %empty  */
-#line 1291 "parser.y"
+  case 139: /* limit_expr: %empty  */
+#line 1325 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4381 "parser.cpp"
+#line 4438 "parser.cpp"
     break;
 
-  case 138: /* offset_expr: OFFSET expr  */
-#line 1293 "parser.y"
+  case 140: /* offset_expr: OFFSET expr  */
+#line 1327 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4389 "parser.cpp"
+#line 4446 "parser.cpp"
     break;
 
-  case 139: /* offset_expr: %empty  */
-#line 1297 "parser.y"
+  case 141: /* offset_expr: %empty  */
+#line 1331 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4395 "parser.cpp"
+#line 4452 "parser.cpp"
     break;
 
-  case 140: /* distinct: DISTINCT  */
-#line 1299 "parser.y"
+  case 142: /* distinct: DISTINCT  */
+#line 1333 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 4403 "parser.cpp"
+#line 4460 "parser.cpp"
     break;
 
-  case 141: /* distinct: %empty  */
-#line 1302 "parser.y"
+  case 143: /* distinct: %empty  */
+#line 1336 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 4411 "parser.cpp"
+#line 4468 "parser.cpp"
     break;
 
-  case 142: /* from_clause: FROM table_reference  */
-#line 1306 "parser.y"
+  case 144: /* from_clause: FROM table_reference  */
+#line 1340 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4419 "parser.cpp"
+#line 4476 "parser.cpp"
     break;
 
-  case 143: /* from_clause: %empty  */
-#line 1309 "parser.y"
+  case 145: /* from_clause: %empty  */
+#line 1343 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4427 "parser.cpp"
+#line 4484 "parser.cpp"
     break;
 
-  case 144: /* search_clause: SEARCH sub_search_array  */
-#line 1313 "parser.y"
+  case 146: /* search_clause: SEARCH sub_search_array  */
+#line 1347 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4437 "parser.cpp"
+#line 4494 "parser.cpp"
     break;
 
-  case 145: /* search_clause: %empty  */
-#line 1318 "parser.y"
+  case 147: /* search_clause: %empty  */
+#line 1352 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4445 "parser.cpp"
+#line 4502 "parser.cpp"
     break;
 
-  case 146: /* where_clause: WHERE expr  */
-#line 1322 "parser.y"
+  case 148: /* where_clause: WHERE expr  */
+#line 1356 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4453 "parser.cpp"
+#line 4510 "parser.cpp"
     break;
 
-  case 147: /* where_clause: %empty  */
-#line 1325 "parser.y"
+  case 149: /* where_clause: %empty  */
+#line 1359 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4461 "parser.cpp"
+#line 4518 "parser.cpp"
     break;
 
-  case 148: /* having_clause: HAVING expr  */
-#line 1329 "parser.y"
+  case 150: /* having_clause: HAVING expr  */
+#line 1363 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4469 "parser.cpp"
+#line 4526 "parser.cpp"
     break;
 
-  case 149: /* having_clause: %empty  */
-#line 1332 "parser.y"
+  case 151: /* having_clause: %empty  */
+#line 1366 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4477 "parser.cpp"
+#line 4534 "parser.cpp"
     break;
 
-  case 150: /* group_by_clause: GROUP BY expr_array  */
-#line 1336 "parser.y"
+  case 152: /* group_by_clause: GROUP BY expr_array  */
+#line 1370 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4485 "parser.cpp"
+#line 4542 "parser.cpp"
     break;
 
-  case 151: /* group_by_clause: %empty  */
-#line 1339 "parser.y"
+  case 153: /* group_by_clause: %empty  */
+#line 1373 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4493 "parser.cpp"
+#line 4550 "parser.cpp"
     break;
 
-  case 152: /* set_operator: UNION  */
-#line 1343 "parser.y"
+  case 154: /* set_operator: UNION  */
+#line 1377 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4501 "parser.cpp"
+#line 4558 "parser.cpp"
     break;
 
-  case 153: /* set_operator: UNION ALL  */
-#line 1346 "parser.y"
+  case 155: /* set_operator: UNION ALL  */
+#line 1380 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4509 "parser.cpp"
+#line 4566 "parser.cpp"
     break;
 
-  case 154: /* set_operator: INTERSECT  */
-#line 1349 "parser.y"
+  case 156: /* set_operator: INTERSECT  */
+#line 1383 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4517 "parser.cpp"
+#line 4574 "parser.cpp"
     break;
 
-  case 155: /* set_operator: EXCEPT  */
-#line 1352 "parser.y"
+  case 157: /* set_operator: EXCEPT  */
+#line 1386 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4525 "parser.cpp"
+#line 4582 "parser.cpp"
     break;
 
-  case 156: /* table_reference: table_reference_unit  */
-#line 1360 "parser.y"
+  case 158: /* table_reference: table_reference_unit  */
+#line 1394 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4533 "parser.cpp"
+#line 4590 "parser.cpp"
     break;
 
-  case 157: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1363 "parser.y"
+  case 159: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1397 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -4547,11 +4604,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4551 "parser.cpp"
+#line 4608 "parser.cpp"
     break;
 
-  case 160: /* table_reference_name: table_name table_alias  */
-#line 1380 "parser.y"
+  case 162: /* table_reference_name: table_name table_alias  */
+#line 1414 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4565,32 +4622,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4569 "parser.cpp"
+#line 4626 "parser.cpp"
     break;
 
-  case 161: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1394 "parser.y"
+  case 163: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1428 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 4580 "parser.cpp"
+#line 4637 "parser.cpp"
     break;
 
-  case 162: /* table_name: IDENTIFIER  */
-#line 1403 "parser.y"
+  case 164: /* table_name: IDENTIFIER  */
+#line 1437 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4590 "parser.cpp"
+#line 4647 "parser.cpp"
     break;
 
-  case 163: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1408 "parser.y"
+  case 165: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1442 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4598,84 +4655,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4602 "parser.cpp"
+#line 4659 "parser.cpp"
     break;
 
-  case 164: /* table_alias: AS IDENTIFIER  */
-#line 1417 "parser.y"
+  case 166: /* table_alias: AS IDENTIFIER  */
+#line 1451 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4612 "parser.cpp"
+#line 4669 "parser.cpp"
     break;
 
-  case 165: /* table_alias: IDENTIFIER  */
-#line 1422 "parser.y"
+  case 167: /* table_alias: IDENTIFIER  */
+#line 1456 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4622 "parser.cpp"
+#line 4679 "parser.cpp"
     break;
 
-  case 166: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1427 "parser.y"
+  case 168: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1461 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 4633 "parser.cpp"
+#line 4690 "parser.cpp"
     break;
 
-  case 167: /* table_alias: %empty  */
-#line 1433 "parser.y"
+  case 169: /* table_alias: %empty  */
+#line 1467 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 4641 "parser.cpp"
+#line 4698 "parser.cpp"
     break;
 
-  case 168: /* with_clause: WITH with_expr_list  */
-#line 1440 "parser.y"
+  case 170: /* with_clause: WITH with_expr_list  */
+#line 1474 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 4649 "parser.cpp"
+#line 4706 "parser.cpp"
     break;
 
-  case 169: /* with_clause: %empty  */
-#line 1443 "parser.y"
+  case 171: /* with_clause: %empty  */
+#line 1477 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 4657 "parser.cpp"
+#line 4714 "parser.cpp"
     break;
 
-  case 170: /* with_expr_list: with_expr  */
-#line 1447 "parser.y"
+  case 172: /* with_expr_list: with_expr  */
+#line 1481 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 4666 "parser.cpp"
+#line 4723 "parser.cpp"
     break;
 
-  case 171: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1450 "parser.y"
+  case 173: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1484 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 4675 "parser.cpp"
+#line 4732 "parser.cpp"
     break;
 
-  case 172: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1455 "parser.y"
+  case 174: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1489 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -4683,11 +4740,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 4687 "parser.cpp"
+#line 4744 "parser.cpp"
     break;
 
-  case 173: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1467 "parser.y"
+  case 175: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1501 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -4695,11 +4752,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 4699 "parser.cpp"
+#line 4756 "parser.cpp"
     break;
 
-  case 174: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1474 "parser.y"
+  case 176: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1508 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -4708,129 +4765,129 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 4712 "parser.cpp"
+#line 4769 "parser.cpp"
     break;
 
-  case 175: /* join_type: INNER  */
-#line 1488 "parser.y"
+  case 177: /* join_type: INNER  */
+#line 1522 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 4720 "parser.cpp"
+#line 4777 "parser.cpp"
     break;
 
-  case 176: /* join_type: LEFT  */
-#line 1491 "parser.y"
+  case 178: /* join_type: LEFT  */
+#line 1525 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 4728 "parser.cpp"
+#line 4785 "parser.cpp"
     break;
 
-  case 177: /* join_type: RIGHT  */
-#line 1494 "parser.y"
+  case 179: /* join_type: RIGHT  */
+#line 1528 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 4736 "parser.cpp"
+#line 4793 "parser.cpp"
     break;
 
-  case 178: /* join_type: OUTER  */
-#line 1497 "parser.y"
+  case 180: /* join_type: OUTER  */
+#line 1531 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4744 "parser.cpp"
+#line 4801 "parser.cpp"
     break;
 
-  case 179: /* join_type: FULL  */
-#line 1500 "parser.y"
+  case 181: /* join_type: FULL  */
+#line 1534 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4752 "parser.cpp"
+#line 4809 "parser.cpp"
     break;
 
-  case 180: /* join_type: CROSS  */
-#line 1503 "parser.y"
+  case 182: /* join_type: CROSS  */
+#line 1537 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 4760 "parser.cpp"
+#line 4817 "parser.cpp"
     break;
 
-  case 181: /* join_type: %empty  */
-#line 1506 "parser.y"
+  case 183: /* join_type: %empty  */
+#line 1540 "parser.y"
                 {
 }
-#line 4767 "parser.cpp"
+#line 4824 "parser.cpp"
     break;
 
-  case 182: /* show_statement: SHOW DATABASES  */
-#line 1512 "parser.y"
+  case 184: /* show_statement: SHOW DATABASES  */
+#line 1546 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 4776 "parser.cpp"
+#line 4833 "parser.cpp"
     break;
 
-  case 183: /* show_statement: SHOW TABLES  */
-#line 1516 "parser.y"
+  case 185: /* show_statement: SHOW TABLES  */
+#line 1550 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 4785 "parser.cpp"
+#line 4842 "parser.cpp"
     break;
 
-  case 184: /* show_statement: SHOW VIEWS  */
-#line 1520 "parser.y"
+  case 186: /* show_statement: SHOW VIEWS  */
+#line 1554 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 4794 "parser.cpp"
+#line 4851 "parser.cpp"
     break;
 
-  case 185: /* show_statement: SHOW CONFIGS  */
-#line 1524 "parser.y"
+  case 187: /* show_statement: SHOW CONFIGS  */
+#line 1558 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 4803 "parser.cpp"
+#line 4860 "parser.cpp"
     break;
 
-  case 186: /* show_statement: SHOW PROFILES  */
-#line 1528 "parser.y"
+  case 188: /* show_statement: SHOW PROFILES  */
+#line 1562 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 4812 "parser.cpp"
+#line 4869 "parser.cpp"
     break;
 
-  case 187: /* show_statement: SHOW SESSION STATUS  */
-#line 1532 "parser.y"
+  case 189: /* show_statement: SHOW SESSION STATUS  */
+#line 1566 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionStatus;
 }
-#line 4821 "parser.cpp"
+#line 4878 "parser.cpp"
     break;
 
-  case 188: /* show_statement: SHOW GLOBAL STATUS  */
-#line 1536 "parser.y"
+  case 190: /* show_statement: SHOW GLOBAL STATUS  */
+#line 1570 "parser.y"
                      {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalStatus;
 }
-#line 4830 "parser.cpp"
+#line 4887 "parser.cpp"
     break;
 
-  case 189: /* show_statement: SHOW VAR IDENTIFIER  */
-#line 1540 "parser.y"
+  case 191: /* show_statement: SHOW VAR IDENTIFIER  */
+#line 1574 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kVar;
@@ -4838,22 +4895,22 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4842 "parser.cpp"
+#line 4899 "parser.cpp"
     break;
 
-  case 190: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1547 "parser.y"
+  case 192: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1581 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 4853 "parser.cpp"
+#line 4910 "parser.cpp"
     break;
 
-  case 191: /* show_statement: SHOW TABLE table_name  */
-#line 1553 "parser.y"
+  case 193: /* show_statement: SHOW TABLE table_name  */
+#line 1587 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -4865,11 +4922,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4869 "parser.cpp"
+#line 4926 "parser.cpp"
     break;
 
-  case 192: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1564 "parser.y"
+  case 194: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1598 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -4881,11 +4938,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4885 "parser.cpp"
+#line 4942 "parser.cpp"
     break;
 
-  case 193: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1575 "parser.y"
+  case 195: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1609 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4897,11 +4954,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4901 "parser.cpp"
+#line 4958 "parser.cpp"
     break;
 
-  case 194: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1586 "parser.y"
+  case 196: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1620 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -4914,11 +4971,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 4918 "parser.cpp"
+#line 4975 "parser.cpp"
     break;
 
-  case 195: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1598 "parser.y"
+  case 197: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1632 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -4931,11 +4988,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 4935 "parser.cpp"
+#line 4992 "parser.cpp"
     break;
 
-  case 196: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1610 "parser.y"
+  case 198: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1644 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -4949,11 +5006,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 4953 "parser.cpp"
+#line 5010 "parser.cpp"
     break;
 
-  case 197: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1623 "parser.y"
+  case 199: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
+#line 1657 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -4968,11 +5025,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 4972 "parser.cpp"
+#line 5029 "parser.cpp"
     break;
 
-  case 198: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1637 "parser.y"
+  case 200: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1671 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -4984,11 +5041,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4988 "parser.cpp"
+#line 5045 "parser.cpp"
     break;
 
-  case 199: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1648 "parser.y"
+  case 201: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1682 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -5003,38 +5060,38 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5007 "parser.cpp"
+#line 5064 "parser.cpp"
     break;
 
-  case 200: /* flush_statement: FLUSH DATA  */
-#line 1666 "parser.y"
+  case 202: /* flush_statement: FLUSH DATA  */
+#line 1700 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 5016 "parser.cpp"
+#line 5073 "parser.cpp"
     break;
 
-  case 201: /* flush_statement: FLUSH LOG  */
-#line 1670 "parser.y"
+  case 203: /* flush_statement: FLUSH LOG  */
+#line 1704 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 5025 "parser.cpp"
+#line 5082 "parser.cpp"
     break;
 
-  case 202: /* flush_statement: FLUSH BUFFER  */
-#line 1674 "parser.y"
+  case 204: /* flush_statement: FLUSH BUFFER  */
+#line 1708 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 5034 "parser.cpp"
+#line 5091 "parser.cpp"
     break;
 
-  case 203: /* optimize_statement: OPTIMIZE table_name  */
-#line 1682 "parser.y"
+  case 205: /* optimize_statement: OPTIMIZE table_name  */
+#line 1716 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5045,54 +5102,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5049 "parser.cpp"
+#line 5106 "parser.cpp"
     break;
 
-  case 204: /* command_statement: USE IDENTIFIER  */
-#line 1696 "parser.y"
+  case 206: /* command_statement: USE IDENTIFIER  */
+#line 1730 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5060 "parser.cpp"
+#line 5117 "parser.cpp"
     break;
 
-  case 205: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1702 "parser.y"
+  case 207: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1736 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 5070 "parser.cpp"
+#line 5127 "parser.cpp"
     break;
 
-  case 206: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1707 "parser.y"
+  case 208: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1741 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5081 "parser.cpp"
+#line 5138 "parser.cpp"
     break;
 
-  case 207: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1713 "parser.y"
+  case 209: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1747 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5092 "parser.cpp"
+#line 5149 "parser.cpp"
     break;
 
-  case 208: /* command_statement: SET SESSION IDENTIFIER STRING  */
-#line 1719 "parser.y"
+  case 210: /* command_statement: SET SESSION IDENTIFIER STRING  */
+#line 1753 "parser.y"
                                 {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5101,55 +5158,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5105 "parser.cpp"
+#line 5162 "parser.cpp"
     break;
 
-  case 209: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1727 "parser.y"
+  case 211: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1761 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5116 "parser.cpp"
+#line 5173 "parser.cpp"
     break;
 
-  case 210: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1733 "parser.y"
+  case 212: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1767 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5127 "parser.cpp"
+#line 5184 "parser.cpp"
     break;
 
-  case 211: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1739 "parser.y"
+  case 213: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1773 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5138 "parser.cpp"
+#line 5195 "parser.cpp"
     break;
 
-  case 212: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1745 "parser.y"
+  case 214: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1779 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5149 "parser.cpp"
+#line 5206 "parser.cpp"
     break;
 
-  case 213: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
-#line 1751 "parser.y"
+  case 215: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
+#line 1785 "parser.y"
                                {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5158,33 +5215,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5162 "parser.cpp"
+#line 5219 "parser.cpp"
     break;
 
-  case 214: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1759 "parser.y"
+  case 216: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1793 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5173 "parser.cpp"
+#line 5230 "parser.cpp"
     break;
 
-  case 215: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1765 "parser.y"
+  case 217: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1799 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5184 "parser.cpp"
+#line 5241 "parser.cpp"
     break;
 
-  case 216: /* command_statement: COMPACT TABLE table_name  */
-#line 1771 "parser.y"
+  case 218: /* command_statement: COMPACT TABLE table_name  */
+#line 1805 "parser.y"
                            {
     (yyval.command_stmt) = new infinity::CommandStatement();
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5196,38 +5253,54 @@ yyreduce:
         free((yyvsp[0].table_name_t)->table_name_ptr_);
     } delete (yyvsp[0].table_name_t);
 }
-#line 5200 "parser.cpp"
+#line 5257 "parser.cpp"
+    break;
+
+  case 219: /* command_statement: ANALYZE table_name  */
+#line 1816 "parser.y"
+                     {
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
+        (yyval.command_stmt)->command_info_ = std::make_unique<infinity::AnalyzeTable>(std::string((yyvsp[0].table_name_t)->schema_name_ptr_), std::string((yyvsp[0].table_name_t)->table_name_ptr_));
+        free((yyvsp[0].table_name_t)->schema_name_ptr_);
+        free((yyvsp[0].table_name_t)->table_name_ptr_);
+    } else {
+        (yyval.command_stmt)->command_info_ = std::make_unique<infinity::AnalyzeTable>(std::string((yyvsp[0].table_name_t)->table_name_ptr_));
+        free((yyvsp[0].table_name_t)->table_name_ptr_);
+    } delete (yyvsp[0].table_name_t);
+}
+#line 5273 "parser.cpp"
     break;
 
-  case 217: /* expr_array: expr_alias  */
-#line 1787 "parser.y"
+  case 220: /* expr_array: expr_alias  */
+#line 1832 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5209 "parser.cpp"
+#line 5282 "parser.cpp"
     break;
 
-  case 218: /* expr_array: expr_array ',' expr_alias  */
-#line 1791 "parser.y"
+  case 221: /* expr_array: expr_array ',' expr_alias  */
+#line 1836 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5218 "parser.cpp"
+#line 5291 "parser.cpp"
     break;
 
-  case 219: /* expr_array_list: '(' expr_array ')'  */
-#line 1796 "parser.y"
+  case 222: /* expr_array_list: '(' expr_array ')'  */
+#line 1841 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5227 "parser.cpp"
+#line 5300 "parser.cpp"
     break;
 
-  case 220: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1800 "parser.y"
+  case 223: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 1845 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5243,57 +5316,57 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5247 "parser.cpp"
+#line 5320 "parser.cpp"
     break;
 
-  case 221: /* expr_alias: expr AS IDENTIFIER  */
-#line 1827 "parser.y"
+  case 224: /* expr_alias: expr AS IDENTIFIER  */
+#line 1872 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5258 "parser.cpp"
+#line 5331 "parser.cpp"
     break;
 
-  case 222: /* expr_alias: expr  */
-#line 1833 "parser.y"
+  case 225: /* expr_alias: expr  */
+#line 1878 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5266 "parser.cpp"
+#line 5339 "parser.cpp"
     break;
 
-  case 228: /* operand: '(' expr ')'  */
-#line 1843 "parser.y"
+  case 231: /* operand: '(' expr ')'  */
+#line 1888 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5274 "parser.cpp"
+#line 5347 "parser.cpp"
     break;
 
-  case 229: /* operand: '(' select_without_paren ')'  */
-#line 1846 "parser.y"
+  case 232: /* operand: '(' select_without_paren ')'  */
+#line 1891 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5285 "parser.cpp"
+#line 5358 "parser.cpp"
     break;
 
-  case 230: /* operand: constant_expr  */
-#line 1852 "parser.y"
+  case 233: /* operand: constant_expr  */
+#line 1897 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5293 "parser.cpp"
+#line 5366 "parser.cpp"
     break;
 
-  case 239: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 1864 "parser.y"
+  case 242: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 1909 "parser.y"
                                                                                                       {
     infinity::KnnExpr* knn_expr = new infinity::KnnExpr();
     (yyval.expr_t) = knn_expr;
@@ -5345,6 +5418,25 @@ yyreduce:
         free((yyvsp[-6].str_value));
         free((yyvsp[-4].str_value));
         delete (yyvsp[-8].const_expr_t);
+    } else if((strcmp((yyvsp[-6].str_value), "float16") == 0 or strcmp((yyvsp[-6].str_value), "bfloat16") == 0) and knn_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
+        // stored as the raw 16 bits, narrowed from the double or integer literals
+        bool is_bfloat16 = strcmp((yyvsp[-6].str_value), "bfloat16") == 0;
+        knn_expr->embedding_data_type_ = is_bfloat16 ? infinity::EmbeddingDataType::kElemBFloat16 : infinity::EmbeddingDataType::kElemFloat16;
+        std::vector<float> values;
+        for(double v : (yyvsp[-8].const_expr_t)->double_array_) {
+            values.push_back(v);
+        }
+        for(long v : (yyvsp[-8].const_expr_t)->long_array_) {
+            values.push_back(v);
+        }
+        knn_expr->dimension_ = values.size();
+        knn_expr->embedding_data_ptr_ = new int16_t[knn_expr->dimension_];
+        for(long i = 0; i < knn_expr->dimension_; ++ i) {
+            ((uint16_t*)(knn_expr->embedding_data_ptr_))[i] = is_bfloat16 ? infinity::bfloat16_t(values[i]).raw : infinity::float16_t(values[i]).raw;
+        }
+        free((yyvsp[-6].str_value));
+        free((yyvsp[-4].str_value));
+        delete (yyvsp[-8].const_expr_t);
     } else if(strcmp((yyvsp[-6].str_value), "tinyint") == 0 and knn_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
         knn_expr->dimension_ = (yyvsp[-8].const_expr_t)->long_array_.size();
         knn_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt8;
@@ -5400,11 +5492,11 @@ yyreduce:
                 char embedding_unit = 0;
                 for(long bit_idx = 0; bit_idx < 8; ++ bit_idx) {
                     if((yyvsp[-8].const_expr_t)->long_array_[i * 8 + bit_idx] == 1) {
-                        char temp = embedding_unit << 1;
-                        temp &= 1;
-                        embedding_unit = temp;
+                        // bits are packed from the most significant bit of each byte,
+                        // the same layout as a bit embedding column
+                        embedding_unit |= (1 << (7 - bit_idx));
                     } else if((yyvsp[-8].const_expr_t)->long_array_[i * 8 + bit_idx] == 0) {
-                        embedding_unit <<= 0;
+                        // bit stays zero
                     } else {
                         for (auto* param_ptr: *(yyvsp[0].with_index_param_list_t)) {
                             delete param_ptr;
@@ -5460,11 +5552,11 @@ yyreduce:
     knn_expr->topn_ = (yyvsp[-2].long_value);
     knn_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
 }
-#line 5464 "parser.cpp"
+#line 5556 "parser.cpp"
     break;
 
-  case 240: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
-#line 2031 "parser.y"
+  case 243: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
+#line 2095 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5473,11 +5565,11 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5477 "parser.cpp"
+#line 5569 "parser.cpp"
     break;
 
-  case 241: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
-#line 2039 "parser.y"
+  case 244: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
+#line 2103 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5488,22 +5580,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5492 "parser.cpp"
+#line 5584 "parser.cpp"
     break;
 
-  case 242: /* query_expr: QUERY '(' STRING ')'  */
-#line 2050 "parser.y"
+  case 245: /* query_expr: QUERY '(' STRING ')'  */
+#line 2114 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5503 "parser.cpp"
+#line 5595 "parser.cpp"
     break;
 
-  case 243: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2056 "parser.y"
+  case 246: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 2120 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5512,22 +5604,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5516 "parser.cpp"
+#line 5608 "parser.cpp"
     break;
 
-  case 244: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2065 "parser.y"
+  case 247: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2129 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5527 "parser.cpp"
+#line 5619 "parser.cpp"
     break;
 
-  case 245: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2071 "parser.y"
+  case 248: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2135 "parser.y"
                                    {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -5536,83 +5628,83 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5540 "parser.cpp"
+#line 5632 "parser.cpp"
     break;
 
-  case 246: /* sub_search_array: knn_expr  */
-#line 2081 "parser.y"
+  case 249: /* sub_search_array: knn_expr  */
+#line 2145 "parser.y"
                             {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5549 "parser.cpp"
+#line 5641 "parser.cpp"
     break;
 
-  case 247: /* sub_search_array: match_expr  */
-#line 2085 "parser.y"
+  case 250: /* sub_search_array: match_expr  */
+#line 2149 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5558 "parser.cpp"
+#line 5650 "parser.cpp"
     break;
 
-  case 248: /* sub_search_array: query_expr  */
-#line 2089 "parser.y"
+  case 251: /* sub_search_array: query_expr  */
+#line 2153 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5567 "parser.cpp"
+#line 5659 "parser.cpp"
     break;
 
-  case 249: /* sub_search_array: fusion_expr  */
-#line 2093 "parser.y"
+  case 252: /* sub_search_array: fusion_expr  */
+#line 2157 "parser.y"
               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5576 "parser.cpp"
+#line 5668 "parser.cpp"
     break;
 
-  case 250: /* sub_search_array: sub_search_array ',' knn_expr  */
-#line 2097 "parser.y"
+  case 253: /* sub_search_array: sub_search_array ',' knn_expr  */
+#line 2161 "parser.y"
                                 {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5585 "parser.cpp"
+#line 5677 "parser.cpp"
     break;
 
-  case 251: /* sub_search_array: sub_search_array ',' match_expr  */
-#line 2101 "parser.y"
+  case 254: /* sub_search_array: sub_search_array ',' match_expr  */
+#line 2165 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5594 "parser.cpp"
+#line 5686 "parser.cpp"
     break;
 
-  case 252: /* sub_search_array: sub_search_array ',' query_expr  */
-#line 2105 "parser.y"
+  case 255: /* sub_search_array: sub_search_array ',' query_expr  */
+#line 2169 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5603 "parser.cpp"
+#line 5695 "parser.cpp"
     break;
 
-  case 253: /* sub_search_array: sub_search_array ',' fusion_expr  */
-#line 2109 "parser.y"
+  case 256: /* sub_search_array: sub_search_array ',' fusion_expr  */
+#line 2173 "parser.y"
                                    {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5612 "parser.cpp"
+#line 5704 "parser.cpp"
     break;
 
-  case 254: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2114 "parser.y"
+  case 257: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2178 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5621,11 +5713,11 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 5625 "parser.cpp"
+#line 5717 "parser.cpp"
     break;
 
-  case 255: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2122 "parser.y"
+  case 258: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2186 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5634,11 +5726,11 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 5638 "parser.cpp"
+#line 5730 "parser.cpp"
     break;
 
-  case 256: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2130 "parser.y"
+  case 259: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2194 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5648,11 +5740,11 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 5652 "parser.cpp"
+#line 5744 "parser.cpp"
     break;
 
-  case 257: /* function_expr: operand IS NOT NULLABLE  */
-#line 2139 "parser.y"
+  case 260: /* function_expr: operand IS NOT NULLABLE  */
+#line 2203 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -5660,11 +5752,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5664 "parser.cpp"
+#line 5756 "parser.cpp"
     break;
 
-  case 258: /* function_expr: operand IS NULLABLE  */
-#line 2146 "parser.y"
+  case 261: /* function_expr: operand IS NULLABLE  */
+#line 2210 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -5672,11 +5764,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5676 "parser.cpp"
+#line 5768 "parser.cpp"
     break;
 
-  case 259: /* function_expr: NOT operand  */
-#line 2153 "parser.y"
+  case 262: /* function_expr: NOT operand  */
+#line 2217 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -5684,11 +5776,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5688 "parser.cpp"
+#line 5780 "parser.cpp"
     break;
 
-  case 260: /* function_expr: '-' operand  */
-#line 2160 "parser.y"
+  case 263: /* function_expr: '-' operand  */
+#line 2224 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5696,11 +5788,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5700 "parser.cpp"
+#line 5792 "parser.cpp"
     break;
 
-  case 261: /* function_expr: '+' operand  */
-#line 2167 "parser.y"
+  case 264: /* function_expr: '+' operand  */
+#line 2231 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5708,11 +5800,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5712 "parser.cpp"
+#line 5804 "parser.cpp"
     break;
 
-  case 262: /* function_expr: operand '-' operand  */
-#line 2174 "parser.y"
+  case 265: /* function_expr: operand '-' operand  */
+#line 2238 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5721,11 +5813,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5725 "parser.cpp"
+#line 5817 "parser.cpp"
     break;
 
-  case 263: /* function_expr: operand '+' operand  */
-#line 2182 "parser.y"
+  case 266: /* function_expr: operand '+' operand  */
+#line 2246 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5734,11 +5826,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5738 "parser.cpp"
+#line 5830 "parser.cpp"
     break;
 
-  case 264: /* function_expr: operand '*' operand  */
-#line 2190 "parser.y"
+  case 267: /* function_expr: operand '*' operand  */
+#line 2254 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -5747,11 +5839,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5751 "parser.cpp"
+#line 5843 "parser.cpp"
     break;
 
-  case 265: /* function_expr: operand '/' operand  */
-#line 2198 "parser.y"
+  case 268: /* function_expr: operand '/' operand  */
+#line 2262 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -5760,11 +5852,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5764 "parser.cpp"
+#line 5856 "parser.cpp"
     break;
 
-  case 266: /* function_expr: operand '%' operand  */
-#line 2206 "parser.y"
+  case 269: /* function_expr: operand '%' operand  */
+#line 2270 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -5773,11 +5865,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5777 "parser.cpp"
+#line 5869 "parser.cpp"
     break;
 
-  case 267: /* function_expr: operand '=' operand  */
-#line 2214 "parser.y"
+  case 270: /* function_expr: operand '=' operand  */
+#line 2278 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5786,11 +5878,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5790 "parser.cpp"
+#line 5882 "parser.cpp"
     break;
 
-  case 268: /* function_expr: operand EQUAL operand  */
-#line 2222 "parser.y"
+  case 271: /* function_expr: operand EQUAL operand  */
+#line 2286 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5799,11 +5891,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5803 "parser.cpp"
+#line 5895 "parser.cpp"
     break;
 
-  case 269: /* function_expr: operand NOT_EQ operand  */
-#line 2230 "parser.y"
+  case 272: /* function_expr: operand NOT_EQ operand  */
+#line 2294 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -5812,11 +5904,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5816 "parser.cpp"
+#line 5908 "parser.cpp"
     break;
 
-  case 270: /* function_expr: operand '<' operand  */
-#line 2238 "parser.y"
+  case 273: /* function_expr: operand '<' operand  */
+#line 2302 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -5825,11 +5917,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5829 "parser.cpp"
+#line 5921 "parser.cpp"
     break;
 
-  case 271: /* function_expr: operand '>' operand  */
-#line 2246 "parser.y"
+  case 274: /* function_expr: operand '>' operand  */
+#line 2310 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -5838,11 +5930,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5842 "parser.cpp"
+#line 5934 "parser.cpp"
     break;
 
-  case 272: /* function_expr: operand LESS_EQ operand  */
-#line 2254 "parser.y"
+  case 275: /* function_expr: operand LESS_EQ operand  */
+#line 2318 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -5851,11 +5943,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5855 "parser.cpp"
+#line 5947 "parser.cpp"
     break;
 
-  case 273: /* function_expr: operand GREATER_EQ operand  */
-#line 2262 "parser.y"
+  case 276: /* function_expr: operand GREATER_EQ operand  */
+#line 2326 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -5864,11 +5956,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5868 "parser.cpp"
+#line 5960 "parser.cpp"
     break;
 
-  case 274: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2270 "parser.y"
+  case 277: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2334 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5899,11 +5991,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5903 "parser.cpp"
+#line 5995 "parser.cpp"
     break;
 
-  case 275: /* function_expr: operand LIKE operand  */
-#line 2300 "parser.y"
+  case 278: /* function_expr: operand LIKE operand  */
+#line 2364 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -5912,11 +6004,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5916 "parser.cpp"
+#line 6008 "parser.cpp"
     break;
 
-  case 276: /* function_expr: operand NOT LIKE operand  */
-#line 2308 "parser.y"
+  case 279: /* function_expr: operand NOT LIKE operand  */
+#line 2372 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -5925,11 +6017,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5929 "parser.cpp"
+#line 6021 "parser.cpp"
     break;
 
-  case 277: /* conjunction_expr: expr AND expr  */
-#line 2317 "parser.y"
+  case 280: /* conjunction_expr: expr AND expr  */
+#line 2381 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -5938,11 +6030,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5942 "parser.cpp"
+#line 6034 "parser.cpp"
     break;
 
-  case 278: /* conjunction_expr: expr OR expr  */
-#line 2325 "parser.y"
+  case 281: /* conjunction_expr: expr OR expr  */
+#line 2389 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -5951,11 +6043,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5955 "parser.cpp"
+#line 6047 "parser.cpp"
     break;
 
-  case 279: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2334 "parser.y"
+  case 282: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2398 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -5963,44 +6055,44 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 5967 "parser.cpp"
+#line 6059 "parser.cpp"
     break;
 
-  case 280: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2342 "parser.y"
+  case 283: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2406 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5978 "parser.cpp"
+#line 6070 "parser.cpp"
     break;
 
-  case 281: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2348 "parser.y"
+  case 284: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2412 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5989 "parser.cpp"
+#line 6081 "parser.cpp"
     break;
 
-  case 282: /* case_expr: CASE expr case_check_array END  */
-#line 2355 "parser.y"
+  case 285: /* case_expr: CASE expr case_check_array END  */
+#line 2419 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6000 "parser.cpp"
+#line 6092 "parser.cpp"
     break;
 
-  case 283: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2361 "parser.y"
+  case 286: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2425 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -6008,32 +6100,32 @@ yyreduce:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6012 "parser.cpp"
+#line 6104 "parser.cpp"
     break;
 
-  case 284: /* case_expr: CASE case_check_array END  */
-#line 2368 "parser.y"
+  case 287: /* case_expr: CASE case_check_array END  */
+#line 2432 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6022 "parser.cpp"
+#line 6114 "parser.cpp"
     break;
 
-  case 285: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2373 "parser.y"
+  case 288: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2437 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6033 "parser.cpp"
+#line 6125 "parser.cpp"
     break;
 
-  case 286: /* case_check_array: WHEN expr THEN expr  */
-#line 2380 "parser.y"
+  case 289: /* case_check_array: WHEN expr THEN expr  */
+#line 2444 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -6041,11 +6133,11 @@ yyreduce:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 6045 "parser.cpp"
+#line 6137 "parser.cpp"
     break;
 
-  case 287: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2387 "parser.y"
+  case 290: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2451 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -6053,11 +6145,11 @@ yyreduce:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 6057 "parser.cpp"
+#line 6149 "parser.cpp"
     break;
 
-  case 288: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2395 "parser.y"
+  case 291: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2459 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -6081,33 +6173,33 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 6085 "parser.cpp"
+#line 6177 "parser.cpp"
     break;
 
-  case 289: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2419 "parser.y"
+  case 292: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2483 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6096 "parser.cpp"
+#line 6188 "parser.cpp"
     break;
 
-  case 290: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2425 "parser.y"
+  case 293: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2489 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6107 "parser.cpp"
+#line 6199 "parser.cpp"
     break;
 
-  case 291: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2431 "parser.y"
+  case 294: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2495 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -6115,11 +6207,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6119 "parser.cpp"
+#line 6211 "parser.cpp"
     break;
 
-  case 292: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2438 "parser.y"
+  case 295: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2502 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -6127,11 +6219,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6131 "parser.cpp"
+#line 6223 "parser.cpp"
     break;
 
-  case 293: /* column_expr: IDENTIFIER  */
-#line 2446 "parser.y"
+  case 296: /* column_expr: IDENTIFIER  */
+#line 2510 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6139,11 +6231,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6143 "parser.cpp"
+#line 6235 "parser.cpp"
     break;
 
-  case 294: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2453 "parser.y"
+  case 297: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2517 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6151,21 +6243,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6155 "parser.cpp"
+#line 6247 "parser.cpp"
     break;
 
-  case 295: /* column_expr: '*'  */
-#line 2460 "parser.y"
+  case 298: /* column_expr: '*'  */
+#line 2524 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6165 "parser.cpp"
+#line 6257 "parser.cpp"
     break;
 
-  case 296: /* column_expr: column_expr '.' '*'  */
-#line 2465 "parser.y"
+  case 299: /* column_expr: column_expr '.' '*'  */
+#line 2529 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6175,353 +6267,353 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6179 "parser.cpp"
+#line 6271 "parser.cpp"
     break;
 
-  case 297: /* constant_expr: STRING  */
-#line 2475 "parser.y"
+  case 300: /* constant_expr: STRING  */
+#line 2539 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6189 "parser.cpp"
+#line 6281 "parser.cpp"
     break;
 
-  case 298: /* constant_expr: TRUE  */
-#line 2480 "parser.y"
+  case 301: /* constant_expr: TRUE  */
+#line 2544 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6199 "parser.cpp"
+#line 6291 "parser.cpp"
     break;
 
-  case 299: /* constant_expr: FALSE  */
-#line 2485 "parser.y"
+  case 302: /* constant_expr: FALSE  */
+#line 2549 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6209 "parser.cpp"
+#line 6301 "parser.cpp"
     break;
 
-  case 300: /* constant_expr: DOUBLE_VALUE  */
-#line 2490 "parser.y"
+  case 303: /* constant_expr: DOUBLE_VALUE  */
+#line 2554 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6219 "parser.cpp"
+#line 6311 "parser.cpp"
     break;
 
-  case 301: /* constant_expr: LONG_VALUE  */
-#line 2495 "parser.y"
+  case 304: /* constant_expr: LONG_VALUE  */
+#line 2559 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6229 "parser.cpp"
+#line 6321 "parser.cpp"
     break;
 
-  case 302: /* constant_expr: DATE STRING  */
-#line 2500 "parser.y"
+  case 305: /* constant_expr: DATE STRING  */
+#line 2564 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6239 "parser.cpp"
+#line 6331 "parser.cpp"
     break;
 
-  case 303: /* constant_expr: TIME STRING  */
-#line 2505 "parser.y"
+  case 306: /* constant_expr: TIME STRING  */
+#line 2569 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6249 "parser.cpp"
+#line 6341 "parser.cpp"
     break;
 
-  case 304: /* constant_expr: DATETIME STRING  */
-#line 2510 "parser.y"
+  case 307: /* constant_expr: DATETIME STRING  */
+#line 2574 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6259 "parser.cpp"
+#line 6351 "parser.cpp"
     break;
 
-  case 305: /* constant_expr: TIMESTAMP STRING  */
-#line 2515 "parser.y"
+  case 308: /* constant_expr: TIMESTAMP STRING  */
+#line 2579 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6269 "parser.cpp"
+#line 6361 "parser.cpp"
     break;
 
-  case 306: /* constant_expr: INTERVAL interval_expr  */
-#line 2520 "parser.y"
+  case 309: /* constant_expr: INTERVAL interval_expr  */
+#line 2584 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6277 "parser.cpp"
+#line 6369 "parser.cpp"
     break;
 
-  case 307: /* constant_expr: interval_expr  */
-#line 2523 "parser.y"
+  case 310: /* constant_expr: interval_expr  */
+#line 2587 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6285 "parser.cpp"
+#line 6377 "parser.cpp"
     break;
 
-  case 308: /* constant_expr: long_array_expr  */
-#line 2526 "parser.y"
+  case 311: /* constant_expr: long_array_expr  */
+#line 2590 "parser.y"
                   {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6293 "parser.cpp"
+#line 6385 "parser.cpp"
     break;
 
-  case 309: /* constant_expr: double_array_expr  */
-#line 2529 "parser.y"
+  case 312: /* constant_expr: double_array_expr  */
+#line 2593 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6301 "parser.cpp"
+#line 6393 "parser.cpp"
     break;
 
-  case 310: /* array_expr: long_array_expr  */
-#line 2533 "parser.y"
+  case 313: /* array_expr: long_array_expr  */
+#line 2597 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6309 "parser.cpp"
+#line 6401 "parser.cpp"
     break;
 
-  case 311: /* array_expr: double_array_expr  */
-#line 2536 "parser.y"
+  case 314: /* array_expr: double_array_expr  */
+#line 2600 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6317 "parser.cpp"
+#line 6409 "parser.cpp"
     break;
 
-  case 312: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2540 "parser.y"
+  case 315: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2604 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6325 "parser.cpp"
+#line 6417 "parser.cpp"
     break;
 
-  case 313: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2544 "parser.y"
+  case 316: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2608 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6335 "parser.cpp"
+#line 6427 "parser.cpp"
     break;
 
-  case 314: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2549 "parser.y"
+  case 317: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2613 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6344 "parser.cpp"
+#line 6436 "parser.cpp"
     break;
 
-  case 315: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2554 "parser.y"
+  case 318: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2618 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6352 "parser.cpp"
+#line 6444 "parser.cpp"
     break;
 
-  case 316: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2558 "parser.y"
+  case 319: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2622 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6362 "parser.cpp"
+#line 6454 "parser.cpp"
     break;
 
-  case 317: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2563 "parser.y"
+  case 320: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2627 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6371 "parser.cpp"
+#line 6463 "parser.cpp"
     break;
 
-  case 318: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2568 "parser.y"
+  case 321: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2632 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6382 "parser.cpp"
+#line 6474 "parser.cpp"
     break;
 
-  case 319: /* interval_expr: LONG_VALUE SECOND  */
-#line 2574 "parser.y"
+  case 322: /* interval_expr: LONG_VALUE SECOND  */
+#line 2638 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6393 "parser.cpp"
+#line 6485 "parser.cpp"
     break;
 
-  case 320: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2580 "parser.y"
+  case 323: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2644 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6404 "parser.cpp"
+#line 6496 "parser.cpp"
     break;
 
-  case 321: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2586 "parser.y"
+  case 324: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2650 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6415 "parser.cpp"
+#line 6507 "parser.cpp"
     break;
 
-  case 322: /* interval_expr: LONG_VALUE HOURS  */
-#line 2592 "parser.y"
+  case 325: /* interval_expr: LONG_VALUE HOURS  */
+#line 2656 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6426 "parser.cpp"
+#line 6518 "parser.cpp"
     break;
 
-  case 323: /* interval_expr: LONG_VALUE HOUR  */
-#line 2598 "parser.y"
+  case 326: /* interval_expr: LONG_VALUE HOUR  */
+#line 2662 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6437 "parser.cpp"
+#line 6529 "parser.cpp"
     break;
 
-  case 324: /* interval_expr: LONG_VALUE DAYS  */
-#line 2604 "parser.y"
+  case 327: /* interval_expr: LONG_VALUE DAYS  */
+#line 2668 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6448 "parser.cpp"
+#line 6540 "parser.cpp"
     break;
 
-  case 325: /* interval_expr: LONG_VALUE DAY  */
-#line 2610 "parser.y"
+  case 328: /* interval_expr: LONG_VALUE DAY  */
+#line 2674 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6459 "parser.cpp"
+#line 6551 "parser.cpp"
     break;
 
-  case 326: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2616 "parser.y"
+  case 329: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2680 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6470 "parser.cpp"
+#line 6562 "parser.cpp"
     break;
 
-  case 327: /* interval_expr: LONG_VALUE MONTH  */
-#line 2622 "parser.y"
+  case 330: /* interval_expr: LONG_VALUE MONTH  */
+#line 2686 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6481 "parser.cpp"
+#line 6573 "parser.cpp"
     break;
 
-  case 328: /* interval_expr: LONG_VALUE YEARS  */
-#line 2628 "parser.y"
+  case 331: /* interval_expr: LONG_VALUE YEARS  */
+#line 2692 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6492 "parser.cpp"
+#line 6584 "parser.cpp"
     break;
 
-  case 329: /* interval_expr: LONG_VALUE YEAR  */
-#line 2634 "parser.y"
+  case 332: /* interval_expr: LONG_VALUE YEAR  */
+#line 2698 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6503 "parser.cpp"
+#line 6595 "parser.cpp"
     break;
 
-  case 330: /* copy_option_list: copy_option  */
-#line 2645 "parser.y"
+  case 333: /* copy_option_list: copy_option  */
+#line 2709 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 6512 "parser.cpp"
+#line 6604 "parser.cpp"
     break;
 
-  case 331: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2649 "parser.y"
+  case 334: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2713 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 6521 "parser.cpp"
+#line 6613 "parser.cpp"
     break;
 
-  case 332: /* copy_option: FORMAT IDENTIFIER  */
-#line 2654 "parser.y"
+  case 335: /* copy_option: FORMAT IDENTIFIER  */
+#line 2718 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -6544,11 +6636,11 @@ yyreduce:
         YYERROR;
     }
 }
-#line 6548 "parser.cpp"
+#line 6640 "parser.cpp"
     break;
 
-  case 333: /* copy_option: DELIMITER STRING  */
-#line 2676 "parser.y"
+  case 336: /* copy_option: DELIMITER STRING  */
+#line 2740 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -6559,53 +6651,53 @@ yyreduce:
     }
     free((yyvsp[0].str_value));
 }
-#line 6563 "parser.cpp"
+#line 6655 "parser.cpp"
     break;
 
-  case 334: /* copy_option: HEADER  */
-#line 2686 "parser.y"
+  case 337: /* copy_option: HEADER  */
+#line 2750 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 6573 "parser.cpp"
+#line 6665 "parser.cpp"
     break;
 
-  case 335: /* file_path: STRING  */
-#line 2692 "parser.y"
+  case 338: /* file_path: STRING  */
+#line 2756 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6581 "parser.cpp"
+#line 6673 "parser.cpp"
     break;
 
-  case 336: /* if_exists: IF EXISTS  */
-#line 2696 "parser.y"
+  case 339: /* if_exists: IF EXISTS  */
+#line 2760 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 6587 "parser.cpp"
+#line 6679 "parser.cpp"
     break;
 
-  case 337: /* if_exists: %empty  */
-#line 2697 "parser.y"
+  case 340: /* if_exists: %empty  */
+#line 2761 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6593 "parser.cpp"
+#line 6685 "parser.cpp"
     break;
 
-  case 338: /* if_not_exists: IF NOT EXISTS  */
-#line 2699 "parser.y"
+  case 341: /* if_not_exists: IF NOT EXISTS  */
+#line 2763 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 6599 "parser.cpp"
+#line 6691 "parser.cpp"
     break;
 
-  case 339: /* if_not_exists: %empty  */
-#line 2700 "parser.y"
+  case 342: /* if_not_exists: %empty  */
+#line 2764 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6605 "parser.cpp"
+#line 6697 "parser.cpp"
     break;
 
-  case 342: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2715 "parser.y"
+  case 345: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2779 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -6614,79 +6706,79 @@ yyreduce:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6618 "parser.cpp"
+#line 6710 "parser.cpp"
     break;
 
-  case 343: /* if_not_exists_info: %empty  */
-#line 2723 "parser.y"
+  case 346: /* if_not_exists_info: %empty  */
+#line 2787 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 6626 "parser.cpp"
+#line 6718 "parser.cpp"
     break;
 
-  case 344: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2727 "parser.y"
+  case 347: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2791 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = std::move((yyvsp[-1].index_param_list_t));
 }
-#line 6634 "parser.cpp"
+#line 6726 "parser.cpp"
     break;
 
-  case 345: /* with_index_param_list: %empty  */
-#line 2730 "parser.y"
+  case 348: /* with_index_param_list: %empty  */
+#line 2794 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 6642 "parser.cpp"
+#line 6734 "parser.cpp"
     break;
 
-  case 346: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 2734 "parser.y"
+  case 349: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 2798 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 6650 "parser.cpp"
+#line 6742 "parser.cpp"
     break;
 
-  case 347: /* optional_table_properties_list: %empty  */
-#line 2737 "parser.y"
+  case 350: /* optional_table_properties_list: %empty  */
+#line 2801 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 6658 "parser.cpp"
+#line 6750 "parser.cpp"
     break;
 
-  case 348: /* index_param_list: index_param  */
-#line 2741 "parser.y"
+  case 351: /* index_param_list: index_param  */
+#line 2805 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 6667 "parser.cpp"
+#line 6759 "parser.cpp"
     break;
 
-  case 349: /* index_param_list: index_param_list ',' index_param  */
-#line 2745 "parser.y"
+  case 352: /* index_param_list: index_param_list ',' index_param  */
+#line 2809 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 6676 "parser.cpp"
+#line 6768 "parser.cpp"
     break;
 
-  case 350: /* index_param: IDENTIFIER  */
-#line 2750 "parser.y"
+  case 353: /* index_param: IDENTIFIER  */
+#line 2814 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6686 "parser.cpp"
+#line 6778 "parser.cpp"
     break;
 
-  case 351: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2755 "parser.y"
+  case 354: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2819 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6695,11 +6787,11 @@ yyreduce:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6699 "parser.cpp"
+#line 6791 "parser.cpp"
     break;
 
-  case 352: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2763 "parser.y"
+  case 355: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 2827 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6707,11 +6799,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 6711 "parser.cpp"
+#line 6803 "parser.cpp"
     break;
 
-  case 353: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2770 "parser.y"
+  case 356: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 2834 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6719,11 +6811,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 6723 "parser.cpp"
+#line 6815 "parser.cpp"
     break;
 
-  case 354: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2781 "parser.y"
+  case 357: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2845 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6772,11 +6864,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6776 "parser.cpp"
+#line 6868 "parser.cpp"
     break;
 
-  case 355: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2829 "parser.y"
+  case 358: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2893 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6826,11 +6918,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6830 "parser.cpp"
+#line 6922 "parser.cpp"
     break;
 
-  case 356: /* index_info_list: '(' identifier_array ')'  */
-#line 2878 "parser.y"
+  case 359: /* index_info_list: '(' identifier_array ')'  */
+#line 2942 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -6844,11 +6936,11 @@ yyreduce:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 6848 "parser.cpp"
+#line 6940 "parser.cpp"
     break;
 
 
-#line 6852 "parser.cpp"
+#line 6944 "parser.cpp"
 
       default: break;
     }
@@ -7077,7 +7169,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 2892 "parser.y"
+#line 2956 "parser.y"
 
 
 void
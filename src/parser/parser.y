@@ -771,6 +771,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | EMBEDDING '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | EMBEDDING '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | EMBEDDING '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types are not keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "float16") == 0 or strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 | VECTOR '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemBit}; }
 | VECTOR '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt8}; }
 | VECTOR '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt16}; }
@@ -779,6 +795,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | VECTOR '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | VECTOR '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | VECTOR '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| VECTOR '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // half precision element types are not keywords
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "float16") == 0 or strcmp($3, "half") == 0) {
+        elem_type = infinity::kElemFloat16;
+    } else if (strcmp($3, "bfloat16") == 0) {
+        elem_type = infinity::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unknown embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 /*
 | DECIMAL opt_decimal_specification {
   $$ = infinity::ColumnType{DataType::DECIMAL, 0, $2->first, $2->second};
@@ -938,6 +970,11 @@ explain_statement : EXPLAIN explain_type explainable_statement {
     $$->type_ = $2;
     $$->statement_ = $3;
 }
+| EXPLAIN explainable_statement {
+    $$ = new infinity::ExplainStatement();
+    $$->type_ = infinity::ExplainType::kPhysical;
+    $$->statement_ = $2;
+}
 
 explain_type: ANALYZE {
     $$ = infinity::ExplainType::kAnalyze;
@@ -960,9 +997,6 @@ explain_type: ANALYZE {
 | FRAGMENT {
     $$ = infinity::ExplainType::kFragment;
 }
-| {
-    $$ = infinity::ExplainType::kPhysical;
-}
 
 /*
  * UPDATE STATEMENT
@@ -1779,6 +1813,17 @@ command_statement: USE IDENTIFIER {
         free($3->table_name_ptr_);
     } delete $3;
 }
+| ANALYZE table_name {
+    $$ = new infinity::CommandStatement();
+    if ($2->schema_name_ptr_ != nullptr) {
+        $$->command_info_ = std::make_unique<infinity::AnalyzeTable>(std::string($2->schema_name_ptr_), std::string($2->table_name_ptr_));
+        free($2->schema_name_ptr_);
+        free($2->table_name_ptr_);
+    } else {
+        $$->command_info_ = std::make_unique<infinity::AnalyzeTable>(std::string($2->table_name_ptr_));
+        free($2->table_name_ptr_);
+    } delete $2;
+}
 
 /*
  * EXPRESSION
@@ -1912,6 +1957,25 @@ knn_expr : KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')'
         free($7);
         free($9);
         delete $5;
+    } else if((strcmp($7, "float16") == 0 or strcmp($7, "bfloat16") == 0) and knn_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
+        // stored as the raw 16 bits, narrowed from the double or integer literals
+        bool is_bfloat16 = strcmp($7, "bfloat16") == 0;
+        knn_expr->embedding_data_type_ = is_bfloat16 ? infinity::EmbeddingDataType::kElemBFloat16 : infinity::EmbeddingDataType::kElemFloat16;
+        std::vector<float> values;
+        for(double v : $5->double_array_) {
+            values.push_back(v);
+        }
+        for(long v : $5->long_array_) {
+            values.push_back(v);
+        }
+        knn_expr->dimension_ = values.size();
+        knn_expr->embedding_data_ptr_ = new int16_t[knn_expr->dimension_];
+        for(long i = 0; i < knn_expr->dimension_; ++ i) {
+            ((uint16_t*)(knn_expr->embedding_data_ptr_))[i] = is_bfloat16 ? infinity::bfloat16_t(values[i]).raw : infinity::float16_t(values[i]).raw;
+        }
+        free($7);
+        free($9);
+        delete $5;
     } else if(strcmp($7, "tinyint") == 0 and knn_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
         knn_expr->dimension_ = $5->long_array_.size();
         knn_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt8;
@@ -1967,11 +2031,11 @@ knn_expr : KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')'
                 char embedding_unit = 0;
                 for(long bit_idx = 0; bit_idx < 8; ++ bit_idx) {
                     if($5->long_array_[i * 8 + bit_idx] == 1) {
-                        char temp = embedding_unit << 1;
-                        temp &= 1;
-                        embedding_unit = temp;
+                        // bits are packed from the most significant bit of each byte,
+                        // the same layout as a bit embedding column
+                        embedding_unit |= (1 << (7 - bit_idx));
                     } else if($5->long_array_[i * 8 + bit_idx] == 0) {
-                        embedding_unit <<= 0;
+                        // bit stays zero
                     } else {
                         for (auto* param_ptr: *$13) {
                             delete param_ptr;
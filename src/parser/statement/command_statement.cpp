@@ -21,6 +21,7 @@ std::string SetCmd::ToString() const { return "Set Command"; }
 std::string ExportCmd::ToString() const { return "Export Command"; }
 std::string CheckTable::ToString() const { return "Check Table Command"; }
 std::string CompactTable::ToString() const { return "Compact Table Command"; }
+std::string AnalyzeTable::ToString() const { return "Analyze Table Command"; }
 std::string CommandStatement::ToString() const { return command_info_->ToString(); }
 
 } // namespace infinity
\ No newline at end of file
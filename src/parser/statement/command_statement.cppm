@@ -31,5 +31,6 @@ export using infinity::UseCmd;
 export using infinity::CheckTable;
 export using infinity::ExportCmd;
 export using infinity::CompactTable;
+export using infinity::AnalyzeTable;
 
 }
@@ -28,6 +28,7 @@ enum class CommandType {
     kExport,
     kCheckTable,
     kCompactTable,
+    kAnalyzeTable,
 };
 
 class CommandInfo {
@@ -170,6 +171,21 @@ public:
     std::string table_name_;
 };
 
+class AnalyzeTable final : public CommandInfo {
+public:
+    explicit AnalyzeTable(std::string &&schema_name, std::string &&table_name)
+        : CommandInfo(CommandType::kAnalyzeTable), schema_name_(std::move(schema_name)), table_name_(std::move(table_name)) {}
+
+    explicit AnalyzeTable(std::string &&table_name) : CommandInfo(CommandType::kAnalyzeTable), table_name_(std::move(table_name)) {}
+
+    std::string ToString() const final;
+
+public:
+    std::string schema_name_{};
+
+    std::string table_name_;
+};
+
 class CommandStatement final : public BaseStatement {
 public:
     CommandStatement() : BaseStatement(StatementType::kCommand) {}
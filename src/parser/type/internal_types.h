@@ -17,6 +17,8 @@
 
 #include "type/number/huge_int.h"
 #include "type/number/decimal_type.h"
+#include "type/number/float16.h"
+#include "type/number/bfloat16.h"
 #include "type/datetime/date_type.h"
 #include "type/datetime/time_type.h"
 #include "type/datetime/datetime_type.h"
@@ -49,6 +51,8 @@ using HugeIntT = HugeInt;
 
 using FloatT = float;
 using DoubleT = double;
+using Float16T = float16_t;
+using BFloat16T = bfloat16_t;
 
 using DecimalT = DecimalType;
 
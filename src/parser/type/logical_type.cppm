@@ -21,5 +21,6 @@ export module logical_type;
 namespace infinity {
 
 export using infinity::LogicalType;
+export using infinity::LogicalType2Str;
 
 }
\ No newline at end of file
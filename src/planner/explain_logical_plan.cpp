@@ -76,6 +76,9 @@ import join_reference;
 import statement_common;
 import flush_statement;
 import optimize_statement;
+import base_table_ref;
+import block_index;
+import default_values;
 
 namespace infinity {
 
@@ -817,6 +820,15 @@ void ExplainLogicalPlan::Explain(const LogicalIndexScan *index_scan_node, Shared
     Explain(index_scan_node->index_filter_qualified_.get(), filter_str);
     result->emplace_back(MakeShared<String>(filter_str));
 
+    if (!index_scan_node->scan_segment_ids_.empty()) {
+        String strategy_str = String(intent_size, ' ');
+        strategy_str += fmt::format(" - column scan segments: {} of {} (estimated selectivity above {})",
+                                    index_scan_node->scan_segment_ids_.size(),
+                                    index_scan_node->base_table_ref_->block_index_->SegmentCount(),
+                                    INDEX_SCAN_MAX_SELECTIVITY);
+        result->emplace_back(MakeShared<String>(strategy_str));
+    }
+
     // Output columns
     String output_columns = String(intent_size, ' ');
     output_columns += " - output columns: [";
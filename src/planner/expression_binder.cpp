@@ -463,6 +463,12 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_k
                                                              parsed_knn_expr.dimension_,
                                                              embedding_info->Dimension())));
         }
+        // the scan reads the column with the element type of the query embedding
+        if (embedding_info->Type() != parsed_knn_expr.embedding_data_type_) {
+            RecoverableError(Status::SyntaxError(fmt::format("Query embedding with element type: {} which doesn't not matched with {}",
+                                                             EmbeddingT::EmbeddingDataType2String(parsed_knn_expr.embedding_data_type_),
+                                                             EmbeddingT::EmbeddingDataType2String(embedding_info->Type()))));
+        }
     }
 
     arguments.emplace_back(expr_ptr);
@@ -658,6 +658,7 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
                                              fmt::format("{}_{}", create_index_info->table_name_, *index_name),
                                              {index_info->column_name_},
                                              *(index_info->index_param_list_));
+            static_cast<const IndexHnsw *>(base_index_ptr.get())->ValidateColumnElementType(base_table_ref, index_info->column_name_);
             break;
         }
         case IndexType::kIVFFlat: {
@@ -960,6 +961,21 @@ Status LogicalPlanner::BuildCommand(const CommandStatement *statement, SharedPtr
             this->logical_plan_ = logical_command;
             break;
         }
+        case CommandType::kAnalyzeTable: {
+            auto *analyze_table = static_cast<AnalyzeTable *>(command_statement->command_info_.get());
+            BindSchemaName(analyze_table->schema_name_);
+
+            Txn *txn = query_context_ptr_->GetTxn();
+            auto [table_entry, status] = txn->GetTableByName(analyze_table->schema_name_, analyze_table->table_name_);
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            auto logical_command = MakeShared<LogicalCommand>(bind_context_ptr->GetNewLogicalNodeId(), std::move(command_statement->command_info_));
+            logical_command->table_entry_ = table_entry;
+
+            this->logical_plan_ = logical_command;
+            break;
+        }
         default: {
             UnrecoverableError("Invalid command type.");
         }
@@ -104,6 +104,11 @@ String LogicalCommand::ToString(i64 &space) const {
             ss << String(space, ' ') << arrow_str << "Compact table: " << compact_table_info->schema_name_ << " " << compact_table_info->table_name_;
             break;
         }
+        case CommandType::kAnalyzeTable: {
+            auto *analyze_table_info = static_cast<AnalyzeTable *>(command_info_.get());
+            ss << String(space, ' ') << arrow_str << "Analyze table: " << analyze_table_info->schema_name_ << " " << analyze_table_info->table_name_;
+            break;
+        }
         case CommandType::kInvalid: {
             UnrecoverableError("Invalid command type.");
         }
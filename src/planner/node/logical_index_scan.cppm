@@ -29,6 +29,7 @@ import data_type;
 import table_entry;
 import table_index_entry;
 import fast_rough_filter;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -40,6 +41,7 @@ public:
                               HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                               Vector<FilterExecuteElem> &&filter_execute_command,
                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                              HashSet<SegmentID> &&scan_segment_ids,
                               bool add_row_id = true);
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
@@ -68,6 +70,12 @@ public:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
+    // segments in which the filter is evaluated on the column data instead of the index, chosen by estimated selectivity
+    HashSet<SegmentID> scan_segment_ids_;
+
+    // set when the scan feeds an ORDER BY ... LIMIT on one of its columns
+    SharedPtr<TopNThreshold> top_n_threshold_;
+
     bool add_row_id_;
 };
 
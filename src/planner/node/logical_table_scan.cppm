@@ -24,6 +24,7 @@ import table_entry;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import top_n_threshold;
 
 export module logical_table_scan;
 
@@ -53,6 +54,9 @@ public:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
+    // set when the scan feeds an ORDER BY ... LIMIT on one of its columns
+    SharedPtr<TopNThreshold> top_n_threshold_;
+
     bool add_row_id_;
 };
 
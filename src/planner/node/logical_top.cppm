@@ -26,6 +26,7 @@ import base_table_ref;
 import internal_types;
 import select_statement;
 import data_type;
+import top_n_threshold;
 
 namespace infinity {
 
@@ -56,6 +57,8 @@ public:
     SharedPtr<BaseExpression> offset_expression_{};
     Vector<SharedPtr<BaseExpression>> sort_expressions_{};
     Vector<OrderType> order_by_types_{};
+    // shared with the scan below when the first sort expression is a column of the scanned table
+    SharedPtr<TopNThreshold> top_n_threshold_{};
 };
 
 } // namespace infinity
@@ -22,6 +22,7 @@ import column_pruner;
 import lazy_load;
 import secondary_index_scan_builder;
 import apply_fast_rough_filter;
+import top_n_push_down;
 import explain_logical_plan;
 import optimizer_rule;
 import bound_delete_statement;
@@ -39,6 +40,7 @@ Optimizer::Optimizer(QueryContext *query_context_ptr) : query_context_ptr_(query
     // TODO: need an equivalent expression optimizer
     AddRule(MakeUnique<ApplyFastRoughFilter>());      // put it before SecondaryIndexScanBuilder
     AddRule(MakeUnique<SecondaryIndexScanBuilder>()); // put it before ColumnPruner
+    AddRule(MakeUnique<TopNPushDown>());              // put it after SecondaryIndexScanBuilder
     AddRule(MakeUnique<ColumnPruner>());
     AddRule(MakeUnique<LazyLoad>());
     AddRule(MakeUnique<ColumnRemapper>());
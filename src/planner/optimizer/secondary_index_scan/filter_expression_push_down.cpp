@@ -46,6 +46,7 @@ import value;
 import column_vector;
 import filter_expression_push_down_helper;
 import table_index_meta;
+import like_matcher;
 
 namespace infinity {
 
@@ -219,6 +220,8 @@ private:
     SharedPtr<BaseExpression> index_filter_qualified_;
     SharedPtr<BaseExpression> extra_leftover_filter_;
     Vector<FilterExecuteElem> filter_execute_command_;
+    // set when a LIKE is rewritten to a range wider than the rows it matches
+    bool like_rewrite_inexact_ = false;
 
 public:
     IndexScanFilterExpressionPushDownMethod(QueryContext *query_context, const BaseTableRef &base_table_ref)
@@ -274,8 +277,13 @@ private:
 
     inline void FindIndexFilterCandidates() {
         for (auto &expression : flatten_and_subexpressions_) {
+            like_rewrite_inexact_ = false;
             if (auto new_expr = RewriteForIndexScan(expression); new_expr) {
                 index_filter_candidates_.emplace_back(std::move(new_expr));
+                if (like_rewrite_inexact_) {
+                    // the index scan only narrows down the rows, the LIKE is still evaluated on them
+                    index_filter_leftover_.emplace_back(expression);
+                }
             } else {
                 index_filter_leftover_.emplace_back(std::move(expression));
             }
@@ -392,6 +400,8 @@ private:
                                               function_expression->Name()));
                         return nullptr;
                     }
+                } else if (f_name == "like") {
+                    return RewriteLikeForIndexScan(function_expression, sub_expr_depth);
                 } else {
                     // unsupported compare function
                     LOG_TRACE(fmt::format("Expression depth: {}. Unsupported filter function for index scan: {}.",
@@ -421,6 +431,58 @@ private:
         }
     }
 
+    // "x LIKE 'abc%'" on a varchar column with a secondary index scans the range ['abc', 'abd') of the index.
+    // Patterns with more than a literal prefix get the same range, and the LIKE is kept as a leftover filter.
+    inline SharedPtr<BaseExpression> RewriteLikeForIndexScan(const SharedPtr<FunctionExpression> &expression, u32 sub_expr_depth) {
+        const SharedPtr<BaseExpression> &column_expr = expression->arguments()[0];
+        const SharedPtr<BaseExpression> &pattern_expr = expression->arguments()[1];
+        if (column_expr->type() != ExpressionType::kColumn || pattern_expr->type() != ExpressionType::kValue) {
+            LOG_TRACE(fmt::format("Expression depth: {}. LIKE needs a column and a constant pattern for index scan: {}.",
+                                  sub_expr_depth,
+                                  expression->Name()));
+            return nullptr;
+        }
+        auto column_id = std::static_pointer_cast<ColumnExpression>(column_expr)->binding().column_idx;
+        if (!candidate_column_index_map_.contains(column_id)) {
+            return nullptr;
+        }
+        LikeMatcher matcher(std::static_pointer_cast<ValueExpression>(pattern_expr)->GetValue().GetVarchar());
+        const String &begin = matcher.literal_prefix();
+        if (begin.empty()) {
+            LOG_TRACE(fmt::format("Expression depth: {}. LIKE pattern has no literal prefix: {}.", sub_expr_depth, expression->Name()));
+            return nullptr;
+        }
+        if (matcher.type() == LikeMatcherType::kExact) {
+            return MakeBinaryFunctionExpression("=", column_expr, MakeShared<ValueExpression>(Value::MakeVarchar(begin)));
+        }
+        if (matcher.type() != LikeMatcherType::kPrefix) {
+            like_rewrite_inexact_ = true;
+        }
+        auto range_expr = MakeBinaryFunctionExpression(">=", column_expr, MakeShared<ValueExpression>(Value::MakeVarchar(begin)));
+        // the smallest string after all strings starting with begin, in the char order used by varchar comparison
+        String end = begin;
+        while (!end.empty() && end.back() == std::numeric_limits<char>::max()) {
+            end.pop_back();
+        }
+        if (!end.empty()) {
+            ++end.back();
+            auto end_expr = MakeBinaryFunctionExpression("<", column_expr, MakeShared<ValueExpression>(Value::MakeVarchar(end)));
+            range_expr = MakeBinaryFunctionExpression("AND", std::move(range_expr), std::move(end_expr));
+        }
+        return range_expr;
+    }
+
+    inline SharedPtr<BaseExpression>
+    MakeBinaryFunctionExpression(const String &func_name, SharedPtr<BaseExpression> left, SharedPtr<BaseExpression> right) const {
+        Vector<SharedPtr<BaseExpression>> arguments;
+        arguments.emplace_back(std::move(left));
+        arguments.emplace_back(std::move(right));
+        auto function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), func_name);
+        auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
+        ScalarFunction func = scalar_function_set_ptr->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(func), std::move(arguments));
+    }
+
     inline void PrepareResult() {
         auto and_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "AND");
         auto and_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(and_function_set_ptr);
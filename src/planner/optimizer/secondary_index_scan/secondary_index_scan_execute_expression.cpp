@@ -36,6 +36,7 @@ concept IncompatibleFilterIntervalRangePair = (not std::same_as<T1, T2>) or std:
 class FilterCommandBuilder {
 private:
     // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue
+    // and kLess, kGreater for varchar columns
     // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr
     const Vector<FilterEvaluatorElem> &filter_evaluator_;
     Vector<FilterExecuteElem> result_;
@@ -82,6 +83,10 @@ private:
                 result.SetIntervalRange<TimestampT>(value, compare_type);
                 break;
             }
+            case LogicalType::kVarchar: {
+                result.SetIntervalRange<VarcharT>(value, compare_type);
+                break;
+            }
             default: {
                 UnrecoverableError(fmt::format("SaveToResult(): type error: {}.", value.type().ToString()));
             }
@@ -96,10 +101,13 @@ private:
                 return;
             }
             case FilterCompareType::kEqual:
+            case FilterCompareType::kLess:
             case FilterCompareType::kLessEqual:
+            case FilterCompareType::kGreater:
             case FilterCompareType::kGreaterEqual:
             case FilterCompareType::kAlwaysTrue: {
                 // step 2. set interval range for kEqual, kLessEqual, kGreaterEqual and kAlwaysTrue
+                // kLess and kGreater are only kept for varchar
                 auto &result_variant = result_.emplace_back(std::in_place_index<1>, column_id, FilterRangeType::kInterval);
                 auto &result = std::get<FilterExecuteSingleRange>(result_variant);
                 SetResultIntervalValue(result, value, compare_type);
@@ -46,6 +46,9 @@ public:
         AddFilter(val_, compare_type);
     }
 
+    // [begin_val, end_val] of index keys
+    explicit FilterIntervalRangeT(T begin_val, T end_val) : begin_val_(begin_val), end_val_(end_val) {}
+
     [[nodiscard]] bool MergeAnd(const FilterIntervalRangeT &other) {
         AddLE(other.end_val_);
         AddGE(other.begin_val_);
@@ -103,6 +106,97 @@ private:
     }
 };
 
+// varchar keys are searched in the sorted dictionary of each segment, so the range keeps the bounds as strings
+// "<" and ">" can't be rewritten into "<=" and ">=" for strings, so the bounds can be exclusive
+export template <>
+class FilterIntervalRangeT<VarcharT> {
+public:
+    explicit FilterIntervalRangeT(const Value &val, FilterCompareType compare_type) {
+        const String &str = val.GetVarchar();
+        switch (compare_type) {
+            case FilterCompareType::kLess: {
+                AddEnd(str, false);
+                break;
+            }
+            case FilterCompareType::kLessEqual: {
+                AddEnd(str, true);
+                break;
+            }
+            case FilterCompareType::kGreater: {
+                AddBegin(str, false);
+                break;
+            }
+            case FilterCompareType::kGreaterEqual: {
+                AddBegin(str, true);
+                break;
+            }
+            case FilterCompareType::kEqual: {
+                AddBegin(str, true);
+                AddEnd(str, true);
+                break;
+            }
+            case FilterCompareType::kAlwaysTrue: {
+                // default to all strings
+                break;
+            }
+            default: {
+                UnrecoverableError("FilterIntervalRangeT<VarcharT>: compare type error.");
+            }
+        }
+    }
+
+    [[nodiscard]] bool MergeAnd(const FilterIntervalRangeT &other) {
+        if (other.range_.begin_val_) {
+            AddBegin(*other.range_.begin_val_, other.range_.begin_inclusive_);
+        }
+        if (other.range_.end_val_) {
+            AddEnd(*other.range_.end_val_, other.range_.end_inclusive_);
+        }
+        return !IsEmptyRange();
+    }
+
+    [[nodiscard]] const VarcharKeyRange &GetRange() const { return range_; }
+
+    inline void SetAlwaysFalse() {
+        // ["", "")
+        range_.begin_val_ = String();
+        range_.begin_inclusive_ = true;
+        range_.end_val_ = String();
+        range_.end_inclusive_ = false;
+    }
+
+private:
+    VarcharKeyRange range_;
+
+    inline void AddBegin(const String &val, bool inclusive) {
+        if (!range_.begin_val_ or VarcharKeyLess{}(*range_.begin_val_, val)) {
+            range_.begin_val_ = val;
+            range_.begin_inclusive_ = inclusive;
+        } else if (*range_.begin_val_ == val) {
+            range_.begin_inclusive_ = range_.begin_inclusive_ and inclusive;
+        }
+    }
+
+    inline void AddEnd(const String &val, bool inclusive) {
+        if (!range_.end_val_ or VarcharKeyLess{}(val, *range_.end_val_)) {
+            range_.end_val_ = val;
+            range_.end_inclusive_ = inclusive;
+        } else if (*range_.end_val_ == val) {
+            range_.end_inclusive_ = range_.end_inclusive_ and inclusive;
+        }
+    }
+
+    [[nodiscard]] bool IsEmptyRange() const {
+        if (!range_.begin_val_ or !range_.end_val_) {
+            return false;
+        }
+        if (*range_.begin_val_ == *range_.end_val_) {
+            return !(range_.begin_inclusive_ and range_.end_inclusive_);
+        }
+        return VarcharKeyLess{}(*range_.end_val_, *range_.begin_val_);
+    }
+};
+
 export using FilterIntervalRange = std::variant<std::monostate,
                                                 FilterIntervalRangeT<TinyIntT>,
                                                 FilterIntervalRangeT<SmallIntT>,
@@ -113,7 +207,8 @@ export using FilterIntervalRange = std::variant<std::monostate,
                                                 FilterIntervalRangeT<DateT>,
                                                 FilterIntervalRangeT<TimeT>,
                                                 FilterIntervalRangeT<DateTimeT>,
-                                                FilterIntervalRangeT<TimestampT>>;
+                                                FilterIntervalRangeT<TimestampT>,
+                                                FilterIntervalRangeT<VarcharT>>;
 
 // because some rows may be deleted, kAlwaysTrue is meaningless
 // kInterval of the same column can be merged in "AND" condition
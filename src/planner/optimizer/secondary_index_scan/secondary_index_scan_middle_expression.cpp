@@ -83,6 +83,15 @@ private:
                     auto &right = function_expression->arguments()[1]; // value-expression
                     // 2. right
                     auto right_val = FilterExpressionPushDownHelper::CalcValueResult(right);
+                    if (left->type() == ExpressionType::kColumn and left->Type().type() == LogicalType::kVarchar) {
+                        // varchar column keeps "<" and ">", see FilterIntervalRangeT<VarcharT>
+                        auto column_expression = std::static_pointer_cast<ColumnExpression>(left);
+                        ColumnID column_id = column_expression->binding().column_idx;
+                        result_.emplace_back(column_id);
+                        result_.emplace_back(std::move(right_val));
+                        result_.emplace_back(compare_type);
+                        return true;
+                    }
                     // 1. left, maybe with cast
                     auto [column_id, final_val, final_compare_type] =
                         FilterExpressionPushDownHelper::UnwindCast(left, std::move(right_val), compare_type);
@@ -137,6 +146,7 @@ Vector<FilterEvaluatorElem> BuildSecondaryIndexScanMiddleCommand(SharedPtr<BaseE
     // Use Reverse Polish notation to evaluate the filter
     // For example, the filter "a >= 1 AND a <= 2" will be converted to "a 1 >= a 2 <= AND"
     // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue
+    // and kLess, kGreater for varchar columns
     // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr
     Vector<FilterEvaluatorElem> filter_evaluator;
     FilterEvaluatorBuilder filter_builder(index_filter_qualified_);
@@ -30,9 +30,99 @@ import infinity_exception;
 import logger;
 import third_party;
 import filter_expression_push_down;
+import secondary_index_scan_execute_expression;
+import filter_value_type_classification;
+import table_index_entry;
+import segment_index_entry;
+import segment_entry;
+import secondary_index_data;
+import buffer_handle;
+import fast_rough_filter;
+import default_values;
+import txn;
+import internal_types;
+import base_table_ref;
+import block_index;
 
 namespace infinity {
 
+namespace {
+
+// fraction of the index keys in the range, from the approximate positions of the bounds in the PGM index
+template <typename T>
+f64 EstimateKeyRange(const SecondaryIndexDataHead *index, T begin_val, T end_val) {
+    if (end_val < begin_val) {
+        return 0.0;
+    }
+    const u32 data_num = index->GetDataNum();
+    auto begin_approx_pos = index->SearchPGM(&begin_val).pos_;
+    auto end_approx_pos = index->SearchPGM(&end_val).pos_;
+    if (end_approx_pos <= begin_approx_pos) {
+        return 0.0;
+    }
+    return std::min<f64>(1.0, static_cast<f64>(end_approx_pos - begin_approx_pos) / data_num);
+}
+
+f64 EstimateSingleRange(const FilterExecuteSingleRange &single_range, const HashMap<ColumnID, TableIndexEntry *> &column_index_map, SegmentID segment_id) {
+    if (single_range.IsEmpty()) {
+        return 0.0;
+    }
+    auto &index_by_segment = column_index_map.at(single_range.GetColumnID())->index_by_segment();
+    auto iter = index_by_segment.find(segment_id);
+    if (iter == index_by_segment.end()) {
+        // no index on this segment
+        return 1.0;
+    }
+    BufferHandle index_handle_head = iter->second->GetIndex();
+    auto index = static_cast<const SecondaryIndexDataHead *>(index_handle_head.GetData());
+    if (index->GetDataNum() == 0) {
+        // all rows are in the in-memory index, which is searched in order
+        return 0.0;
+    }
+    return std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) -> f64 {
+                                   auto [begin_val, end_val] = interval_range.GetRange();
+                                   return EstimateKeyRange(index, begin_val, end_val);
+                               },
+                               [&](const FilterIntervalRangeT<VarcharT> &interval_range) -> f64 {
+                                   auto [begin_ordinal, end_ordinal] = index->SearchDictionary(interval_range.GetRange());
+                                   return EstimateKeyRange(index, begin_ordinal, end_ordinal);
+                               },
+                               [](const std::monostate &) -> f64 { return 1.0; }},
+                      single_range.GetIntervalRange());
+}
+
+// estimated fraction of the rows of the segment selected by the filter command, the conditions are assumed independent
+f64 EstimateSelectivity(const Vector<FilterExecuteElem> &filter_execute_command,
+                        const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
+                        SegmentID segment_id) {
+    Vector<f64> selectivity_stack;
+    for (const auto &elem : filter_execute_command) {
+        std::visit(Overload{[&](FilterExecuteCombineType combine_type) {
+                                if (selectivity_stack.size() < 2) {
+                                    UnrecoverableError("EstimateSelectivity(): filter command stack error.");
+                                }
+                                f64 right = selectivity_stack.back();
+                                selectivity_stack.pop_back();
+                                f64 &left = selectivity_stack.back();
+                                if (combine_type == FilterExecuteCombineType::kAnd) {
+                                    left = left * right;
+                                } else {
+                                    left = left + right - left * right;
+                                }
+                            },
+                            [&](const FilterExecuteSingleRange &single_range) {
+                                selectivity_stack.push_back(EstimateSingleRange(single_range, column_index_map, segment_id));
+                            }},
+                   elem);
+    }
+    if (selectivity_stack.size() != 1) {
+        UnrecoverableError("EstimateSelectivity(): filter command stack error.");
+    }
+    return selectivity_stack.back();
+}
+
+} // namespace
+
 // Different from LogicalNodeVisitor, this visitor accepts shared_ptr<LogicalNode> as input.
 class BuildSecondaryIndexScan {
 public:
@@ -64,7 +154,35 @@ public:
                 if (!v_qualified) {
                     // no qualified index filter condition, keep the table scan
                     LOG_TRACE("BuildSecondaryIndexScan: No qualified index scan filter. Keep the table scan.");
-                } else {
+                    return VisitChildren(op);
+                }
+                // 2. choose index or column scan for each segment from the estimated selectivity
+                HashSet<SegmentID> scan_segment_ids;
+                SizeT candidate_segment_count = 0;
+                const TxnTimeStamp begin_ts = query_context_->GetTxn()->BeginTS();
+                const auto &segment_index = base_table_ref_ptr->block_index_->segment_index_;
+                for (const auto &[segment_id, segment_entry] : segment_index) {
+                    if (fast_rough_filter_evaluator and !fast_rough_filter_evaluator->Evaluate(begin_ts, *segment_entry->GetFastRoughFilter())) {
+                        // the segment will be skipped
+                        continue;
+                    }
+                    if (segment_entry->row_count() < DEFAULT_BLOCK_CAPACITY) {
+                        // cheap either way, and the error of the PGM positions dominates the estimate
+                        continue;
+                    }
+                    ++candidate_segment_count;
+                    f64 selectivity = EstimateSelectivity(filter_execute_command, column_index_map, segment_id);
+                    if (selectivity > INDEX_SCAN_MAX_SELECTIVITY) {
+                        scan_segment_ids.insert(segment_id);
+                    }
+                    LOG_TRACE(fmt::format("BuildSecondaryIndexScan: segment {} estimated selectivity {}", segment_id, selectivity));
+                }
+                if (candidate_segment_count > 0 and scan_segment_ids.size() == candidate_segment_count) {
+                    // the index would not pay off in any segment that is actually read, keep the filtered table scan
+                    LOG_TRACE("BuildSecondaryIndexScan: Index scan filter is not selective. Keep the table scan.");
+                    return VisitChildren(op);
+                }
+                {
                     // try to push down the qualified index filter condition to the scan
                     // replace logical table scan with logical index scan
                     auto index_scan = MakeShared<LogicalIndexScan>(query_context_->GetNextNodeID(),
@@ -73,11 +191,12 @@ public:
                                                                    std::move(column_index_map),
                                                                    std::move(filter_execute_command),
                                                                    std::move(fast_rough_filter_evaluator),
+                                                                   std::move(scan_segment_ids),
                                                                    true);
                     op->set_left_node(std::move(index_scan));
                     LOG_TRACE("BuildSecondaryIndexScan: Push down the qualified index scan filter. Replace table scan with index scan.");
                 }
-                // 2. check the remaining filter expression
+                // 3. check the remaining filter expression
                 if (s_leftover) {
                     // Keep the filter node.
                     filter_expression = std::move(s_leftover);
@@ -94,7 +213,11 @@ public:
             auto &match = static_cast<LogicalMatch &>(*op);
             match.common_query_filter_->TryApplySecondaryIndexFilterOptimizer(query_context_);
         }
-        // visit children after handling current node
+        VisitChildren(op);
+    }
+
+    // visit children after handling current node
+    void VisitChildren(SharedPtr<LogicalNode> &op) {
         VisitNode(op->left_node());
         VisitNode(op->right_node());
     }
@@ -0,0 +1,98 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+module;
+
+module top_n_push_down;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_top;
+import logical_table_scan;
+import logical_index_scan;
+import query_context;
+import base_expression;
+import column_expression;
+import expression_type;
+import logical_type;
+import top_n_threshold;
+import logger;
+import third_party;
+
+namespace infinity {
+
+class TopNPushDownMethod {
+public:
+    static void VisitNode(SharedPtr<LogicalNode> &op) {
+        if (!op) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kTop) {
+            TryPushDown(static_cast<LogicalTop &>(*op));
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    static void TryPushDown(LogicalTop &top) {
+        // the threshold is kept on the first sort key, which has to be a column with min / max filter
+        const auto &sort_expression = top.sort_expressions_[0];
+        if (sort_expression->type() != ExpressionType::kColumn) {
+            return;
+        }
+        const auto &sort_type = sort_expression->Type();
+        if (!sort_type.SupportMinMaxFilter() or sort_type.type() == LogicalType::kVarchar) {
+            return;
+        }
+        // filters between the scan and the top do not change which rows can enter the result
+        LogicalNode *child = top.left_node().get();
+        while (child != nullptr and child->operator_type() == LogicalNodeType::kFilter) {
+            child = child->left_node().get();
+        }
+        if (child == nullptr) {
+            return;
+        }
+        const auto &binding = static_cast<const ColumnExpression &>(*sort_expression).binding();
+        auto threshold = MakeShared<TopNThreshold>(binding.column_idx, top.order_by_types_[0]);
+        switch (child->operator_type()) {
+            case LogicalNodeType::kTableScan: {
+                auto &table_scan = static_cast<LogicalTableScan &>(*child);
+                if (table_scan.TableIndex() != binding.table_idx) {
+                    return;
+                }
+                table_scan.top_n_threshold_ = threshold;
+                break;
+            }
+            case LogicalNodeType::kIndexScan: {
+                auto &index_scan = static_cast<LogicalIndexScan &>(*child);
+                if (index_scan.TableIndex() != binding.table_idx) {
+                    return;
+                }
+                index_scan.top_n_threshold_ = threshold;
+                break;
+            }
+            default: {
+                return;
+            }
+        }
+        LOG_TRACE(fmt::format("TopNPushDown: push down the threshold on column {} into the scan of node {}", sort_expression->Name(), child->node_id()));
+        top.top_n_threshold_ = std::move(threshold);
+    }
+};
+
+void TopNPushDown::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) { TopNPushDownMethod::VisitNode(logical_plan); }
+
+} // namespace infinity
@@ -19,6 +19,7 @@ export module fragment_task;
 import stl;
 import profiler;
 import operator_state;
+import options;
 
 namespace infinity {
 
@@ -63,6 +64,15 @@ public:
 
     [[nodiscard]] inline i64 LastWorkerID() const { return last_worker_id_; }
 
+    inline void SetPriority(QueryPriority priority) { priority_ = priority; }
+
+    [[nodiscard]] inline QueryPriority Priority() const { return priority_; }
+
+    // Set by the scheduler when the task is queued, used for the wait time metrics.
+    inline void SetQueuedTime(std::chrono::steady_clock::time_point queued_time) { queued_time_ = queued_time; }
+
+    [[nodiscard]] inline std::chrono::steady_clock::time_point QueuedTime() const { return queued_time_; }
+
     u64 FragmentId() const;
 
     [[nodiscard]] inline i64 TaskID() const { return task_id_; }
@@ -100,6 +110,8 @@ private:
     void *fragment_context_{};
     bool is_terminator_{false};
     i64 last_worker_id_{-1};
+    QueryPriority priority_{QueryPriority::kInteractive};
+    std::chrono::steady_clock::time_point queued_time_{};
     i64 task_id_{-1};
     i64 operator_count_{0};
 };
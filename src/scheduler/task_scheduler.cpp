@@ -14,7 +14,8 @@
 
 module;
 
-#include <list>
+#include <chrono>
+#include <random>
 #include <sched.h>
 
 module task_scheduler;
@@ -37,6 +38,7 @@ import physical_sink;
 import base_statement;
 import extra_ddl_info;
 import create_statement;
+import options;
 
 namespace infinity {
 
@@ -47,7 +49,6 @@ TaskScheduler::TaskScheduler(const Config *config_ptr) { Init(config_ptr); }
 void TaskScheduler::Init(const Config *config_ptr) {
     worker_count_ = config_ptr->worker_cpu_limit();
     worker_array_.reserve(worker_count_);
-    worker_workloads_.resize(worker_count_);
     u64 cpu_count = Thread::hardware_concurrency();
 
     u64 cpu_select_step = cpu_count / worker_count_;
@@ -57,38 +58,59 @@ void TaskScheduler::Init(const Config *config_ptr) {
         cpu_select_step = 1;
     }
 
-    for (u64 cpu_id = 0; cpu_id < worker_count_; cpu_id += cpu_select_step) {
-        UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>();
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), cpu_id);
-        // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id % cpu_count);
-
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
-        worker_workloads_[cpu_id] = 0;
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        u64 cpu_id = (worker_id * cpu_select_step) % cpu_count;
+        worker_array_.emplace_back(cpu_id, ThreadUtil::numa_node(cpu_id));
     }
-
     if (worker_array_.empty()) {
         UnrecoverableError("No cpu is used in scheduler");
     }
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        Worker &worker = worker_array_[worker_id];
+        for (u64 victim_id = 0; victim_id < worker_count_; ++victim_id) {
+            if (victim_id == worker_id) {
+                continue;
+            }
+            if (worker_array_[victim_id].numa_node_ == worker.numa_node_) {
+                worker.local_victims_.push_back(victim_id);
+            } else {
+                worker.remote_victims_.push_back(victim_id);
+            }
+        }
+    }
+
+    admission_limit_ = std::max(worker_count_ * SCHEDULER_ADMISSION_QUERIES_PER_WORKER, u64(2));
 
     initialized_ = true;
+    // All workers exist before any of them may try to steal.
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        Worker &worker = worker_array_[worker_id];
+        worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_id);
+        // Pin the thread to specific cpu
+        ThreadUtil::pin(*worker.thread_, worker.cpu_id_);
+    }
 }
 
 void TaskScheduler::UnInit() {
-    initialized_ = false;
-    UniquePtr<FragmentTask> terminate_task = MakeUnique<FragmentTask>(true);
+    {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        initialized_ = false;
+    }
+    park_cv_.notify_all();
+    admission_cv_.notify_all();
 
     for (const auto &worker : worker_array_) {
-        worker.queue_->Enqueue(terminate_task.get());
         worker.thread_->join();
     }
 }
 
 u64 TaskScheduler::FindLeastWorkloadWorker() {
-    u64 min_workload = worker_workloads_[0];
+    // Only a hint for the initial placement, idle workers steal queued tasks anyway.
+    u64 min_workload = std::numeric_limits<u64>::max();
     u64 min_workload_worker_id = 0;
-    for (u64 worker_id = 1; worker_id < worker_count_ && min_workload; ++worker_id) {
-        u64 current_worker_load = worker_workloads_[worker_id];
+    for (u64 worker_id = 0; worker_id < worker_count_ && min_workload; ++worker_id) {
+        const Worker &worker = worker_array_[worker_id];
+        u64 current_worker_load = worker.queue_->Size() + (worker.executing_->load() ? 1 : 0);
         if (current_worker_load < min_workload) {
             min_workload = current_worker_load;
             min_workload_worker_id = worker_id;
@@ -115,33 +137,130 @@ SizeT TaskScheduler::GetStartFragments(PlanFragment *plan_fragment, Vector<PlanF
     return all_fragment_n;
 }
 
-void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement) {
-    if (!initialized_) {
-        UnrecoverableError("Scheduler isn't initialized");
-    }
-    // DumpPlanFragment(plan_fragment);
-    bool use_scheduler = false;
-    switch(base_statement->Type()) {
+bool TaskScheduler::UseScheduler(const BaseStatement *base_statement) {
+    switch (base_statement->Type()) {
         case StatementType::kSelect:
         case StatementType::kExplain:
         case StatementType::kDelete:
-        case StatementType::kUpdate:
-        {
-            use_scheduler = true; // continue;
-            break;
+        case StatementType::kUpdate: {
+            return true;
         }
         case StatementType::kCreate: {
             const CreateStatement *create_statement = static_cast<const CreateStatement *>(base_statement);
-            if (create_statement->create_info_->type_ == DDLType::kIndex) {
-                // Create index will generate multiple tasks
-                use_scheduler = true;
-            }
-            break;
+            // Create index will generate multiple tasks
+            return create_statement->create_info_->type_ == DDLType::kIndex;
         }
         default: {
-            ;
+            return false;
+        }
+    }
+}
+
+QueryPriority TaskScheduler::StatementPriority(const BaseStatement *base_statement, QueryPriority session_priority) {
+    if (base_statement->Type() == StatementType::kCreate) {
+        const CreateStatement *create_statement = static_cast<const CreateStatement *>(base_statement);
+        if (create_statement->create_info_->type_ == DDLType::kIndex) {
+            return QueryPriority::kBackground;
+        }
+    }
+    return session_priority;
+}
+
+u64 TaskScheduler::AdmissionLimit(QueryPriority priority) const {
+    switch (priority) {
+        case QueryPriority::kInteractive: {
+            return admission_limit_;
+        }
+        case QueryPriority::kBatch: {
+            return std::max(admission_limit_ * 3 / 4, u64(1));
+        }
+        default: {
+            return std::max(admission_limit_ / 2, u64(1));
+        }
+    }
+}
+
+Status TaskScheduler::Admit(QueryPriority priority) {
+    SizeT class_id = static_cast<SizeT>(priority);
+    std::unique_lock<std::mutex> lock(admission_mutex_);
+    auto can_run = [&] {
+        if (!initialized_) {
+            return true;
+        }
+        if (running_query_count_ >= AdmissionLimit(priority)) {
+            return false;
+        }
+        for (SizeT higher_class_id = 0; higher_class_id < class_id; ++higher_class_id) {
+            if (class_waiting_query_count_[higher_class_id] > 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!can_run()) {
+        u64 waiting_query_count = 0;
+        for (u64 count : class_waiting_query_count_) {
+            waiting_query_count += count;
+        }
+        if (waiting_query_count >= SCHEDULER_ADMISSION_QUEUE_SIZE) {
+            ++class_rejected_query_count_[class_id];
+            return Status::SchedulerBusy(fmt::format("{} statements are waiting for admission", waiting_query_count));
+        }
+        ++class_waiting_query_count_[class_id];
+        bool admitted = admission_cv_.wait_for(lock, std::chrono::milliseconds(SCHEDULER_ADMISSION_TIMEOUT_MS), can_run);
+        --class_waiting_query_count_[class_id];
+        if (!admitted) {
+            ++class_rejected_query_count_[class_id];
+            // lower classes may have been waiting behind this statement
+            admission_cv_.notify_all();
+            return Status::SchedulerBusy(
+                fmt::format("{} statement waited {} ms for admission", QueryPriority2String(priority), SCHEDULER_ADMISSION_TIMEOUT_MS));
         }
     }
+    if (!initialized_) {
+        return Status::SchedulerBusy("scheduler is stopped");
+    }
+    ++running_query_count_;
+    ++class_running_query_count_[class_id];
+    return Status::OK();
+}
+
+void TaskScheduler::Release(QueryPriority priority) {
+    {
+        std::lock_guard<std::mutex> lock(admission_mutex_);
+        --running_query_count_;
+        --class_running_query_count_[static_cast<SizeT>(priority)];
+    }
+    admission_cv_.notify_all();
+}
+
+TaskSchedulerMetrics TaskScheduler::Metrics() const {
+    TaskSchedulerMetrics metrics;
+    metrics.admission_limit_ = admission_limit_;
+    for (SizeT class_id = 0; class_id < QUERY_PRIORITY_COUNT; ++class_id) {
+        const PriorityClassCounter &counter = class_counters_[class_id];
+        PriorityClassMetrics &class_metrics = metrics.classes_[class_id];
+        class_metrics.queued_task_count_ = counter.queued_task_count_.load();
+        class_metrics.dispatched_task_count_ = counter.dispatched_task_count_.load();
+        class_metrics.total_wait_us_ = counter.total_wait_us_.load();
+        class_metrics.max_wait_us_ = counter.max_wait_us_.load();
+    }
+    std::lock_guard<std::mutex> lock(admission_mutex_);
+    for (SizeT class_id = 0; class_id < QUERY_PRIORITY_COUNT; ++class_id) {
+        PriorityClassMetrics &class_metrics = metrics.classes_[class_id];
+        class_metrics.running_query_count_ = class_running_query_count_[class_id];
+        class_metrics.waiting_query_count_ = class_waiting_query_count_[class_id];
+        class_metrics.rejected_query_count_ = class_rejected_query_count_[class_id];
+    }
+    return metrics;
+}
+
+void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement, QueryPriority priority) {
+    if (!initialized_) {
+        UnrecoverableError("Scheduler isn't initialized");
+    }
+    // DumpPlanFragment(plan_fragment);
+    bool use_scheduler = UseScheduler(base_statement);
 
     if(!use_scheduler) {
         if (!plan_fragment->HasChild()) {
@@ -157,6 +276,17 @@ void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *b
         }
     }
 
+    // the tasks of the fragments scheduled later inherit the priority as well
+    std::function<void(PlanFragment *)> SetFragmentPriority = [&](PlanFragment *fragment) {
+        for (auto &task : fragment->GetContext()->Tasks()) {
+            task->SetPriority(priority);
+        }
+        for (auto &child : fragment->Children()) {
+            SetFragmentPriority(child.get());
+        }
+    };
+    SetFragmentPriority(plan_fragment);
+
     Vector<PlanFragment *> start_fragments;
     SizeT task_n = GetStartFragments(plan_fragment, start_fragments);
     plan_fragment->GetContext()->notifier()->SetTaskN(task_n);
@@ -213,71 +343,106 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
 }
 
 void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
-    ++worker_workloads_[worker_id];
-    worker_array_[worker_id].queue_->Enqueue(task);
+    // counted before it becomes visible, so the counter never drops below the real number of queued tasks
+    ++queued_task_count_;
+    ++class_counters_[static_cast<SizeT>(task->Priority())].queued_task_count_;
+    task->SetQueuedTime(std::chrono::steady_clock::now());
+    worker_array_[worker_id].queue_->Push(task);
+    if (idle_worker_count_ > 0) {
+        // the lock orders the wakeup after the predicate check of a parking worker
+        { std::lock_guard<std::mutex> lock(park_mutex_); }
+        park_cv_.notify_one();
+    }
 }
 
-void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
-    List<FragmentTask *> task_lists;
-    auto iter = task_lists.end();
-    auto last_iter = task_lists.end();
-    while (true) {
-        if (iter == last_iter) {
-            Vector<FragmentTask *> dequeue_output;
-            if (task_lists.empty()) {
-                task_queue->DequeueBulk(dequeue_output);
-            } else {
-                task_queue->TryDequeueBulk(dequeue_output);
-            }
-            if (!dequeue_output.empty()) {
-                task_lists.insert(task_lists.end(), dequeue_output.begin(), dequeue_output.end());
-            }
-            last_iter = task_lists.end();
+bool TaskScheduler::NextTask(u64 worker_id, std::mt19937 &rand_gen, FragmentTask *&task) {
+    if (worker_array_[worker_id].queue_->Pop(task) || StealTask(worker_id, rand_gen, task)) {
+        --queued_task_count_;
+        PriorityClassCounter &counter = class_counters_[static_cast<SizeT>(task->Priority())];
+        --counter.queued_task_count_;
+        ++counter.dispatched_task_count_;
+        u64 wait_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task->QueuedTime()).count();
+        counter.total_wait_us_ += wait_us;
+        u64 max_wait_us = counter.max_wait_us_.load();
+        while (wait_us > max_wait_us && !counter.max_wait_us_.compare_exchange_weak(max_wait_us, wait_us)) {
         }
-        if (iter == task_lists.end()) {
-            iter = task_lists.begin();
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::StealTask(u64 worker_id, std::mt19937 &rand_gen, FragmentTask *&task) {
+    const Worker &worker = worker_array_[worker_id];
+    for (const Vector<u64> *victims : {&worker.local_victims_, &worker.remote_victims_}) {
+        SizeT victim_count = victims->size();
+        if (victim_count == 0) {
+            continue;
         }
-        auto &fragment_task = *iter;
-        if (fragment_task->IsTerminator()) {
-            break;
+        SizeT start = rand_gen() % victim_count;
+        for (SizeT i = 0; i < victim_count; ++i) {
+            u64 victim_id = (*victims)[(start + i) % victim_count];
+            if (worker_array_[victim_id].queue_->Steal(task)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool TaskScheduler::ParkWorker() {
+    std::unique_lock<std::mutex> lock(park_mutex_);
+    ++idle_worker_count_;
+    park_cv_.wait(lock, [this] { return queued_task_count_ > 0 || !initialized_; });
+    --idle_worker_count_;
+    return initialized_;
+}
+
+void TaskScheduler::WorkerLoop(u64 worker_id) {
+    Worker &worker = worker_array_[worker_id];
+    std::mt19937 rand_gen(worker_id + 1);
+    while (initialized_) {
+        FragmentTask *fragment_task = nullptr;
+        if (!NextTask(worker_id, rand_gen, fragment_task)) {
+            if (!ParkWorker()) {
+                break;
+            }
+            continue;
         }
         auto *fragment_ctx = fragment_task->fragment_context();
         if (!fragment_ctx->notifier()->StartTask()) {
-            --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
             continue;
         }
 
+        worker.executing_->store(true);
         fragment_task->OnExecute();
         fragment_task->SetLastWorkID(worker_id);
+        worker.executing_->store(false);
 
         bool error = false;
         bool finish = false;
+        bool requeue = false;
 
         if (fragment_task->status() != FragmentTaskStatus::kError) {
             if (fragment_task->IsComplete()) {
                 // auto *sink_op = fragment_ctx->GetSinkOperator();
-                --worker_workloads_[worker_id];
                 fragment_task->CompleteTask();
-                iter = task_lists.erase(iter);
                 finish = true;
-            } else if (fragment_task->QuitFromWorkerLoop()) {
-                --worker_workloads_[worker_id];
-                iter = task_lists.erase(iter);
-            } else {
-                ++iter;
+            } else if (!fragment_task->QuitFromWorkerLoop()) {
+                // Unfinished tasks go to the tail, so the other queued tasks run first and idle workers may steal it.
+                requeue = true;
             }
         } else {
             error = true;
             finish = true;
-            --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
         }
         if (finish || error) {
             fragment_ctx->notifier()->FinishTask(error, fragment_ctx);
         } else {
             fragment_ctx->notifier()->UnstartTask();
         }
+        if (requeue) {
+            ScheduleTask(fragment_task, worker_id);
+        }
     }
 }
 
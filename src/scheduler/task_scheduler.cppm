@@ -19,22 +19,110 @@ export module task_scheduler;
 import config;
 import stl;
 import fragment_task;
-import blocking_queue;
 import base_statement;
+import options;
+import status;
+import default_values;
 
 namespace infinity {
 
 class QueryContext;
 class PlanFragment;
 
-using FragmentTaskBlockQueue = BlockingQueue<FragmentTask*>;
+// Tasks queued on one worker, one deque per priority class. The owner takes tasks from the head and requeues its
+// unfinished tasks at the tail. Idle workers steal from the head as well, the task waiting longest is the one that
+// hurts tail latency most.
+// The class is chosen by weighted round robin: every class may dispatch `weight` tasks per round, a round ends when
+// no class with queued tasks has credit left. So background tasks are slowed down but never starve.
+class WorkerTaskDeque {
+public:
+    WorkerTaskDeque() { credits_ = weights_; }
+
+    void Push(FragmentTask *task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_[static_cast<SizeT>(task->Priority())].push_back(task);
+        ++size_;
+    }
+
+    bool Pop(FragmentTask *&task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return PopInner(task);
+    }
+
+    bool Steal(FragmentTask *&task) {
+        // cheap check without the lock, most victims are empty when the system is idle
+        if (size_.load() == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return PopInner(task);
+    }
+
+    [[nodiscard]] SizeT Size() const { return size_.load(); }
+
+private:
+    bool PopInner(FragmentTask *&task) {
+        if (size_.load() == 0) {
+            return false;
+        }
+        for (SizeT round = 0; round < 2; ++round) {
+            for (SizeT class_id = 0; class_id < QUERY_PRIORITY_COUNT; ++class_id) {
+                if (tasks_[class_id].empty() || credits_[class_id] == 0) {
+                    continue;
+                }
+                --credits_[class_id];
+                task = tasks_[class_id].front();
+                tasks_[class_id].pop_front();
+                --size_;
+                return true;
+            }
+            credits_ = weights_;
+        }
+        return false;
+    }
+
+    static constexpr Array<u64, QUERY_PRIORITY_COUNT> weights_{SCHEDULER_INTERACTIVE_WEIGHT, SCHEDULER_BATCH_WEIGHT, SCHEDULER_BACKGROUND_WEIGHT};
+
+    std::mutex mutex_{};
+    Array<Deque<FragmentTask *>, QUERY_PRIORITY_COUNT> tasks_{};
+    Array<u64, QUERY_PRIORITY_COUNT> credits_{};
+    atomic_u64 size_{0};
+};
+
+// Counters of one priority class, updated without a lock.
+struct PriorityClassCounter {
+    atomic_u64 queued_task_count_{0};
+    atomic_u64 dispatched_task_count_{0};
+    atomic_u64 total_wait_us_{0};
+    atomic_u64 max_wait_us_{0};
+};
+
+export struct PriorityClassMetrics {
+    u64 queued_task_count_{0};
+    u64 dispatched_task_count_{0};
+    // time tasks spent in the worker deques, measured every time a task is dequeued
+    u64 total_wait_us_{0};
+    u64 max_wait_us_{0};
+    u64 running_query_count_{0};
+    u64 waiting_query_count_{0};
+    u64 rejected_query_count_{0};
+};
+
+export struct TaskSchedulerMetrics {
+    u64 admission_limit_{0};
+    Array<PriorityClassMetrics, QUERY_PRIORITY_COUNT> classes_{};
+};
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
-        : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
+    Worker(u64 cpu_id, u32 numa_node) : cpu_id_(cpu_id), numa_node_(numa_node), queue_(MakeUnique<WorkerTaskDeque>()) {}
     u64 cpu_id_{0};
-    UniquePtr<FragmentTaskBlockQueue> queue_{};
+    u32 numa_node_{0};
+    UniquePtr<WorkerTaskDeque> queue_{};
     UniquePtr<Thread> thread_{};
+    // victims on the same numa node are tried before the remote ones
+    Vector<u64> local_victims_{};
+    Vector<u64> remote_victims_{};
+    UniquePtr<atomic_bool> executing_{MakeUnique<atomic_bool>(false)};
 };
 
 export class TaskScheduler {
@@ -48,7 +136,21 @@ public:
     void UnInit();
 
     // Schedule start fragments
-    void Schedule(PlanFragment * plan_fragment_root, const BaseStatement* base_statement);
+    void Schedule(PlanFragment *plan_fragment_root, const BaseStatement *base_statement, QueryPriority priority = QueryPriority::kInteractive);
+
+    // Statements which are executed by the workers, the others run inline in the session thread.
+    static bool UseScheduler(const BaseStatement *base_statement);
+
+    // Index building runs in the background class whatever the session priority is.
+    static QueryPriority StatementPriority(const BaseStatement *base_statement, QueryPriority session_priority);
+
+    // Wait until the statement may run. Higher classes are admitted first and the lower ones may only use part of the
+    // slots, so some are always left to interactive statements. Fails when the admission queue is full or on timeout.
+    Status Admit(QueryPriority priority);
+
+    void Release(QueryPriority priority);
+
+    TaskSchedulerMetrics Metrics() const;
 
     // `plan_fragment` can be scheduled because all of its dependencies are met.
     void ScheduleFragment(PlanFragment *plan_fragment);
@@ -64,15 +166,41 @@ private:
 
     void RunTask(FragmentTask *task);
 
-    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
+    void WorkerLoop(u64 worker_id);
+
+    bool NextTask(u64 worker_id, std::mt19937 &rand_gen, FragmentTask *&task);
+
+    // Randomized stealing, the victims on the same numa node first.
+    bool StealTask(u64 worker_id, std::mt19937 &rand_gen, FragmentTask *&task);
+
+    // Block until some task is queued. Return false when the scheduler is stopped.
+    bool ParkWorker();
+
+    u64 AdmissionLimit(QueryPriority priority) const;
 
 private:
-    bool initialized_{false};
+    atomic_bool initialized_{false};
 
     Vector<Worker> worker_array_{};
-    Deque<Atomic<u64>> worker_workloads_{};
 
     u64 worker_count_{0};
+
+    // tasks waiting in all worker deques
+    atomic_u64 queued_task_count_{0};
+    atomic_u64 idle_worker_count_{0};
+    std::mutex park_mutex_{};
+    std::condition_variable park_cv_{};
+
+    Array<PriorityClassCounter, QUERY_PRIORITY_COUNT> class_counters_{};
+
+    // admission control
+    u64 admission_limit_{0};
+    mutable std::mutex admission_mutex_{};
+    std::condition_variable admission_cv_{};
+    u64 running_query_count_{0};
+    Array<u64, QUERY_PRIORITY_COUNT> class_running_query_count_{};
+    Array<u64, QUERY_PRIORITY_COUNT> class_waiting_query_count_{};
+    Array<u64, QUERY_PRIORITY_COUNT> class_rejected_query_count_{};
 };
 
 } // namespace infinity
@@ -32,6 +32,7 @@ export enum class BGTaskType {
     kForceCheckpoint, // Manually triggered by PhysicalFlush
     kNotifyCompact,
     kNotifyOptimize,
+    kNotifyAnalyze,
     kCleanup,
     kUpdateSegmentBloomFilterData, // Not used
     kInvalid
@@ -51,6 +52,8 @@ export String BGTaskTypeToString(BGTaskType type) {
             return "NotifyCompact";
         case BGTaskType::kNotifyOptimize:
             return "NotifyOptimize";
+        case BGTaskType::kNotifyAnalyze:
+            return "NotifyAnalyze";
         case BGTaskType::kCleanup:
             return "Cleanup";
         case BGTaskType::kUpdateSegmentBloomFilterData:
@@ -177,4 +180,13 @@ public:
     String ToString() const override { return "NotifyOptimizeTask"; }
 };
 
+export class NotifyAnalyzeTask final : public BGTask {
+public:
+    NotifyAnalyzeTask() : BGTask(BGTaskType::kNotifyAnalyze, true) {}
+
+    ~NotifyAnalyzeTask() override = default;
+
+    String ToString() const override { return "NotifyAnalyzeTask"; }
+};
+
 } // namespace infinity
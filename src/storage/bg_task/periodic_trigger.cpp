@@ -64,4 +64,9 @@ void OptimizeIndexPeriodicTrigger::Trigger() {
     compact_processor_->Submit(std::move(optimize_task));
 }
 
+void AnalyzePeriodicTrigger::Trigger() {
+    auto analyze_task = MakeShared<NotifyAnalyzeTask>();
+    compact_processor_->Submit(std::move(analyze_task));
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -98,4 +98,15 @@ private:
     CompactionProcessor *const compact_processor_{};
 };
 
+export class AnalyzePeriodicTrigger final : public PeriodicTrigger {
+public:
+    explicit AnalyzePeriodicTrigger(std::chrono::seconds interval, CompactionProcessor *compact_processor)
+        : PeriodicTrigger(interval), compact_processor_(compact_processor) {}
+
+    virtual void Trigger() override;
+
+private:
+    CompactionProcessor *const compact_processor_{};
+};
+
 } // namespace infinity
@@ -134,12 +134,30 @@ void BufferManager::RequestSpace(SizeT need_size) {
             ++iter;
         }
     }
+    if (current_memory_size_ + need_size > memory_limit_ && space_reclaimer_) {
+        space_reclaimer_(current_memory_size_ + need_size - memory_limit_);
+    }
     if (current_memory_size_ + need_size > memory_limit_) {
         UnrecoverableError("Out of memory.");
     }
     current_memory_size_ += need_size;
 }
 
+bool BufferManager::TryReserveSpace(SizeT size) {
+    u64 memory_usage = current_memory_size_.load();
+    do {
+        if (memory_usage + size > memory_limit_) {
+            return false;
+        }
+    } while (!current_memory_size_.compare_exchange_weak(memory_usage, memory_usage + size));
+    return true;
+}
+
+void BufferManager::SetSpaceReclaimer(std::function<void(SizeT)> space_reclaimer) {
+    std::unique_lock lock(gc_locker_);
+    space_reclaimer_ = std::move(space_reclaimer);
+}
+
 void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
     std::unique_lock lock(gc_locker_);
     auto iter = gc_map_.find(buffer_obj);
@@ -57,6 +57,15 @@ public:
 
     void RemoveClean();
 
+    // Charges memory held outside buffer objects, such as caches, to the pool. Fails instead of freeing buffers when the pool is full.
+    bool TryReserveSpace(SizeT size);
+
+    void ReleaseSpace(SizeT size) { current_memory_size_ -= size; }
+
+    // Called by RequestSpace with the missing bytes once no buffer is left to free, so that the holder of reserved space gives
+    // some of it back through ReleaseSpace before the request fails. nullptr removes it.
+    void SetSpaceReclaimer(std::function<void(SizeT)> space_reclaimer);
+
 private:
     friend class BufferObj;
 
@@ -93,6 +102,7 @@ private:
     using GCListIter = List<BufferObj *>::iterator;
     HashMap<BufferObj *, GCListIter> gc_map_{};
     List<BufferObj *> gc_list_{};
+    std::function<void(SizeT)> space_reclaimer_{};
 
     std::mutex clean_locker_{};
     Vector<BufferObj *> clean_list_{};
@@ -99,7 +99,7 @@ void AnnIVFFlatIndexFileWorker<DataType>::AllocateInMemory() {
     }
     switch (GetType()) {
         case kElemFloat: {
-            data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType>(index_ivfflat->metric_type_, dimension, centroids_count));
+            data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType>(index_ivfflat->metric_type_, dimension, centroids_count, index_ivfflat->encode_type_));
             break;
         }
         default: {
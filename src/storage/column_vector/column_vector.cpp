@@ -983,6 +983,19 @@ void ColumnVector::Finalize(SizeT index) {
     tail_index_ = index;
 }
 
+void ColumnVector::AppendBitEmbedding(const Vector<std::string_view> &ele_str_views, SizeT dst_off) {
+    auto *dst = reinterpret_cast<u8 *>(data_ptr_ + dst_off);
+    std::fill_n(dst, data_type_->Size(), 0);
+    for (SizeT i = 0; auto &ele_str_view : ele_str_views) {
+        if (ele_str_view == "1") {
+            dst[i / 8] |= static_cast<u8>(1u << (7 - i % 8));
+        } else if (ele_str_view != "0") {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Invalid bit embedding element: {}", ele_str_view)));
+        }
+        ++i;
+    }
+}
+
 void ColumnVector::SetByRawPtr(SizeT index, const_ptr_t raw_ptr) {
     if (!initialized) {
         UnrecoverableError("Column vector isn't initialized.");
@@ -1249,7 +1262,7 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
             SizeT dst_off = index * data_type_->Size();
             switch (embedding_info->Type()) {
                 case kElemBit: {
-                    RecoverableError(Status::NotSupport("Not implemented"));
+                    AppendBitEmbedding(ele_str_views, dst_off);
                     break;
                 }
                 case kElemInt8: {
@@ -1276,6 +1289,14 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
                     AppendEmbedding<DoubleT>(ele_str_views, dst_off);
                     break;
                 }
+                case kElemFloat16: {
+                    AppendEmbedding<Float16T>(ele_str_views, dst_off);
+                    break;
+                }
+                case kElemBFloat16: {
+                    AppendEmbedding<BFloat16T>(ele_str_views, dst_off);
+                    break;
+                }
                 default: {
                     UnrecoverableError("Invalid embedding type");
                 }
@@ -1302,6 +1323,51 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
     }
 }
 
+void ColumnVector::AppendFixedWidth(const char *data, SizeT row_count) {
+    if (tail_index_ + row_count > capacity_) {
+        UnrecoverableError(fmt::format("Exceed the column vector capacity.({}/{})", tail_index_ + row_count, capacity_));
+    }
+    switch (data_type_->type()) {
+        case kBoolean: {
+            for (SizeT i = 0; i < row_count; ++i) {
+                buffer_->SetCompactBit(tail_index_ + i, data[i] != 0);
+            }
+            break;
+        }
+        case kTinyInt:
+        case kSmallInt:
+        case kInteger:
+        case kBigInt:
+        case kFloat:
+        case kDouble:
+        case kDate:
+        case kTime:
+        case kDateTime:
+        case kTimestamp:
+        case kEmbedding: {
+            SizeT value_size = data_type_->Size();
+            std::memcpy(data_ptr_ + tail_index_ * value_size, data, row_count * value_size);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("{} isn't a fixed width type", data_type_->ToString()));
+        }
+    }
+    tail_index_ += row_count;
+}
+
+void ColumnVector::AppendVarchar(const u32 *offsets, const char *data, SizeT row_count) {
+    if (data_type_->type() != kVarchar) {
+        UnrecoverableError(fmt::format("Attempt to append strings to a {} column", data_type_->ToString()));
+    }
+    if (tail_index_ + row_count > capacity_) {
+        UnrecoverableError(fmt::format("Exceed the column vector capacity.({}/{})", tail_index_ + row_count, capacity_));
+    }
+    for (SizeT i = 0; i < row_count; ++i) {
+        AppendByStringView(std::string_view(data + offsets[i], offsets[i + 1] - offsets[i]), ',');
+    }
+}
+
 void ColumnVector::AppendByConstantExpr(const ConstantExpr *const_expr) {
     switch (data_type_->type()) {
         case kBoolean: {
@@ -1393,6 +1459,24 @@ void ColumnVector::AppendByConstantExpr(const ConstantExpr *const_expr) {
                     AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
                     break;
                 }
+                case kElemFloat16: {
+                    Vector<Float16T> embedding;
+                    embedding.reserve(const_expr->double_array_.size());
+                    std::transform(const_expr->double_array_.begin(), const_expr->double_array_.end(), std::back_inserter(embedding), [](auto &v) {
+                        return Float16T(static_cast<float>(v));
+                    });
+                    AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                    break;
+                }
+                case kElemBFloat16: {
+                    Vector<BFloat16T> embedding;
+                    embedding.reserve(const_expr->double_array_.size());
+                    std::transform(const_expr->double_array_.begin(), const_expr->double_array_.end(), std::back_inserter(embedding), [](auto &v) {
+                        return BFloat16T(static_cast<float>(v));
+                    });
+                    AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                    break;
+                }
                 case kElemDouble: {
                     Vector<i8> embedding;
                     embedding.reserve(const_expr->double_array_.size());
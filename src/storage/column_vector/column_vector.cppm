@@ -191,6 +191,12 @@ public:
 
     void AppendByStringView(std::string_view sv, char delimiter);
 
+    // Append `row_count` values stored back to back in the layout of the column type, one byte per value for boolean.
+    void AppendFixedWidth(const char *data, SizeT row_count);
+
+    // Append `row_count` strings, the i-th one is data[offsets[i], offsets[i + 1]).
+    void AppendVarchar(const u32 *offsets, const char *data, SizeT row_count);
+
     void AppendByConstantExpr(const ConstantExpr *const_expr);
 
     void AppendWith(const ColumnVector &other, SizeT start_row, SizeT count);
@@ -236,12 +242,21 @@ private:
     template <typename T>
     void AppendEmbedding(const Vector<std::string_view> &ele_str_views, SizeT dst_off) {
         for (SizeT i = 0; auto &ele_str_view : ele_str_views) {
-            T value = DataType::StringToValue<T>(ele_str_view);
+            T value;
+            if constexpr (std::is_same_v<T, Float16T> || std::is_same_v<T, BFloat16T>) {
+                // half precision is parsed as float and narrowed
+                value = T(DataType::StringToValue<FloatT>(ele_str_view));
+            } else {
+                value = DataType::StringToValue<T>(ele_str_view);
+            }
             ((T *)(data_ptr_ + dst_off))[i] = value;
             ++i;
         }
     }
 
+    // bit embedding elements are 0 or 1, packed from the most significant bit of each byte
+    void AppendBitEmbedding(const Vector<std::string_view> &ele_str_views, SizeT dst_off);
+
     // Used by Append by Ptr
     void SetByRawPtr(SizeT index, const_ptr_t raw_ptr);
 
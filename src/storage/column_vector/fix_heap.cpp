@@ -225,6 +225,23 @@ void FixHeapManager::ReadFromHeap(char *buffer, ChunkId chunk_id, u64 chunk_offs
     }
 }
 
+const char *FixHeapManager::GetVarcharData(const VarcharT &varchar, Vector<char> &buffer) {
+    if (varchar.IsInlined()) {
+        return varchar.short_.data_;
+    }
+    if (varchar.IsValue()) {
+        return varchar.value_.ptr_;
+    }
+    ChunkId chunk_id = varchar.vector_.chunk_id_;
+    u64 chunk_offset = varchar.vector_.chunk_offset_;
+    if (chunk_offset + varchar.length_ <= current_chunk_size_) {
+        return ReadChunk(chunk_id).GetPtr() + chunk_offset;
+    }
+    buffer.resize(varchar.length_);
+    ReadFromHeap(buffer.data(), chunk_id, chunk_offset, varchar.length_);
+    return buffer.data();
+}
+
 String FixHeapManager::Stats() const {
     std::stringstream ss;
     ss << "Chunk count: " << current_chunk_idx_ << ", Chunk size: " << current_chunk_size_ << ", Current Offset: " << current_chunk_offset_
@@ -50,6 +50,9 @@ public:
     // the size of data.
     void ReadFromHeap(char *buffer, ChunkId chunk_id, u64 chunk_offset, SizeT nbytes);
 
+    // Contiguous bytes of a varchar stored in this heap. Only the bytes crossing a chunk boundary are copied, into #buffer.
+    [[nodiscard]] const char *GetVarcharData(const VarcharT &varchar, Vector<char> &buffer);
+
     [[nodiscard]] String Stats() const;
 
 public:
@@ -29,9 +29,23 @@ import bitmask_buffer;
 import third_party;
 import internal_types;
 import status;
+import simd_compare;
 
 namespace infinity {
 
+// Comparison operators wrapped as Wrapper<Operation> with Operation::simd_compare_type run on the SIMD kernels.
+template <typename Operator>
+struct SIMDCompareOperator {
+    static constexpr bool value = false;
+};
+
+template <template <typename> typename Wrapper, typename Operation>
+    requires requires { Operation::simd_compare_type; }
+struct SIMDCompareOperator<Wrapper<Operation>> {
+    static constexpr bool value = true;
+    static constexpr SIMDCompareType compare_type = Operation::simd_compare_type;
+};
+
 template <typename LeftType, typename RightType, typename Operator>
     requires std::same_as<LeftType, RightType> // if they are not same, we need to implement a new function
 class BooleanResultBinaryOperator {
@@ -52,6 +66,11 @@ public:
         if (!check_vector_type_valid(left_vector_type) || !check_vector_type_valid(right_vector_type)) {
             UnrecoverableError("Invalid input ColumnVectorType. Support only kFlat and kConstant.");
         }
+        if constexpr (SIMDCompareOperator<Operator>::value && SIMDCompareSupported<LeftType>) {
+            if (left_vector_type == ColumnVectorType::kFlat || right_vector_type == ColumnVectorType::kFlat) {
+                return ExecuteSIMDCompare(left, right, result, count, nullable);
+            }
+        }
         const SharedPtr<Bitmask> &left_null = left->nulls_ptr_;
         const SharedPtr<Bitmask> &right_null = right->nulls_ptr_;
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
@@ -113,6 +132,54 @@ public:
     }
 
 private:
+    // Compare all rows into the compact bits, including the null ones, and only merge the null masks.
+    static inline void
+    ExecuteSIMDCompare(const SharedPtr<ColumnVector> &left, const SharedPtr<ColumnVector> &right, SharedPtr<ColumnVector> &result, SizeT count, bool nullable) {
+        constexpr SIMDCompareType compare_type = SIMDCompareOperator<Operator>::compare_type;
+        const SharedPtr<Bitmask> &left_null = left->nulls_ptr_;
+        const SharedPtr<Bitmask> &right_null = right->nulls_ptr_;
+        SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
+        const auto *left_ptr = reinterpret_cast<const LeftType *>(left->data());
+        const auto *right_ptr = reinterpret_cast<const RightType *>(right->data());
+        auto *result_bits = reinterpret_cast<u8 *>(result->data());
+        if (left->vector_type() == ColumnVectorType::kFlat && right->vector_type() == ColumnVectorType::kFlat) {
+            SIMDCompareFlatFlat<compare_type>(left_ptr, right_ptr, result_bits, count);
+            if (!nullable) {
+                result_null->SetAllTrue();
+            } else if (left_null->IsAllTrue()) {
+                result_null->DeepCopy(*right_null);
+            } else {
+                result_null->DeepCopy(*left_null);
+                if (!(right_null->IsAllTrue())) {
+                    result_null->Merge(*right_null);
+                }
+            }
+        } else if (left->vector_type() == ColumnVectorType::kConstant) {
+            if (nullable && !(left_null->IsAllTrue())) {
+                result_null->SetAllFalse();
+            } else {
+                SIMDCompareConstantFlat<compare_type>(left_ptr[0], right_ptr, result_bits, count);
+                if (nullable) {
+                    result_null->DeepCopy(*right_null);
+                } else {
+                    result_null->SetAllTrue();
+                }
+            }
+        } else {
+            if (nullable && !(right_null->IsAllTrue())) {
+                result_null->SetAllFalse();
+            } else {
+                SIMDCompareFlatConstant<compare_type>(left_ptr, right_ptr[0], result_bits, count);
+                if (nullable) {
+                    result_null->DeepCopy(*left_null);
+                } else {
+                    result_null->SetAllTrue();
+                }
+            }
+        }
+        result->Finalize(count);
+    }
+
     static inline void ResultBooleanExecuteWithNull(const SharedPtr<ColumnVector> &left,
                                                     const SharedPtr<ColumnVector> &right,
                                                     SharedPtr<ColumnVector> &result,
@@ -0,0 +1,495 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+export module simd_compare;
+
+import stl;
+import internal_types;
+
+namespace infinity {
+
+// Comparison kernels writing one result bit per row into a compact bit buffer (LSB first, the layout of
+// ColumnVectorType::kCompactBit). Rows are compared in blocks of 64, each block produces one u64 mask.
+
+export enum class SIMDCompareType : u8 {
+    kEqual,
+    kNotEqual,
+    kLess,
+    kLessEqual,
+    kGreater,
+    kGreaterEqual,
+};
+
+// a op b <=> b op' a
+export constexpr SIMDCompareType ReverseSIMDCompareType(SIMDCompareType compare_type) {
+    switch (compare_type) {
+        case SIMDCompareType::kLess:
+            return SIMDCompareType::kGreater;
+        case SIMDCompareType::kLessEqual:
+            return SIMDCompareType::kGreaterEqual;
+        case SIMDCompareType::kGreater:
+            return SIMDCompareType::kLess;
+        case SIMDCompareType::kGreaterEqual:
+            return SIMDCompareType::kLessEqual;
+        default:
+            return compare_type;
+    }
+}
+
+// Values are compared on their storage representation. DateT and TimeT only wrap an i32.
+// DateTimeT and TimestampT are two fields and HugeIntT is 128 bits, they stay on the per row path.
+template <typename T>
+struct SIMDCompareStorage {
+    using type = void;
+};
+
+template <>
+struct SIMDCompareStorage<TinyIntT> {
+    using type = i8;
+};
+
+template <>
+struct SIMDCompareStorage<SmallIntT> {
+    using type = i16;
+};
+
+template <>
+struct SIMDCompareStorage<IntegerT> {
+    using type = i32;
+};
+
+template <>
+struct SIMDCompareStorage<BigIntT> {
+    using type = i64;
+};
+
+template <>
+struct SIMDCompareStorage<FloatT> {
+    using type = f32;
+};
+
+template <>
+struct SIMDCompareStorage<DoubleT> {
+    using type = f64;
+};
+
+template <>
+struct SIMDCompareStorage<DateT> {
+    using type = i32;
+};
+
+template <>
+struct SIMDCompareStorage<TimeT> {
+    using type = i32;
+};
+
+static_assert(sizeof(DateT) == sizeof(i32) && sizeof(TimeT) == sizeof(i32));
+static_assert(std::endian::native == std::endian::little, "compact bit masks are stored as little endian u64");
+
+export template <typename T>
+concept SIMDCompareSupported = !std::is_void_v<typename SIMDCompareStorage<T>::type>;
+
+constexpr SizeT SIMD_COMPARE_BLOCK = 64;
+
+export template <SIMDCompareType compare_type, typename T>
+inline bool ScalarCompare(T left, T right) {
+    if constexpr (compare_type == SIMDCompareType::kEqual) {
+        return left == right;
+    } else if constexpr (compare_type == SIMDCompareType::kNotEqual) {
+        return left != right;
+    } else if constexpr (compare_type == SIMDCompareType::kLess) {
+        return left < right;
+    } else if constexpr (compare_type == SIMDCompareType::kLessEqual) {
+        return left <= right;
+    } else if constexpr (compare_type == SIMDCompareType::kGreater) {
+        return left > right;
+    } else {
+        return left >= right;
+    }
+}
+
+// One register of lanes: Load, Broadcast and Compare returning one bit per lane.
+template <typename T>
+struct SIMDCompareKernel {
+    static constexpr bool enabled = false;
+};
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+template <SIMDCompareType compare_type>
+constexpr int AVX512IntPredicate() {
+    switch (compare_type) {
+        case SIMDCompareType::kEqual:
+            return _MM_CMPINT_EQ;
+        case SIMDCompareType::kNotEqual:
+            return _MM_CMPINT_NE;
+        case SIMDCompareType::kLess:
+            return _MM_CMPINT_LT;
+        case SIMDCompareType::kLessEqual:
+            return _MM_CMPINT_LE;
+        case SIMDCompareType::kGreater:
+            return _MM_CMPINT_NLE;
+        case SIMDCompareType::kGreaterEqual:
+            return _MM_CMPINT_NLT;
+    }
+    return _MM_CMPINT_EQ;
+}
+
+// Ordered predicates except not-equal, same as the C++ operators on NaN.
+template <SIMDCompareType compare_type>
+constexpr int FloatPredicate() {
+    switch (compare_type) {
+        case SIMDCompareType::kEqual:
+            return _CMP_EQ_OQ;
+        case SIMDCompareType::kNotEqual:
+            return _CMP_NEQ_UQ;
+        case SIMDCompareType::kLess:
+            return _CMP_LT_OQ;
+        case SIMDCompareType::kLessEqual:
+            return _CMP_LE_OQ;
+        case SIMDCompareType::kGreater:
+            return _CMP_GT_OQ;
+        case SIMDCompareType::kGreaterEqual:
+            return _CMP_GE_OQ;
+    }
+    return _CMP_EQ_OQ;
+}
+
+template <>
+struct SIMDCompareKernel<i8> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 64;
+    using Vec = __m512i;
+    static inline Vec Load(const i8 *ptr) { return _mm512_loadu_si512(ptr); }
+    static inline Vec Broadcast(i8 value) { return _mm512_set1_epi8(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = AVX512IntPredicate<compare_type>();
+        return _mm512_cmp_epi8_mask(a, b, predicate);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i16> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 32;
+    using Vec = __m512i;
+    static inline Vec Load(const i16 *ptr) { return _mm512_loadu_si512(ptr); }
+    static inline Vec Broadcast(i16 value) { return _mm512_set1_epi16(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = AVX512IntPredicate<compare_type>();
+        return _mm512_cmp_epi16_mask(a, b, predicate);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i32> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 16;
+    using Vec = __m512i;
+    static inline Vec Load(const i32 *ptr) { return _mm512_loadu_si512(ptr); }
+    static inline Vec Broadcast(i32 value) { return _mm512_set1_epi32(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = AVX512IntPredicate<compare_type>();
+        return _mm512_cmp_epi32_mask(a, b, predicate);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i64> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 8;
+    using Vec = __m512i;
+    static inline Vec Load(const i64 *ptr) { return _mm512_loadu_si512(ptr); }
+    static inline Vec Broadcast(i64 value) { return _mm512_set1_epi64(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = AVX512IntPredicate<compare_type>();
+        return _mm512_cmp_epi64_mask(a, b, predicate);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<f32> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 16;
+    using Vec = __m512;
+    static inline Vec Load(const f32 *ptr) { return _mm512_loadu_ps(ptr); }
+    static inline Vec Broadcast(f32 value) { return _mm512_set1_ps(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = FloatPredicate<compare_type>();
+        return _mm512_cmp_ps_mask(a, b, predicate);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<f64> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 8;
+    using Vec = __m512d;
+    static inline Vec Load(const f64 *ptr) { return _mm512_loadu_pd(ptr); }
+    static inline Vec Broadcast(f64 value) { return _mm512_set1_pd(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = FloatPredicate<compare_type>();
+        return _mm512_cmp_pd_mask(a, b, predicate);
+    }
+};
+
+#elif defined(__AVX2__)
+
+// Ordered predicates except not-equal, same as the C++ operators on NaN.
+template <SIMDCompareType compare_type>
+constexpr int FloatPredicate() {
+    switch (compare_type) {
+        case SIMDCompareType::kEqual:
+            return _CMP_EQ_OQ;
+        case SIMDCompareType::kNotEqual:
+            return _CMP_NEQ_UQ;
+        case SIMDCompareType::kLess:
+            return _CMP_LT_OQ;
+        case SIMDCompareType::kLessEqual:
+            return _CMP_LE_OQ;
+        case SIMDCompareType::kGreater:
+            return _CMP_GT_OQ;
+        case SIMDCompareType::kGreaterEqual:
+            return _CMP_GE_OQ;
+    }
+    return _CMP_EQ_OQ;
+}
+
+// AVX2 only has equal and signed greater-than for integers, the other predicates swap the operands or invert the lane bits.
+template <SIMDCompareType compare_type, typename Kernel>
+inline u64 AVX2IntCompare(typename Kernel::Vec a, typename Kernel::Vec b) {
+    constexpr u64 lane_bits = (u64(1) << Kernel::lanes) - 1;
+    if constexpr (compare_type == SIMDCompareType::kEqual) {
+        return Kernel::MoveMask(Kernel::CmpEq(a, b));
+    } else if constexpr (compare_type == SIMDCompareType::kNotEqual) {
+        return ~Kernel::MoveMask(Kernel::CmpEq(a, b)) & lane_bits;
+    } else if constexpr (compare_type == SIMDCompareType::kLess) {
+        return Kernel::MoveMask(Kernel::CmpGt(b, a));
+    } else if constexpr (compare_type == SIMDCompareType::kLessEqual) {
+        return ~Kernel::MoveMask(Kernel::CmpGt(a, b)) & lane_bits;
+    } else if constexpr (compare_type == SIMDCompareType::kGreater) {
+        return Kernel::MoveMask(Kernel::CmpGt(a, b));
+    } else {
+        return ~Kernel::MoveMask(Kernel::CmpGt(b, a)) & lane_bits;
+    }
+}
+
+template <>
+struct SIMDCompareKernel<i8> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 32;
+    using Vec = __m256i;
+    static inline Vec Load(const i8 *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+    static inline Vec Broadcast(i8 value) { return _mm256_set1_epi8(value); }
+    static inline Vec CmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi8(a, b); }
+    static inline Vec CmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi8(a, b); }
+    static inline u64 MoveMask(Vec v) { return static_cast<u32>(_mm256_movemask_epi8(v)); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        return AVX2IntCompare<compare_type, SIMDCompareKernel<i8>>(a, b);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i16> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 16;
+    using Vec = __m256i;
+    static inline Vec Load(const i16 *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+    static inline Vec Broadcast(i16 value) { return _mm256_set1_epi16(value); }
+    static inline Vec CmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi16(a, b); }
+    static inline Vec CmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi16(a, b); }
+    // lanes are 0 or -1, packing to i8 with saturation keeps them
+    static inline u64 MoveMask(Vec v) {
+        return static_cast<u16>(_mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1))));
+    }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        return AVX2IntCompare<compare_type, SIMDCompareKernel<i16>>(a, b);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i32> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 8;
+    using Vec = __m256i;
+    static inline Vec Load(const i32 *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+    static inline Vec Broadcast(i32 value) { return _mm256_set1_epi32(value); }
+    static inline Vec CmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+    static inline Vec CmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi32(a, b); }
+    static inline u64 MoveMask(Vec v) { return static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(v))); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        return AVX2IntCompare<compare_type, SIMDCompareKernel<i32>>(a, b);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<i64> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 4;
+    using Vec = __m256i;
+    static inline Vec Load(const i64 *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+    static inline Vec Broadcast(i64 value) { return _mm256_set1_epi64x(value); }
+    static inline Vec CmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi64(a, b); }
+    static inline Vec CmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi64(a, b); }
+    static inline u64 MoveMask(Vec v) { return static_cast<u32>(_mm256_movemask_pd(_mm256_castsi256_pd(v))); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        return AVX2IntCompare<compare_type, SIMDCompareKernel<i64>>(a, b);
+    }
+};
+
+template <>
+struct SIMDCompareKernel<f32> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 8;
+    using Vec = __m256;
+    static inline Vec Load(const f32 *ptr) { return _mm256_loadu_ps(ptr); }
+    static inline Vec Broadcast(f32 value) { return _mm256_set1_ps(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = FloatPredicate<compare_type>();
+        return static_cast<u32>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, predicate)));
+    }
+};
+
+template <>
+struct SIMDCompareKernel<f64> {
+    static constexpr bool enabled = true;
+    static constexpr SizeT lanes = 4;
+    using Vec = __m256d;
+    static inline Vec Load(const f64 *ptr) { return _mm256_loadu_pd(ptr); }
+    static inline Vec Broadcast(f64 value) { return _mm256_set1_pd(value); }
+    template <SIMDCompareType compare_type>
+    static inline u64 Compare(Vec a, Vec b) {
+        constexpr int predicate = FloatPredicate<compare_type>();
+        return static_cast<u32>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, predicate)));
+    }
+};
+
+#endif
+
+template <SIMDCompareType compare_type, typename T>
+inline u64 CompareBlockFlatFlat(const T *left, const T *right) {
+    using Kernel = SIMDCompareKernel<T>;
+    u64 mask = 0;
+    if constexpr (Kernel::enabled) {
+        for (SizeT j = 0; j < SIMD_COMPARE_BLOCK; j += Kernel::lanes) {
+            mask |= Kernel::template Compare<compare_type>(Kernel::Load(left + j), Kernel::Load(right + j)) << j;
+        }
+    } else {
+        for (SizeT j = 0; j < SIMD_COMPARE_BLOCK; ++j) {
+            mask |= u64(ScalarCompare<compare_type>(left[j], right[j])) << j;
+        }
+    }
+    return mask;
+}
+
+template <SIMDCompareType compare_type, typename T, typename RightVec>
+inline u64 CompareBlockFlatConstant(const T *left, T right, const RightVec &right_vec) {
+    using Kernel = SIMDCompareKernel<T>;
+    u64 mask = 0;
+    if constexpr (Kernel::enabled) {
+        for (SizeT j = 0; j < SIMD_COMPARE_BLOCK; j += Kernel::lanes) {
+            mask |= Kernel::template Compare<compare_type>(Kernel::Load(left + j), right_vec) << j;
+        }
+    } else {
+        for (SizeT j = 0; j < SIMD_COMPARE_BLOCK; ++j) {
+            mask |= u64(ScalarCompare<compare_type>(left[j], right)) << j;
+        }
+    }
+    return mask;
+}
+
+// Write the low `rows` bits of mask at dst, bits after the last row of a partial byte are kept.
+inline void StoreCompareMask(u8 *dst, u64 mask, SizeT rows) {
+    if (rows == SIMD_COMPARE_BLOCK) {
+        std::memcpy(dst, &mask, sizeof(mask));
+        return;
+    }
+    SizeT full_bytes = rows / 8;
+    std::memcpy(dst, &mask, full_bytes);
+    if (SizeT tail_bits = rows % 8; tail_bits > 0) {
+        u8 keep = static_cast<u8>(0xFF << tail_bits);
+        dst[full_bytes] = (dst[full_bytes] & keep) | (static_cast<u8>(mask >> (full_bytes * 8)) & ~keep);
+    }
+}
+
+export template <SIMDCompareType compare_type, SIMDCompareSupported T>
+void SIMDCompareFlatFlat(const T *left, const T *right, u8 *result_bits, SizeT count) {
+    using StorageT = typename SIMDCompareStorage<T>::type;
+    const auto *left_ptr = reinterpret_cast<const StorageT *>(left);
+    const auto *right_ptr = reinterpret_cast<const StorageT *>(right);
+    SizeT i = 0;
+    for (; i + SIMD_COMPARE_BLOCK <= count; i += SIMD_COMPARE_BLOCK) {
+        StoreCompareMask(result_bits + i / 8, CompareBlockFlatFlat<compare_type>(left_ptr + i, right_ptr + i), SIMD_COMPARE_BLOCK);
+    }
+    if (i < count) {
+        u64 mask = 0;
+        for (SizeT j = 0; i + j < count; ++j) {
+            mask |= u64(ScalarCompare<compare_type>(left_ptr[i + j], right_ptr[i + j])) << j;
+        }
+        StoreCompareMask(result_bits + i / 8, mask, count - i);
+    }
+}
+
+export template <SIMDCompareType compare_type, SIMDCompareSupported T>
+void SIMDCompareFlatConstant(const T *left, T right, u8 *result_bits, SizeT count) {
+    using StorageT = typename SIMDCompareStorage<T>::type;
+    using Kernel = SIMDCompareKernel<StorageT>;
+    const auto *left_ptr = reinterpret_cast<const StorageT *>(left);
+    const auto right_value = std::bit_cast<StorageT>(right);
+    auto right_vec = [&] {
+        if constexpr (Kernel::enabled) {
+            return Kernel::Broadcast(right_value);
+        } else {
+            return right_value;
+        }
+    }();
+    SizeT i = 0;
+    for (; i + SIMD_COMPARE_BLOCK <= count; i += SIMD_COMPARE_BLOCK) {
+        StoreCompareMask(result_bits + i / 8, CompareBlockFlatConstant<compare_type>(left_ptr + i, right_value, right_vec), SIMD_COMPARE_BLOCK);
+    }
+    if (i < count) {
+        u64 mask = 0;
+        for (SizeT j = 0; i + j < count; ++j) {
+            mask |= u64(ScalarCompare<compare_type>(left_ptr[i + j], right_value)) << j;
+        }
+        StoreCompareMask(result_bits + i / 8, mask, count - i);
+    }
+}
+
+export template <SIMDCompareType compare_type, SIMDCompareSupported T>
+void SIMDCompareConstantFlat(T left, const T *right, u8 *result_bits, SizeT count) {
+    SIMDCompareFlatConstant<ReverseSIMDCompareType(compare_type)>(right, left, result_bits, count);
+}
+
+} // namespace infinity
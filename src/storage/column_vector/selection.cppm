@@ -109,6 +109,21 @@ public:
         return latest_selection_idx_;
     }
 
+    // Kernels that fill the selection branch free write the raw vector and publish the row count with Resize.
+    inline u16 *Data() const {
+        if (selection_vector == nullptr) {
+            UnrecoverableError("Selection container isn't initialized");
+        }
+        return selection_vector;
+    }
+
+    inline void Resize(SizeT size) {
+        if (size > Capacity()) {
+            UnrecoverableError("Exceed the selection vector capacity.");
+        }
+        latest_selection_idx_ = size;
+    }
+
     void Reset() {
         storage_.reset();
         latest_selection_idx_ = 0;
@@ -845,6 +845,24 @@ String EmbeddingValueInfo::GetString(EmbeddingInfo* embedding_info) {
             res += std::to_string(element);
             break;
         }
+        case EmbeddingDataType::kElemFloat16: {
+            for(SizeT i = 0; i < count - 1; ++ i) {
+                f32 element = ((Float16T*)ptr)[i];
+                res += std::to_string(element) + ", ";
+            }
+            f32 element = ((Float16T*)ptr)[count - 1];
+            res += std::to_string(element);
+            break;
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            for(SizeT i = 0; i < count - 1; ++ i) {
+                f32 element = ((BFloat16T*)ptr)[i];
+                res += std::to_string(element) + ", ";
+            }
+            f32 element = ((BFloat16T*)ptr)[count - 1];
+            res += std::to_string(element);
+            break;
+        }
         default: {
             UnrecoverableError("Not supported embedding data type.");
             break;
@@ -188,6 +188,10 @@ public:
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, vec.size()));
         } else if constexpr (std::is_same_v<T, double>) {
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemDouble, vec.size()));
+        } else if constexpr (std::is_same_v<T, Float16T>) {
+            value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat16, vec.size()));
+        } else if constexpr (std::is_same_v<T, BFloat16T>) {
+            value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemBFloat16, vec.size()));
         } else {
             UnrecoverableError("Not supported embedding data type.");
         }
@@ -98,6 +98,27 @@ void CompactionProcessor::ScanAndOptimize() {
     }
 }
 
+void CompactionProcessor::ScanAndAnalyze() {
+    Txn *analyze_txn = txn_mgr_->BeginTxn();
+    TransactionID txn_id = analyze_txn->TxnID();
+    TxnTimeStamp begin_ts = analyze_txn->BeginTS();
+
+    SizeT analyzed_count = 0;
+    Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
+    for (auto *db_entry : db_entries) {
+        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
+        for (auto *table_entry : table_entries) {
+            analyzed_count += table_entry->Analyze(analyze_txn, true);
+        }
+    }
+    LOG_TRACE(fmt::format("{} segments analyzed.", analyzed_count));
+    try {
+        txn_mgr_->CommitTxn(analyze_txn);
+    } catch (const RecoverableException &e) {
+        txn_mgr_->RollBackTxn(analyze_txn);
+    }
+}
+
 void CompactionProcessor::Process() {
     bool running = true;
     while (running) {
@@ -128,6 +149,12 @@ void CompactionProcessor::Process() {
                     LOG_TRACE("Optimize done.");
                     break;
                 }
+                case BGTaskType::kNotifyAnalyze: {
+                    LOG_TRACE("Analyze start.");
+                    ScanAndAnalyze();
+                    LOG_TRACE("Analyze done.");
+                    break;
+                }
                 default: {
                     UnrecoverableError(fmt::format("Invalid background task: {}", (u8)bg_task->type_));
                     break;
@@ -42,6 +42,8 @@ private:
 
     void ScanAndOptimize();
 
+    void ScanAndAnalyze();
+
     void Process();
 
 private:
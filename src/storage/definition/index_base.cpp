@@ -42,6 +42,9 @@ String MetricTypeToString(MetricType metric_type) {
         case MetricType::kMetricL2: {
             return "l2";
         }
+        case MetricType::kMetricHamming: {
+            return "hamming";
+        }
         case MetricType::kInvalid: {
             return "Invalid";
         }
@@ -53,6 +56,8 @@ MetricType StringToMetricType(const String &str) {
         return MetricType::kMetricInnerProduct;
     } else if (str == "l2") {
         return MetricType::kMetricL2;
+    } else if (str == "hamming") {
+        return MetricType::kMetricHamming;
     } else {
         return MetricType::kInvalid;
     }
@@ -108,8 +113,14 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
     switch (index_type) {
         case IndexType::kIVFFlat: {
             size_t centroids_count = ReadBufAdv<size_t>(ptr);
-            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
-            res = MakeShared<IndexIVFFlat>(index_name, file_name, column_names, centroids_count, metric_type);
+            i32 metric_value = ReadBufAdv<i32>(ptr);
+            IVFEncodeType encode_type = IVFEncodeType::kPlain;
+            if (metric_value & IVF_ENCODE_TYPE_FLAG) {
+                metric_value &= ~IVF_ENCODE_TYPE_FLAG;
+                encode_type = ReadBufAdv<IVFEncodeType>(ptr);
+            }
+            MetricType metric_type = static_cast<MetricType>(metric_value);
+            res = MakeShared<IndexIVFFlat>(index_name, file_name, column_names, centroids_count, metric_type, encode_type);
             break;
         }
         case IndexType::kHnsw: {
@@ -177,7 +188,11 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
         case IndexType::kIVFFlat: {
             size_t centroids_count = index_def_json["centroids_count"];
             MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
-            auto ptr = MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type);
+            IVFEncodeType encode_type = IVFEncodeType::kPlain;
+            if (index_def_json.contains("encode_type")) {
+                encode_type = StringToIVFEncodeType(index_def_json["encode_type"]);
+            }
+            auto ptr = MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type, encode_type);
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
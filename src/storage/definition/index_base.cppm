@@ -27,6 +27,7 @@ namespace infinity {
 export enum class MetricType {
     kMetricInnerProduct,
     kMetricL2,
+    kMetricHamming,
     kInvalid,
 };
 
@@ -57,7 +57,7 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
     if (analyzer.empty()) {
         analyzer = "standard";
     }
-    UniquePtr<Analyzer> ana = AnalyzerPool::instance().Get(analyzer);
+    PooledAnalyzer ana = AnalyzerPool::instance().Get(analyzer);
     if (ana.get() == nullptr) {
         RecoverableError(Status::InvalidIndexDefinition(fmt::format("Attempt to create full-text index using invalid analyer: {}.", analyzer)));
     }
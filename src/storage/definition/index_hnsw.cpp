@@ -30,6 +30,8 @@ import default_values;
 import index_base;
 import logical_type;
 import statement_common;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -152,4 +154,38 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
     }
 }
 
+void IndexHnsw::ValidateColumnElementType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const {
+    auto &column_names_vector = *(base_table_ref->column_names_);
+    auto &column_types_vector = *(base_table_ref->column_types_);
+    SizeT column_id = std::find(column_names_vector.begin(), column_names_vector.end(), column_name) - column_names_vector.begin();
+    const auto &data_type = column_types_vector[column_id];
+    // float: plain or lvq with ip / l2, int8 and half precision: plain with ip / l2, bit: plain with hamming
+    auto embedding_info = static_cast<const EmbeddingInfo *>(data_type->type_info().get());
+    bool supported = false;
+    switch (embedding_info->Type()) {
+        case kElemFloat: {
+            supported = metric_type_ == MetricType::kMetricL2 || metric_type_ == MetricType::kMetricInnerProduct;
+            break;
+        }
+        case kElemInt8:
+        case kElemFloat16:
+        case kElemBFloat16: {
+            supported = encode_type_ == HnswEncodeType::kPlain &&
+                        (metric_type_ == MetricType::kMetricL2 || metric_type_ == MetricType::kMetricInnerProduct);
+            break;
+        }
+        case kElemBit: {
+            supported = encode_type_ == HnswEncodeType::kPlain && metric_type_ == MetricType::kMetricHamming;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    if (!supported) {
+        RecoverableError(Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create HNSW index on column: {}, data type: {}, {}.", column_name, data_type->ToString(), BuildOtherParamsString())));
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -73,6 +73,9 @@ public:
 public:
     static void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name);
 
+    // Check the element type of the embedding column against the metric and the encoding, after ValidateColumnDataType
+    void ValidateColumnElementType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const;
+
 public:
     const MetricType metric_type_{MetricType::kInvalid};
     const HnswEncodeType encode_type_{HnswEncodeType::kInvalid};
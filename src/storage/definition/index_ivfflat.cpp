@@ -29,33 +29,69 @@ import serialize;
 import index_base;
 import logical_type;
 import statement_common;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
+IVFEncodeType StringToIVFEncodeType(const String &str) {
+    if (str == "plain") {
+        return IVFEncodeType::kPlain;
+    } else if (str == "sq8") {
+        return IVFEncodeType::kSQ8;
+    } else if (str == "fp16") {
+        return IVFEncodeType::kFP16;
+    } else {
+        return IVFEncodeType::kInvalid;
+    }
+}
+
+String IVFEncodeTypeToString(IVFEncodeType encode_type) {
+    switch (encode_type) {
+        case IVFEncodeType::kPlain:
+            return "plain";
+        case IVFEncodeType::kSQ8:
+            return "sq8";
+        case IVFEncodeType::kFP16:
+            return "fp16";
+        default:
+            return "invalid";
+    }
+}
+
 SharedPtr<IndexBase> IndexIVFFlat::Make(SharedPtr<String> index_name,
                                         const String &file_name,
                                         Vector<String> column_names,
                                         const Vector<InitParameter *> &index_param_list) {
     SizeT centroids_count = 0;
     MetricType metric_type = MetricType::kInvalid;
+    IVFEncodeType encode_type = IVFEncodeType::kPlain;
     for (auto para : index_param_list) {
         if (para->param_name_ == "centroids_count") {
             centroids_count = std::stoi(para->param_value_);
         } else if (para->param_name_ == "metric") {
             metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "encode") {
+            encode_type = StringToIVFEncodeType(para->param_value_);
         }
     }
     if (metric_type == MetricType::kInvalid) {
         RecoverableError(Status::LackIndexParam());
     }
-    return MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type);
+    if (metric_type != MetricType::kMetricL2 && metric_type != MetricType::kMetricInnerProduct) {
+        RecoverableError(Status::InvalidIndexParam("Metric type"));
+    }
+    if (encode_type == IVFEncodeType::kInvalid) {
+        RecoverableError(Status::InvalidIndexParam("Encode type"));
+    }
+    return MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type, encode_type);
 }
 
 bool IndexIVFFlat::operator==(const IndexIVFFlat &other) const {
     if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
         return false;
     }
-    return centroids_count_ == other.centroids_count_ && metric_type_ == other.metric_type_;
+    return centroids_count_ == other.centroids_count_ && metric_type_ == other.metric_type_ && encode_type_ == other.encode_type_;
 }
 
 bool IndexIVFFlat::operator!=(const IndexIVFFlat &other) const { return !(*this == other); }
@@ -64,13 +100,15 @@ i32 IndexIVFFlat::GetSizeInBytes() const {
     SizeT size = IndexBase::GetSizeInBytes();
     size += sizeof(centroids_count_);
     size += sizeof(metric_type_);
+    size += sizeof(encode_type_);
     return size;
 }
 
 void IndexIVFFlat::WriteAdv(char *&ptr) const {
     IndexBase::WriteAdv(ptr);
     WriteBufAdv(ptr, centroids_count_);
-    WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, static_cast<i32>(metric_type_) | IVF_ENCODE_TYPE_FLAG);
+    WriteBufAdv(ptr, encode_type_);
 }
 
 SharedPtr<IndexBase> IndexIVFFlat::ReadAdv(char *&, int32_t) {
@@ -80,13 +118,15 @@ SharedPtr<IndexBase> IndexIVFFlat::ReadAdv(char *&, int32_t) {
 
 String IndexIVFFlat::ToString() const {
     std::stringstream ss;
-    ss << IndexBase::ToString() << ", " << centroids_count_ << ", " << MetricTypeToString(metric_type_);
+    ss << IndexBase::ToString() << ", " << centroids_count_ << ", " << MetricTypeToString(metric_type_) << ", "
+       << IVFEncodeTypeToString(encode_type_);
     return ss.str();
 }
 
 String IndexIVFFlat::BuildOtherParamsString() const {
     std::stringstream ss;
-    ss << "metric = " << MetricTypeToString(metric_type_) << ", centroids_count = " << centroids_count_;
+    ss << "metric = " << MetricTypeToString(metric_type_) << ", centroids_count = " << centroids_count_
+       << ", encode = " << IVFEncodeTypeToString(encode_type_);
     return ss.str();
 }
 
@@ -94,6 +134,7 @@ nlohmann::json IndexIVFFlat::Serialize() const {
     nlohmann::json res = IndexBase::Serialize();
     res["centroids_count"] = centroids_count_;
     res["metric_type"] = MetricTypeToString(metric_type_);
+    res["encode_type"] = IVFEncodeTypeToString(encode_type_);
     return res;
 }
 
@@ -111,6 +152,10 @@ void IndexIVFFlat::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_ta
     } else if (auto &data_type = column_types_vector[column_id]; data_type->type() != LogicalType::kEmbedding) {
         RecoverableError(Status::InvalidIndexDefinition(
             fmt::format("Attempt to create IVFFLAT index on column: {}, data type: {}.", column_name, data_type->ToString())));
+    } else if (static_cast<const EmbeddingInfo *>(data_type->type_info().get())->Type() != kElemFloat) {
+        // int8 and bit embeddings are searched by brute force or HNSW
+        RecoverableError(Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create IVFFLAT index on column: {}, data type: {}.", column_name, data_type->ToString())));
     }
 }
 
@@ -26,14 +26,36 @@ import create_index_info;
 import statement_common;
 
 namespace infinity {
+
+// How the vectors of each centroid list are stored.
+export enum class IVFEncodeType : i8 {
+    kPlain, // raw vectors
+    kSQ8,   // per dimension scalar quantized uint8
+    kFP16,  // half precision float
+    kInvalid,
+};
+
+// Set in the metric type written by WriteAdv to tell the encode type follows it.
+// Entries written before the encoded lists have no encode type, they are plain.
+export constexpr i32 IVF_ENCODE_TYPE_FLAG = 0x100;
+
+export String IVFEncodeTypeToString(IVFEncodeType encode_type);
+
+export IVFEncodeType StringToIVFEncodeType(const String &str);
+
 export class IndexIVFFlat final : public IndexBase {
 public:
     static SharedPtr<IndexBase>
     Make(SharedPtr<String> index_name, const String &file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
 
-    IndexIVFFlat(SharedPtr<String> index_name, const String &file_name, Vector<String> column_names, SizeT centroids_count, MetricType metric_type)
+    IndexIVFFlat(SharedPtr<String> index_name,
+                 const String &file_name,
+                 Vector<String> column_names,
+                 SizeT centroids_count,
+                 MetricType metric_type,
+                 IVFEncodeType encode_type = IVFEncodeType::kPlain)
         : IndexBase(IndexType::kIVFFlat, index_name, file_name, std::move(column_names)), centroids_count_(centroids_count),
-          metric_type_(metric_type) {}
+          metric_type_(metric_type), encode_type_(encode_type) {}
 
     ~IndexIVFFlat() final = default;
 
@@ -63,6 +85,8 @@ public:
     const SizeT centroids_count_{};
 
     const MetricType metric_type_{MetricType::kInvalid};
+
+    const IVFEncodeType encode_type_{IVFEncodeType::kPlain};
 };
 
 } // namespace infinity
\ No newline at end of file
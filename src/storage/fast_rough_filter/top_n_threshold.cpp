@@ -0,0 +1,54 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+module;
+
+#include <cmath>
+
+module top_n_threshold;
+
+import stl;
+import value;
+import fast_rough_filter;
+import filter_expression_push_down_helper;
+import column_statistics;
+import internal_types;
+import select_statement;
+
+namespace infinity {
+
+void TopNThreshold::Update(const Value &value) {
+    Optional<f64> key = StatisticsKey(value);
+    if (!key.has_value() or std::isnan(*key)) {
+        return;
+    }
+    std::lock_guard lock(mutex_);
+    if (threshold_key_.has_value() and (order_type_ == OrderType::kAsc ? *key >= *threshold_key_ : *key <= *threshold_key_)) {
+        return;
+    }
+    threshold_key_ = key;
+    threshold_ = value;
+}
+
+bool TopNThreshold::EvaluateInner(TxnTimeStamp, const FastRoughFilter &filter) const {
+    std::lock_guard lock(mutex_);
+    if (!threshold_.has_value()) {
+        return true;
+    }
+    // ASC: some row <= threshold, DESC: some row >= threshold
+    auto compare_type = order_type_ == OrderType::kAsc ? FilterCompareType::kLessEqual : FilterCompareType::kGreaterEqual;
+    return filter.MayInRange(column_id_, *threshold_, compare_type);
+}
+
+} // namespace infinity
@@ -0,0 +1,54 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+module;
+
+export module top_n_threshold;
+
+import stl;
+import value;
+import fast_rough_filter;
+import internal_types;
+import select_statement;
+
+namespace infinity {
+
+// the first sort key value that a row has to reach to enter the result of ORDER BY ... LIMIT
+// shared by the Top operators of all fragments and the scans below them,
+// the scans skip the blocks and segments whose min / max of the sort column cannot reach it
+export class TopNThreshold final : public FastRoughFilterEvaluator {
+public:
+    TopNThreshold(ColumnID column_id, OrderType order_type) : column_id_(column_id), order_type_(order_type) {}
+
+    ~TopNThreshold() final = default;
+
+    // value: the first sort key of the last row of a full top-N candidate set, the threshold is only tightened
+    void Update(const Value &value);
+
+    bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const final;
+
+    [[nodiscard]] ColumnID column_id() const { return column_id_; }
+
+    [[nodiscard]] OrderType order_type() const { return order_type_; }
+
+private:
+    const ColumnID column_id_;
+    const OrderType order_type_;
+
+    mutable std::mutex mutex_;
+    Optional<f64> threshold_key_;
+    Optional<Value> threshold_;
+};
+
+} // namespace infinity
@@ -44,6 +44,8 @@ bool ColumnIndexIterator::Next(String &key, PostingDecoder *&decoder) {
     if (!ret)
         return false;
     u32 total_len = 0;
+    // a ranged iteration does not start at the beginning of the posting file
+    posting_file_->Seek(term_meta_.doc_start_);
     DecodeDocList();
     DecodePosList();
 
@@ -21,6 +21,9 @@ public:
 
     ~ColumnIndexIterator();
 
+    // restricts the iteration to the terms in [begin, end), an empty bound leaves that side open
+    void SetRange(const String &begin, const String &end) { dict_reader_->InitRangeIterator(begin, end); }
+
     bool Next(String &term, PostingDecoder *&decoder);
 
 private:
@@ -27,17 +27,16 @@ import file_system;
 import file_system_type;
 import infinity_exception;
 import vector_with_lock;
+import dict_reader;
+import local_file_system;
+import default_values;
 
 namespace infinity {
-ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool)
-    : index_dir_(index_dir), flag_(flag), memory_pool_(memory_pool), buffer_pool_(buffer_pool) {}
+ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool, SizeT part_count)
+    : index_dir_(index_dir), flag_(flag), memory_pool_(memory_pool), buffer_pool_(buffer_pool), part_count_(part_count) {}
 
 ColumnIndexMerger::~ColumnIndexMerger() {}
 
-SharedPtr<PostingMerger> ColumnIndexMerger::CreatePostingMerger() {
-    return MakeShared<PostingMerger>(memory_pool_, buffer_pool_, flag_, column_lengths_);
-}
-
 void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name) {
     assert(base_names.size() == base_rowids.size());
     if (base_rowids.empty()) {
@@ -47,19 +46,20 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     String index_prefix = path.string();
     String dict_file = index_prefix + DICT_SUFFIX;
     String fst_file = dict_file + ".fst";
-    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file, 1024);
+    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file, FULLTEXT_MERGE_WRITE_BUFFER_SIZE);
     TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
     String posting_file = index_prefix + POSTING_SUFFIX;
-    posting_file_writer_ = MakeShared<FileWriter>(fs_, posting_file, 1024);
 
     std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
     OstreamWriter wtr(ofs);
     FstBuilder fst_builder(wtr);
 
-    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_);
-    String term;
-    TermMeta term_meta;
     SizeT term_meta_offset = 0;
+    auto add_term = [&](const String &term, const TermMeta &term_meta) {
+        term_meta_dumpler.Dump(dict_file_writer, term_meta);
+        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+        term_meta_offset = dict_file_writer->TotalWrittenBytes();
+    };
 
     auto merge_base_rowid = base_rowids[0];
     for (auto& row_id : base_rowids) {
@@ -94,19 +94,70 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
         fs_.Close(*file_handler);
     }
 
-    while (!term_posting_queue.Empty()) {
-        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
-
-        MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid);
-
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
+    Vector<String> bounds = PartitionTerms(base_names);
+    if (bounds.empty()) {
+        SharedPtr<FileWriter> posting_file_writer = MakeShared<FileWriter>(fs_, posting_file, FULLTEXT_MERGE_WRITE_BUFFER_SIZE);
+        MergeRange(base_names, base_rowids, merge_base_rowid, String(), String(), posting_file_writer, memory_pool_, buffer_pool_, add_term);
+        posting_file_writer->Sync();
+    } else {
+        // Each key range is merged by its own thread, with its own pools, into its own posting file.
+        // The ranges are taken in key order as they finish: their term metas are moved past the postings
+        // of the previous ranges, and appended to the dictionary and the fst, which need sorted input.
+        const SizeT range_count = bounds.size() + 1;
+        Vector<String> range_posting_files(range_count, posting_file);
+        Vector<Vector<Pair<String, TermMeta>>> range_terms(range_count);
+        Vector<SizeT> range_posting_sizes(range_count, 0);
+        Vector<Thread> threads;
+        for (SizeT i = 0; i < range_count; ++i) {
+            if (i > 0) {
+                range_posting_files[i] = fmt::format("{}.{}", posting_file, i);
+            }
+            threads.emplace_back([&, i]() {
+                const String &begin = i == 0 ? String() : bounds[i - 1];
+                const String &end = i + 1 == range_count ? String() : bounds[i];
+                LocalFileSystem fs;
+                auto posting_file_writer = MakeShared<FileWriter>(fs,
+                                                                  range_posting_files[i],
+                                                                  FULLTEXT_MERGE_WRITE_BUFFER_SIZE,
+                                                                  FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE);
+                MemoryPool memory_pool;
+                RecyclePool buffer_pool;
+                Vector<Pair<String, TermMeta>> &terms = range_terms[i];
+                MergeRange(base_names,
+                           base_rowids,
+                           merge_base_rowid,
+                           begin,
+                           end,
+                           posting_file_writer,
+                           &memory_pool,
+                           &buffer_pool,
+                           [&](const String &term, const TermMeta &term_meta) { terms.emplace_back(term, term_meta); });
+                posting_file_writer->Sync();
+                range_posting_sizes[i] = posting_file_writer->TotalWrittenBytes();
+            });
+        }
 
-        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
-        term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_posting_queue.MoveToNextTerm();
+        const bool has_position_list = PostingFormatOption(flag_).HasPositionList();
+        SizeT posting_offset = 0;
+        for (SizeT i = 0; i < range_count; ++i) {
+            threads[i].join();
+            for (auto &[term, term_meta] : range_terms[i]) {
+                term_meta.doc_start_ += posting_offset;
+                if (has_position_list) {
+                    term_meta.pos_start_ += posting_offset;
+                    term_meta.pos_end_ += posting_offset;
+                }
+                add_term(term, term_meta);
+            }
+            Vector<Pair<String, TermMeta>>().swap(range_terms[i]);
+            posting_offset += range_posting_sizes[i];
+        }
+        for (SizeT i = 1; i < range_count; ++i) {
+            fs_.AppendFile(posting_file, range_posting_files[i]);
+            fs_.DeleteFile(range_posting_files[i]);
+        }
     }
     dict_file_writer->Sync();
-    posting_file_writer_->Sync();
     fst_builder.Finish();
     fs_.AppendFile(dict_file, fst_file);
     fs_.DeleteFile(fst_file);
@@ -114,16 +165,76 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     buffer_pool_->Release();
 }
 
-void ColumnIndexMerger::MergeTerm(const String &term,
-                                  TermMeta &term_meta,
+// Split keys of the ranges merged in parallel. They are taken from the dictionary of the source with the most
+// postings, at equal shares of its posting file, so that the ranges hold about the same amount of postings.
+Vector<String> ColumnIndexMerger::PartitionTerms(const Vector<String> &base_names) {
+    Vector<String> bounds;
+    SizeT total_size = 0;
+    SizeT largest_size = 0;
+    SizeT largest_idx = 0;
+    for (SizeT i = 0; i < base_names.size(); ++i) {
+        String posting_file = (Path(index_dir_) / base_names[i]).string() + POSTING_SUFFIX;
+        SizeT posting_size = LocalFileSystem::GetFileSizeByPath(posting_file);
+        total_size += posting_size;
+        if (posting_size > largest_size) {
+            largest_size = posting_size;
+            largest_idx = i;
+        }
+    }
+    SizeT part_count = part_count_;
+    if (part_count == 0) {
+        part_count = std::min<SizeT>({FULLTEXT_MERGE_MAX_PARTS, Thread::hardware_concurrency(), total_size / FULLTEXT_MERGE_MIN_PART_BYTES});
+    }
+    if (part_count <= 1 || largest_size == 0) {
+        return bounds;
+    }
+
+    String dict_file = (Path(index_dir_) / base_names[largest_idx]).string() + DICT_SUFFIX;
+    DictionaryReader dict_reader(dict_file, PostingFormatOption(flag_));
+    String term;
+    TermMeta term_meta;
+    SizeT next_bound = largest_size / part_count;
+    while (bounds.size() + 1 < part_count && dict_reader.Next(term, term_meta)) {
+        if (term_meta.doc_start_ >= next_bound && !term.empty()) {
+            bounds.push_back(term);
+            next_bound = largest_size * (bounds.size() + 1) / part_count;
+        }
+    }
+    return bounds;
+}
+
+void ColumnIndexMerger::MergeRange(const Vector<String> &base_names,
+                                   const Vector<RowID> &base_rowids,
+                                   const RowID &merge_base_rowid,
+                                   const String &begin,
+                                   const String &end,
+                                   const SharedPtr<FileWriter> &posting_file_writer,
+                                   MemoryPool *memory_pool,
+                                   RecyclePool *buffer_pool,
+                                   const AddTerm &add_term) {
+    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_, begin, end);
+    String term;
+    TermMeta term_meta;
+    while (!term_posting_queue.Empty()) {
+        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
+
+        MergeTerm(term_meta, merging_term_postings, merge_base_rowid, posting_file_writer, memory_pool, buffer_pool);
+
+        add_term(term, term_meta);
+        term_posting_queue.MoveToNextTerm();
+    }
+}
+
+void ColumnIndexMerger::MergeTerm(TermMeta &term_meta,
                                   const Vector<SegmentTermPosting *> &merging_term_postings,
-                                  const RowID &merge_base_rowid) {
-    SharedPtr<PostingMerger> posting_merger = CreatePostingMerger();
+                                  const RowID &merge_base_rowid,
+                                  const SharedPtr<FileWriter> &posting_file_writer,
+                                  MemoryPool *memory_pool,
+                                  RecyclePool *buffer_pool) {
+    SharedPtr<PostingMerger> posting_merger = MakeShared<PostingMerger>(memory_pool, buffer_pool, flag_, column_lengths_);
     posting_merger->Merge(merging_term_postings, merge_base_rowid);
 
-    posting_merger->Dump(posting_file_writer_, term_meta);
-//    memory_pool_->Reset();
-//    buffer_pool_->Reset();
+    posting_merger->Dump(posting_file_writer, term_meta);
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -20,24 +20,42 @@ import vector_with_lock;
 namespace infinity {
 export class ColumnIndexMerger {
 public:
-    ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool);
+    // part_count is the number of key ranges merged in parallel, 0 derives it from the size of the source postings
+    ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool, SizeT part_count = 0);
     ~ColumnIndexMerger();
 
     void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name);
 
 private:
-    SharedPtr<PostingMerger> CreatePostingMerger();
-
-    void MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
+    using AddTerm = std::function<void(const String &, const TermMeta &)>;
+
+    Vector<String> PartitionTerms(const Vector<String> &base_names);
+
+    void MergeRange(const Vector<String> &base_names,
+                    const Vector<RowID> &base_rowids,
+                    const RowID &merge_base_rowid,
+                    const String &begin,
+                    const String &end,
+                    const SharedPtr<FileWriter> &posting_file_writer,
+                    MemoryPool *memory_pool,
+                    RecyclePool *buffer_pool,
+                    const AddTerm &add_term);
+
+    void MergeTerm(TermMeta &term_meta,
+                   const Vector<SegmentTermPosting *> &merging_term_postings,
+                   const RowID &merge_base_rowid,
+                   const SharedPtr<FileWriter> &posting_file_writer,
+                   MemoryPool *memory_pool,
+                   RecyclePool *buffer_pool);
 
     String index_dir_;
     optionflag_t flag_;
     MemoryPool *memory_pool_{nullptr};
     RecyclePool *buffer_pool_{nullptr};
-    SharedPtr<FileWriter> posting_file_writer_;
+    SizeT part_count_{0};
     LocalFileSystem fs_;
 
     // for column length info
     VectorWithLock<u32> column_lengths_;
 };
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
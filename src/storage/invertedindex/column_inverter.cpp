@@ -74,6 +74,9 @@ SizeT ColumnInverter::InvertColumn(u32 doc_id, const String &val) {
     auto terms_once_ = MakeUnique<TermList>();
     analyzer_->Analyze(val, *terms_once_);
     SizeT term_count = terms_once_->size();
+    for (const Term &term : *terms_once_) {
+        term_bytes_ += sizeof(Term) + term.text_.size();
+    }
     terms_per_doc_.push_back(Pair<u32, UniquePtr<TermList>>(doc_id, std::move(terms_once_)));
     return term_count;
 }
@@ -105,6 +108,7 @@ void ColumnInverter::MergePrepare() {
         }
     }
     terms_per_doc_.clear();
+    term_bytes_ = 0;
 }
 
 void ColumnInverter::Merge(ColumnInverter &rhs) {
@@ -122,6 +126,7 @@ void ColumnInverter::Merge(ColumnInverter &rhs) {
     doc_count_ += rhs.doc_count_;
     merged_++;
     rhs.terms_per_doc_.clear();
+    rhs.term_bytes_ = 0;
     rhs.doc_count_ = 0;
     rhs.merged_ = 0;
 }
@@ -190,11 +195,13 @@ void ColumnInverter::Sort() {
                                                                                        16);
 }
 
-void ColumnInverter::GeneratePosting() {
+i64 ColumnInverter::GeneratePosting() {
     u32 last_term_num = std::numeric_limits<u32>::max();
     u32 last_doc_id = INVALID_DOCID;
     StringRef last_term, term;
     SharedPtr<PostingWriter> posting = nullptr;
+    i64 dump_length_growth = 0;
+    i64 dump_length = 0;
     // printf("GeneratePosting() begin begin_doc_id_ %u, doc_count_ %u, merged_ %u", begin_doc_id_, doc_count_, merged_);
     for (auto &i : positions_) {
         if (last_term_num != i.term_num_) {
@@ -202,9 +209,11 @@ void ColumnInverter::GeneratePosting() {
                 assert(posting.get() != nullptr);
                 posting->EndDocument(last_doc_id, 0);
                 // printf(" EndDocument1-%u\n", last_doc_id);
+                dump_length_growth += static_cast<i64>(posting->GetDumpLength()) - dump_length;
             }
             term = GetTermFromNum(i.term_num_);
             posting = posting_writer_provider_(String(term.data()));
+            dump_length = posting->GetDumpLength();
             // printf("\nswitched-term-%d-<%s>\n", i.term_num_, term.data());
             if (last_term_num != (u32)(-1)) {
                 assert(last_term_num < i.term_num_);
@@ -227,8 +236,10 @@ void ColumnInverter::GeneratePosting() {
     if (last_doc_id != INVALID_DOCID) {
         posting->EndDocument(last_doc_id, 0);
         // printf(" EndDocument3-%u\n", last_doc_id);
+        dump_length_growth += static_cast<i64>(posting->GetDumpLength()) - dump_length;
     }
     // printf("GeneratePosting() end begin_doc_id_ %u, doc_count_ %u, merged_ %u", begin_doc_id_, doc_count_, merged_);
+    return dump_length_growth;
 }
 
 void ColumnInverter::SortForOfflineDump() {
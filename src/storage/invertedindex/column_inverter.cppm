@@ -20,6 +20,7 @@ export module column_inverter;
 
 import stl;
 import analyzer;
+import analyzer_pool;
 
 import column_vector;
 import term;
@@ -49,10 +50,16 @@ public:
 
     void Sort();
 
-    void GeneratePosting();
+    // Returns how much the dump length of the postings changed.
+    i64 GeneratePosting();
 
     u32 GetDocCount() { return doc_count_; }
 
+    // Estimated heap bytes of the analyzed terms and of the sort buffers.
+    SizeT MemUsage() const {
+        return term_bytes_ + terms_.capacity() + positions_.capacity() * sizeof(PosInfo) + term_refs_.capacity() * sizeof(u32);
+    }
+
     u32 GetMerged() { return merged_; }
 
     struct PosInfo {
@@ -110,7 +117,7 @@ private:
 
     void MergePrepare();
 
-    UniquePtr<Analyzer> analyzer_{nullptr};
+    PooledAnalyzer analyzer_{nullptr};
     u32 begin_doc_id_{0};
     u32 doc_count_{0};
     u32 merged_{1};
@@ -118,6 +125,7 @@ private:
     PosInfoVec positions_;
     U32Vec term_refs_;
     Vector<Pair<u32, UniquePtr<TermList>>> terms_per_doc_;
+    SizeT term_bytes_{0};
     PostingWriterProvider posting_writer_provider_{};
     VectorWithLock<u32> &column_lengths_;
 };
@@ -69,6 +69,12 @@ void DictionaryReader::InitIterator(const String &min, const String &max) {
 
 void DictionaryReader::InitIterator(const String &prefix) { s_->Reset((u8 *)prefix.c_str(), prefix.length()); }
 
+void DictionaryReader::InitRangeIterator(const String &begin, const String &end) {
+    Bound min = begin.empty() ? Bound() : Bound(Bound::kIncluded, (u8 *)begin.c_str(), begin.length());
+    Bound max = end.empty() ? Bound() : Bound(Bound::kExcluded, (u8 *)end.c_str(), end.length());
+    s_->Reset(min, max);
+}
+
 bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     Vector<u8> key;
     u64 val;
@@ -42,6 +42,9 @@ public:
 
     void InitIterator(const String &prefix);
 
+    // iterates the terms in [begin, end), an empty bound leaves that side open
+    void InitRangeIterator(const String &begin, const String &end);
+
     bool Next(String &term, TermMeta &term_meta);
 };
 } // namespace infinity
@@ -33,6 +33,7 @@ import third_party;
 import byte_slice_reader;
 import infinity_exception;
 import status;
+import term_meta_cache;
 
 namespace infinity {
 
@@ -43,6 +44,7 @@ DiskIndexSegmentReader::DiskIndexSegmentReader(const String &index_dir, const St
     String dict_file = path_str;
     dict_file.append(DICT_SUFFIX);
     dict_reader_ = MakeShared<DictionaryReader>(dict_file, PostingFormatOption(flag));
+    chunk_id_ = TermMetaCache::ChunkId(dict_file);
     posting_file_ = path_str;
     posting_file_.append(POSTING_SUFFIX);
     int rc = fs_.MmapFile(posting_file_, data_ptr_, data_len_);
@@ -61,8 +63,18 @@ DiskIndexSegmentReader::~DiskIndexSegmentReader() {
 }
 
 bool DiskIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *session_pool, bool fetch_position) const {
+    if (!dict_reader_.get()) {
+        return false;
+    }
     TermMeta term_meta;
-    if (!dict_reader_.get() || !dict_reader_->Lookup(term, term_meta)) {
+    bool found = false;
+    if (chunk_id_ == 0 || !TermMetaCache::instance().Get(chunk_id_, term, term_meta, found)) {
+        found = dict_reader_->Lookup(term, term_meta);
+        if (chunk_id_ != 0) {
+            TermMetaCache::instance().Put(chunk_id_, term, found ? &term_meta : nullptr);
+        }
+    }
+    if (!found) {
         return false;
     }
     u64 file_length = fetch_position ? (term_meta.pos_end_ - term_meta.doc_start_) : (term_meta.pos_start_ - term_meta.doc_start_);
@@ -39,6 +39,8 @@ public:
 private:
     RowID base_row_id_{INVALID_ROWID};
     SharedPtr<DictionaryReader> dict_reader_;
+    // identity of the chunk in the TermMetaCache, 0 bypasses the cache
+    u64 chunk_id_{};
     String posting_file_{};
     u8 *data_ptr_{};
     SizeT data_len_{};
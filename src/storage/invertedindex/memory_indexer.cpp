@@ -54,6 +54,9 @@ import logger;
 import file_system;
 import file_system_type;
 import vector_with_lock;
+import doc_list_encoder;
+import position_list_encoder;
+import default_values;
 
 namespace infinity {
 constexpr int MAX_TUPLE_LENGTH = 1024; // we assume that analyzed term, together with docid/offset info, will never exceed such length
@@ -133,6 +136,7 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector, u32 row_offset
             // LOG_INFO(fmt::format("online inverter {} begin", id));
             SizeT column_length_sum = inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
             column_length_sum_ += column_length_sum;
+            inverting_bytes_ += inverter->MemUsage();
             this->ring_inverted_.Put(task->task_seq_, inverter);
             // LOG_INFO(fmt::format("online inverter {} end", id));
         };
@@ -187,29 +191,56 @@ SizeT MemoryIndexer::CommitOffline(SizeT wait_if_empty_ms) {
 }
 
 SizeT MemoryIndexer::CommitSync(SizeT wait_if_empty_ms) {
-    Vector<SharedPtr<ColumnInverter>> inverters;
-    // LOG_INFO("MemoryIndexer::CommitSync begin");
-    u64 seq_commit = this->ring_inverted_.GetBatch(inverters);
-    SizeT num_sorted = inverters.size();
     SizeT num_generated = 0;
-    // SizeT num_merged = 0;
-    if (num_sorted > 0) {
-        ColumnInverter::Merge(inverters);
-        inverters[0]->Sort();
-        this->ring_sorted_.Put(seq_commit, inverters[0]);
-    };
+    while (true) {
+        Vector<SharedPtr<ColumnInverter>> inverters;
+        // LOG_INFO("MemoryIndexer::CommitSync begin");
+        SizeT batch_size = commit_batch_size_.load();
+        u64 seq_commit = this->ring_inverted_.GetBatch(inverters, 0, batch_size);
+        SizeT num_sorted = inverters.size();
+        if (num_sorted > 0) {
+            auto begin = std::chrono::steady_clock::now();
+            i64 inverted_bytes = 0;
+            for (auto &inverter : inverters) {
+                inverted_bytes += inverter->MemUsage();
+            }
+            ColumnInverter::Merge(inverters);
+            inverters[0]->Sort();
+            inverting_bytes_ += static_cast<i64>(inverters[0]->MemUsage()) - inverted_bytes;
+            this->ring_sorted_.Put(seq_commit, inverters[0]);
+            auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+            AdaptCommitBatchSize(num_sorted, latency.count());
+        }
+
+        // a full batch may have left inverted documents in the ring, so there is no waiting for more
+        num_generated += CommitSorted(num_sorted < batch_size ? wait_if_empty_ms : 0);
+
+        // LOG_INFO(fmt::format("MemoryIndexer::CommitSync sorted {} inverters, generated posting for {} inverters, inflight_tasks_ is {}",
+        //                      num_sorted,
+        //                      num_generated,
+        //                      inflight_tasks_));
+
+        if (num_sorted < batch_size) {
+            break;
+        }
+    }
+    return num_generated;
+}
 
+SizeT MemoryIndexer::CommitSorted(SizeT wait_if_empty_ms) {
     std::unique_lock<std::mutex> lock(mutex_commit_, std::defer_lock);
     if (!lock.try_lock())
         return 0;
 
+    Vector<SharedPtr<ColumnInverter>> inverters;
+    SizeT num_generated = 0;
     while (1) {
         this->ring_sorted_.GetBatch(inverters, wait_if_empty_ms);
-        // num_merged = inverters.size();
         if (inverters.empty())
             break;
         for (auto &inverter : inverters) {
-            inverter->GeneratePosting();
+            posting_bytes_ += inverter->GeneratePosting();
+            inverting_bytes_ -= inverter->MemUsage();
             num_generated += inverter->GetMerged();
         }
     }
@@ -220,14 +251,23 @@ SizeT MemoryIndexer::CommitSync(SizeT wait_if_empty_ms) {
             cv_.notify_all();
         }
     }
+    return num_generated;
+}
 
-    // LOG_INFO(fmt::format("MemoryIndexer::CommitSync sorted {} inverters, generated posting for {} inverters(merged to {}), inflight_tasks_ is {}",
-    //                      num_sorted,
-    //                      num_generated,
-    //                      num_merged,
-    //                      inflight_tasks_));
+// Larger batches amortize merging and sorting, smaller ones make documents searchable sooner and need less memory.
+// The batch is halved when merging and sorting it took longer than the target latency, and doubled when a full batch took less than half of it.
+void MemoryIndexer::AdaptCommitBatchSize(SizeT batch_size, SizeT latency_ms) {
+    SizeT current = commit_batch_size_.load();
+    if (latency_ms > MEMINDEX_COMMIT_TARGET_LATENCY_MS) {
+        commit_batch_size_.store(std::max<SizeT>(1, std::min(current, batch_size) / 2));
+    } else if (latency_ms * 2 < MEMINDEX_COMMIT_TARGET_LATENCY_MS && batch_size >= current) {
+        commit_batch_size_.store(std::min(current * 2, MEMINDEX_COMMIT_MAX_BATCH_SIZE));
+    }
+}
 
-    return num_generated;
+SizeT MemoryIndexer::GetMemUsed() const {
+    i64 mem_used = posting_bytes_.load() + inverting_bytes_.load();
+    return std::max<i64>(mem_used, 0) + doc_count_ * sizeof(u32);
 }
 
 void MemoryIndexer::Dump(bool offline, bool spill) {
@@ -315,6 +355,7 @@ void MemoryIndexer::Load() {
         SharedPtr<PostingWriter> posting = GetOrAddPosting(term);
         posting_reader->Seek(term_meta.doc_start_);
         posting->Load(posting_reader);
+        posting_bytes_ += posting->GetDumpLength();
     }
 
     String column_length_file = index_prefix + LENGTH_SUFFIX + SPILL_SUFFIX;
@@ -335,6 +376,8 @@ SharedPtr<PostingWriter> MemoryIndexer::GetOrAddPosting(const String &term) {
     PostingPtr posting;
     bool found = posting_store.GetOrAdd(term, posting, prepared_posting_);
     if (!found) {
+        // the writer, its encoders and the key of the new term
+        posting_bytes_ += sizeof(PostingWriter) + sizeof(DocListEncoder) + sizeof(PositionListEncoder) + term.size();
         prepared_posting_ = MakeShared<PostingWriter>(nullptr, nullptr, PostingFormatOption(flag_), column_lengths_);
     }
     return posting;
@@ -345,6 +388,7 @@ void MemoryIndexer::Reset() {
         posting_table_->store_.Clear();
     }
     column_lengths_.Clear();
+    posting_bytes_ = 0;
 }
 
 void MemoryIndexer::OfflineDump() {
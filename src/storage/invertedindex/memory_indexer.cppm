@@ -30,6 +30,7 @@ import skiplist;
 import internal_types;
 import map_with_lock;
 import vector_with_lock;
+import default_values;
 
 namespace infinity {
 
@@ -97,6 +98,9 @@ public:
 
     u32 GetColumnLength(u32 doc_id) { return column_lengths_.Get(doc_id); }
 
+    // Estimated bytes of the postings, of the inverted documents whose postings are not generated yet and of the column lengths.
+    SizeT GetMemUsed() const;
+
     MemoryPool *GetPool() { return &byte_slice_pool_; }
 
     SharedPtr<PostingTable> GetPostingTable() { return posting_table_; }
@@ -114,6 +118,11 @@ private:
     // CommitOffline is for offline case. It spill a batch of ColumnInverter. Returns the size of the batch.
     SizeT CommitOffline(SizeT wait_if_empty_ms = 0);
 
+    // Generates the postings of the sorted inverters if no other thread does. Returns the number of inverters covered.
+    SizeT CommitSorted(SizeT wait_if_empty_ms);
+
+    void AdaptCommitBatchSize(SizeT batch_size, SizeT latency_ms);
+
     void OfflineDump();
 
     void FinalSpillFile();
@@ -151,5 +160,10 @@ private:
     // for column length info
     VectorWithLock<u32> column_lengths_;
     Atomic<u32> column_length_sum_{0};
+
+    // for memory usage info
+    Atomic<i64> posting_bytes_{0};
+    Atomic<i64> inverting_bytes_{0};
+    Atomic<SizeT> commit_batch_size_{MEMINDEX_COMMIT_INIT_BATCH_SIZE};
 };
 } // namespace infinity
@@ -74,7 +74,8 @@ public:
         return seq;
     }
 
-    u64 GetBatch(Vector<T> &batch, SizeT wait_if_empty_ms = 0) {
+    // Takes up to max_batch_size consecutive ready elements.
+    u64 GetBatch(Vector<T> &batch, SizeT wait_if_empty_ms = 0, SizeT max_batch_size = std::numeric_limits<SizeT>::max()) {
         batch.clear();
         std::unique_lock<std::mutex> lock(mutex_);
         if (off_ground_ == off_filled_) {
@@ -85,13 +86,14 @@ public:
                 return 0;
             }
         }
-        for (u64 off = off_ground_; off < off_filled_; off++) {
+        u64 off_end = off_ground_ + std::min<u64>(off_filled_ - off_ground_, max_batch_size);
+        for (u64 off = off_ground_; off < off_end; off++) {
             T &obj = ring_buf_[off & cap_mask_];
             batch.push_back(obj);
             obj = zero_;
         }
         // printf("%p Ring::GetBatch off_ground_ %lu, off_filled_ %lu, off_ceiling_ %lu\n", this, off_ground_, off_filled_, off_ceiling_);
-        off_ground_ = off_filled_;
+        off_ground_ = off_end;
         u64 seq = seq_get_++;
         cv_full_.notify_all();
         return seq;
@@ -148,7 +148,7 @@ std::unique_ptr<QueryNode> SearchDriver::AnalyzeAndBuildQueryNode(const std::str
             analyzer_name = it->second;
         }
     }
-    UniquePtr<Analyzer> analyzer = AnalyzerPool::instance().Get(analyzer_name);
+    PooledAnalyzer analyzer = AnalyzerPool::instance().Get(analyzer_name);
     if (analyzer.get() == nullptr) {
         RecoverableError(Status::UnexpectedError(String("Failed to get or initialize analyzer: ") + analyzer_name));
     }
@@ -46,6 +46,14 @@ export class SegmentTermPostingQueue {
 public:
     SegmentTermPostingQueue(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, optionflag_t flag);
 
+    // only merges the terms in [begin, end), an empty bound leaves that side open
+    SegmentTermPostingQueue(const String &index_dir,
+                            const Vector<String> &base_names,
+                            const Vector<RowID> &base_rowids,
+                            optionflag_t flag,
+                            const String &begin,
+                            const String &end);
+
     ~SegmentTermPostingQueue();
 
     bool Empty() const { return segment_term_postings_.empty(); }
@@ -0,0 +1,189 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include <sys/stat.h>
+
+module term_meta_cache;
+
+import stl;
+import term_meta;
+import buffer_manager;
+import default_values;
+
+namespace infinity {
+
+namespace {
+
+// the copy constructor of TermMeta leaves out the posting offsets
+void CopyTermMeta(const TermMeta &src, TermMeta &dst) {
+    dst = src;
+    dst.doc_start_ = src.doc_start_;
+    dst.pos_start_ = src.pos_start_;
+    dst.pos_end_ = src.pos_end_;
+}
+
+// list node, hash node and the key held by both of them
+SizeT EntrySize(const String &key) { return 2 * (sizeof(String) + key.size()) + sizeof(TermMeta) + 8 * sizeof(void *); }
+
+u64 HashCombine(u64 seed, u64 value) { return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)); }
+
+} // namespace
+
+void TermMetaCache::Init(BufferManager *buffer_mgr, SizeT capacity) {
+    if (buffer_mgr_ != nullptr) {
+        buffer_mgr_->SetSpaceReclaimer(nullptr);
+    }
+    for (auto &shard : shards_) {
+        std::unique_lock lock(shard.mutex_);
+        while (!shard.lru_.empty()) {
+            EvictLast(shard);
+        }
+        shard.hit_count_ = 0;
+        shard.miss_count_ = 0;
+    }
+    buffer_mgr_ = buffer_mgr;
+    shard_capacity_ = capacity / TERM_META_CACHE_SHARD_COUNT;
+    if (buffer_mgr_ != nullptr && shard_capacity_ != 0) {
+        buffer_mgr_->SetSpaceReclaimer([this](SizeT size) { Shrink(size); });
+    }
+}
+
+u64 TermMetaCache::ChunkId(const String &dict_file) {
+    struct stat file_stat {};
+    if (stat(dict_file.c_str(), &file_stat) != 0) {
+        return 0;
+    }
+    u64 chunk_id = HashCombine(file_stat.st_dev, file_stat.st_ino);
+    chunk_id = HashCombine(chunk_id, file_stat.st_size);
+    chunk_id = HashCombine(chunk_id, file_stat.st_mtim.tv_sec);
+    chunk_id = HashCombine(chunk_id, file_stat.st_mtim.tv_nsec);
+    return chunk_id == 0 ? 1 : chunk_id;
+}
+
+String TermMetaCache::MakeKey(u64 chunk_id, const String &term) {
+    String key(reinterpret_cast<const char *>(&chunk_id), sizeof(chunk_id));
+    key.append(term);
+    return key;
+}
+
+TermMetaCache::Shard &TermMetaCache::GetShard(const String &key) { return shards_[std::hash<String>{}(key) % TERM_META_CACHE_SHARD_COUNT]; }
+
+bool TermMetaCache::Get(u64 chunk_id, const String &term, TermMeta &term_meta, bool &found) {
+    if (shard_capacity_ == 0) {
+        return false;
+    }
+    String key = MakeKey(chunk_id, term);
+    Shard &shard = GetShard(key);
+    std::unique_lock lock(shard.mutex_);
+    auto iter = shard.entries_.find(key);
+    if (iter == shard.entries_.end()) {
+        ++shard.miss_count_;
+        return false;
+    }
+    ++shard.hit_count_;
+    shard.lru_.splice(shard.lru_.begin(), shard.lru_, iter->second);
+    const Entry &entry = *iter->second;
+    found = entry.found_;
+    if (found) {
+        CopyTermMeta(entry.term_meta_, term_meta);
+    }
+    return true;
+}
+
+void TermMetaCache::Put(u64 chunk_id, const String &term, const TermMeta *term_meta) {
+    if (shard_capacity_ == 0) {
+        return;
+    }
+    String key = MakeKey(chunk_id, term);
+    SizeT size = EntrySize(key);
+    if (size > shard_capacity_) {
+        return;
+    }
+    Shard &shard = GetShard(key);
+    std::unique_lock lock(shard.mutex_);
+    if (shard.entries_.contains(key)) {
+        // another reader missed the same term concurrently, its lookup gave the same result
+        return;
+    }
+    while (!shard.lru_.empty() && shard.memory_usage_ + size > shard_capacity_) {
+        EvictLast(shard);
+    }
+    // the buffer pool may be full of data blocks, the cache gives way to them
+    while (buffer_mgr_ != nullptr && !buffer_mgr_->TryReserveSpace(size)) {
+        if (shard.lru_.empty()) {
+            return;
+        }
+        EvictLast(shard);
+    }
+    Entry &entry = shard.lru_.emplace_front();
+    entry.key_ = key;
+    entry.found_ = term_meta != nullptr;
+    if (entry.found_) {
+        CopyTermMeta(*term_meta, entry.term_meta_);
+    }
+    entry.size_ = size;
+    shard.entries_.emplace(std::move(key), shard.lru_.begin());
+    shard.memory_usage_ += size;
+}
+
+void TermMetaCache::EvictLast(Shard &shard) {
+    Entry &entry = shard.lru_.back();
+    if (buffer_mgr_ != nullptr) {
+        buffer_mgr_->ReleaseSpace(entry.size_);
+    }
+    shard.memory_usage_ -= entry.size_;
+    shard.entries_.erase(entry.key_);
+    shard.lru_.pop_back();
+}
+
+SizeT TermMetaCache::Shrink(SizeT size) {
+    SizeT freed = 0;
+    while (freed < size) {
+        // each shard gives its share, so that the entries of one shard are not all dropped first
+        SizeT shard_share = (size - freed + TERM_META_CACHE_SHARD_COUNT - 1) / TERM_META_CACHE_SHARD_COUNT;
+        SizeT round_freed = 0;
+        for (auto &shard : shards_) {
+            std::unique_lock lock(shard.mutex_);
+            SizeT shard_freed = 0;
+            while (!shard.lru_.empty() && shard_freed < shard_share) {
+                shard_freed += shard.lru_.back().size_;
+                EvictLast(shard);
+            }
+            round_freed += shard_freed;
+        }
+        if (round_freed == 0) {
+            break;
+        }
+        freed += round_freed;
+    }
+    return freed;
+}
+
+TermMetaCacheMetrics TermMetaCache::Metrics() {
+    TermMetaCacheMetrics metrics;
+    for (auto &shard : shards_) {
+        std::unique_lock lock(shard.mutex_);
+        metrics.hit_count_ += shard.hit_count_;
+        metrics.miss_count_ += shard.miss_count_;
+        metrics.entry_count_ += shard.lru_.size();
+        metrics.memory_usage_ += shard.memory_usage_;
+    }
+    metrics.capacity_ = shard_capacity_ * TERM_META_CACHE_SHARD_COUNT;
+    return metrics;
+}
+
+} // namespace infinity
@@ -0,0 +1,91 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+export module term_meta_cache;
+
+import stl;
+import singleton;
+import term_meta;
+import buffer_manager;
+import default_values;
+
+namespace infinity {
+
+export struct TermMetaCacheMetrics {
+    u64 hit_count_{};
+    u64 miss_count_{};
+    u64 entry_count_{};
+    u64 memory_usage_{};
+    u64 capacity_{};
+
+    f64 HitRate() const { return hit_count_ + miss_count_ == 0 ? 0.0 : static_cast<f64>(hit_count_) / static_cast<f64>(hit_count_ + miss_count_); }
+};
+
+// Term lookups of the on-disk full text chunks, shared by the readers all queries create.
+// Absent terms are cached too, so query terms missing from most chunks skip the FST walk as well.
+// The cache is split into shards with their own lock and LRU list, the bytes of all entries are charged to the buffer manager,
+// which shrinks the cache when it runs out of buffers to free.
+export class TermMetaCache : public Singleton<TermMetaCache> {
+public:
+    // Drops all entries and charges the following ones to buffer_mgr, a zero capacity disables the cache.
+    void Init(BufferManager *buffer_mgr, SizeT capacity);
+
+    void UnInit() { Init(nullptr, 0); }
+
+    // Identity of the chunk owning dict_file, changes when the chunk is rewritten under the same name. 0 if the file can't be read.
+    static u64 ChunkId(const String &dict_file);
+
+    // Returns false on a miss. On a hit found tells whether the chunk has the term, and term_meta is filled when it has.
+    bool Get(u64 chunk_id, const String &term, TermMeta &term_meta, bool &found);
+
+    // term_meta is nullptr when the chunk doesn't have the term.
+    void Put(u64 chunk_id, const String &term, const TermMeta *term_meta);
+
+    TermMetaCacheMetrics Metrics();
+
+    // Evicts the least recently used entries of all shards until at least size bytes are freed or the cache is empty.
+    SizeT Shrink(SizeT size);
+
+private:
+    struct Entry {
+        String key_{};
+        bool found_{};
+        TermMeta term_meta_{};
+        SizeT size_{};
+    };
+
+    struct Shard {
+        std::mutex mutex_{};
+        List<Entry> lru_{};
+        HashMap<String, List<Entry>::iterator> entries_{};
+        SizeT memory_usage_{};
+        u64 hit_count_{};
+        u64 miss_count_{};
+    };
+
+    static String MakeKey(u64 chunk_id, const String &term);
+
+    Shard &GetShard(const String &key);
+
+    void EvictLast(Shard &shard);
+
+    BufferManager *buffer_mgr_{};
+    SizeT shard_capacity_{};
+    Array<Shard, TERM_META_CACHE_SHARD_COUNT> shards_{};
+};
+
+} // namespace infinity
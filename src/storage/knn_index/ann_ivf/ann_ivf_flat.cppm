@@ -22,6 +22,7 @@ import knn_distance;
 import infinity_exception;
 import index_base;
 import annivfflat_index_data;
+import index_ivfflat;
 import kmeans_partition;
 import vector_distance;
 import search_top_k;
@@ -54,13 +55,22 @@ public:
         result_handler_ = MakeUnique<ResultHandler>(query_count, top_k, distance_array_.get(), id_array_.get());
     }
 
-    static UniquePtr<AnnIVFFlatIndexData<DistType>> CreateIndex(u32 dimension, u32 vector_count, const DistType *vectors_ptr, u32 partition_num) {
-        return AnnIVFFlat<Compare, metric, algo>::CreateIndex(dimension, vector_count, vectors_ptr, vector_count, vectors_ptr, partition_num);
+    static UniquePtr<AnnIVFFlatIndexData<DistType>> CreateIndex(u32 dimension,
+                                                                u32 vector_count,
+                                                                const DistType *vectors_ptr,
+                                                                u32 partition_num,
+                                                                IVFEncodeType encode_type = IVFEncodeType::kPlain) {
+        return AnnIVFFlat<Compare, metric, algo>::CreateIndex(dimension, vector_count, vectors_ptr, vector_count, vectors_ptr, partition_num, encode_type);
     }
 
-    static UniquePtr<AnnIVFFlatIndexData<DistType>>
-    CreateIndex(u32 dimension, u32 train_count, const DistType *train_ptr, u32 vector_count, const DistType *vectors_ptr, u32 partition_num) {
-        auto index_data = MakeUnique<AnnIVFFlatIndexData<DistType>>(metric, dimension, partition_num);
+    static UniquePtr<AnnIVFFlatIndexData<DistType>> CreateIndex(u32 dimension,
+                                                                u32 train_count,
+                                                                const DistType *train_ptr,
+                                                                u32 vector_count,
+                                                                const DistType *vectors_ptr,
+                                                                u32 partition_num,
+                                                                IVFEncodeType encode_type = IVFEncodeType::kPlain) {
+        auto index_data = MakeUnique<AnnIVFFlatIndexData<DistType>>(metric, dimension, partition_num, encode_type);
         index_data->BuildIndex(dimension, train_count, train_ptr, vector_count, vectors_ptr);
         return index_data;
     }
@@ -86,65 +96,55 @@ public:
     void Search(const DistType *, u16, u32, u16, Bitmask &) final { UnrecoverableError("Unsupported search function"); }
 
     void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes) {
-        // check metric type
-        if (base_ivf->metric_ != metric) {
-            UnrecoverableError("Metric type is invalid");
-        }
+        SearchInner(base_ivf, segment_id, n_probes, [](SegmentOffset) { return true; });
+    }
+
+    template <typename Filter>
+    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, Filter &filter) {
+        SearchInner(base_ivf, segment_id, n_probes, [&filter](SegmentOffset segment_offset) { return filter(segment_offset); });
+    }
+
+    void End() final {
         if (!begin_) {
-            UnrecoverableError("IVFFlat isn't begin");
+            return;
         }
-        n_probes = std::min(n_probes, base_ivf->partition_num_);
-        if ((n_probes == 0) || (base_ivf->data_num_ == 0)) {
+        result_handler_->End();
+        begin_ = false;
+    }
+
+    void EndWithoutSort() {
+        if (!begin_) {
             return;
         }
-        this->total_base_count_ += base_ivf->data_num_;
-        if (n_probes == 1) {
-            auto assign_centroid_ids = MakeUniqueForOverwrite<u32[]>(this->query_count_);
-            search_top_1_without_dis<DistType>(this->dimension_,
-                                               this->query_count_,
-                                               this->queries_,
-                                               base_ivf->partition_num_,
-                                               base_ivf->centroids_.data(),
-                                               assign_centroid_ids.get());
-            for (u64 i = 0; i < this->query_count_; i++) {
-                u32 selected_centroid = assign_centroid_ids[i];
-                u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
-                for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                    DistType distance = Distance(x_i, y_j, this->dimension_);
-                    result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
-                }
-            }
-        } else {
-            auto centroid_dists = MakeUniqueForOverwrite<DistType[]>(n_probes * this->query_count_);
-            auto centroid_ids = MakeUniqueForOverwrite<u32[]>(n_probes * this->query_count_);
-            search_top_k_with_dis(n_probes,
-                                  this->dimension_,
-                                  this->query_count_,
-                                  queries_,
-                                  base_ivf->partition_num_,
-                                  base_ivf->centroids_.data(),
-                                  centroid_ids.get(),
-                                  centroid_dists.get(),
-                                  false);
-            for (u64 i = 0; i < this->query_count_; i++) {
-                const DistType *x_i = queries_ + i * this->dimension_;
-                for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
-                    const u32 selected_centroid = centroid_ids[k + i * n_probes];
-                    const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
-                    for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                        DistType distance = Distance(x_i, y_j, this->dimension_);
-                        result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
-                    }
-                }
-            }
+        result_handler_->EndWithoutSort();
+        begin_ = false;
+    }
+
+    [[nodiscard]] inline DistType *GetDistances() const final { return distance_array_.get(); }
+
+    [[nodiscard]] inline RowID *GetIDs() const final { return id_array_.get(); }
+
+    [[nodiscard]] inline DistType *GetDistanceByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            UnrecoverableError("Query index exceeds the limit");
         }
+        return distance_array_.get() + idx * this->top_k_;
     }
 
+    [[nodiscard]] inline RowID *GetIDByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            UnrecoverableError("Query index exceeds the limit");
+        }
+        return id_array_.get() + idx * this->top_k_;
+    }
+
+    [[nodiscard]] static constexpr DistType InvalidValue() { return Compare::InitialValue(); }
+
+    [[nodiscard]] static bool CompareDist(const DistType &a, const DistType &b) { return Compare::Compare(b, a); }
+
+private:
     template <typename Filter>
-    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, Filter &filter) {
+    void SearchInner(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, Filter &&filter) {
         // check metric type
         if (base_ivf->metric_ != metric) {
             UnrecoverableError("Metric type is invalid");
@@ -152,6 +152,7 @@ public:
         if (!begin_) {
             UnrecoverableError("IVFFlat isn't begin");
         }
+        std::shared_lock lock(base_ivf->rw_mutex_);
         n_probes = std::min(n_probes, base_ivf->partition_num_);
         if ((n_probes == 0) || (base_ivf->data_num_ == 0)) {
             return;
@@ -166,17 +167,8 @@ public:
                                                base_ivf->centroids_.data(),
                                                assign_centroid_ids.get());
             for (u64 i = 0; i < this->query_count_; i++) {
-                u32 selected_centroid = assign_centroid_ids[i];
-                u32 contain_nums = base_ivf->ids_[selected_centroid].size();
                 const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
-                for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                    auto segment_offset = base_ivf->ids_[selected_centroid][j];
-                    if (filter(segment_offset)) {
-                        DistType distance = Distance(x_i, y_j, this->dimension_);
-                        result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
-                    }
-                }
+                ScanPartition(base_ivf, i, x_i, assign_centroid_ids[i], segment_id, filter);
             }
         } else {
             auto centroid_dists = MakeUniqueForOverwrite<DistType[]>(n_probes * this->query_count_);
@@ -193,59 +185,37 @@ public:
             for (u64 i = 0; i < this->query_count_; i++) {
                 const DistType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
-                    const u32 selected_centroid = centroid_ids[k + i * n_probes];
-                    const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
-                    for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
-                        auto segment_offset = base_ivf->ids_[selected_centroid][j];
-                        if (filter(segment_offset)) {
-                            DistType distance = Distance(x_i, y_j, this->dimension_);
-                            result_handler_->AddResult(i, distance, RowID(segment_id, segment_offset));
-                        }
-                    }
+                    ScanPartition(base_ivf, i, x_i, centroid_ids[k + i * n_probes], segment_id, filter);
                 }
             }
         }
     }
 
-    void End() final {
-        if (!begin_) {
-            return;
-        }
-        result_handler_->End();
-        begin_ = false;
-    }
-
-    void EndWithoutSort() {
-        if (!begin_) {
+    // Scan one centroid list, either on raw vectors or on the encoded ones.
+    template <typename Filter>
+    void ScanPartition(const AnnIVFFlatIndexData<DistType> *base_ivf, u64 query_id, const DistType *x_i, u32 selected_centroid, u32 segment_id, Filter &&filter) {
+        const Vector<u32> &ids = base_ivf->ids_[selected_centroid];
+        const u32 contain_nums = ids.size();
+        if (base_ivf->Encoded()) {
+            for (u32 j = 0; j < contain_nums; j++) {
+                auto segment_offset = ids[j];
+                if (filter(segment_offset)) {
+                    DistType distance = base_ivf->CodeDistance(x_i, selected_centroid, j);
+                    result_handler_->AddResult(query_id, distance, RowID(segment_id, segment_offset));
+                }
+            }
             return;
         }
-        result_handler_->EndWithoutSort();
-        begin_ = false;
-    }
-
-    [[nodiscard]] inline DistType *GetDistances() const final { return distance_array_.get(); }
-
-    [[nodiscard]] inline RowID *GetIDs() const final { return id_array_.get(); }
-
-    [[nodiscard]] inline DistType *GetDistanceByIdx(u64 idx) const final {
-        if (idx >= this->query_count_) {
-            UnrecoverableError("Query index exceeds the limit");
-        }
-        return distance_array_.get() + idx * this->top_k_;
-    }
-
-    [[nodiscard]] inline RowID *GetIDByIdx(u64 idx) const final {
-        if (idx >= this->query_count_) {
-            UnrecoverableError("Query index exceeds the limit");
+        const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+        for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
+            auto segment_offset = ids[j];
+            if (filter(segment_offset)) {
+                DistType distance = Distance(x_i, y_j, this->dimension_);
+                result_handler_->AddResult(query_id, distance, RowID(segment_id, segment_offset));
+            }
         }
-        return id_array_.get() + idx * this->top_k_;
     }
 
-    [[nodiscard]] static constexpr DistType InvalidValue() { return Compare::InitialValue(); }
-
-    [[nodiscard]] static bool CompareDist(const DistType &a, const DistType &b) { return Compare::Compare(b, a); }
-
 private:
     UniquePtr<RowID[]> id_array_{};
     UniquePtr<DistType[]> distance_array_{};
@@ -14,6 +14,9 @@
 
 module;
 
+#include <algorithm>
+#include <cmath>
+
 export module annivfflat_index_data;
 
 import stl;
@@ -26,9 +29,33 @@ import infinity_exception;
 import logger;
 import third_party;
 import status;
+import index_ivfflat;
+import float16;
+import some_simd_functions;
+import default_values;
 
 namespace infinity {
 
+// Index files written before the encoded lists start with the metric, newer ones with this mark and their format version.
+constexpr i32 IVF_INDEX_FILE_MARK = -0x49564601;
+constexpr u32 IVF_INDEX_FILE_VERSION = 2;
+
+// Trained quantizers of an ivf index, shared by the segments of a table index so that new segments skip k-means.
+export struct IVFTrainedState {
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 partition_num_{};
+    IVFEncodeType encode_type_{IVFEncodeType::kPlain};
+    Vector<f32> centroids_;
+    Vector<f32> sq_min_;
+    Vector<f32> sq_scale_;
+    // how the quantizers were trained, see AnnIVFFlatIndexData::Shareable()
+    bool full_build_{};
+    u32 train_data_num_{};
+
+    [[nodiscard]] inline bool Shareable() const { return full_build_ || train_data_num_ >= IVF_MIN_SHARED_TRAIN_SIZE; }
+};
+
 export template <typename CentroidsDataType, typename VectorDataType = CentroidsDataType>
 struct AnnIVFFlatIndexData {
     using CommonType = std::common_type_t<VectorDataType, CentroidsDataType>;
@@ -37,13 +64,193 @@ struct AnnIVFFlatIndexData {
     u32 dimension_{};
     u32 partition_num_{};
     u32 data_num_{};
+    IVFEncodeType encode_type_{IVFEncodeType::kPlain};
     Vector<CentroidsDataType> centroids_;
     Vector<Vector<u32>> ids_;
+    // raw vectors of each partition, only used by kPlain
     Vector<Vector<VectorDataType>> vectors_;
+    // encoded vectors of each partition, CodeSize() bytes per vector, used by kSQ8 and kFP16
+    Vector<Vector<u8>> codes_;
+    // per dimension quantizer of kSQ8: value = sq_min_[d] + code * sq_scale_[d]
+    Vector<f32> sq_min_;
+    Vector<f32> sq_scale_;
+    // the quantizers come from BuildIndex over a whole segment rather than from the first batch of AppendData
+    bool full_build_{};
+    // number of vectors the quantizers were trained on
+    u32 train_data_num_{};
+    // segment offsets below it are already indexed, not persisted
+    u32 next_offset_{};
+    // searches of a growing index run concurrently with AppendData and SplitOverfullPartitions
+    mutable std::shared_mutex rw_mutex_;
 
     AnnIVFFlatIndexData() = default;
-    AnnIVFFlatIndexData(MetricType metric, u32 dimension, u32 partition_num)
-        : metric_(metric), dimension_(dimension), partition_num_(partition_num) {}
+    AnnIVFFlatIndexData(MetricType metric, u32 dimension, u32 partition_num, IVFEncodeType encode_type = IVFEncodeType::kPlain)
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), encode_type_(encode_type) {}
+
+    [[nodiscard]] inline SizeT CodeSize() const {
+        switch (encode_type_) {
+            case IVFEncodeType::kSQ8:
+                return dimension_ * sizeof(u8);
+            case IVFEncodeType::kFP16:
+                return dimension_ * sizeof(u16);
+            default:
+                return 0;
+        }
+    }
+
+    [[nodiscard]] inline bool Encoded() const { return encode_type_ != IVFEncodeType::kPlain; }
+
+    [[nodiscard]] inline bool Trained() const { return !centroids_.empty(); }
+
+    // Only quantizers of a full build or of a large enough first batch are shared with other segments.
+    [[nodiscard]] inline bool Shareable() const { return Trained() && (full_build_ || train_data_num_ >= IVF_MIN_SHARED_TRAIN_SIZE); }
+
+    // Distance between a query and the j-th encoded vector of a partition, computed without decoding the list.
+    [[nodiscard]] inline f32 CodeDistance(const f32 *query, u32 partition_id, u32 j) const {
+        const u8 *code = codes_[partition_id].data() + j * CodeSize();
+        switch (encode_type_) {
+            case IVFEncodeType::kSQ8: {
+                if (metric_ == MetricType::kMetricL2) {
+                    return L2DistanceSQ8_simd(query, code, sq_min_.data(), sq_scale_.data(), dimension_);
+                }
+                return IPDistanceSQ8_simd(query, code, sq_min_.data(), sq_scale_.data(), dimension_);
+            }
+            case IVFEncodeType::kFP16: {
+                const u16 *half_code = reinterpret_cast<const u16 *>(code);
+                if (metric_ == MetricType::kMetricL2) {
+                    return L2DistanceFP16_simd(query, half_code, dimension_);
+                }
+                return IPDistanceFP16_simd(query, half_code, dimension_);
+            }
+            default: {
+                UnrecoverableError("AnnIVFFlatIndexData::CodeDistance(): Index data is not encoded.");
+                return 0;
+            }
+        }
+    }
+
+    // Train the per dimension min / scale of the uint8 scalar quantizer.
+    inline void TrainQuantizer(const u32 vector_count, const VectorDataType *vector_data_ptr) {
+        if (encode_type_ != IVFEncodeType::kSQ8) {
+            return;
+        }
+        sq_min_.assign(dimension_, std::numeric_limits<f32>::max());
+        Vector<f32> sq_max(dimension_, std::numeric_limits<f32>::lowest());
+        for (u32 i = 0; i < vector_count; ++i) {
+            const VectorDataType *v = vector_data_ptr + i * dimension_;
+            for (u32 d = 0; d < dimension_; ++d) {
+                sq_min_[d] = std::min(sq_min_[d], static_cast<f32>(v[d]));
+                sq_max[d] = std::max(sq_max[d], static_cast<f32>(v[d]));
+            }
+        }
+        sq_scale_.resize(dimension_);
+        for (u32 d = 0; d < dimension_; ++d) {
+            f32 range = sq_max[d] - sq_min_[d];
+            sq_scale_[d] = range > 0 ? range / 255.0f : 1.0f;
+        }
+    }
+
+    // Widen the kSQ8 range to cover vectors appended after training, instead of clamping them to code 0 / 255.
+    // The codes already in the lists are re-encoded with the widened quantizer.
+    inline void WidenQuantizer(const u32 vector_count, const VectorDataType *vector_data_ptr) {
+        if (encode_type_ != IVFEncodeType::kSQ8) {
+            return;
+        }
+        Vector<f32> new_min = sq_min_;
+        Vector<f32> new_max(dimension_);
+        for (u32 d = 0; d < dimension_; ++d) {
+            new_max[d] = sq_min_[d] + 255.0f * sq_scale_[d];
+        }
+        bool widened = false;
+        for (u32 i = 0; i < vector_count; ++i) {
+            const VectorDataType *v = vector_data_ptr + i * dimension_;
+            for (u32 d = 0; d < dimension_; ++d) {
+                // values within half a step of the range round to code 0 / 255 anyway
+                const f32 value = static_cast<f32>(v[d]);
+                const f32 half_step = 0.5f * sq_scale_[d];
+                if (value < sq_min_[d] - half_step) {
+                    new_min[d] = std::min(new_min[d], value);
+                    widened = true;
+                } else if (value > sq_min_[d] + 255.0f * sq_scale_[d] + half_step) {
+                    new_max[d] = std::max(new_max[d], value);
+                    widened = true;
+                }
+            }
+        }
+        if (!widened) {
+            return;
+        }
+        Vector<f32> new_scale(dimension_);
+        for (u32 d = 0; d < dimension_; ++d) {
+            f32 range = new_max[d] - new_min[d];
+            new_scale[d] = range > 0 ? range / 255.0f : 1.0f;
+        }
+        const SizeT code_size = CodeSize();
+        for (auto &partition_codes : codes_) {
+            for (SizeT offset = 0; offset < partition_codes.size(); offset += code_size) {
+                u8 *code = partition_codes.data() + offset;
+                for (u32 d = 0; d < dimension_; ++d) {
+                    f32 value = sq_min_[d] + code[d] * sq_scale_[d];
+                    f32 q = std::round((value - new_min[d]) / new_scale[d]);
+                    code[d] = static_cast<u8>(std::clamp(q, 0.0f, 255.0f));
+                }
+            }
+        }
+        sq_min_ = std::move(new_min);
+        sq_scale_ = std::move(new_scale);
+        LOG_TRACE(fmt::format("AnnIVFFlatIndexData::WidenQuantizer(): sq8 range widened, {} vectors re-encoded", data_num_));
+    }
+
+    inline void DecodeVector(u32 partition_id, u32 j, f32 *output) const {
+        switch (encode_type_) {
+            case IVFEncodeType::kPlain: {
+                const VectorDataType *v = vectors_[partition_id].data() + j * dimension_;
+                for (u32 d = 0; d < dimension_; ++d) {
+                    output[d] = static_cast<f32>(v[d]);
+                }
+                break;
+            }
+            case IVFEncodeType::kSQ8: {
+                const u8 *code = codes_[partition_id].data() + j * CodeSize();
+                for (u32 d = 0; d < dimension_; ++d) {
+                    output[d] = sq_min_[d] + code[d] * sq_scale_[d];
+                }
+                break;
+            }
+            case IVFEncodeType::kFP16: {
+                const u16 *half_code = reinterpret_cast<const u16 *>(codes_[partition_id].data() + j * CodeSize());
+                for (u32 d = 0; d < dimension_; ++d) {
+                    output[d] = static_cast<f32>(float16_t(half_code[d]));
+                }
+                break;
+            }
+            default: {
+                UnrecoverableError("AnnIVFFlatIndexData::DecodeVector(): Invalid encode type.");
+            }
+        }
+    }
+
+    inline void EncodeVector(const VectorDataType *v, u8 *code) const {
+        switch (encode_type_) {
+            case IVFEncodeType::kSQ8: {
+                for (u32 d = 0; d < dimension_; ++d) {
+                    f32 q = std::round((static_cast<f32>(v[d]) - sq_min_[d]) / sq_scale_[d]);
+                    code[d] = static_cast<u8>(std::clamp(q, 0.0f, 255.0f));
+                }
+                break;
+            }
+            case IVFEncodeType::kFP16: {
+                u16 *half_code = reinterpret_cast<u16 *>(code);
+                for (u32 d = 0; d < dimension_; ++d) {
+                    half_code[d] = float16_t(static_cast<f32>(v[d])).raw;
+                }
+                break;
+            }
+            default: {
+                UnrecoverableError("AnnIVFFlatIndexData::EncodeVector(): Index data is not encoded.");
+            }
+        }
+    }
 
     // use existing vectors for training and insert
     // used in benchmark because there is no deleted rows
@@ -77,6 +284,10 @@ struct AnnIVFFlatIndexData {
         // step 1. train centroids
         TrainCentroids(train_count, train_ptr, min_points_per_centroid, max_points_per_centroid);
 
+        TrainQuantizer(vector_count, vectors_ptr);
+        full_build_ = true;
+        train_data_num_ = train_count;
+
         // step 2. insert data to partitions
         struct {
             u32 operator[](u32 i) { return i; }
@@ -146,6 +357,10 @@ struct AnnIVFFlatIndexData {
         // step 2. train centroids
         TrainCentroids(cnt, segment_column_data.data(), min_points_per_centroid, max_points_per_centroid);
 
+        TrainQuantizer(cnt, segment_column_data.data());
+        full_build_ = true;
+        train_data_num_ = cnt;
+
         // step 3. insert data to partitions, will update data_num_
         InsertData(cnt, segment_column_data.data(), segment_offset.data());
 
@@ -199,32 +414,234 @@ struct AnnIVFFlatIndexData {
         for (u32 i = 0; i < vector_count; ++i)
             ++partition_element_count[assigned_partition_id[i]];
         ids_.resize(partition_num_);
-        vectors_.resize(partition_num_);
+        if (Encoded()) {
+            codes_.resize(partition_num_);
+        } else {
+            vectors_.resize(partition_num_);
+        }
+        const SizeT code_size = CodeSize();
         for (u32 i = 0; i < partition_num_; ++i) {
-            ids_[i].reserve(partition_element_count[i]);
-            vectors_[i].reserve(partition_element_count[i] * dimension_);
+            ids_[i].reserve(ids_[i].size() + partition_element_count[i]);
+            if (Encoded()) {
+                codes_[i].reserve(codes_[i].size() + partition_element_count[i] * code_size);
+            } else {
+                vectors_[i].reserve(vectors_[i].size() + partition_element_count[i] * dimension_);
+            }
         }
 
         // step 3. Insert vectors into partitions
         for (u32 i = 0; i < vector_count; ++i) {
             auto vector_pos_i = vector_data_ptr + i * dimension_;
             auto partition_of_i = assigned_partition_id[i];
-            vectors_[partition_of_i].insert(vectors_[partition_of_i].end(), vector_pos_i, vector_pos_i + dimension_);
+            if (Encoded()) {
+                auto &partition_codes = codes_[partition_of_i];
+                partition_codes.resize(partition_codes.size() + code_size);
+                EncodeVector(vector_pos_i, partition_codes.data() + partition_codes.size() - code_size);
+            } else {
+                vectors_[partition_of_i].insert(vectors_[partition_of_i].end(), vector_pos_i, vector_pos_i + dimension_);
+            }
             ids_[partition_of_i].push_back(get_offset[i]);
+            next_offset_ = std::max<u32>(next_offset_, get_offset[i] + 1);
         }
 
         // step 4. Update data_num_
         data_num_ += vector_count;
     }
 
+    // Append vectors of a growing segment: they go to the nearest existing centroid, nothing is retrained.
+    // An empty index is trained on its first batch, lists that grow too large are split by SplitOverfullPartitions later.
+    // Rows below next_offset_ are already indexed (e.g. appends replayed after restart) and are skipped.
+    u32 AppendData(auto &&iter, const u32 min_points_per_centroid = 32, const u32 max_points_per_centroid = 256) {
+        // next_offset_ is read and written under the lock, concurrent appends shall not index the same rows twice
+        std::unique_lock lock(rw_mutex_);
+        Vector<VectorDataType> column_data;
+        Vector<SegmentOffset> segment_offset;
+        while (true) {
+            auto pair_opt = iter.Next();
+            if (!pair_opt) {
+                break;
+            }
+            auto &[val_ptr, offset] = pair_opt.value();
+            if (offset < next_offset_) {
+                continue;
+            }
+            column_data.insert(column_data.end(), val_ptr, val_ptr + dimension_);
+            segment_offset.push_back(offset);
+        }
+        const u32 cnt = segment_offset.size();
+
+        if (cnt > 0) {
+            if (!Trained()) {
+                // a small first batch shall not get one centroid per vector
+                const u32 max_partition_num = std::max(1u, partition_num_ != 0 ? partition_num_ : static_cast<u32>(std::sqrt(cnt)));
+                partition_num_ = std::clamp(cnt / min_points_per_centroid, 1u, max_partition_num);
+                TrainCentroids(cnt, column_data.data(), min_points_per_centroid, max_points_per_centroid);
+                TrainQuantizer(cnt, column_data.data());
+                full_build_ = false;
+                train_data_num_ = cnt;
+            } else {
+                WidenQuantizer(cnt, column_data.data());
+            }
+            InsertData(cnt, column_data.data(), segment_offset.data());
+        }
+        loaded_ = true;
+        return cnt;
+    }
+
+    [[nodiscard]] SharedPtr<IVFTrainedState> ExportTrainedState() const {
+        std::shared_lock lock(rw_mutex_);
+        if (!Trained()) {
+            return nullptr;
+        }
+        auto state = MakeShared<IVFTrainedState>();
+        state->metric_ = metric_;
+        state->dimension_ = dimension_;
+        state->partition_num_ = partition_num_;
+        state->encode_type_ = encode_type_;
+        state->centroids_.assign(centroids_.begin(), centroids_.end());
+        state->sq_min_ = sq_min_;
+        state->sq_scale_ = sq_scale_;
+        state->full_build_ = full_build_;
+        state->train_data_num_ = train_data_num_;
+        return state;
+    }
+
+    // Start an empty index from the quantizers trained by another segment.
+    void ImportTrainedState(const IVFTrainedState &state) {
+        std::unique_lock lock(rw_mutex_);
+        if (Trained() || data_num_ != 0) {
+            UnrecoverableError("AnnIVFFlatIndexData::ImportTrainedState(): Index data already exists.");
+        }
+        if (state.metric_ != metric_ || state.dimension_ != dimension_ || state.encode_type_ != encode_type_) {
+            UnrecoverableError("AnnIVFFlatIndexData::ImportTrainedState(): Trained state doesn't match the index.");
+        }
+        partition_num_ = state.partition_num_;
+        centroids_.assign(state.centroids_.begin(), state.centroids_.end());
+        sq_min_ = state.sq_min_;
+        sq_scale_ = state.sq_scale_;
+        full_build_ = state.full_build_;
+        train_data_num_ = state.train_data_num_;
+        ids_.resize(partition_num_);
+        if (Encoded()) {
+            codes_.resize(partition_num_);
+        } else {
+            vectors_.resize(partition_num_);
+        }
+        loaded_ = true;
+    }
+
+    // A list is over-full when it holds more than ratio times sqrt(data_num_), the list size of the default partition number.
+    [[nodiscard]] inline bool Overfull(u32 partition_id, const u32 ratio) const {
+        const u32 expected_size = static_cast<u32>(std::sqrt(data_num_));
+        return ids_[partition_id].size() > std::max(ratio * expected_size, 2u);
+    }
+
+    [[nodiscard]] bool HasOverfullPartition(const u32 ratio) const {
+        std::shared_lock lock(rw_mutex_);
+        if (!Trained() || data_num_ == 0) {
+            return false;
+        }
+        for (u32 p = 0; p < partition_num_; ++p) {
+            if (Overfull(p, ratio)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Split every over-full list in two with 2-means over its (decoded) vectors.
+    // Codes are moved as they are, the quantizers are kept. Returns the number of splits.
+    u32 SplitOverfullPartitions(const u32 ratio) {
+        std::unique_lock lock(rw_mutex_);
+        if (!Trained() || data_num_ == 0) {
+            return 0;
+        }
+        const SizeT code_size = CodeSize();
+        u32 split_cnt = 0;
+        Vector<f32> partition_vectors;
+        Vector<CentroidsDataType> sub_centroids;
+        // a split list is checked again, the new list is appended and checked at the end of the loop
+        for (u32 p = 0; p < partition_num_;) {
+            if (!Overfull(p, ratio)) {
+                ++p;
+                continue;
+            }
+            const u32 list_size = ids_[p].size();
+            partition_vectors.resize(list_size * dimension_);
+            for (u32 j = 0; j < list_size; ++j) {
+                DecodeVector(p, j, partition_vectors.data() + j * dimension_);
+            }
+            u32 sub_partition_num =
+                GetKMeansCentroids<CommonType>(metric_, dimension_, list_size, partition_vectors.data(), sub_centroids, 2);
+            if (sub_partition_num != 2) {
+                ++p;
+                continue;
+            }
+            auto assigned_sub_id = MakeUniqueForOverwrite<u32[]>(list_size);
+            search_top_1_without_dis<CommonType>(dimension_, list_size, partition_vectors.data(), 2, sub_centroids.data(), assigned_sub_id.get());
+
+            Vector<u32> kept_ids, moved_ids;
+            Vector<VectorDataType> kept_vectors, moved_vectors;
+            Vector<u8> kept_codes, moved_codes;
+            for (u32 j = 0; j < list_size; ++j) {
+                const bool moved = assigned_sub_id[j] == 1;
+                (moved ? moved_ids : kept_ids).push_back(ids_[p][j]);
+                if (Encoded()) {
+                    const u8 *code = codes_[p].data() + j * code_size;
+                    auto &target = moved ? moved_codes : kept_codes;
+                    target.insert(target.end(), code, code + code_size);
+                } else {
+                    const VectorDataType *v = vectors_[p].data() + j * dimension_;
+                    auto &target = moved ? moved_vectors : kept_vectors;
+                    target.insert(target.end(), v, v + dimension_);
+                }
+            }
+            if (kept_ids.empty() || moved_ids.empty()) {
+                // e.g. all vectors of the list are identical
+                ++p;
+                continue;
+            }
+            std::copy(sub_centroids.begin(), sub_centroids.begin() + dimension_, centroids_.begin() + p * dimension_);
+            centroids_.insert(centroids_.end(), sub_centroids.begin() + dimension_, sub_centroids.begin() + 2 * dimension_);
+            ids_[p] = std::move(kept_ids);
+            ids_.push_back(std::move(moved_ids));
+            if (Encoded()) {
+                codes_[p] = std::move(kept_codes);
+                codes_.push_back(std::move(moved_codes));
+            } else {
+                vectors_[p] = std::move(kept_vectors);
+                vectors_.push_back(std::move(moved_vectors));
+            }
+            ++partition_num_;
+            ++split_cnt;
+        }
+        if (split_cnt > 0) {
+            LOG_TRACE(fmt::format("AnnIVFFlatIndexData::SplitOverfullPartitions(): {} splits, partition_num_ = {}", split_cnt, partition_num_));
+        }
+        return split_cnt;
+    }
+
     void SaveIndexInner(FileHandler &file_handler) {
+        // the lists of a growing index are resized by AppendData and SplitOverfullPartitions
+        std::shared_lock lock(rw_mutex_);
         if (!loaded_) {
             UnrecoverableError("AnnIVFFlatIndexData::SaveIndexInner(): Index data not loaded.");
         }
+        file_handler.Write(&IVF_INDEX_FILE_MARK, sizeof(IVF_INDEX_FILE_MARK));
+        file_handler.Write(&IVF_INDEX_FILE_VERSION, sizeof(IVF_INDEX_FILE_VERSION));
         file_handler.Write(&metric_, sizeof(metric_));
         file_handler.Write(&dimension_, sizeof(dimension_));
-        file_handler.Write(&partition_num_, sizeof(partition_num_));
+        // an untrained index has no lists
+        u32 partition_num = Trained() ? partition_num_ : 0;
+        file_handler.Write(&partition_num, sizeof(partition_num));
         file_handler.Write(&data_num_, sizeof(data_num_));
+        file_handler.Write(&encode_type_, sizeof(encode_type_));
+        file_handler.Write(&full_build_, sizeof(full_build_));
+        file_handler.Write(&train_data_num_, sizeof(train_data_num_));
+        if (encode_type_ == IVFEncodeType::kSQ8) {
+            file_handler.Write(sq_min_.data(), sizeof(f32) * dimension_);
+            file_handler.Write(sq_scale_.data(), sizeof(f32) * dimension_);
+        }
         if (!centroids_.empty()) {
             file_handler.Write(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
             u32 vector_element_num;
@@ -232,7 +649,11 @@ struct AnnIVFFlatIndexData {
                 vector_element_num = ids_[i].size();
                 file_handler.Write(&vector_element_num, sizeof(vector_element_num));
                 file_handler.Write(ids_[i].data(), sizeof(u32) * vector_element_num);
-                file_handler.Write(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
+                if (Encoded()) {
+                    file_handler.Write(codes_[i].data(), CodeSize() * vector_element_num);
+                } else {
+                    file_handler.Write(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
+                }
             }
         }
     }
@@ -245,21 +666,62 @@ struct AnnIVFFlatIndexData {
     }
 
     void ReadIndexInner(FileHandler &file_handler) {
-        file_handler.Read(&metric_, sizeof(metric_));
+        i32 mark = 0;
+        file_handler.Read(&mark, sizeof(mark));
+        u32 version = 0;
+        if (mark == IVF_INDEX_FILE_MARK) {
+            file_handler.Read(&version, sizeof(version));
+            if (version > IVF_INDEX_FILE_VERSION) {
+                UnrecoverableError(fmt::format("AnnIVFFlatIndexData::ReadIndexInner(): unknown index file version {}", version));
+            }
+            file_handler.Read(&metric_, sizeof(metric_));
+        } else {
+            static_assert(sizeof(mark) == sizeof(metric_));
+            metric_ = static_cast<MetricType>(mark);
+        }
         file_handler.Read(&dimension_, sizeof(dimension_));
         file_handler.Read(&partition_num_, sizeof(partition_num_));
         file_handler.Read(&data_num_, sizeof(data_num_));
+        encode_type_ = IVFEncodeType::kPlain;
+        if (version >= 1) {
+            file_handler.Read(&encode_type_, sizeof(encode_type_));
+        }
+        // older indexes were all built over a whole segment
+        full_build_ = true;
+        train_data_num_ = data_num_;
+        if (version >= 2) {
+            file_handler.Read(&full_build_, sizeof(full_build_));
+            file_handler.Read(&train_data_num_, sizeof(train_data_num_));
+        }
+        if (encode_type_ == IVFEncodeType::kSQ8) {
+            sq_min_.resize(dimension_);
+            sq_scale_.resize(dimension_);
+            file_handler.Read(sq_min_.data(), sizeof(f32) * dimension_);
+            file_handler.Read(sq_scale_.data(), sizeof(f32) * dimension_);
+        }
         centroids_.resize(dimension_ * partition_num_);
         ids_.resize(partition_num_);
-        vectors_.resize(partition_num_);
+        if (Encoded()) {
+            codes_.resize(partition_num_);
+        } else {
+            vectors_.resize(partition_num_);
+        }
         file_handler.Read(centroids_.data(), sizeof(CentroidsDataType) * dimension_ * partition_num_);
         u32 vector_element_num;
         for (u32 i = 0; i < partition_num_; ++i) {
             file_handler.Read(&vector_element_num, sizeof(vector_element_num));
             ids_[i].resize(vector_element_num);
             file_handler.Read(ids_[i].data(), sizeof(u32) * vector_element_num);
-            vectors_[i].resize(dimension_ * vector_element_num);
-            file_handler.Read(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
+            if (Encoded()) {
+                codes_[i].resize(CodeSize() * vector_element_num);
+                file_handler.Read(codes_[i].data(), CodeSize() * vector_element_num);
+            } else {
+                vectors_[i].resize(dimension_ * vector_element_num);
+                file_handler.Read(vectors_[i].data(), sizeof(VectorDataType) * dimension_ * vector_element_num);
+            }
+            for (u32 id : ids_[i]) {
+                next_offset_ = std::max(next_offset_, id + 1);
+            }
         }
         loaded_ = true;
     }
@@ -47,6 +47,30 @@ inline Vector<u32> RandomPermutatePartially(u32 vector_count, u32 random_num = 0
     return permutation;
 }
 
+// Split [0, count) into contiguous ranges and run func(begin, end, thread_idx) on each of them in its own thread.
+template <typename Func>
+inline void ParallelForRange(u32 count, u32 thread_num, Func &&func) {
+    thread_num = std::max(1u, std::min(thread_num, count));
+    if (thread_num == 1) {
+        func(0u, count, 0u);
+        return;
+    }
+    Vector<Thread> threads;
+    threads.reserve(thread_num);
+    const u32 step = (count + thread_num - 1) / thread_num;
+    for (u32 t = 0; t < thread_num; ++t) {
+        const u32 begin = t * step;
+        const u32 end = std::min(count, begin + step);
+        if (begin >= end) {
+            break;
+        }
+        threads.emplace_back([&func, begin, end, t] { func(begin, end, t); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
 // normalize centroids
 template <typename CentroidType>
 inline void NormalizeCentroids(u32 dimension, u32 partition_num, CentroidType *centroids) {
@@ -65,6 +89,7 @@ inline void NormalizeCentroids(u32 dimension, u32 partition_num, CentroidType *c
 // CentroidsType: the type to calculate centroids
 // partition_num: the number of partitions, default to sqrt(vector_count)
 // iteration_max: the max iteration count, default to 10
+// thread_num: the number of threads used for assignment and centroid update, default to hardware concurrency
 export template <typename CentroidsType, typename ElemType, typename CentroidsOutputType>
 [[nodiscard]] u32 GetKMeansCentroids(const MetricType metric,
                                      const u32 dimension,
@@ -74,8 +99,11 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
                                      u32 partition_num = 0,
                                      u32 iteration_max = 0,
                                      u32 min_points_per_centroid = 32,
-                                     u32 max_points_per_centroid = 256) {
+                                     u32 max_points_per_centroid = 256,
+                                     u32 thread_num = 0) {
     constexpr int default_iteration_max = 10;
+    // below this many training vectors per thread the thread spawn cost dominates
+    constexpr u32 min_vectors_per_thread = 4096;
     if (metric != MetricType::kMetricL2 && metric != MetricType::kMetricInnerProduct) {
         UnrecoverableError("metric type not implemented");
     }
@@ -94,6 +122,9 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
     if (iteration_max <= 0) {
         iteration_max = default_iteration_max;
     }
+    if (thread_num == 0) {
+        thread_num = std::max(1u, Thread::hardware_concurrency());
+    }
     centroids_output_vector.resize(dimension * partition_num);
     CentroidsOutputType *centroids_output = centroids_output_vector.data();
     CentroidsType *centroids = nullptr;
@@ -174,6 +205,9 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
     Vector<f32> partition_element_distance(training_data_num);
     // Record the number of vectors in each partition
     Vector<u32> partition_element_count(partition_num);
+    // Threads actually used and their private centroid sums
+    const u32 work_thread_num = std::max(1u, std::min(thread_num, training_data_num / min_vectors_per_thread));
+    Vector<Vector<CentroidsType>> partial_centroid_sums(work_thread_num, Vector<CentroidsType>(partition_num * dimension));
 
     // Iteration
     for (u32 iter = 1; iter <= iteration_max; ++iter) {
@@ -181,14 +215,16 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         f32 this_iter_distance = 0;
         // First : assign each training vector to a partition
         {
-            // search top 1
-            search_top_1_with_dis(dimension,
-                                  training_data_num,
-                                  training_data,
-                                  partition_num,
-                                  centroids,
-                                  training_data_partition_id.data(),
-                                  partition_element_distance.data());
+            // search top 1, each thread assigns a contiguous range of the training data
+            ParallelForRange(training_data_num, work_thread_num, [&](u32 begin, u32 end, u32) {
+                search_top_1_with_dis(dimension,
+                                      end - begin,
+                                      training_data + begin * dimension,
+                                      partition_num,
+                                      centroids,
+                                      training_data_partition_id.data() + begin,
+                                      partition_element_distance.data() + begin);
+            });
             // Clear partition_element_count
             memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
             // calculate partition_element_count
@@ -200,14 +236,25 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         }
         // Second : update centroids
         {
-            // Clear old centroids data
-            memset(centroids, 0, sizeof(CentroidsType) * partition_num * dimension);
-            // Sum
-            for (u32 i = 0; i < training_data_num; ++i) {
-                auto vector_pos_i = training_data + i * dimension;
-                auto centroid_pos_i = centroids + training_data_partition_id[i] * dimension;
-                for (u32 j = 0; j < dimension; ++j) {
-                    centroid_pos_i[j] += vector_pos_i[j];
+            // Sum, each thread accumulates its range into a private buffer which are reduced afterwards
+            for (auto &partial_sum : partial_centroid_sums) {
+                std::fill(partial_sum.begin(), partial_sum.end(), CentroidsType{});
+            }
+            ParallelForRange(training_data_num, work_thread_num, [&](u32 begin, u32 end, u32 thread_idx) {
+                CentroidsType *partial_sum = partial_centroid_sums[thread_idx].data();
+                for (u32 i = begin; i < end; ++i) {
+                    auto vector_pos_i = training_data + i * dimension;
+                    auto centroid_pos_i = partial_sum + training_data_partition_id[i] * dimension;
+                    for (u32 j = 0; j < dimension; ++j) {
+                        centroid_pos_i[j] += vector_pos_i[j];
+                    }
+                }
+            });
+            memcpy(centroids, partial_centroid_sums[0].data(), sizeof(CentroidsType) * partition_num * dimension);
+            for (u32 t = 1; t < work_thread_num; ++t) {
+                const CentroidsType *partial_sum = partial_centroid_sums[t].data();
+                for (u32 i = 0; i < partition_num * dimension; ++i) {
+                    centroids[i] += partial_sum[i];
                 }
             }
             // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
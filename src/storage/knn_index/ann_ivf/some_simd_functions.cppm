@@ -25,6 +25,7 @@ export module some_simd_functions;
 
 import stl;
 import hnsw_simd_func;
+import float16;
 
 namespace infinity {
 
@@ -133,4 +134,150 @@ export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
 
 #endif
 
+// Distance between a f32 query and a scalar quantized (uint8) vector.
+// The vector is decoded as vmin[d] + code[d] * scale[d] on the fly.
+
+#if defined(__AVX2__)
+
+inline __m256 DecodeSQ8_8(const u8 *code, const f32 *vmin, const f32 *scale) {
+    const __m256i code_i32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(code)));
+    return _mm256_fmadd_ps(_mm256_cvtepi32_ps(code_i32), _mm256_loadu_ps(scale), _mm256_loadu_ps(vmin));
+}
+
+export f32 L2DistanceSQ8_simd(const f32 *query, const u8 *code, const f32 *vmin, const f32 *scale, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        auto diff_1 = _mm256_sub_ps(_mm256_loadu_ps(query + i), DecodeSQ8_8(code + i, vmin + i, scale + i));
+        auto diff_2 = _mm256_sub_ps(_mm256_loadu_ps(query + i + 8), DecodeSQ8_8(code + i + 8, vmin + i + 8, scale + i + 8));
+        sum_1 = _mm256_fmadd_ps(diff_1, diff_1, sum_1);
+        sum_2 = _mm256_fmadd_ps(diff_2, diff_2, sum_2);
+    }
+    if (i + 8 <= dimension) {
+        auto diff = _mm256_sub_ps(_mm256_loadu_ps(query + i), DecodeSQ8_8(code + i, vmin + i, scale + i));
+        sum_1 = _mm256_fmadd_ps(diff, diff, sum_1);
+        i += 8;
+    }
+    f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
+    for (; i < dimension; ++i) {
+        auto diff = query[i] - (vmin[i] + code[i] * scale[i]);
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+export f32 IPDistanceSQ8_simd(const f32 *query, const u8 *code, const f32 *vmin, const f32 *scale, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), DecodeSQ8_8(code + i, vmin + i, scale + i), sum_1);
+        sum_2 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 8), DecodeSQ8_8(code + i + 8, vmin + i + 8, scale + i + 8), sum_2);
+    }
+    if (i + 8 <= dimension) {
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), DecodeSQ8_8(code + i, vmin + i, scale + i), sum_1);
+        i += 8;
+    }
+    f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
+    for (; i < dimension; ++i) {
+        distance += query[i] * (vmin[i] + code[i] * scale[i]);
+    }
+    return distance;
+}
+
+#else
+
+export f32 L2DistanceSQ8_simd(const f32 *query, const u8 *code, const f32 *vmin, const f32 *scale, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        auto diff = query[i] - (vmin[i] + code[i] * scale[i]);
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+export f32 IPDistanceSQ8_simd(const f32 *query, const u8 *code, const f32 *vmin, const f32 *scale, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        distance += query[i] * (vmin[i] + code[i] * scale[i]);
+    }
+    return distance;
+}
+
+#endif
+
+// Distance between a f32 query and a half precision vector, widened with F16C when available.
+
+#if defined(__AVX2__) && defined(__F16C__)
+
+export f32 L2DistanceFP16_simd(const f32 *query, const u16 *code, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        auto y_1 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i)));
+        auto y_2 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i + 8)));
+        auto diff_1 = _mm256_sub_ps(_mm256_loadu_ps(query + i), y_1);
+        auto diff_2 = _mm256_sub_ps(_mm256_loadu_ps(query + i + 8), y_2);
+        sum_1 = _mm256_fmadd_ps(diff_1, diff_1, sum_1);
+        sum_2 = _mm256_fmadd_ps(diff_2, diff_2, sum_2);
+    }
+    if (i + 8 <= dimension) {
+        auto y = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i)));
+        auto diff = _mm256_sub_ps(_mm256_loadu_ps(query + i), y);
+        sum_1 = _mm256_fmadd_ps(diff, diff, sum_1);
+        i += 8;
+    }
+    f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
+    for (; i < dimension; ++i) {
+        auto diff = query[i] - _cvtsh_ss(code[i]);
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+export f32 IPDistanceFP16_simd(const f32 *query, const u16 *code, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        auto y_1 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i)));
+        auto y_2 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i + 8)));
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), y_1, sum_1);
+        sum_2 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 8), y_2, sum_2);
+    }
+    if (i + 8 <= dimension) {
+        auto y = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(code + i)));
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), y, sum_1);
+        i += 8;
+    }
+    f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
+    for (; i < dimension; ++i) {
+        distance += query[i] * _cvtsh_ss(code[i]);
+    }
+    return distance;
+}
+
+#else
+
+export f32 L2DistanceFP16_simd(const f32 *query, const u16 *code, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        auto diff = query[i] - static_cast<f32>(float16_t(code[i]));
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+export f32 IPDistanceFP16_simd(const f32 *query, const u16 *code, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        distance += query[i] * static_cast<f32>(float16_t(code[i]));
+    }
+    return distance;
+}
+
+#endif
+
 } // namespace infinity
\ No newline at end of file
@@ -30,53 +30,98 @@ import column_def;
 import index_hnsw;
 import infinity_exception;
 import index_base;
+import internal_types;
 
 namespace infinity {
 
-export template <typename DataType, typename LabelType>
-class AbstractHnsw {
+// The HNSW variants an embedding element type can be indexed with:
+// float vectors with plain or LVQ encoding, int8 and half precision vectors plain, bit vectors (packed in u8) with hamming distance.
+template <typename DataType, typename LabelType>
+struct HnswVariants {
     using Hnsw1 = KnnHnsw<PlainIPVecStoreType<DataType>, LabelType>;
     using Hnsw2 = KnnHnsw<PlainL2VecStoreType<DataType>, LabelType>;
     using Hnsw3 = KnnHnsw<LVQIPVecStoreType<DataType, i8>, LabelType>;
     using Hnsw4 = KnnHnsw<LVQL2VecStoreType<DataType, i8>, LabelType>;
+    using Ptr = std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *>;
+};
+
+template <typename DataType, typename LabelType>
+struct PlainHnswVariants {
+    using Hnsw1 = KnnHnsw<PlainIPVecStoreType<DataType>, LabelType>;
+    using Hnsw2 = KnnHnsw<PlainL2VecStoreType<DataType>, LabelType>;
+    using Ptr = std::variant<Hnsw1 *, Hnsw2 *>;
+};
+
+template <typename LabelType>
+struct HnswVariants<i8, LabelType> : PlainHnswVariants<i8, LabelType> {};
+
+template <typename LabelType>
+struct HnswVariants<Float16T, LabelType> : PlainHnswVariants<Float16T, LabelType> {};
+
+template <typename LabelType>
+struct HnswVariants<BFloat16T, LabelType> : PlainHnswVariants<BFloat16T, LabelType> {};
+
+template <typename LabelType>
+struct HnswVariants<u8, LabelType> {
+    using Hnsw1 = KnnHnsw<PlainHammingVecStoreType<u8>, LabelType>;
+    using Ptr = std::variant<Hnsw1 *>;
+};
+
+export template <typename DataType, typename LabelType>
+class AbstractHnsw {
+    using Variants = HnswVariants<DataType, LabelType>;
 
 public:
+    // all variants measure distances in f32
+    using DistanceType = f32;
+
     AbstractHnsw(void *ptr, const IndexHnsw *index_hnsw) {
-        switch (index_hnsw->encode_type_) {
-            case HnswEncodeType::kPlain: {
-                switch (index_hnsw->metric_type_) {
-                    case MetricType::kMetricInnerProduct: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw1 *>(ptr);
-                        break;
-                    }
-                    case MetricType::kMetricL2: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw2 *>(ptr);
-                        break;
-                    }
-                    default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
-                    }
-                }
-                break;
+        if constexpr (std::is_same_v<DataType, u8>) {
+            if (index_hnsw->encode_type_ != HnswEncodeType::kPlain || index_hnsw->metric_type_ != MetricType::kMetricHamming) {
+                UnrecoverableError("HNSW on bit embedding supports plain encoding and hamming distance.");
             }
-            case HnswEncodeType::kLVQ: {
-                switch (index_hnsw->metric_type_) {
-                    case MetricType::kMetricInnerProduct: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw3 *>(ptr);
-                        break;
-                    }
-                    case MetricType::kMetricL2: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw4 *>(ptr);
-                        break;
+            knn_hnsw_ptr_ = reinterpret_cast<typename Variants::Hnsw1 *>(ptr);
+        } else {
+            switch (index_hnsw->encode_type_) {
+                case HnswEncodeType::kPlain: {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricInnerProduct: {
+                            knn_hnsw_ptr_ = reinterpret_cast<typename Variants::Hnsw1 *>(ptr);
+                            break;
+                        }
+                        case MetricType::kMetricL2: {
+                            knn_hnsw_ptr_ = reinterpret_cast<typename Variants::Hnsw2 *>(ptr);
+                            break;
+                        }
+                        default: {
+                            UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        }
                     }
-                    default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
+                    break;
+                }
+                case HnswEncodeType::kLVQ: {
+                    if constexpr (!std::is_same_v<DataType, f32>) {
+                        UnrecoverableError("LVQ encoding is for float embedding.");
+                    } else {
+                        switch (index_hnsw->metric_type_) {
+                            case MetricType::kMetricInnerProduct: {
+                                knn_hnsw_ptr_ = reinterpret_cast<typename Variants::Hnsw3 *>(ptr);
+                                break;
+                            }
+                            case MetricType::kMetricL2: {
+                                knn_hnsw_ptr_ = reinterpret_cast<typename Variants::Hnsw4 *>(ptr);
+                                break;
+                            }
+                            default: {
+                                UnrecoverableError("HNSW supports inner product and L2 distance.");
+                            }
+                        }
                     }
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Invalid metric type");
                 }
-                break;
-            }
-            default: {
-                UnrecoverableError("Invalid metric type");
             }
         }
     }
@@ -139,33 +184,33 @@ public:
     }
 
     template <FilterConcept<LabelType> Filter>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
-    KnnSearch(const DataType *q, SizeT k, const Filter &filter, bool with_lock = true) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>>
+    KnnSearch(const DataType *q, SizeT k, SizeT ef, const Filter &filter, bool with_lock = true) const {
         return std::visit(
-            [q, k, &filter, with_lock](auto &&arg) {
+            [q, k, ef, &filter, with_lock](auto &&arg) {
                 if (with_lock) {
-                    return arg->template KnnSearch<Filter, true>(q, k, filter);
+                    return arg->template KnnSearch<Filter, true>(q, k, ef, filter);
                 } else {
-                    return arg->template KnnSearch<Filter, false>(q, k, filter);
+                    return arg->template KnnSearch<Filter, false>(q, k, ef, filter);
                 }
             },
             knn_hnsw_ptr_);
     }
 
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, bool with_lock = true) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, SizeT ef, bool with_lock = true) const {
         return std::visit(
-            [q, k, with_lock](auto &&arg) {
+            [q, k, ef, with_lock](auto &&arg) {
                 if (with_lock) {
-                    return arg->template KnnSearch<true>(q, k);
+                    return arg->template KnnSearch<NoneType, true>(q, k, ef, None);
                 } else {
-                    return arg->template KnnSearch<false>(q, k);
+                    return arg->template KnnSearch<NoneType, false>(q, k, ef, None);
                 }
             },
             knn_hnsw_ptr_);
     }
 
 private:
-    std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *> knn_hnsw_ptr_;
+    typename Variants::Ptr knn_hnsw_ptr_;
 };
 
 } // namespace infinity
\ No newline at end of file
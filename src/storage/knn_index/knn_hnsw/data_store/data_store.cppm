@@ -23,6 +23,7 @@ import stl;
 import hnsw_common;
 import file_system;
 import vec_store_type;
+import plain_vec_store;
 import graph_store;
 
 namespace infinity {
@@ -248,7 +249,7 @@ public:
 
 private:
     constexpr static bool IsPlain() {
-        return std::is_same_v<VecStoreT, PlainL2VecStoreType<DataType>> || std::is_same_v<VecStoreT, PlainIPVecStoreType<DataType>>;
+        return std::is_same_v<typename VecStoreT::Meta, PlainVecStoreMeta<DataType>>;
     }
 
     Pair<Inner &, SizeT> GetInner(SizeT vec_i) { return {inners_[vec_i >> chunk_shift_], vec_i & (chunk_size_ - 1)}; }
@@ -115,7 +115,11 @@ public:
             os << "vec " << i << "(" << offset + i << "): ";
             const DataType *v = GetVec(i, meta);
             for (SizeT j = 0; j < meta.dim(); j++) {
-                os << v[j] << " ";
+                if constexpr (std::is_integral_v<DataType>) {
+                    os << static_cast<i32>(v[j]) << " ";
+                } else {
+                    os << v[j] << " ";
+                }
             }
             os << std::endl;
         }
@@ -21,6 +21,7 @@ import plain_vec_store;
 import lvq_vec_store;
 import dist_func_l2;
 import dist_func_ip;
+import dist_func_hamming;
 
 namespace infinity {
 
@@ -33,6 +34,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = PlainL2Dist<DataType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 export template <typename DataT>
@@ -44,6 +46,20 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = PlainIPDist<DataType>;
+    using DistanceType = typename Distance::DistanceType;
+};
+
+// binary embeddings packed 8 dimensions per u8
+export template <typename DataT>
+class PlainHammingVecStoreType {
+public:
+    using DataType = DataT;
+    using Meta = PlainVecStoreMeta<DataType>;
+    using Inner = PlainVecStoreInner<DataType>;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = PlainHammingDist<DataType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 export template <typename DataT, typename CompressT>
@@ -56,6 +72,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = LVQL2Dist<DataType, CompressType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 export template <typename DataT, typename CompressT>
@@ -68,6 +85,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = LVQIPDist<DataType, CompressType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 } // namespace infinity
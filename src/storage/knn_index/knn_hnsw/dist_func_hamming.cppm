@@ -0,0 +1,60 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import hnsw_common;
+import hnsw_simd_func;
+import plain_vec_store;
+
+export module dist_func_hamming;
+
+namespace infinity {
+
+// Hamming distance of binary embeddings, each u8 holds 8 dimensions and the store dimension is counted in bytes.
+export template <typename DataType>
+class PlainHammingDist {
+public:
+    using VecStoreMeta = PlainVecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = f32;
+
+private:
+    using SIMDFuncType = i32 (*)(const DataType *, const DataType *, SizeT);
+
+    SIMDFuncType SIMDFunc;
+
+public:
+    PlainHammingDist() : SIMDFunc(nullptr) {}
+    PlainHammingDist(PlainHammingDist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    PlainHammingDist &operator=(PlainHammingDist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~PlainHammingDist() = default;
+
+    PlainHammingDist(SizeT) {
+        static_assert(std::is_same<DataType, u8>(), "Hamming distance is defined on packed bits.");
+        SIMDFunc = BitHamming;
+    }
+
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        return static_cast<DistanceType>(SIMDFunc(v1, v2, vec_store_meta.dim()));
+    }
+};
+
+} // namespace infinity
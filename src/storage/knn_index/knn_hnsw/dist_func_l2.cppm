@@ -20,6 +20,7 @@ module;
 import stl;
 import hnsw_common;
 import hnsw_simd_func;
+import internal_types;
 import plain_vec_store;
 import lvq_vec_store;
 
@@ -32,9 +33,11 @@ class PlainL2Dist {
 public:
     using VecStoreMeta = PlainVecStoreMeta<DataType>;
     using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = PlainDistanceType<DataType>;
 
 private:
-    using SIMDFuncType = DataType (*)(const DataType *, const DataType *, SizeT);
+    using SIMDResultType = std::conditional_t<std::is_integral_v<DataType>, i32, DistanceType>;
+    using SIMDFuncType = SIMDResultType (*)(const DataType *, const DataType *, SizeT);
 
     SIMDFuncType SIMDFunc;
 
@@ -72,11 +75,17 @@ public:
 #else
             SIMDFunc = F32IPBF;
 #endif
+        } else if constexpr (std::is_same<DataType, i8>()) {
+            SIMDFunc = I8L2;
+        } else if constexpr (std::is_same<DataType, Float16T>()) {
+            SIMDFunc = F16L2;
+        } else if constexpr (std::is_same<DataType, BFloat16T>()) {
+            SIMDFunc = BF16L2;
         }
     }
 
-    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
-        return SIMDFunc(v1, v2, vec_store_meta.dim());
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        return static_cast<DistanceType>(SIMDFunc(v1, v2, vec_store_meta.dim()));
     }
 };
 
@@ -113,6 +122,7 @@ public:
     using This = LVQL2Dist<DataType, CompressType>;
     using VecStoreMeta = LVQVecStoreMeta<DataType, CompressType, LVQL2Cache<DataType, CompressType>>;
     using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = DataType;
 
 private:
     using SIMDFuncType = i32 (*)(const CompressType *, const CompressType *, SizeT);
@@ -46,10 +46,11 @@ public:
     using StoreType = typename VecStoreType::StoreType;
     using DataStore = DataStore<VecStoreType, LabelType>;
     using Distance = typename VecStoreType::Distance;
+    using DistanceType = typename VecStoreType::DistanceType;
 
-    using PDV = Pair<DataType, VertexType>;
-    using CMP = CompareByFirst<DataType, VertexType>;
-    using CMPReverse = CompareByFirstReverse<DataType, VertexType>;
+    using PDV = Pair<DistanceType, VertexType>;
+    using CMP = CompareByFirst<DistanceType, VertexType>;
+    using CMPReverse = CompareByFirstReverse<DistanceType, VertexType>;
     using DistHeap = Heap<PDV, CMP>;
 
     constexpr static int prefetch_offset_ = 0;
@@ -124,11 +125,11 @@ private:
 
     // return the nearest `ef_construction_` neighbors of `query` in layer `layer_idx`
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>>
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>>
     SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
-        auto d_ptr = MakeUniqueForOverwrite<DataType[]>(result_n);
+        auto d_ptr = MakeUniqueForOverwrite<DistanceType[]>(result_n);
         auto i_ptr = MakeUniqueForOverwrite<VertexType[]>(result_n);
-        HeapResultHandler<CompareMax<DataType, VertexType>> result_handler(1, result_n, d_ptr.get(), i_ptr.get());
+        HeapResultHandler<CompareMax<DistanceType, VertexType>> result_handler(1, result_n, d_ptr.get(), i_ptr.get());
         result_handler.Begin();
         DistHeap candidate;
 
@@ -196,7 +197,7 @@ private:
     template <bool WithLock>
     VertexType SearchLayerNearest(VertexType enter_point, const StoreType &query, i32 layer_idx) const {
         VertexType cur_p = enter_point;
-        DataType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_.vec_store_meta());
+        DistanceType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_.vec_store_meta());
         bool check = true;
         while (check) {
             check = false;
@@ -209,7 +210,7 @@ private:
             const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(cur_p, layer_idx);
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                DataType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
+                DistanceType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
                 if (n_dist < cur_dist) {
                     cur_p = n_idx;
                     cur_dist = n_dist;
@@ -237,7 +238,7 @@ private:
                 bool check = true;
                 for (SizeT i = 0; i < SizeT(result_size); ++i) {
                     VertexType r_idx = result_p[i];
-                    DataType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_.vec_store_meta());
+                    DistanceType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_.vec_store_meta());
                     if (cr_dist < c_dist) {
                         check = false;
                         break;
@@ -268,7 +269,7 @@ private:
                 continue;
             }
             StoreType n_data = data_store_.GetVec(n_idx);
-            DataType n_dist = distance_(n_data, data_store_.GetVec(vertex_i), data_store_.vec_store_meta());
+            DistanceType n_dist = distance_(n_data, data_store_.GetVec(vertex_i), data_store_.vec_store_meta());
 
             Vector<PDV> candidates;
             candidates.reserve(n_neighbor_size + 1);
@@ -284,7 +285,7 @@ private:
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, const Filter &filter) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, SizeT ef, const Filter &filter) const {
         auto query = data_store_.MakeQuery(q);
         auto [max_layer, ep] = data_store_.GetEnterPoint();
         if (ep == -1) {
@@ -293,7 +294,7 @@ private:
         for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
         }
-        return SearchLayer<WithLock, Filter>(ep, query, 0, std::max(k, ef_), filter);
+        return SearchLayer<WithLock, Filter>(ep, query, 0, std::max(k, ef), filter);
     }
 
 public:
@@ -354,9 +355,10 @@ public:
         }
     }
 
+    // ef is passed per call so concurrent searches on a shared index do not overwrite ef_
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
-        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, SizeT ef, const Filter &filter) const {
+        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, ef, filter);
         auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             labels[i] = GetLabel(v_ptr[i]);
@@ -364,16 +366,21 @@ public:
         return {result_n, std::move(d_ptr), std::move(labels)};
     }
 
+    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
+        return KnnSearch<Filter, WithLock>(q, k, ef_, filter);
+    }
+
     template <bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k) const {
         return KnnSearch<NoneType, WithLock>(q, k, None);
     }
 
     // function for test, add sort for convenience
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
-    Vector<Pair<DataType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k, const Filter &filter) const {
-        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
-        Vector<Pair<DataType, LabelType>> result(result_n);
+    Vector<Pair<DistanceType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k, const Filter &filter) const {
+        auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, ef_, filter);
+        Vector<Pair<DistanceType, LabelType>> result(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             result[i] = {d_ptr[i], GetLabel(v_ptr[i])};
         }
@@ -382,7 +389,7 @@ public:
     }
 
     // function for test
-    Vector<Pair<DataType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k) const { return KnnSearchSorted<NoneType>(q, k, None); }
+    Vector<Pair<DistanceType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k) const { return KnnSearchSorted<NoneType>(q, k, None); }
 
     void SetEf(SizeT ef) { ef_ = ef; }
 
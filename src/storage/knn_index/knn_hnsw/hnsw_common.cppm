@@ -36,6 +36,11 @@ export using VertexType = i32;
 export using VertexListSize = i32;
 export using LayerSize = i32;
 
+// Distance of two plain vectors: integer and bit vectors are accumulated exactly in i32 by the kernels and compared as f32,
+// half precision vectors are widened and accumulated in f32.
+export template <typename DataType>
+using PlainDistanceType = std::conditional_t<std::is_same_v<DataType, f64>, f64, f32>;
+
 export template <typename Iterator, typename DataType, typename LabelType>
 concept DataIteratorConcept = requires(Iterator iter) {
     { iter.Next() } -> std::same_as<Optional<Pair<DataType, LabelType>>>;
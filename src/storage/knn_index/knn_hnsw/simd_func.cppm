@@ -15,6 +15,10 @@
 module;
 
 #include "header.h"
+#include "type/number/bfloat16.h"
+#include "type/number/float16.h"
+#include <bit>
+#include <cstring>
 
 import stl;
 
@@ -60,11 +64,17 @@ export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
         v2 = _mm512_loadu_si512((__m512i_u *)pv2);
         pv2 += 64;
 
+#if defined(__AVX512VNNI__)
+        // u8 * i8 products summed into i32 lanes in one instruction
+        low7 = _mm512_dpbusd_epi32(_mm512_setzero_si512(), _mm512_andnot_si512(highest_bit, v1), v2);
+        msb = _mm512_dpbusd_epi32(_mm512_setzero_si512(), _mm512_and_si512(v1, highest_bit), v2);
+#else
         msb = _mm512_maddubs_epi16(_mm512_and_si512(v1, highest_bit), v2);
         low7 = _mm512_maddubs_epi16(_mm512_andnot_si512(highest_bit, v1), v2);
 
         low7 = _mm512_madd_epi16(low7, _mm512_set1_epi16(1));
         msb = _mm512_madd_epi16(msb, _mm512_set1_epi16(1));
+#endif
 
         sum = _mm512_add_epi32(sum, _mm512_sub_epi32(low7, msb));
     }
@@ -152,6 +162,136 @@ export int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim)
 
 #endif
 
+// inner product of any dimension with the widest kernel available
+export int32_t I8IP(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return I8IPAVX512Residual(pv1, pv2, dim);
+#elif defined(USE_AVX)
+    return I8IPAVXResidual(pv1, pv2, dim);
+#elif defined(USE_SSE)
+    return I8IPSSEResidual(pv1, pv2, dim);
+#else
+    return I8IPBF(pv1, pv2, dim);
+#endif
+}
+
+//------------------------------//------------------------------//------------------------------
+
+export int32_t I8L2BF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        int32_t t = (int16_t)(pv1[i]) - pv2[i];
+        res += t * t;
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+export int32_t I8L2AVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    size_t dim32 = dim >> 5;
+    const int8_t *pend1 = pv1 + (dim32 << 5);
+
+    // the differences need 9 bits, widen to i16 and square-accumulate pairs into i32
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pend1) {
+        __m512i v1 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)pv1));
+        pv1 += 32;
+        __m512i v2 = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)pv2));
+        pv2 += 32;
+        __m512i diff = _mm512_sub_epi16(v1, v2);
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(diff, diff));
+    }
+    return _mm512_reduce_add_epi32(sum);
+}
+
+export int32_t I8L2AVX512Residual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    return I8L2AVX512(pv1, pv2, dim) + I8L2BF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
+}
+#endif
+
+#if defined(USE_AVX)
+export int32_t I8L2AVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    size_t dim16 = dim >> 4;
+    const int8_t *pend1 = pv1 + (dim16 << 4);
+
+    __m256i sum = _mm256_setzero_si256();
+    while (pv1 < pend1) {
+        __m256i v1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)pv1));
+        pv1 += 16;
+        __m256i v2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)pv2));
+        pv2 += 16;
+        __m256i diff = _mm256_sub_epi16(v1, v2);
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(diff, diff));
+    }
+
+    // Horizontal add
+    sum = _mm256_hadd_epi32(sum, sum);
+    sum = _mm256_hadd_epi32(sum, sum);
+
+    // Extract the result
+    return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4);
+}
+
+export int32_t I8L2AVXResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    return I8L2AVX(pv1, pv2, dim) + I8L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
+}
+#endif
+
+// squared l2 distance of any dimension with the widest kernel available
+export int32_t I8L2(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return I8L2AVX512Residual(pv1, pv2, dim);
+#elif defined(USE_AVX)
+    return I8L2AVXResidual(pv1, pv2, dim);
+#else
+    return I8L2BF(pv1, pv2, dim);
+#endif
+}
+
+//------------------------------//------------------------------//------------------------------
+
+// Hamming distance of two bit vectors, `size` is the number of bytes
+export int32_t BitHammingBF(const uint8_t *pv1, const uint8_t *pv2, size_t size) {
+    int32_t res = 0;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w1, w2;
+        std::memcpy(&w1, pv1 + i, 8);
+        std::memcpy(&w2, pv2 + i, 8);
+        res += std::popcount(w1 ^ w2);
+    }
+    for (; i < size; i++) {
+        res += std::popcount(static_cast<uint8_t>(pv1[i] ^ pv2[i]));
+    }
+    return res;
+}
+
+#if defined(USE_AVX512) && defined(__AVX512VPOPCNTDQ__)
+export int32_t BitHammingAVX512(const uint8_t *pv1, const uint8_t *pv2, size_t size) {
+    size_t size64 = size >> 6;
+    const uint8_t *pend1 = pv1 + (size64 << 6);
+
+    __m512i sum = _mm512_setzero_si512();
+    while (pv1 < pend1) {
+        __m512i v1 = _mm512_loadu_si512((const __m512i_u *)pv1);
+        pv1 += 64;
+        __m512i v2 = _mm512_loadu_si512((const __m512i_u *)pv2);
+        pv2 += 64;
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(_mm512_xor_si512(v1, v2)));
+    }
+    return static_cast<int32_t>(_mm512_reduce_add_epi64(sum)) + BitHammingBF(pv1, pv2, size & 63);
+}
+#endif
+
+export int32_t BitHamming(const uint8_t *pv1, const uint8_t *pv2, size_t size) {
+#if defined(USE_AVX512) && defined(__AVX512VPOPCNTDQ__)
+    return BitHammingAVX512(pv1, pv2, size);
+#else
+    // compiles to POPCNT when the target has it
+    return BitHammingBF(pv1, pv2, size);
+#endif
+}
+
 //------------------------------//------------------------------//------------------------------
 
 export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
@@ -416,4 +556,216 @@ export float F32IPSSEResidual(const float *pVect1, const float *pVect2, SizeT qt
 
 #endif
 
-} // namespace infinity
\ No newline at end of file
+//------------------------------//------------------------------//------------------------------
+
+// Half precision vectors are widened to f32 in registers and accumulated in f32, the distance is as accurate as the f32 kernels
+// on the rounded values. Widening costs one instruction per 8 or 16 elements, while the vectors take half the memory bandwidth.
+
+export float F16L2BF(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        float t = float(pv1[i]) - float(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export float F16IPBF(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += float(pv1[i]) * float(pv2[i]);
+    }
+    return res;
+}
+
+export float BF16L2BF(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        float t = float(pv1[i]) - float(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export float BF16IPBF(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += float(pv1[i]) * float(pv2[i]);
+    }
+    return res;
+}
+
+#if defined(USE_AVX512)
+// bf16 is the high half of f32
+inline __m512 BF16ToF32AVX512(const bfloat16_t *p) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)p)), 16));
+}
+
+export float F16L2AVX512(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    const float16_t *pend1 = pv1 + (dim & ~15);
+    __m512 sum = _mm512_setzero_ps();
+    while (pv1 < pend1) {
+        __m512 v1 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)pv1));
+        pv1 += 16;
+        __m512 v2 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)pv2));
+        pv2 += 16;
+        __m512 diff = _mm512_sub_ps(v1, v2);
+        sum = _mm512_fmadd_ps(diff, diff, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + F16L2BF(pv1, pv2, dim & 15);
+}
+
+export float F16IPAVX512(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    const float16_t *pend1 = pv1 + (dim & ~15);
+    __m512 sum = _mm512_setzero_ps();
+    while (pv1 < pend1) {
+        __m512 v1 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)pv1));
+        pv1 += 16;
+        __m512 v2 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)pv2));
+        pv2 += 16;
+        sum = _mm512_fmadd_ps(v1, v2, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + F16IPBF(pv1, pv2, dim & 15);
+}
+
+export float BF16L2AVX512(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    const bfloat16_t *pend1 = pv1 + (dim & ~15);
+    __m512 sum = _mm512_setzero_ps();
+    while (pv1 < pend1) {
+        __m512 diff = _mm512_sub_ps(BF16ToF32AVX512(pv1), BF16ToF32AVX512(pv2));
+        pv1 += 16;
+        pv2 += 16;
+        sum = _mm512_fmadd_ps(diff, diff, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + BF16L2BF(pv1, pv2, dim & 15);
+}
+
+export float BF16IPAVX512(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    __m512 sum = _mm512_setzero_ps();
+#if defined(__AVX512BF16__)
+    // the products of two bf16 are exact in f32, VDPBF16PS accumulates pairs of them into each f32 lane
+    const bfloat16_t *pend32 = pv1 + (dim & ~31);
+    while (pv1 < pend32) {
+        __m512i v1 = _mm512_loadu_si512((const __m512i_u *)pv1);
+        pv1 += 32;
+        __m512i v2 = _mm512_loadu_si512((const __m512i_u *)pv2);
+        pv2 += 32;
+        sum = _mm512_dpbf16_ps(sum, (__m512bh)v1, (__m512bh)v2);
+    }
+    dim &= 31;
+#endif
+    const bfloat16_t *pend1 = pv1 + (dim & ~15);
+    while (pv1 < pend1) {
+        sum = _mm512_fmadd_ps(BF16ToF32AVX512(pv1), BF16ToF32AVX512(pv2), sum);
+        pv1 += 16;
+        pv2 += 16;
+    }
+    return _mm512_reduce_add_ps(sum) + BF16IPBF(pv1, pv2, dim & 15);
+}
+#endif
+
+#if defined(USE_AVX) && defined(__F16C__) && defined(__FMA__)
+inline float ReduceAddAVX(__m256 sum) {
+    __m128 res = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    res = _mm_hadd_ps(res, res);
+    res = _mm_hadd_ps(res, res);
+    return _mm_cvtss_f32(res);
+}
+
+inline __m256 BF16ToF32AVX(const bfloat16_t *p) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p)), 16));
+}
+
+export float F16L2AVX(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    const float16_t *pend1 = pv1 + (dim & ~7);
+    __m256 sum = _mm256_setzero_ps();
+    while (pv1 < pend1) {
+        __m256 v1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)pv1));
+        pv1 += 8;
+        __m256 v2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)pv2));
+        pv2 += 8;
+        __m256 diff = _mm256_sub_ps(v1, v2);
+        sum = _mm256_fmadd_ps(diff, diff, sum);
+    }
+    return ReduceAddAVX(sum) + F16L2BF(pv1, pv2, dim & 7);
+}
+
+export float F16IPAVX(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+    const float16_t *pend1 = pv1 + (dim & ~7);
+    __m256 sum = _mm256_setzero_ps();
+    while (pv1 < pend1) {
+        __m256 v1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)pv1));
+        pv1 += 8;
+        __m256 v2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)pv2));
+        pv2 += 8;
+        sum = _mm256_fmadd_ps(v1, v2, sum);
+    }
+    return ReduceAddAVX(sum) + F16IPBF(pv1, pv2, dim & 7);
+}
+
+export float BF16L2AVX(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    const bfloat16_t *pend1 = pv1 + (dim & ~7);
+    __m256 sum = _mm256_setzero_ps();
+    while (pv1 < pend1) {
+        __m256 diff = _mm256_sub_ps(BF16ToF32AVX(pv1), BF16ToF32AVX(pv2));
+        pv1 += 8;
+        pv2 += 8;
+        sum = _mm256_fmadd_ps(diff, diff, sum);
+    }
+    return ReduceAddAVX(sum) + BF16L2BF(pv1, pv2, dim & 7);
+}
+
+export float BF16IPAVX(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+    const bfloat16_t *pend1 = pv1 + (dim & ~7);
+    __m256 sum = _mm256_setzero_ps();
+    while (pv1 < pend1) {
+        sum = _mm256_fmadd_ps(BF16ToF32AVX(pv1), BF16ToF32AVX(pv2), sum);
+        pv1 += 8;
+        pv2 += 8;
+    }
+    return ReduceAddAVX(sum) + BF16IPBF(pv1, pv2, dim & 7);
+}
+#endif
+
+// half precision distances of any dimension with the widest kernel available
+export float F16L2(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return F16L2AVX512(pv1, pv2, dim);
+#elif defined(USE_AVX) && defined(__F16C__) && defined(__FMA__)
+    return F16L2AVX(pv1, pv2, dim);
+#else
+    return F16L2BF(pv1, pv2, dim);
+#endif
+}
+
+export float F16IP(const float16_t *pv1, const float16_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return F16IPAVX512(pv1, pv2, dim);
+#elif defined(USE_AVX) && defined(__F16C__) && defined(__FMA__)
+    return F16IPAVX(pv1, pv2, dim);
+#else
+    return F16IPBF(pv1, pv2, dim);
+#endif
+}
+
+export float BF16L2(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return BF16L2AVX512(pv1, pv2, dim);
+#elif defined(USE_AVX) && defined(__F16C__) && defined(__FMA__)
+    return BF16L2AVX(pv1, pv2, dim);
+#else
+    return BF16L2BF(pv1, pv2, dim);
+#endif
+}
+
+export float BF16IP(const bfloat16_t *pv1, const bfloat16_t *pv2, size_t dim) {
+#if defined(USE_AVX512)
+    return BF16IPAVX512(pv1, pv2, dim);
+#elif defined(USE_AVX) && defined(__F16C__) && defined(__FMA__)
+    return BF16IPAVX(pv1, pv2, dim);
+#else
+    return BF16IPBF(pv1, pv2, dim);
+#endif
+}
+
+} // namespace infinity
@@ -32,10 +32,12 @@ public:
     virtual ~MergeKnnBase() = default;
 };
 
+// DataType is the distance type, the scanned vectors may have another element type (int8, packed bits).
 export template <typename DataType, template <typename, typename> typename C>
 class MergeKnn final : public MergeKnnBase {
     using ResultHandler = ReservoirResultHandler<C<DataType, RowID>>;
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    template <typename ElemType>
+    using DistFunc = DataType (*)(const ElemType *, const ElemType *, SizeT);
 
 public:
     explicit MergeKnn(u64 query_count, u64 topk)
@@ -47,9 +49,18 @@ public:
     ~MergeKnn() final = default;
 
 public:
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
-
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+    template <typename ElemType>
+    void Search(const ElemType *query, const ElemType *data, u32 dim, DistFunc<ElemType> dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
+
+    template <typename ElemType>
+    void Search(const ElemType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<ElemType> dist_f,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
 
     void Search(const DataType *dist, const RowID *row_ids, u16 count);
 
@@ -84,12 +95,19 @@ private:
 };
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id) {
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
+                                   u32 dim,
+                                   DistFunc<ElemType> dist_f,
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
     this->total_count_ += row_cnt;
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             auto dist = dist_f(x_i, y_j, dim);
             result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
@@ -98,10 +116,11 @@ void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data,
 }
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query,
-                                   const DataType *data,
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
                                    u32 dim,
-                                   DistFunc dist_f,
+                                   DistFunc<ElemType> dist_f,
                                    u16 row_cnt,
                                    u32 segment_id,
                                    u16 block_id,
@@ -112,8 +131,8 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             if (bitmask.IsTrue(j)) {
                 if (i == 0) {
@@ -43,6 +43,7 @@ import compact_segments_task;
 import cleanup_scanner;
 import background_process;
 import wal_entry;
+import column_statistics;
 
 namespace infinity {
 
@@ -435,6 +436,9 @@ nlohmann::json SegmentEntry::Serialize(TxnTimeStamp max_commit_ts) {
             this->GetFastRoughFilter()->SaveToJsonFile(json_res);
             LOG_TRACE(fmt::format("SegmentEntry::Serialize: End try to save FastRoughFilter to json file"));
         }
+        if (statistics_.get() != nullptr && statistics_->build_ts_ <= max_commit_ts) {
+            json_res["statistics"] = statistics_->Serialize();
+        }
         for (auto &block_entry : this->block_entries_) {
             if (block_entry->commit_ts_ <= max_commit_ts) {
                 block_entry->Flush(max_commit_ts);
@@ -483,6 +487,9 @@ SharedPtr<SegmentEntry> SegmentEntry::Deserialize(const nlohmann::json &segment_
             LOG_TRACE("SegmentEntry::Deserialize: Cannot load FastRoughFilter from json file");
         }
     }
+    if (segment_entry_json.contains("statistics")) {
+        segment_entry->statistics_ = SegmentStatistics::Deserialize(segment_entry_json["statistics"]);
+    }
 
     LOG_TRACE(fmt::format("Segment: {}, Block count: {}", segment_entry->segment_id_, segment_entry->block_entries_.size()));
 
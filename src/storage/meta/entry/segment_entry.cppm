@@ -30,6 +30,7 @@ import fast_rough_filter;
 import value;
 import meta_entry_interface;
 import cleanup_scanner;
+import column_statistics;
 
 namespace infinity {
 
@@ -125,6 +126,18 @@ public:
     const FastRoughFilter *GetFastRoughFilter() const { return &fast_rough_filter_; }
 
     void LoadFilterBinaryData(const String &segment_filter_data);
+
+    // statistics built by ANALYZE or the background analyze task, nullptr if never analyzed
+    SharedPtr<const SegmentStatistics> GetStatistics() const {
+        std::shared_lock lock(rw_locker_);
+        return statistics_;
+    }
+
+    void SetStatistics(SharedPtr<const SegmentStatistics> statistics) {
+        std::unique_lock lock(rw_locker_);
+        statistics_ = std::move(statistics);
+    }
+
     static String SegmentStatusToString(const SegmentStatus &type);
 
 public:
@@ -224,6 +237,8 @@ private:
     // check if a value must not exist in the segment
     FastRoughFilter fast_rough_filter_;
 
+    SharedPtr<const SegmentStatistics> statistics_;
+
     CompactSegmentsTask *compact_task_{};
     SegmentStatus status_;
 
@@ -41,6 +41,7 @@ import annivfflat_index_data;
 import secondary_index_data;
 import type_info;
 import embedding_info;
+import internal_types;
 import create_index_info;
 import column_def;
 import block_column_entry;
@@ -58,6 +59,8 @@ import chunk_index_entry;
 import abstract_hnsw;
 import block_column_iter;
 import txn_store;
+import segment_entry;
+import secondary_index_in_mem;
 
 namespace infinity {
 
@@ -127,8 +130,12 @@ SharedPtr<SegmentIndexEntry> SegmentIndexEntry::NewReplaySegmentIndexEntry(Table
         UnrecoverableError(status.message());
     }
     String column_name = table_index_entry->index_base()->column_name();
-    auto create_index_param =
-        SegmentIndexEntry::GetCreateIndexParam(table_index_entry->table_index_def(), segment_row_count, table_entry->GetColumnDefByName(column_name));
+    SharedPtr<ColumnDef> column_def = table_entry->GetColumnDefByName(column_name);
+    SizeT index_row_count = segment_row_count;
+    if (table_index_entry->index_base()->index_type_ == IndexType::kSecondary) {
+        index_row_count = SecondaryIndexRowCount(table_index_entry, segment_id, segment_row_count, buffer_manager, column_def);
+    }
+    auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(table_index_entry->table_index_def(), index_row_count, column_def);
     auto vector_file_worker = SegmentIndexEntry::CreateFileWorkers(table_index_entry->index_dir(), create_index_param.get(), segment_id);
     Vector<BufferObj *> vector_buffer(vector_file_worker.size());
     for (u32 i = 0; i < vector_file_worker.size(); ++i) {
@@ -232,6 +239,25 @@ SegmentIndexEntry::LoadIndexEntry(TableIndexEntry *table_index_entry, u32 segmen
     return UniquePtr<SegmentIndexEntry>(new SegmentIndexEntry(table_index_entry, segment_id, std::move(vector_buffer)));
 }
 
+SizeT SegmentIndexEntry::SecondaryIndexRowCount(TableIndexEntry *table_index_entry,
+                                                SegmentID segment_id,
+                                                SizeT segment_row_count,
+                                                BufferManager *buffer_mgr,
+                                                SharedPtr<ColumnDef> column_def) {
+    String file_path = *table_index_entry->index_dir() + "/" + IndexFileName(segment_id);
+    LocalFileSystem fs;
+    if (!fs.Exists(file_path)) {
+        return segment_row_count;
+    }
+    // the index head keeps the rows it was built or last merged on
+    auto param = GetCreateIndexParam(table_index_entry->table_index_def(), 0, std::move(column_def));
+    auto vector_file_worker = CreateFileWorkers(table_index_entry->index_dir(), param.get(), segment_id);
+    BufferObj *head_buffer = buffer_mgr->GetBufferObject(std::move(vector_file_worker[0]));
+    BufferHandle buffer_handle_head = head_buffer->Load();
+    const auto *secondary_index_head = static_cast<const SecondaryIndexDataHead *>(buffer_handle_head.GetData());
+    return secondary_index_head->GetFullDataNum();
+}
+
 BufferHandle SegmentIndexEntry::GetIndex() { return vector_buffer_[0]->Load(); }
 
 BufferHandle SegmentIndexEntry::GetIndexPartAt(u32 idx) { return vector_buffer_[idx + 1]->Load(); }
@@ -298,12 +324,31 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
 
             BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
             SizeT row_cnt = 0;
+            auto InsertHnswInner = [&]<typename DataType>() {
+                AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                MemIndexInserterIter<DataType> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
+                auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
+                row_cnt = end_i;
+            };
             switch (embedding_info->Type()) {
                 case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
-                    MemIndexInserterIter<f32> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
-                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
-                    row_cnt = end_i;
+                    InsertHnswInner.template operator()<f32>();
+                    break;
+                }
+                case kElemInt8: {
+                    InsertHnswInner.template operator()<i8>();
+                    break;
+                }
+                case kElemFloat16: {
+                    InsertHnswInner.template operator()<Float16T>();
+                    break;
+                }
+                case kElemBFloat16: {
+                    InsertHnswInner.template operator()<BFloat16T>();
+                    break;
+                }
+                case kElemBit: {
+                    InsertHnswInner.template operator()<u8>();
                     break;
                 }
                 default: {
@@ -313,11 +358,67 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
             memory_hnsw_indexer_->SetRowCount(row_cnt);
             break;
         }
-        case IndexType::kIVFFlat:
+        case IndexType::kIVFFlat: {
+            if (column_def->type()->type() != LogicalType::kEmbedding) {
+                UnrecoverableError("AnnIVFFlat only supports embedding type.");
+            }
+            TypeInfo *type_info = column_def->type()->type_info().get();
+            auto embedding_info = static_cast<EmbeddingInfo *>(type_info);
+            BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+            BufferHandle buffer_handle = GetIndex();
+            switch (embedding_info->Type()) {
+                case kElemFloat: {
+                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
+                    if (!annivfflat_index->Trained()) {
+                        if (auto trained_state = table_index_entry_->GetIVFTrainedState(segment_id_); trained_state.get() != nullptr) {
+                            annivfflat_index->ImportTrainedState(*trained_state);
+                        }
+                    }
+                    // Without shared centroids the first batch trains a few of them and the lists are split as the segment grows.
+                    // They are published only if that batch was large enough, see IVF_MIN_SHARED_TRAIN_SIZE.
+                    const bool trained = annivfflat_index->Trained();
+                    MemIndexInserterIter<f32> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
+                    annivfflat_index->AppendData(iter);
+                    if (!trained && annivfflat_index->Shareable()) {
+                        table_index_entry_->SetIVFTrainedState(annivfflat_index->ExportTrainedState());
+                    }
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Not support data type for index ivf."));
+                }
+            }
+            break;
+        }
         case IndexType::kSecondary: {
-            UniquePtr<String> err_msg =
-                MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
-            LOG_WARN(*err_msg);
+            SharedPtr<SecondaryIndexInMem> memory_secondary_index;
+            {
+                std::shared_lock<std::shared_mutex> lck(secondary_index_rw_locker_);
+                memory_secondary_index = memory_secondary_index_;
+            }
+            if (memory_secondary_index.get() == nullptr) {
+                std::unique_lock<std::shared_mutex> lck(secondary_index_rw_locker_);
+                // checked again under the lock, a concurrent append may have created it
+                if (memory_secondary_index_.get() == nullptr) {
+                    bool index_built = false;
+                    u32 base_row_count = 0;
+                    {
+                        BufferHandle buffer_handle_head = GetIndex();
+                        const auto *secondary_index_head = static_cast<const SecondaryIndexDataHead *>(buffer_handle_head.GetData());
+                        index_built = secondary_index_head->Loaded();
+                        base_row_count = index_built ? secondary_index_head->GetFullDataNum() : 0;
+                    }
+                    if (!index_built) {
+                        // the segment index entry is created by the appends, the rows are merged into an empty index later
+                        BuildSecondaryIndex(nullptr, buffer_manager, commit_ts, false, 0);
+                    }
+                    memory_secondary_index_ = SecondaryIndexInMem::NewSecondaryIndexInMem(column_def, base_row_count);
+                }
+                memory_secondary_index = memory_secondary_index_;
+            }
+            BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+            ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_manager);
+            memory_secondary_index->Insert(column_vector, row_offset, row_count, block_offset, commit_ts);
             break;
         }
         default: {
@@ -390,6 +491,8 @@ void SegmentIndexEntry::MemIndexLoad(const String &base_name, RowID base_row_id)
 
 u32 SegmentIndexEntry::MemIndexRowCount() { return memory_indexer_.get() == nullptr ? 0 : memory_indexer_->GetDocCount(); }
 
+SizeT SegmentIndexEntry::MemIndexMemUsed() { return memory_indexer_.get() == nullptr ? 0 : memory_indexer_->GetMemUsed(); }
+
 void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
@@ -448,46 +551,99 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             this->AddChunkIndexEntry(chunk_index_entry);
             BufferHandle buffer_handle = chunk_index_entry->GetIndex();
 
+            auto PopulateHnswInner = [&]<typename DataType>() {
+                AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                auto InsertHnswInner = [&](auto &iter) {
+                    HnswInsertConfig insert_config;
+                    insert_config.optimize_ = true;
+                    SegmentOffset start_i, end_i;
+                    if (!config.prepare_) {
+                        // Single thread insert
+                        std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                    } else {
+                        // Multi thread insert data, write file in the physical create index finish stage.
+                        std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
+                    }
+                    LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
+                    return end_i - start_i;
+                };
+                SegmentOffset row_count = 0;
+                if (config.check_ts_) {
+                    OneColumnIterator<DataType> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                    row_count = InsertHnswInner(iter);
+                } else {
+                    // Not check ts in uncommitted segment when compact segment
+                    OneColumnIterator<DataType, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                    row_count = InsertHnswInner(iter);
+                }
+                chunk_index_entry->SetRowCount(row_count);
+            };
+            switch (embedding_info->Type()) {
+                case kElemFloat: {
+                    PopulateHnswInner.template operator()<f32>();
+                    break;
+                }
+                case kElemInt8: {
+                    PopulateHnswInner.template operator()<i8>();
+                    break;
+                }
+                case kElemFloat16: {
+                    PopulateHnswInner.template operator()<Float16T>();
+                    break;
+                }
+                case kElemBFloat16: {
+                    PopulateHnswInner.template operator()<BFloat16T>();
+                    break;
+                }
+                case kElemBit: {
+                    PopulateHnswInner.template operator()<u8>();
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Not support data type for index hnsw."));
+                }
+            }
+            break;
+        }
+        case IndexType::kIVFFlat: {
+            if (column_def->type()->type() != LogicalType::kEmbedding) {
+                UnrecoverableError("AnnIVFFlat only supports embedding type.");
+            }
+            TypeInfo *type_info = column_def->type()->type_info().get();
+            auto embedding_info = static_cast<EmbeddingInfo *>(type_info);
+            BufferHandle buffer_handle = GetIndex();
             switch (embedding_info->Type()) {
                 case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
-                    auto InsertHnswInner = [&](auto &iter) {
-                        HnswInsertConfig insert_config;
-                        insert_config.optimize_ = true;
-                        SegmentOffset start_i, end_i;
-                        if (!config.prepare_) {
-                            // Single thread insert
-                            std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
+                    // reuse the centroids of the other segments, train on this segment only if there are none
+                    auto trained_state = table_index_entry_->GetIVFTrainedState(segment_id_);
+                    auto PopulateIVFInner = [&](auto &iter) {
+                        if (trained_state.get() != nullptr) {
+                            annivfflat_index->ImportTrainedState(*trained_state);
+                            annivfflat_index->AppendData(iter);
                         } else {
-                            // Multi thread insert data, write file in the physical create index finish stage.
-                            std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
+                            annivfflat_index->BuildIndex(iter, embedding_info->Dimension(), segment_entry->row_count());
+                            table_index_entry_->SetIVFTrainedState(annivfflat_index->ExportTrainedState());
                         }
-                        LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
-                        return end_i - start_i;
                     };
-                    SegmentOffset row_count = 0;
                     if (config.check_ts_) {
                         OneColumnIterator<float> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                        row_count = InsertHnswInner(iter);
+                        PopulateIVFInner(iter);
                     } else {
                         // Not check ts in uncommitted segment when compact segment
                         OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                        row_count = InsertHnswInner(iter);
+                        PopulateIVFInner(iter);
                     }
-                    chunk_index_entry->SetRowCount(row_count);
                     break;
                 }
                 default: {
-                    RecoverableError(Status::NotSupport("Not support data type for index hnsw."));
+                    RecoverableError(Status::NotSupport("Not support data type for index ivf."));
                 }
             }
             break;
         }
-        case IndexType::kIVFFlat:
-        case IndexType::kSecondary: { // TODO
-            UniquePtr<String> err_msg =
-                MakeUnique<String>(fmt::format("{} PopulateEntirely is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
-            LOG_WARN(*err_msg);
+        case IndexType::kSecondary: {
+            BuildSecondaryIndex(segment_entry, buffer_mgr, begin_ts, config.check_ts_, segment_entry->row_count());
             break;
         }
         default: {
@@ -532,6 +688,7 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
                         OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
                         annivfflat_index->BuildIndex(iter, dimension, full_row_count);
                     }
+                    table_index_entry_->SetIVFTrainedState(annivfflat_index->ExportTrainedState());
                     break;
                 }
                 default: {
@@ -549,32 +706,7 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             break;
         }
         case IndexType::kSecondary: {
-            auto &data_type = column_def->type();
-            if (!(data_type->CanBuildSecondaryIndex())) {
-                UnrecoverableError(fmt::format("Cannot build secondary index on data type: {}", data_type->ToString()));
-            }
-            // 1. build secondary index by merge sort
-            u32 part_capacity = DEFAULT_BLOCK_CAPACITY;
-            // fetch the row_count from segment_entry
-            auto secondary_index_builder = GetSecondaryIndexDataBuilder(data_type, segment_entry->row_count(), part_capacity);
-            secondary_index_builder->LoadSegmentData(segment_entry, buffer_mgr, column_def->id(), begin_ts, check_ts);
-            secondary_index_builder->StartOutput();
-            // 2. output into SecondaryIndexDataPart
-            {
-                u32 part_num = GetIndexPartNum();
-                for (u32 part_id = 0; part_id < part_num; ++part_id) {
-                    BufferHandle buffer_handle_part = GetIndexPartAt(part_id);
-                    auto secondary_index_part = static_cast<SecondaryIndexDataPart *>(buffer_handle_part.GetDataMut());
-                    secondary_index_builder->OutputToPart(secondary_index_part);
-                }
-            }
-            // 3. output into SecondaryIndexDataHead
-            {
-                BufferHandle buffer_handle_head = GetIndex();
-                auto secondary_index_head = static_cast<SecondaryIndexDataHead *>(buffer_handle_head.GetDataMut());
-                secondary_index_builder->OutputToHeader(secondary_index_head);
-            }
-            secondary_index_builder->EndOutput();
+            BuildSecondaryIndex(segment_entry, buffer_mgr, begin_ts, check_ts, segment_entry->row_count());
             break;
         }
         default: {
@@ -587,6 +719,88 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
     return Status::OK();
 }
 
+void SegmentIndexEntry::BuildSecondaryIndex(const SegmentEntry *segment_entry,
+                                            BufferManager *buffer_mgr,
+                                            TxnTimeStamp begin_ts,
+                                            bool check_ts,
+                                            u32 full_row_count) {
+    const SharedPtr<ColumnDef> &column_def = table_index_entry_->column_def();
+    auto &data_type = column_def->type();
+    if (!(data_type->CanBuildSecondaryIndex())) {
+        UnrecoverableError(fmt::format("Cannot build secondary index on data type: {}", data_type->ToString()));
+    }
+    // 1. build secondary index by merge sort
+    u32 part_capacity = DEFAULT_BLOCK_CAPACITY;
+    auto secondary_index_builder = GetSecondaryIndexDataBuilder(data_type, full_row_count, part_capacity);
+    if (full_row_count > 0) {
+        secondary_index_builder->LoadSegmentData(segment_entry, buffer_mgr, column_def->id(), begin_ts, check_ts);
+    }
+    secondary_index_builder->StartOutput();
+    // 2. output into SecondaryIndexDataPart
+    {
+        u32 part_num = (full_row_count + part_capacity - 1) / part_capacity;
+        // parts for the rows appended since the index was built
+        for (u32 part_id = GetIndexPartNum(); part_id < part_num; ++part_id) {
+            auto part_file_name = MakeShared<String>(fmt::format("{}_part{}", IndexFileName(segment_id_), part_id + 1));
+            auto file_worker = MakeUnique<SecondaryIndexFileWorker>(index_dir_,
+                                                                    part_file_name,
+                                                                    table_index_entry_->table_index_def(),
+                                                                    column_def,
+                                                                    part_id + 1,
+                                                                    full_row_count,
+                                                                    part_capacity);
+            vector_buffer_.push_back(buffer_mgr->AllocateBufferObject(std::move(file_worker)));
+        }
+        for (u32 part_id = 0; part_id < part_num; ++part_id) {
+            BufferHandle buffer_handle_part = GetIndexPartAt(part_id);
+            auto secondary_index_part = static_cast<SecondaryIndexDataPart *>(buffer_handle_part.GetDataMut());
+            secondary_index_builder->OutputToPart(secondary_index_part);
+        }
+    }
+    // 3. output into SecondaryIndexDataHead
+    {
+        BufferHandle buffer_handle_head = GetIndex();
+        auto secondary_index_head = static_cast<SecondaryIndexDataHead *>(buffer_handle_head.GetDataMut());
+        secondary_index_head->ResetFullDataNum(full_row_count);
+        secondary_index_builder->OutputToHeader(secondary_index_head);
+    }
+    secondary_index_builder->EndOutput();
+}
+
+bool SegmentIndexEntry::MergeSecondaryIndexInMem(const SegmentEntry *segment_entry, Txn *txn) {
+    const IndexBase *index_base = table_index_entry_->index_base();
+    if (index_base->index_type_ != IndexType::kSecondary) {
+        return false;
+    }
+    std::unique_lock lock(secondary_index_rw_locker_);
+    if (memory_secondary_index_.get() == nullptr) {
+        return false;
+    }
+    u32 in_mem_row_count = memory_secondary_index_->RowCount();
+    if (in_mem_row_count == 0 || (segment_entry->status() == SegmentStatus::kUnsealed && in_mem_row_count < SECONDARY_INDEX_MERGE_ROW_COUNT)) {
+        return false;
+    }
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    u32 base_row_count = memory_secondary_index_->BaseRowCount();
+    u32 full_row_count = memory_secondary_index_->VisibleRowEnd(begin_ts);
+    if (full_row_count <= base_row_count) {
+        return false;
+    }
+    BuildSecondaryIndex(segment_entry, txn->buffer_mgr(), begin_ts, true, full_row_count);
+    memory_secondary_index_->Merge(full_row_count);
+    // save the parts before the head, the head on disk never refers to a part which is not saved
+    for (SizeT i = 1; i < vector_buffer_.size(); ++i) {
+        vector_buffer_[i]->Save();
+    }
+    vector_buffer_[0]->Save();
+    LOG_INFO(fmt::format("Segment: {}, Index: {} merged rows [{}, {}) of the in-memory secondary index",
+                         segment_id_,
+                         *table_index_entry_->index_dir(),
+                         base_row_count,
+                         full_row_count));
+    return true;
+}
+
 Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
     const IndexBase *index_base = table_index_entry_->index_base();
     const ColumnDef *column_def = table_index_entry_->column_def().get();
@@ -607,16 +821,35 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
                 SegmentOffset row_count = chunk_index_entry->row_count_;
                 BufferHandle buffer_handle = chunk_index_entry->GetIndex();
 
+                auto BuildHnswInner = [&]<typename DataType>() {
+                    AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    while (true) {
+                        SizeT idx = create_index_idx.fetch_add(1);
+                        if (idx >= row_count) {
+                            break;
+                        }
+                        abstract_hnsw.Build(offset + idx);
+                    }
+                };
                 switch (embedding_info->Type()) {
                     case kElemFloat: {
-                        AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
-                        while (true) {
-                            SizeT idx = create_index_idx.fetch_add(1);
-                            if (idx >= row_count) {
-                                break;
-                            }
-                            abstract_hnsw.Build(offset + idx);
-                        }
+                        BuildHnswInner.template operator()<f32>();
+                        break;
+                    }
+                    case kElemInt8: {
+                        BuildHnswInner.template operator()<i8>();
+                        break;
+                    }
+                    case kElemFloat16: {
+                        BuildHnswInner.template operator()<Float16T>();
+                        break;
+                    }
+                    case kElemBFloat16: {
+                        BuildHnswInner.template operator()<BFloat16T>();
+                        break;
+                    }
+                    case kElemBit: {
+                        BuildHnswInner.template operator()<u8>();
                         break;
                     }
                     default: {
@@ -786,16 +1019,35 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
             SharedPtr<ChunkIndexEntry> merged_chunk_index_entry = CreateChunkIndexEntry(column_def, base_rowid, buffer_mgr);
             BufferHandle buffer_handle = merged_chunk_index_entry->GetIndex();
 
+            auto RebuildHnswInner = [&]<typename DataType>() {
+                AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                OneColumnIterator<DataType, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                HnswInsertConfig insert_config;
+                insert_config.optimize_ = true;
+                auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                if (end_i - start_i != row_count) {
+                    UnrecoverableError("Rebuild HNSW index failed.");
+                }
+            };
             switch (embedding_info->Type()) {
                 case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
-                    OneColumnIterator<float, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                    HnswInsertConfig insert_config;
-                    insert_config.optimize_ = true;
-                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
-                    if (end_i - start_i != row_count) {
-                        UnrecoverableError("Rebuild HNSW index failed.");
-                    }
+                    RebuildHnswInner.template operator()<f32>();
+                    break;
+                }
+                case kElemInt8: {
+                    RebuildHnswInner.template operator()<i8>();
+                    break;
+                }
+                case kElemFloat16: {
+                    RebuildHnswInner.template operator()<Float16T>();
+                    break;
+                }
+                case kElemBFloat16: {
+                    RebuildHnswInner.template operator()<BFloat16T>();
+                    break;
+                }
+                case kElemBit: {
+                    RebuildHnswInner.template operator()<u8>();
                     break;
                 }
                 default: {
@@ -814,10 +1066,35 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
     return nullptr;
 }
 
+bool SegmentIndexEntry::SplitOverfullIVFPartitions() {
+    const IndexBase *index_base = table_index_entry_->index_base();
+    if (index_base->index_type_ != IndexType::kIVFFlat) {
+        return false;
+    }
+    u32 split_cnt = 0;
+    {
+        BufferHandle buffer_handle = GetIndex();
+        // GetDataMut marks the buffer dirty, only take it when there is something to split
+        const auto *annivfflat_index = static_cast<const AnnIVFFlatIndexData<f32> *>(buffer_handle.GetData());
+        if (!annivfflat_index->HasOverfullPartition(IVF_SPLIT_PARTITION_RATIO)) {
+            return false;
+        }
+        auto annivfflat_index_mut = reinterpret_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
+        split_cnt = annivfflat_index_mut->SplitOverfullPartitions(IVF_SPLIT_PARTITION_RATIO);
+    }
+    if (split_cnt == 0) {
+        return false;
+    }
+    LOG_INFO(fmt::format("Segment: {}, Index: {} split {} ivf partitions", segment_id_, *table_index_entry_->index_dir(), split_cnt));
+    vector_buffer_[0]->Save();
+    return true;
+}
+
 void SegmentIndexEntry::SaveIndexFile() {
     String &index_name = *table_index_entry_->index_dir();
     u64 segment_id = this->segment_id_;
     LOG_TRACE(fmt::format("Segment: {}, Index: {} is being flushing", segment_id, index_name));
+    std::shared_lock lock(secondary_index_rw_locker_);
     for (auto &buffer_ptr : vector_buffer_) {
         buffer_ptr->Save();
     }
@@ -905,8 +1182,12 @@ UniquePtr<SegmentIndexEntry> SegmentIndexEntry::Deserialize(const nlohmann::json
     }
     const IndexBase *index_base = table_index_entry->index_base();
     String column_name = index_base->column_name();
-    UniquePtr<CreateIndexParam> create_index_param =
-        GetCreateIndexParam(table_index_entry->table_index_def(), segment_row_count, table_entry->GetColumnDefByName(column_name));
+    SharedPtr<ColumnDef> column_def = table_entry->GetColumnDefByName(column_name);
+    SizeT index_row_count = segment_row_count;
+    if (index_base->index_type_ == IndexType::kSecondary) {
+        index_row_count = SecondaryIndexRowCount(table_index_entry, segment_id, segment_row_count, buffer_mgr, column_def);
+    }
+    UniquePtr<CreateIndexParam> create_index_param = GetCreateIndexParam(table_index_entry->table_index_def(), index_row_count, column_def);
 
     auto segment_index_entry = LoadIndexEntry(table_index_entry, segment_id, buffer_mgr, create_index_param.get());
     if (segment_index_entry.get() == nullptr) {
@@ -32,6 +32,7 @@ import meta_entry_interface;
 import cleanup_scanner;
 import chunk_index_entry;
 import memory_indexer;
+import secondary_index_in_mem;
 import default_values;
 
 namespace infinity {
@@ -126,8 +127,17 @@ public:
 
     u32 MemIndexRowCount();
 
+    SizeT MemIndexMemUsed();
+
     Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts);
 
+    // Split the over-full lists of an ivf index that grew by appends, save the index file if anything changed.
+    bool SplitOverfullIVFPartitions();
+
+    // Merge the rows of the in-memory secondary index visible to txn into a new build of the index parts and head, save
+    // the index files if anything is merged. Rows of an unsealed segment are merged once there are enough of them.
+    bool MergeSecondaryIndexInMem(const SegmentEntry *segment_entry, Txn *txn);
+
     Status CreateIndexDo(atomic_u64 &create_index_idx);
 
     static UniquePtr<CreateIndexParam> GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT seg_row_count, SharedPtr<ColumnDef> column_def);
@@ -174,6 +184,13 @@ public:
         return {chunk_index_entries_, memory_hnsw_indexer_};
     }
 
+    // The in-memory index is nullptr if no rows are appended since the index was built. The lock keeps the index parts
+    // from being rebuilt by a merge while they are searched.
+    Tuple<SharedPtr<SecondaryIndexInMem>, std::shared_lock<std::shared_mutex>> GetSecondaryIndexSnapshot() {
+        std::shared_lock lock(secondary_index_rw_locker_);
+        return {memory_secondary_index_, std::move(lock)};
+    }
+
     Pair<u64, u32> GetFulltextColumnLenInfo() {
         std::shared_lock lock(rw_locker_);
         if (ft_column_len_sum_ == 0 && memory_indexer_.get() != nullptr) {
@@ -216,6 +233,14 @@ private:
 
     ChunkID GetNextChunkID() { return next_chunk_id_++; }
 
+    // Build the secondary index over the rows of the segment before full_row_count, the parts and head are rebuilt in
+    // place if the index was built before.
+    void BuildSecondaryIndex(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts, bool check_ts, u32 full_row_count);
+
+    // Rows of the segment covered by the secondary index files, the rows after them are replayed into the in-memory index.
+    static SizeT
+    SecondaryIndexRowCount(TableIndexEntry *table_index_entry, SegmentID segment_id, SizeT segment_row_count, BufferManager *buffer_mgr, SharedPtr<ColumnDef> column_def);
+
 private:
     BufferManager *buffer_manager_{};
     TableIndexEntry *table_index_entry_;
@@ -234,6 +259,8 @@ private:
     Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries_{};
     SharedPtr<ChunkIndexEntry> memory_hnsw_indexer_{};
     SharedPtr<MemoryIndexer> memory_indexer_{};
+    std::shared_mutex secondary_index_rw_locker_{};
+    SharedPtr<SecondaryIndexInMem> memory_secondary_index_{};
 
     u64 ft_column_len_sum_{}; // increase only
     u32 ft_column_len_cnt_{}; // increase only
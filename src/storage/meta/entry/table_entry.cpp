@@ -55,6 +55,8 @@ import column_index_merger;
 import parsed_expr;
 import constant_expr;
 import infinity_context;
+import config;
+import statistics_builder;
 
 namespace infinity {
 
@@ -327,7 +329,8 @@ void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
         if (!status.ok())
             continue;
         const IndexBase *index_base = table_index_entry->index_base();
-        if (index_base->index_type_ != IndexType::kFullText && index_base->index_type_ != IndexType::kHnsw) {
+        if (index_base->index_type_ != IndexType::kFullText && index_base->index_type_ != IndexType::kHnsw &&
+            index_base->index_type_ != IndexType::kIVFFlat && index_base->index_type_ != IndexType::kSecondary) {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
             LOG_WARN(*err_msg);
@@ -618,7 +621,9 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
         const IndexBase *index_base = table_index_entry->index_base();
         switch (index_base->index_type_) {
             case IndexType::kHnsw:
-            case IndexType::kFullText: {
+            case IndexType::kIVFFlat:
+            case IndexType::kFullText:
+            case IndexType::kSecondary: {
                 for (auto &[seg_id, ranges] : seg_append_ranges) {
                     MemIndexInsertInner(table_index_entry, txn, seg_id, ranges);
                 }
@@ -664,7 +669,11 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
         AppendRange &range = append_ranges[i];
         SharedPtr<BlockEntry> block_entry = block_entries[i];
         segment_index_entry->MemIndexInsert(block_entry, range.start_offset_, range.row_count_, txn->CommitTS(), txn->buffer_mgr());
-        if (i == dump_idx && segment_index_entry->MemIndexRowCount() >= infinity::InfinityContext::instance().config()->memindex_capacity()) {
+        Config *config = infinity::InfinityContext::instance().config();
+        bool reach_capacity = i == dump_idx && segment_index_entry->MemIndexRowCount() >= config->memindex_capacity();
+        // postings of large documents may outgrow the memory quota long before the row capacity is reached
+        bool reach_memory_quota = segment_index_entry->MemIndexMemUsed() >= config->memindex_memory_quota();
+        if (reach_capacity || reach_memory_quota) {
             SharedPtr<ChunkIndexEntry> chunk_index_entry = segment_index_entry->MemIndexDump();
             if (chunk_index_entry.get() != nullptr) {
                 chunk_index_entry->Commit(txn->CommitTS());
@@ -843,6 +852,24 @@ void TableEntry::OptimizeIndex(Txn *txn) {
                 }
                 break;
             }
+            case IndexType::kIVFFlat: {
+                // lists of the ivf index grow with realtime appends, rebalance them without retraining
+                for (auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+                    segment_index_entry->SplitOverfullIVFPartitions();
+                }
+                break;
+            }
+            case IndexType::kSecondary: {
+                // appended rows are searched in the in-memory index until they are merged into the built one
+                TxnTimeStamp begin_ts = txn->BeginTS();
+                for (auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+                    SegmentEntry *segment_entry = GetSegmentByID(segment_id, begin_ts).get();
+                    if (segment_entry != nullptr) {
+                        segment_index_entry->MergeSecondaryIndexInMem(segment_entry, txn);
+                    }
+                }
+                break;
+            }
             default: {
                 UniquePtr<String> err_msg =
                     MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -901,6 +928,49 @@ SharedPtr<BlockIndex> TableEntry::GetBlockIndex(TxnTimeStamp begin_ts) {
     return result;
 }
 
+SharedPtr<TableStatistics> TableEntry::GetStatistics(TxnTimeStamp begin_ts) const {
+    SharedPtr<TableStatistics> result = MakeShared<TableStatistics>();
+    std::shared_lock<std::shared_mutex> rw_locker(this->rw_locker_);
+    for (const auto &[segment_id, segment_entry] : this->segment_map_) {
+        if (!segment_entry->CheckVisible(begin_ts)) {
+            continue;
+        }
+        result->AddSegment(segment_id, segment_entry->actual_row_count(), segment_entry->GetStatistics());
+    }
+    return result;
+}
+
+SizeT TableEntry::Analyze(Txn *txn, bool only_stale) {
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    Vector<SegmentEntry *> segments;
+    {
+        std::shared_lock<std::shared_mutex> rw_locker(this->rw_locker_);
+        for (const auto &[segment_id, segment_entry] : this->segment_map_) {
+            if (segment_entry->CheckVisible(begin_ts)) {
+                segments.push_back(segment_entry.get());
+            }
+        }
+    }
+    SizeT analyzed_count = 0;
+    for (auto *segment_entry : segments) {
+        if (only_stale) {
+            auto statistics = segment_entry->GetStatistics();
+            // stale when the visible row count drifted by more than 10%
+            if (statistics.get() != nullptr) {
+                u64 row_count = segment_entry->actual_row_count();
+                u64 drift = row_count > statistics->row_count_ ? row_count - statistics->row_count_ : statistics->row_count_ - row_count;
+                if (drift * 10 <= statistics->row_count_) {
+                    continue;
+                }
+            }
+        }
+        segment_entry->SetStatistics(StatisticsBuilder::Build(segment_entry, txn->buffer_mgr(), begin_ts));
+        ++analyzed_count;
+    }
+    LOG_TRACE(fmt::format("Analyze table {}: {} segments analyzed", *table_name_, analyzed_count));
+    return analyzed_count;
+}
+
 bool TableEntry::CheckVisible(SegmentID segment_id, TxnTimeStamp begin_ts) const {
     std::shared_lock lock(this->rw_locker_);
     auto iter = segment_map_.find(segment_id);
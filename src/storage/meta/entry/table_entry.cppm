@@ -43,6 +43,7 @@ import memory_pool;
 import meta_info;
 import block_entry;
 import column_index_reader;
+import column_statistics;
 
 namespace infinity {
 
@@ -188,6 +189,10 @@ public:
 
     void OptimizeIndex(Txn *txn);
 
+    // Build the statistics of the visible segments, only_stale skips the segments whose statistics are still accurate.
+    // Returns the number of segments analyzed.
+    SizeT Analyze(Txn *txn, bool only_stale);
+
 public:
     // Getter
 
@@ -217,6 +222,9 @@ public:
 
     SharedPtr<BlockIndex> GetBlockIndex(TxnTimeStamp begin_ts);
 
+    // statistics of the segments visible at begin_ts, for the optimizer
+    SharedPtr<TableStatistics> GetStatistics(TxnTimeStamp begin_ts) const;
+
     void GetFulltextAnalyzers(TransactionID txn_id, TxnTimeStamp begin_ts, Map<String, String> &column2analyzer);
 
 public:
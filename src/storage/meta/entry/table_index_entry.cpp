@@ -41,6 +41,8 @@ import embedding_info;
 import block_entry;
 import segment_entry;
 import table_entry;
+import annivfflat_index_data;
+import buffer_handle;
 
 namespace infinity {
 
@@ -136,7 +138,9 @@ bool TableIndexEntry::GetOrCreateSegment(SegmentID segment_id, Txn *txn, SharedP
     std::unique_lock w_lock(rw_locker_);
     auto iter = index_by_segment_.find(segment_id);
     if (iter == index_by_segment_.end()) {
-        auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, DEFAULT_SEGMENT_CAPACITY, column_def_);
+        // parts of a secondary index are added as the appended rows are merged into it
+        SizeT row_count = index_base_->index_type_ == IndexType::kSecondary ? 0 : DEFAULT_SEGMENT_CAPACITY;
+        auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, row_count, column_def_);
         segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         index_by_segment_.emplace(segment_id, segment_index_entry);
         created = true;
@@ -146,6 +150,50 @@ bool TableIndexEntry::GetOrCreateSegment(SegmentID segment_id, Txn *txn, SharedP
     return created;
 }
 
+SharedPtr<IVFTrainedState> TableIndexEntry::GetIVFTrainedState(SegmentID exclude_segment_id) {
+    {
+        std::unique_lock lock(ivf_trained_state_mutex_);
+        if (ivf_trained_state_.get() != nullptr) {
+            return ivf_trained_state_;
+        }
+    }
+    // loading the segment indexes may read them from disk, so it runs without holding any lock
+    Vector<Pair<SegmentID, SharedPtr<SegmentIndexEntry>>> segment_index_entries;
+    {
+        std::shared_lock r_lock(rw_locker_);
+        for (const auto &[segment_id, segment_index_entry] : index_by_segment_) {
+            if (segment_id != exclude_segment_id) {
+                segment_index_entries.emplace_back(segment_id, segment_index_entry);
+            }
+        }
+    }
+    for (const auto &[segment_id, segment_index_entry] : segment_index_entries) {
+        BufferHandle buffer_handle = segment_index_entry->GetIndex();
+        const auto *annivfflat_index = static_cast<const AnnIVFFlatIndexData<f32> *>(buffer_handle.GetData());
+        if (!annivfflat_index->Shareable()) {
+            continue;
+        }
+        SharedPtr<IVFTrainedState> trained_state = annivfflat_index->ExportTrainedState();
+        if (trained_state.get() != nullptr) {
+            LOG_TRACE(fmt::format("Index {} reuses the ivf centroids of segment {}", *index_base_->index_name_, segment_id));
+            SetIVFTrainedState(std::move(trained_state));
+            break;
+        }
+    }
+    std::unique_lock lock(ivf_trained_state_mutex_);
+    return ivf_trained_state_;
+}
+
+void TableIndexEntry::SetIVFTrainedState(SharedPtr<IVFTrainedState> trained_state) {
+    if (trained_state.get() == nullptr || !trained_state->Shareable()) {
+        return;
+    }
+    std::unique_lock lock(ivf_trained_state_mutex_);
+    if (ivf_trained_state_.get() == nullptr) {
+        ivf_trained_state_ = std::move(trained_state);
+    }
+}
+
 // For segment_index_entry
 void TableIndexEntry::CommitCreateIndex(TxnIndexStore *txn_index_store, TxnTimeStamp commit_ts, bool is_replay) {
     {
@@ -267,10 +315,13 @@ SharedPtr<ChunkIndexEntry> TableIndexEntry::MemIndexDump(TxnIndexStore *txn_inde
 }
 
 SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config) {
-    if (index_base_->index_type_ != IndexType::kFullText && index_base_->index_type_ != IndexType::kHnsw) {
+    if (index_base_->index_type_ != IndexType::kFullText && index_base_->index_type_ != IndexType::kHnsw &&
+        index_base_->index_type_ != IndexType::kIVFFlat && index_base_->index_type_ != IndexType::kSecondary) {
         return nullptr;
     }
-    auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, segment_entry->row_capacity(), column_def_);
+    // a secondary index is built on the rows of the segment, not on its capacity
+    SizeT row_count = index_base_->index_type_ == IndexType::kSecondary ? segment_entry->row_count() : segment_entry->row_capacity();
+    auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, row_count, column_def_);
     u32 segment_id = segment_entry->segment_id();
     SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
     segment_index_entry->PopulateEntirely(segment_entry, txn, config);
@@ -34,6 +34,7 @@ import index_file_worker;
 import column_def;
 import memory_pool;
 import block_entry;
+import annivfflat_index_data;
 
 namespace infinity {
 
@@ -128,6 +129,13 @@ public:
 
     void UpdateFulltextSegmentTs(TxnTimeStamp ts);
 
+    // Quantizers trained by some segment of this ivf index, nullptr if no segment has shareable ones yet.
+    // Falls back to the segment indexes on disk when nothing is cached, e.g. after restart; they are loaded outside the lock.
+    SharedPtr<IVFTrainedState> GetIVFTrainedState(SegmentID exclude_segment_id);
+
+    // Only the first shareable state (see IVFTrainedState::Shareable) is kept, so that all new segments share the same centroids.
+    void SetIVFTrainedState(SharedPtr<IVFTrainedState> trained_state);
+
     void CommitCreateIndex(TxnIndexStore *txn_index_store, TxnTimeStamp commit_ts, bool is_replay = false);
 
     // void RollbackPopulateIndex(TxnIndexStore *txn_index_store, Txn *txn);
@@ -149,6 +157,10 @@ private:
     std::shared_mutex segment_update_ts_mutex_{};
     TxnTimeStamp segment_update_ts_{0};
 
+    // For ivf index
+    std::mutex ivf_trained_state_mutex_{};
+    SharedPtr<IVFTrainedState> ivf_trained_state_{};
+
     std::shared_mutex rw_locker_{};
     TableIndexMeta *const table_index_meta_{};
     const SharedPtr<IndexBase> index_base_{};
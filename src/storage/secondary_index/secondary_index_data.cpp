@@ -32,6 +32,9 @@ import segment_iter;
 import buffer_manager;
 import secondary_index_pgm;
 import logger;
+import block_entry;
+import block_column_iter;
+import value;
 
 namespace infinity {
 
@@ -48,10 +51,11 @@ inline void LoadFromSegmentColumnIterator(OneColumnIterator<RawValueType, CheckT
         if (!pair_opt) {
             break;
         }
-        if (data_num >= full_data_num) {
-            UnrecoverableError("LoadFromSegmentColumnIterator(): segment row count more than expected");
-        }
         auto &[val_ptr, offset] = pair_opt.value(); // val_ptr is const RawValueType * type, offset is SegmentOffset type
+        if (offset >= full_data_num) {
+            // appended after the rows the index is built on, they are kept in SecondaryIndexInMem
+            continue;
+        }
         sorted_key_offset_pair[data_num++] = {ConvertToOrderedKeyValue<RawValueType>(*val_ptr), offset};
     }
     // finally, sort
@@ -63,7 +67,7 @@ inline void LoadFromSegmentColumnIterator(OneColumnIterator<RawValueType, CheckT
 //  2.1. OutputToPart(): copy sorted (key, offset) pairs into several SecondaryIndexDataPart structures.
 //  2.2. OutputToHeader(): create PGM index in SecondaryIndexDataHead.
 template <typename RawValueType>
-class SecondaryIndexDataBuilder final : public SecondaryIndexDataBuilderBase {
+class SecondaryIndexDataBuilder : public SecondaryIndexDataBuilderBase {
 public:
     using KeyType = ConvertToOrderedType<RawValueType>;
     using OffsetType = SegmentOffset;
@@ -76,10 +80,10 @@ public:
         sorted_key_offset_pair_ = MakeUniqueForOverwrite<KeyOffsetPair[]>(full_data_num_);
     }
 
-    ~SecondaryIndexDataBuilder() final = default;
+    ~SecondaryIndexDataBuilder() override = default;
 
     void
-    LoadSegmentData(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) final {
+    LoadSegmentData(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) override {
         static_assert(std::is_same_v<OffsetType, SegmentOffset>, "OffsetType != SegmentOffset, need to fix");
         if (check_ts) {
             OneColumnIterator<RawValueType> iter(segment_entry, buffer_mgr, column_id, begin_ts);
@@ -110,7 +114,7 @@ public:
         LOG_TRACE(fmt::format("EndOutput(), output_row_progress_: {}, data_num_: {}.", output_row_progress_, data_num_));
     }
 
-    void OutputToHeader(SecondaryIndexDataHead *index_head) final {
+    void OutputToHeader(SecondaryIndexDataHead *index_head) override {
         if (output_part_progress_ != output_part_num_) {
             UnrecoverableError(
                 "OutputToHeader(): error: output_part_progress_ != output_part_num_, need to call OutputToHeader() after OutputToPart().");
@@ -156,7 +160,10 @@ public:
             UnrecoverableError("OutputToPart(): error: unexpected index_part->part_id_ value");
         }
         if (auto expect_size = std::min(output_part_capacity_, data_num_ - output_row_progress_); expect_size != index_part->part_size_) {
-            if (index_part->part_size_ < expect_size) {
+            if (index_part->loaded_) {
+                // the part is built again after rows are appended to the segment
+                index_part->part_size_ = expect_size;
+            } else if (index_part->part_size_ < expect_size) {
                 UnrecoverableError("OutputToPart(): error: index_part->part_size_");
             } else {
                 LOG_INFO(fmt::format("OutputToPart(): index_part->part_size_: {}, expect_size: {}. Maybe some rows are deleted.",
@@ -207,7 +214,7 @@ public:
         LOG_TRACE(fmt::format("OutputToPart(), output_row_progress_: {}, data_num_: {}.", output_row_progress_, data_num_));
     }
 
-private:
+protected:
     const u32 full_data_num_{};                          // number of rows in the segment, include those deleted
     u32 data_num_{};                                     // number of rows in the segment, except those deleted, start from 0, grow during input
     LogicalType index_key_type_ = LogicalType::kInvalid; // type of ordered keys stored in the raw index
@@ -223,6 +230,72 @@ private:
     UniquePtr<KeyType[]> sorted_keys_;                       // for pgm. Will be created in StartOutput().
 };
 
+// varchar values are replaced by their ordinals in the sorted dictionary of the segment
+// the parts and the PGM index are built on the ordinals, the dictionary is kept in SecondaryIndexDataHead
+class SecondaryIndexDataVarcharBuilder final : public SecondaryIndexDataBuilder<IntegerT> {
+public:
+    using Base = SecondaryIndexDataBuilder<IntegerT>;
+
+    explicit SecondaryIndexDataVarcharBuilder(u32 full_data_num, u32 part_capacity) : Base(full_data_num, part_capacity) {}
+
+    ~SecondaryIndexDataVarcharBuilder() final = default;
+
+    void
+    LoadSegmentData(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) final {
+        if (check_ts) {
+            return LoadSegmentDataT<true>(segment_entry, buffer_mgr, column_id, begin_ts);
+        } else {
+            return LoadSegmentDataT<false>(segment_entry, buffer_mgr, column_id, begin_ts);
+        }
+    }
+
+    void OutputToHeader(SecondaryIndexDataHead *index_head) final {
+        Base::OutputToHeader(index_head);
+        index_head->dictionary_ = std::move(dictionary_);
+    }
+
+private:
+    template <bool CheckTS>
+    void LoadSegmentDataT(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts) {
+        if (data_num_ != 0) {
+            UnrecoverableError("SecondaryIndexDataVarcharBuilder::LoadSegmentData(): data_num_ is not initially 0");
+        }
+        Vector<Pair<String, SegmentOffset>> value_offset_pairs;
+        auto block_entry_iter = BlockEntryIter(segment_entry);
+        for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+            const SegmentOffset block_offset = block_entry->segment_offset();
+            BlockColumnIter<CheckTS> column_iter(block_entry->GetColumnBlockEntry(column_id), buffer_mgr, begin_ts);
+            for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
+                auto &[_, offset] = next_pair.value();
+                SegmentOffset segment_offset = block_offset + offset;
+                if (segment_offset >= full_data_num_) {
+                    // appended after the rows the index is built on, they are kept in SecondaryIndexInMem
+                    continue;
+                }
+                Value val = column_iter.column_vector()->GetValue(offset);
+                value_offset_pairs.emplace_back(val.GetVarchar(), segment_offset);
+            }
+        }
+        std::sort(value_offset_pairs.begin(), value_offset_pairs.end(), [](const auto &left, const auto &right) {
+            if (VarcharKeyLess{}(left.first, right.first)) {
+                return true;
+            }
+            if (VarcharKeyLess{}(right.first, left.first)) {
+                return false;
+            }
+            return left.second < right.second;
+        });
+        for (auto &[value, offset] : value_offset_pairs) {
+            if (dictionary_.empty() or dictionary_.back() != value) {
+                dictionary_.emplace_back(std::move(value));
+            }
+            sorted_key_offset_pair_[data_num_++] = {static_cast<IntegerT>(dictionary_.size() - 1), offset};
+        }
+    }
+
+    Vector<String> dictionary_;
+};
+
 UniquePtr<SecondaryIndexDataBuilderBase> GetSecondaryIndexDataBuilder(const SharedPtr<DataType> &data_type, u32 full_data_num, u32 part_capacity) {
     if (!(data_type->CanBuildSecondaryIndex())) {
         UnrecoverableError(fmt::format("Cannot build secondary index on data type: {}", data_type->ToString()));
@@ -259,6 +332,9 @@ UniquePtr<SecondaryIndexDataBuilderBase> GetSecondaryIndexDataBuilder(const Shar
         case LogicalType::kTimestamp: {
             return MakeUnique<SecondaryIndexDataBuilder<TimestampT>>(full_data_num, part_capacity);
         }
+        case LogicalType::kVarchar: {
+            return MakeUnique<SecondaryIndexDataVarcharBuilder>(full_data_num, part_capacity);
+        }
         default: {
             UnrecoverableError(fmt::format("Need to add secondary index support for data type: {}", data_type->ToString()));
             return {};
@@ -279,6 +355,10 @@ void SecondaryIndexDataHead::SaveIndexInner(FileHandler &file_handler) const {
     file_handler.Write(&data_type_offset_, sizeof(data_type_offset_));
     // pgm
     pgm_index_->SaveIndex(file_handler);
+    // dictionary of varchar values
+    if (data_type_raw_ == LogicalType::kVarchar) {
+        SaveDictionary(file_handler);
+    }
     LOG_TRACE("SaveIndexInner() done.");
 }
 
@@ -325,11 +405,54 @@ void SecondaryIndexDataHead::ReadIndexInner(FileHandler &file_handler) {
     }
     // load pgm
     pgm_index_->LoadIndex(file_handler);
+    // load dictionary of varchar values
+    if (data_type_raw_ == LogicalType::kVarchar) {
+        ReadDictionary(file_handler);
+    }
     // update loaded_
     loaded_ = true;
     LOG_TRACE("ReadIndexInner() done.");
 }
 
+// front coding: each value is saved as the length of the prefix shared with the previous value and the rest of it
+void SecondaryIndexDataHead::SaveDictionary(FileHandler &file_handler) const {
+    u32 dictionary_size = dictionary_.size();
+    file_handler.Write(&dictionary_size, sizeof(dictionary_size));
+    const String *prev_value = nullptr;
+    for (const auto &value : dictionary_) {
+        u32 shared_len = 0;
+        if (prev_value != nullptr) {
+            auto [mismatch_iter, _] = std::mismatch(prev_value->begin(), prev_value->end(), value.begin(), value.end());
+            shared_len = mismatch_iter - prev_value->begin();
+        }
+        u32 suffix_len = value.size() - shared_len;
+        file_handler.Write(&shared_len, sizeof(shared_len));
+        file_handler.Write(&suffix_len, sizeof(suffix_len));
+        file_handler.Write(value.data() + shared_len, suffix_len);
+        prev_value = &value;
+    }
+}
+
+void SecondaryIndexDataHead::ReadDictionary(FileHandler &file_handler) {
+    u32 dictionary_size = 0;
+    file_handler.Read(&dictionary_size, sizeof(dictionary_size));
+    dictionary_.clear();
+    dictionary_.reserve(dictionary_size);
+    for (u32 i = 0; i < dictionary_size; ++i) {
+        u32 shared_len = 0;
+        u32 suffix_len = 0;
+        file_handler.Read(&shared_len, sizeof(shared_len));
+        file_handler.Read(&suffix_len, sizeof(suffix_len));
+        if (i == 0 ? shared_len != 0 : shared_len > dictionary_.back().size()) {
+            UnrecoverableError(fmt::format("ReadDictionary(): invalid shared prefix length: {}.", shared_len));
+        }
+        String value = i == 0 ? String() : dictionary_.back().substr(0, shared_len);
+        value.resize(shared_len + suffix_len);
+        file_handler.Read(value.data() + shared_len, suffix_len);
+        dictionary_.emplace_back(std::move(value));
+    }
+}
+
 void SecondaryIndexDataPart::SaveIndexInner(FileHandler &file_handler) const {
     if (!loaded_) {
         UnrecoverableError("SaveIndexInner(): error: SecondaryIndexDataPart is not loaded");
@@ -361,6 +484,7 @@ void SecondaryIndexDataPart::ReadIndexInner(FileHandler &file_handler) {
     file_handler.Read(&part_id_, sizeof(part_id_));
     file_handler.Read(&part_size_, sizeof(part_size_));
     if (part_size_ == 0) {
+        loaded_ = true;
         return;
     }
     // key type
@@ -111,6 +111,61 @@ LogicalType GetLogicalType<IntegerT> = LogicalType::kInteger;
 template <>
 LogicalType GetLogicalType<BigIntT> = LogicalType::kBigInt;
 
+// varchar keys are ordered in the same way as the varchar compare functions: char by char, then by length
+export struct VarcharKeyLess {
+    bool operator()(const String &left, const String &right) const {
+        return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end());
+    }
+};
+
+// range of varchar keys, a bound is either inclusive or exclusive, a missing bound is unbounded
+export struct VarcharKeyRange {
+    Optional<String> begin_val_{};
+    bool begin_inclusive_{true};
+    Optional<String> end_val_{};
+    bool end_inclusive_{true};
+
+    // the first position in [first, last) which is in the range
+    template <typename Iter>
+    Iter LowerBound(Iter first, Iter last) const {
+        if (!begin_val_) {
+            return first;
+        }
+        if (begin_inclusive_) {
+            return std::lower_bound(first, last, *begin_val_, VarcharKeyLess{});
+        }
+        return std::upper_bound(first, last, *begin_val_, VarcharKeyLess{});
+    }
+
+    // the first position in [first, last) which is after the range
+    template <typename Iter>
+    Iter UpperBound(Iter first, Iter last) const {
+        if (!end_val_) {
+            return last;
+        }
+        if (end_inclusive_) {
+            return std::upper_bound(first, last, *end_val_, VarcharKeyLess{});
+        }
+        return std::lower_bound(first, last, *end_val_, VarcharKeyLess{});
+    }
+
+    // whether val is not before the range
+    bool NotBeforeBegin(const String &val) const {
+        if (!begin_val_) {
+            return true;
+        }
+        return begin_inclusive_ ? !VarcharKeyLess{}(val, *begin_val_) : VarcharKeyLess{}(*begin_val_, val);
+    }
+
+    // whether val is not after the range
+    bool NotAfterEnd(const String &val) const {
+        if (!end_val_) {
+            return true;
+        }
+        return end_inclusive_ ? !VarcharKeyLess{}(*end_val_, val) : VarcharKeyLess{}(val, *end_val_);
+    }
+};
+
 export class SecondaryIndexDataHead;
 
 export class SecondaryIndexDataPart;
@@ -140,6 +195,7 @@ class SecondaryIndexDataHead {
     friend class SecondaryIndexDataBuilderBase;
     template <typename ValueT>
     friend class SecondaryIndexDataBuilder;
+    friend class SecondaryIndexDataVarcharBuilder;
 
 private:
     bool loaded_{false};  // whether data of this part is in memory
@@ -155,6 +211,9 @@ private:
     LogicalType data_type_offset_ = LogicalType::kInvalid;
     // pgm index
     UniquePtr<SecondaryPGMIndex> pgm_index_;
+    // distinct varchar values in the segment in VarcharKeyLess order, the keys in the parts are ordinals into it
+    // saved with front coding
+    Vector<String> dictionary_;
 
 public:
     // will be called when an old index is loaded
@@ -174,6 +233,23 @@ public:
     [[nodiscard]] u32 GetPartCapacity() const { return part_capacity_; }
     [[nodiscard]] u32 GetPartNum() const { return part_num_; }
     [[nodiscard]] u32 GetDataNum() const { return data_num_; }
+    [[nodiscard]] u32 GetFullDataNum() const { return full_data_num_; }
+    [[nodiscard]] bool Loaded() const { return loaded_; }
+
+    // will be called before the index is built again over the first full_data_num rows of the segment
+    // used when the rows of SecondaryIndexInMem are merged
+    void ResetFullDataNum(u32 full_data_num) {
+        full_data_num_ = full_data_num;
+        part_num_ = (full_data_num + part_capacity_ - 1) / part_capacity_;
+        data_num_ = 0;
+    }
+
+    // ordinals [begin, end] of the dictionary values in range, begin > end if there is none
+    [[nodiscard]] Pair<IntegerT, IntegerT> SearchDictionary(const VarcharKeyRange &range) const {
+        auto begin = range.LowerBound(dictionary_.begin(), dictionary_.end());
+        auto end = range.UpperBound(begin, dictionary_.end());
+        return {static_cast<IntegerT>(begin - dictionary_.begin()), static_cast<IntegerT>(end - dictionary_.begin()) - 1};
+    }
 
     [[nodiscard]] auto SearchPGM(const void *val_ptr) const {
         if (!pgm_index_) {
@@ -185,6 +261,11 @@ public:
     void SaveIndexInner(FileHandler &file_handler) const;
 
     void ReadIndexInner(FileHandler &file_handler);
+
+private:
+    void SaveDictionary(FileHandler &file_handler) const;
+
+    void ReadDictionary(FileHandler &file_handler);
 };
 
 // an index may include several parts
@@ -193,6 +274,7 @@ class SecondaryIndexDataPart {
     friend class SecondaryIndexDataBuilderBase;
     template <typename ValueT>
     friend class SecondaryIndexDataBuilder;
+    friend class SecondaryIndexDataVarcharBuilder;
 
 private:
     bool loaded_{false}; // whether data of this part is in memory
@@ -0,0 +1,129 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module secondary_index_in_mem;
+
+import stl;
+import column_vector;
+import column_def;
+import internal_types;
+import logical_type;
+import data_type;
+import third_party;
+import infinity_exception;
+
+namespace infinity {
+
+SharedPtr<SecondaryIndexInMem> SecondaryIndexInMem::NewSecondaryIndexInMem(const SharedPtr<ColumnDef> &column_def, u32 base_row_count) {
+    const auto &data_type = column_def->type();
+    if (!(data_type->CanBuildSecondaryIndex())) {
+        UnrecoverableError(fmt::format("Cannot build secondary index on data type: {}", data_type->ToString()));
+        return nullptr;
+    }
+    switch (data_type->type()) {
+        case LogicalType::kTinyInt: {
+            return MakeShared<SecondaryIndexInMemT<TinyIntT>>(base_row_count);
+        }
+        case LogicalType::kSmallInt: {
+            return MakeShared<SecondaryIndexInMemT<SmallIntT>>(base_row_count);
+        }
+        case LogicalType::kInteger: {
+            return MakeShared<SecondaryIndexInMemT<IntegerT>>(base_row_count);
+        }
+        case LogicalType::kBigInt: {
+            return MakeShared<SecondaryIndexInMemT<BigIntT>>(base_row_count);
+        }
+        case LogicalType::kFloat: {
+            return MakeShared<SecondaryIndexInMemT<FloatT>>(base_row_count);
+        }
+        case LogicalType::kDouble: {
+            return MakeShared<SecondaryIndexInMemT<DoubleT>>(base_row_count);
+        }
+        case LogicalType::kDate: {
+            return MakeShared<SecondaryIndexInMemT<DateT>>(base_row_count);
+        }
+        case LogicalType::kTime: {
+            return MakeShared<SecondaryIndexInMemT<TimeT>>(base_row_count);
+        }
+        case LogicalType::kDateTime: {
+            return MakeShared<SecondaryIndexInMemT<DateTimeT>>(base_row_count);
+        }
+        case LogicalType::kTimestamp: {
+            return MakeShared<SecondaryIndexInMemT<TimestampT>>(base_row_count);
+        }
+        case LogicalType::kVarchar: {
+            return MakeShared<SecondaryIndexInMemT<VarcharT>>(base_row_count);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Need to add secondary index support for data type: {}", data_type->ToString()));
+            return nullptr;
+        }
+    }
+}
+
+void SecondaryIndexInMem::Insert(const ColumnVector &column_vector,
+                                 u32 row_offset,
+                                 u32 row_count,
+                                 SegmentOffset block_offset,
+                                 TxnTimeStamp commit_ts) {
+    u32 row_end = block_offset + row_offset + row_count;
+    std::unique_lock lock(rw_mutex_);
+    InsertInner(column_vector, row_offset, row_count, block_offset);
+    if (!commit_row_ends_.empty() && commit_row_ends_.back().first == commit_ts) {
+        // several blocks of one commit
+        commit_row_ends_.back().second = std::max(commit_row_ends_.back().second, row_end);
+    } else {
+        commit_row_ends_.emplace_back(commit_ts, row_end);
+    }
+}
+
+void SecondaryIndexInMem::Merge(u32 new_base_row_count) {
+    std::unique_lock lock(rw_mutex_);
+    if (new_base_row_count <= base_row_count_) {
+        return;
+    }
+    MergeInner(new_base_row_count);
+    // commit_row_ends_ is kept, readers older than the merge still have to skip the rows they can't see in the built index
+    base_row_count_ = new_base_row_count;
+}
+
+u32 SecondaryIndexInMem::VisibleRowEnd(TxnTimeStamp begin_ts) const {
+    std::shared_lock lock(rw_mutex_);
+    return VisibleRowEndInner(begin_ts);
+}
+
+u32 SecondaryIndexInMem::VisibleRowEndInner(TxnTimeStamp begin_ts) const {
+    // first commit after begin_ts
+    auto iter = std::lower_bound(commit_row_ends_.begin(), commit_row_ends_.end(), begin_ts, [](const Pair<TxnTimeStamp, u32> &commit, TxnTimeStamp ts) {
+        return commit.first <= ts;
+    });
+    if (iter == commit_row_ends_.begin()) {
+        return init_row_end_;
+    }
+    return std::prev(iter)->second;
+}
+
+u32 SecondaryIndexInMem::BaseRowCount() const {
+    std::shared_lock lock(rw_mutex_);
+    return base_row_count_;
+}
+
+u32 SecondaryIndexInMem::RowCount() const {
+    std::shared_lock lock(rw_mutex_);
+    return row_count_;
+}
+
+} // namespace infinity
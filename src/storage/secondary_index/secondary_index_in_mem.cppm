@@ -0,0 +1,167 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module secondary_index_in_mem;
+
+import stl;
+import column_vector;
+import column_def;
+import internal_types;
+import secondary_index_data;
+import value;
+
+namespace infinity {
+
+// Rows appended to a segment after its secondary index was built.
+// The built index (SecondaryIndexDataHead and parts) covers the rows of the segment before base_row_count_, the rows
+// after it are kept here in key order until they are merged into a new build of the index by optimize.
+export class SecondaryIndexInMem {
+public:
+    explicit SecondaryIndexInMem(u32 base_row_count) : base_row_count_(base_row_count), init_row_end_(base_row_count) {}
+
+    virtual ~SecondaryIndexInMem() = default;
+
+    static SharedPtr<SecondaryIndexInMem> NewSecondaryIndexInMem(const SharedPtr<ColumnDef> &column_def, u32 base_row_count);
+
+    // Rows are appended to a segment in commit order, the rows [row_offset, row_offset + row_count) of the block starting
+    // at block_offset were committed at commit_ts
+    void Insert(const ColumnVector &column_vector, u32 row_offset, u32 row_count, SegmentOffset block_offset, TxnTimeStamp commit_ts);
+
+    // Drop the rows before new_base_row_count, they are in the built index now
+    void Merge(u32 new_base_row_count);
+
+    // End of the rows of the segment committed before begin_ts
+    u32 VisibleRowEnd(TxnTimeStamp begin_ts) const;
+
+    u32 BaseRowCount() const;
+
+    u32 RowCount() const;
+
+protected:
+    virtual void InsertInner(const ColumnVector &column_vector, u32 row_offset, u32 row_count, SegmentOffset block_offset) = 0;
+
+    virtual void MergeInner(u32 new_base_row_count) = 0;
+
+    u32 VisibleRowEndInner(TxnTimeStamp begin_ts) const;
+
+    mutable std::shared_mutex rw_mutex_{};
+    u32 base_row_count_{};
+    u32 init_row_end_{}; // rows visible before the first commit recorded here
+    u32 row_count_{};
+    Vector<Pair<TxnTimeStamp, u32>> commit_row_ends_{}; // end of the rows of each commit, in commit order
+};
+
+export template <typename RawValueType>
+class SecondaryIndexInMemT final : public SecondaryIndexInMem {
+public:
+    using KeyType = ConvertToOrderedType<RawValueType>;
+
+    explicit SecondaryIndexInMemT(u32 base_row_count) : SecondaryIndexInMem(base_row_count) {}
+
+    // Append the sorted offsets of the rows in [begin_val, end_val] visible at begin_ts
+    void SearchRange(KeyType begin_val, KeyType end_val, TxnTimeStamp begin_ts, Vector<u32> &offsets) const {
+        std::shared_lock lock(rw_mutex_);
+        u32 visible_row_end = VisibleRowEndInner(begin_ts);
+        SizeT begin_size = offsets.size();
+        for (auto iter = key_offsets_.lower_bound(begin_val); iter != key_offsets_.end() && !(end_val < iter->first); ++iter) {
+            if (iter->second < visible_row_end) {
+                offsets.push_back(iter->second);
+            }
+        }
+        std::sort(offsets.begin() + begin_size, offsets.end());
+    }
+
+protected:
+    void InsertInner(const ColumnVector &column_vector, u32 row_offset, u32 row_count, SegmentOffset block_offset) final {
+        const auto *values = reinterpret_cast<const RawValueType *>(column_vector.data());
+        for (u32 i = 0; i < row_count; ++i) {
+            SegmentOffset segment_offset = block_offset + row_offset + i;
+            if (segment_offset < base_row_count_) {
+                // replayed rows which are in the built index already
+                continue;
+            }
+            key_offsets_.emplace(ConvertToOrderedKeyValue(values[row_offset + i]), segment_offset);
+            ++row_count_;
+        }
+    }
+
+    void MergeInner(u32 new_base_row_count) final {
+        for (auto iter = key_offsets_.begin(); iter != key_offsets_.end();) {
+            if (iter->second < new_base_row_count) {
+                iter = key_offsets_.erase(iter);
+                --row_count_;
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+private:
+    MultiMap<KeyType, u32> key_offsets_{};
+};
+
+export template <>
+class SecondaryIndexInMemT<VarcharT> final : public SecondaryIndexInMem {
+public:
+    explicit SecondaryIndexInMemT(u32 base_row_count) : SecondaryIndexInMem(base_row_count) {}
+
+    // Append the sorted offsets of the rows in range visible at begin_ts
+    void SearchRange(const VarcharKeyRange &range, TxnTimeStamp begin_ts, Vector<u32> &offsets) const {
+        std::shared_lock lock(rw_mutex_);
+        u32 visible_row_end = VisibleRowEndInner(begin_ts);
+        SizeT begin_size = offsets.size();
+        auto begin_iter = key_offsets_.begin();
+        if (range.begin_val_) {
+            begin_iter = range.begin_inclusive_ ? key_offsets_.lower_bound(*range.begin_val_) : key_offsets_.upper_bound(*range.begin_val_);
+        }
+        for (auto iter = begin_iter; iter != key_offsets_.end() && range.NotAfterEnd(iter->first); ++iter) {
+            if (iter->second < visible_row_end) {
+                offsets.push_back(iter->second);
+            }
+        }
+        std::sort(offsets.begin() + begin_size, offsets.end());
+    }
+
+protected:
+    void InsertInner(const ColumnVector &column_vector, u32 row_offset, u32 row_count, SegmentOffset block_offset) final {
+        for (u32 i = 0; i < row_count; ++i) {
+            SegmentOffset segment_offset = block_offset + row_offset + i;
+            if (segment_offset < base_row_count_) {
+                // replayed rows which are in the built index already
+                continue;
+            }
+            Value val = column_vector.GetValue(row_offset + i);
+            key_offsets_.emplace(val.GetVarchar(), segment_offset);
+            ++row_count_;
+        }
+    }
+
+    void MergeInner(u32 new_base_row_count) final {
+        for (auto iter = key_offsets_.begin(); iter != key_offsets_.end();) {
+            if (iter->second < new_base_row_count) {
+                iter = key_offsets_.erase(iter);
+                --row_count_;
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+private:
+    MultiMap<String, u32, VarcharKeyLess> key_offsets_{};
+};
+
+} // namespace infinity
@@ -0,0 +1,188 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+module column_statistics;
+
+import stl;
+import third_party;
+import value;
+import internal_types;
+import hyper_log_log;
+import equi_depth_histogram;
+
+namespace infinity {
+
+Optional<f64> StatisticsKey(const Value &value) {
+    switch (value.type().type()) {
+        case kBoolean: {
+            return StatisticsKey(value.GetValue<BooleanT>());
+        }
+        case kTinyInt: {
+            return StatisticsKey(value.GetValue<TinyIntT>());
+        }
+        case kSmallInt: {
+            return StatisticsKey(value.GetValue<SmallIntT>());
+        }
+        case kInteger: {
+            return StatisticsKey(value.GetValue<IntegerT>());
+        }
+        case kBigInt: {
+            return StatisticsKey(value.GetValue<BigIntT>());
+        }
+        case kFloat: {
+            return StatisticsKey(value.GetValue<FloatT>());
+        }
+        case kDouble: {
+            return StatisticsKey(value.GetValue<DoubleT>());
+        }
+        case kDate: {
+            return StatisticsKey(value.GetValue<DateT>());
+        }
+        case kTime: {
+            return StatisticsKey(value.GetValue<TimeT>());
+        }
+        case kDateTime: {
+            return StatisticsKey(value.GetValue<DateTimeT>());
+        }
+        case kTimestamp: {
+            return StatisticsKey(value.GetValue<TimestampT>());
+        }
+        default: {
+            return None;
+        }
+    }
+}
+
+void ColumnStatistics::SaveToJson(nlohmann::json &json) const {
+    json["row_count"] = row_count_;
+    json["null_count"] = null_count_;
+    distinct_.SaveToJson(json);
+    if (!histogram_.Empty()) {
+        histogram_.SaveToJson(json);
+    }
+}
+
+void ColumnStatistics::LoadFromJson(const nlohmann::json &json) {
+    row_count_ = json["row_count"];
+    null_count_ = json["null_count"];
+    distinct_.LoadFromJson(json);
+    histogram_.LoadFromJson(json);
+}
+
+nlohmann::json SegmentStatistics::Serialize() const {
+    nlohmann::json json;
+    json["build_ts"] = build_ts_;
+    json["row_count"] = row_count_;
+    for (const auto &column : columns_) {
+        nlohmann::json column_json;
+        column.SaveToJson(column_json);
+        json["columns"].emplace_back(std::move(column_json));
+    }
+    return json;
+}
+
+SharedPtr<SegmentStatistics> SegmentStatistics::Deserialize(const nlohmann::json &json) {
+    auto statistics = MakeShared<SegmentStatistics>();
+    statistics->build_ts_ = json["build_ts"];
+    statistics->row_count_ = json["row_count"];
+    if (json.contains("columns")) {
+        for (const auto &column_json : json["columns"]) {
+            statistics->columns_.emplace_back().LoadFromJson(column_json);
+        }
+    }
+    return statistics;
+}
+
+void TableStatistics::AddSegment(SegmentID segment_id, u64 row_count, SharedPtr<const SegmentStatistics> statistics) {
+    row_count_ += row_count;
+    if (statistics.get() != nullptr) {
+        analyzed_row_count_ += statistics->row_count_;
+        segments_.emplace(segment_id, std::move(statistics));
+    }
+}
+
+const SegmentStatistics *TableStatistics::GetSegmentStatistics(SegmentID segment_id) const {
+    auto iter = segments_.find(segment_id);
+    return iter == segments_.end() ? nullptr : iter->second.get();
+}
+
+f64 TableStatistics::DistinctCount(ColumnID column_id) const {
+    HyperLogLog distinct;
+    u64 non_null_count = 0;
+    for (const auto &[segment_id, statistics] : segments_) {
+        if (column_id < statistics->columns_.size()) {
+            const auto &column = statistics->columns_[column_id];
+            distinct.Merge(column.distinct_);
+            non_null_count += column.row_count_ - column.null_count_;
+        }
+    }
+    return std::min<f64>(distinct.Estimate(), non_null_count);
+}
+
+u64 TableStatistics::NullCount(ColumnID column_id) const {
+    u64 null_count = 0;
+    for (const auto &[segment_id, statistics] : segments_) {
+        if (column_id < statistics->columns_.size()) {
+            null_count += statistics->columns_[column_id].null_count_;
+        }
+    }
+    return null_count;
+}
+
+Optional<f64>
+TableStatistics::RangeSelectivity(ColumnID column_id, Optional<f64> lower, bool lower_inclusive, Optional<f64> upper, bool upper_inclusive) const {
+    // the segment fractions weighted by the segment row counts
+    f64 row_count = 0.0;
+    u64 total_row_count = 0;
+    for (const auto &[segment_id, statistics] : segments_) {
+        if (column_id >= statistics->columns_.size()) {
+            continue;
+        }
+        const auto &column = statistics->columns_[column_id];
+        if (column.histogram_.Empty()) {
+            if (column.row_count_ != 0) {
+                return None;
+            }
+            continue;
+        }
+        row_count += column.histogram_.RangeFraction(lower, lower_inclusive, upper, upper_inclusive) * column.row_count_;
+        total_row_count += column.row_count_;
+    }
+    if (total_row_count == 0) {
+        return None;
+    }
+    return row_count / total_row_count;
+}
+
+f64 TableStatistics::EqualSelectivity(ColumnID column_id, const Value &value) const {
+    f64 distinct_count = DistinctCount(column_id);
+    f64 selectivity = distinct_count < 1.0 ? 1.0 : 1.0 / distinct_count;
+    // a value frequent enough to get its own histogram bucket
+    if (Optional<f64> key = StatisticsKey(value); key.has_value() && analyzed_row_count_ != 0) {
+        f64 row_count = 0.0;
+        for (const auto &[segment_id, statistics] : segments_) {
+            if (column_id < statistics->columns_.size()) {
+                const auto &column = statistics->columns_[column_id];
+                row_count += column.histogram_.PointFraction(*key) * column.row_count_;
+            }
+        }
+        selectivity = std::max(selectivity, row_count / analyzed_row_count_);
+    }
+    return selectivity;
+}
+
+} // namespace infinity
@@ -0,0 +1,104 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include <type_traits>
+
+export module column_statistics;
+
+import stl;
+import third_party;
+import value;
+import internal_types;
+import column_vector;
+import hyper_log_log;
+import equi_depth_histogram;
+
+namespace infinity {
+
+// the key a value has in the histogram, None for the types without an order the histogram can use
+export template <typename T>
+Optional<f64> StatisticsKey(const T &value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<f64>(value);
+    } else if constexpr (IsAnyOf<T, DateT, TimeT>) {
+        return static_cast<f64>(value.GetValue());
+    } else if constexpr (IsAnyOf<T, DateTimeT, TimestampT>) {
+        return static_cast<f64>(value.GetEpochTime());
+    } else {
+        return None;
+    }
+}
+
+export Optional<f64> StatisticsKey(const Value &value);
+
+export struct ColumnStatistics {
+    u64 row_count_{};
+    // null values are not persisted by the block columns yet, always 0
+    u64 null_count_{};
+    HyperLogLog distinct_;
+    EquiDepthHistogram histogram_;
+
+    f64 DistinctCount() const { return std::min<f64>(distinct_.Estimate(), row_count_ - null_count_); }
+
+    void SaveToJson(nlohmann::json &json) const;
+
+    void LoadFromJson(const nlohmann::json &json);
+};
+
+// statistics of the visible rows of a segment at build_ts_, kept with the segment entry
+export struct SegmentStatistics {
+    TxnTimeStamp build_ts_{};
+    u64 row_count_{};
+    Vector<ColumnStatistics> columns_;
+
+    nlohmann::json Serialize() const;
+
+    static SharedPtr<SegmentStatistics> Deserialize(const nlohmann::json &json);
+};
+
+// what the optimizer rules see: the statistics of the segments visible to a transaction
+export class TableStatistics {
+public:
+    // row_count is the row count of the segment, analyzed or not
+    void AddSegment(SegmentID segment_id, u64 row_count, SharedPtr<const SegmentStatistics> statistics);
+
+    u64 row_count() const { return row_count_; }
+
+    // rows of the segments that have statistics
+    u64 analyzed_row_count() const { return analyzed_row_count_; }
+
+    bool Empty() const { return segments_.empty(); }
+
+    const SegmentStatistics *GetSegmentStatistics(SegmentID segment_id) const;
+
+    f64 DistinctCount(ColumnID column_id) const;
+
+    u64 NullCount(ColumnID column_id) const;
+
+    // estimated fraction of rows in the range, None when the column has no histogram
+    Optional<f64> RangeSelectivity(ColumnID column_id, Optional<f64> lower, bool lower_inclusive, Optional<f64> upper, bool upper_inclusive) const;
+
+    // estimated fraction of rows equal to value
+    f64 EqualSelectivity(ColumnID column_id, const Value &value) const;
+
+private:
+    u64 row_count_{};
+    u64 analyzed_row_count_{};
+    Map<SegmentID, SharedPtr<const SegmentStatistics>> segments_;
+};
+
+} // namespace infinity
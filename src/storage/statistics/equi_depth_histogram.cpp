@@ -0,0 +1,108 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include <algorithm>
+module equi_depth_histogram;
+
+import stl;
+import third_party;
+
+namespace infinity {
+
+void EquiDepthHistogram::Build(Vector<f64> &sample) {
+    lows_.clear();
+    highs_.clear();
+    fractions_.clear();
+    const SizeT n = sample.size();
+    if (n == 0) {
+        return;
+    }
+    std::sort(sample.begin(), sample.end());
+    const SizeT bucket_count = std::min(MAX_BUCKET_COUNT, n);
+    const SizeT bucket_depth = n / bucket_count;
+    SizeT begin = 0;
+    while (begin < n) {
+        // spread the remaining rows over the remaining buckets
+        SizeT remaining_bucket_count = bucket_count > fractions_.size() ? bucket_count - fractions_.size() : 1;
+        SizeT end = begin + (n - begin + remaining_bucket_count - 1) / remaining_bucket_count;
+        if (end < n && sample[end] == sample[end - 1]) {
+            // keep equal keys in one bucket, a key as frequent as a whole bucket gets a bucket of its own
+            const f64 key = sample[end - 1];
+            SizeT run_begin = std::lower_bound(sample.begin() + begin, sample.begin() + end, key) - sample.begin();
+            SizeT run_end = std::upper_bound(sample.begin() + end, sample.end(), key) - sample.begin();
+            end = run_begin > begin && run_end - run_begin >= bucket_depth ? run_begin : run_end;
+        }
+        lows_.push_back(sample[begin]);
+        highs_.push_back(sample[end - 1]);
+        fractions_.push_back(static_cast<f64>(end - begin) / n);
+        begin = end;
+    }
+}
+
+f64 EquiDepthHistogram::LessFraction(f64 value, bool inclusive) const {
+    f64 fraction = 0.0;
+    for (SizeT i = 0; i < fractions_.size(); ++i) {
+        const f64 low = lows_[i];
+        const f64 high = highs_[i];
+        if (high < value || (inclusive && high == value)) {
+            fraction += fractions_[i];
+            continue;
+        }
+        if (low > value || (!inclusive && low == value)) {
+            break;
+        }
+        // low <= value < high: assume uniform keys inside the bucket
+        fraction += fractions_[i] * (value - low) / (high - low);
+        break;
+    }
+    return fraction;
+}
+
+f64 EquiDepthHistogram::RangeFraction(Optional<f64> lower, bool lower_inclusive, Optional<f64> upper, bool upper_inclusive) const {
+    f64 upper_fraction = upper.has_value() ? LessFraction(*upper, upper_inclusive) : 1.0;
+    f64 lower_fraction = lower.has_value() ? LessFraction(*lower, !lower_inclusive) : 0.0;
+    return std::clamp(upper_fraction - lower_fraction, 0.0, 1.0);
+}
+
+f64 EquiDepthHistogram::PointFraction(f64 value) const {
+    for (SizeT i = 0; i < fractions_.size() && lows_[i] <= value; ++i) {
+        if (lows_[i] == value && highs_[i] == value) {
+            return fractions_[i];
+        }
+    }
+    return 0.0;
+}
+
+void EquiDepthHistogram::SaveToJson(nlohmann::json &json) const {
+    auto &histogram_json = json[JsonTag];
+    histogram_json["lows"] = lows_;
+    histogram_json["highs"] = highs_;
+    histogram_json["fractions"] = fractions_;
+}
+
+bool EquiDepthHistogram::LoadFromJson(const nlohmann::json &json) {
+    if (!json.contains(JsonTag)) {
+        return false;
+    }
+    const auto &histogram_json = json[JsonTag];
+    lows_ = histogram_json["lows"].get<Vector<f64>>();
+    highs_ = histogram_json["highs"].get<Vector<f64>>();
+    fractions_ = histogram_json["fractions"].get<Vector<f64>>();
+    return lows_.size() == fractions_.size() && highs_.size() == fractions_.size();
+}
+
+} // namespace infinity
@@ -0,0 +1,62 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+export module equi_depth_histogram;
+
+import stl;
+import third_party;
+
+namespace infinity {
+
+// Equi-depth histogram over the f64 keys of a numeric or temporal column, built from a row sample.
+// Every bucket holds about the same number of sampled rows and equal keys never straddle two buckets.
+// A key as frequent as a whole bucket gets a bucket of its own with low == high, so there may be up to
+// 2 * MAX_BUCKET_COUNT buckets.
+export class EquiDepthHistogram {
+public:
+    constexpr static SizeT MAX_BUCKET_COUNT = 64;
+    constexpr static std::string_view JsonTag = "histogram";
+
+    EquiDepthHistogram() = default;
+
+    // sample is sorted in place
+    void Build(Vector<f64> &sample);
+
+    bool Empty() const { return fractions_.empty(); }
+
+    SizeT BucketCount() const { return fractions_.size(); }
+
+    // fraction of the rows with key < value, or key <= value when inclusive
+    f64 LessFraction(f64 value, bool inclusive) const;
+
+    // fraction of the rows in the range, a missing bound is unbounded
+    f64 RangeFraction(Optional<f64> lower, bool lower_inclusive, Optional<f64> upper, bool upper_inclusive) const;
+
+    // fraction of the rows with key == value, when value is a bucket of its own, otherwise 0
+    f64 PointFraction(f64 value) const;
+
+    void SaveToJson(nlohmann::json &json) const;
+
+    bool LoadFromJson(const nlohmann::json &json);
+
+private:
+    Vector<f64> lows_;
+    Vector<f64> highs_;
+    Vector<f64> fractions_;
+};
+
+} // namespace infinity
@@ -0,0 +1,61 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include "base64.hpp"
+#include <cmath>
+module hyper_log_log;
+
+import stl;
+import third_party;
+
+namespace infinity {
+
+f64 HyperLogLog::Estimate() const {
+    constexpr f64 m = REGISTER_COUNT;
+    constexpr f64 alpha = 0.7213 / (1.0 + 1.079 / m);
+    f64 sum = 0.0;
+    u32 zero_count = 0;
+    for (u8 r : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int>(r));
+        zero_count += r == 0;
+    }
+    f64 estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zero_count != 0) {
+        // linear counting for the small range
+        estimate = m * std::log(m / zero_count);
+    }
+    return estimate;
+}
+
+void HyperLogLog::SaveToJson(nlohmann::json &json) const {
+    json[JsonTag] = base64::to_base64(std::string_view(reinterpret_cast<const char *>(registers_.data()), registers_.size()));
+}
+
+bool HyperLogLog::LoadFromJson(const nlohmann::json &json) {
+    if (!json.contains(JsonTag)) {
+        return false;
+    }
+    String registers_base64 = json[JsonTag];
+    String registers = base64::from_base64(registers_base64);
+    if (registers.size() != REGISTER_COUNT) {
+        return false;
+    }
+    std::copy(registers.begin(), registers.end(), registers_.begin());
+    return true;
+}
+
+} // namespace infinity
@@ -0,0 +1,72 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include <bit>
+
+export module hyper_log_log;
+
+import stl;
+import third_party;
+
+namespace infinity {
+
+// HyperLogLog distinct count sketch, 2^PRECISION one byte registers (1 KiB), about 3% standard error.
+// Sketches of the same precision can be merged, so per segment sketches give the table NDV.
+export class HyperLogLog {
+public:
+    constexpr static u32 PRECISION = 10;
+    constexpr static u32 REGISTER_COUNT = 1u << PRECISION;
+    constexpr static std::string_view JsonTag = "hll";
+
+    HyperLogLog() : registers_(REGISTER_COUNT, 0) {}
+
+    // key is the ConvertValueToU64 of the value, it is mixed again because the integer conversions are the identity
+    void Add(u64 key) {
+        u64 hash = Mix(key);
+        u32 idx = hash >> (64 - PRECISION);
+        u64 rest = hash << PRECISION;
+        u8 rank = rest == 0 ? static_cast<u8>(64 - PRECISION + 1) : static_cast<u8>(std::countl_zero(rest) + 1);
+        registers_[idx] = std::max(registers_[idx], rank);
+    }
+
+    void Merge(const HyperLogLog &other) {
+        for (u32 i = 0; i < REGISTER_COUNT; ++i) {
+            registers_[i] = std::max(registers_[i], other.registers_[i]);
+        }
+    }
+
+    f64 Estimate() const;
+
+    void SaveToJson(nlohmann::json &json) const;
+
+    bool LoadFromJson(const nlohmann::json &json);
+
+private:
+    // splitmix64 finalizer
+    static u64 Mix(u64 x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    Vector<u8> registers_;
+};
+
+} // namespace infinity
@@ -0,0 +1,178 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+#include <bit>
+#include <random>
+module statistics_builder;
+
+import stl;
+import segment_entry;
+import segment_iter;
+import block_entry;
+import block_column_entry;
+import block_column_iter;
+import buffer_manager;
+import column_vector;
+import value;
+import internal_types;
+import logger;
+import third_party;
+import probabilistic_data_filter;
+import column_statistics;
+import table_entry;
+import column_def;
+
+namespace infinity {
+
+namespace {
+
+template <typename ValueType>
+u64 DistinctKey(const ValueType &value) {
+    if constexpr (std::is_same_v<ValueType, FloatT>) {
+        return std::bit_cast<u32>(value);
+    } else if constexpr (std::is_same_v<ValueType, DoubleT>) {
+        return std::bit_cast<u64>(value);
+    } else {
+        return ConvertValueToU64(value);
+    }
+}
+
+} // namespace
+
+template <typename ValueType>
+void StatisticsBuilder::BuildColumn(ColumnStatistics &column,
+                                    SegmentEntry *segment_entry,
+                                    ColumnID column_id,
+                                    BufferManager *buffer_mgr,
+                                    TxnTimeStamp begin_ts) {
+    Vector<f64> sample;
+    std::mt19937_64 rng(segment_entry->segment_id());
+    u64 row_count = 0;
+    auto add_key = [&](Optional<f64> key) {
+        if (!key.has_value()) {
+            return;
+        }
+        // reservoir sampling
+        if (sample.size() < MAX_SAMPLE_SIZE) {
+            sample.push_back(*key);
+        } else if (u64 idx = rng() % row_count; idx < MAX_SAMPLE_SIZE) {
+            sample[idx] = *key;
+        }
+    };
+
+    auto block_iter = BlockEntryIter(segment_entry);
+    for (auto *block_entry = block_iter.Next(); block_entry != nullptr; block_entry = block_iter.Next()) {
+        if (block_entry->row_count() == 0) {
+            continue;
+        }
+        BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+        BlockColumnIter<true> column_iter(block_column_entry, buffer_mgr, begin_ts);
+        for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
+            ++row_count;
+            auto &[ptr, offset] = next_pair.value();
+            if constexpr (std::is_same_v<ValueType, VarcharT>) {
+                Value value = column_iter.column_vector()->GetValue(offset);
+                column.distinct_.Add(ConvertValueToU64(value.GetVarchar()));
+            } else {
+                const auto &value = *static_cast<const ValueType *>(ptr);
+                column.distinct_.Add(DistinctKey(value));
+                add_key(StatisticsKey(value));
+            }
+        }
+    }
+    column.row_count_ = row_count;
+    column.histogram_.Build(sample);
+}
+
+SharedPtr<SegmentStatistics> StatisticsBuilder::Build(SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts) {
+    auto statistics = MakeShared<SegmentStatistics>();
+    statistics->build_ts_ = begin_ts;
+    const auto *table_entry = segment_entry->GetTableEntry();
+    const SizeT column_count = segment_entry->column_count();
+    statistics->columns_.resize(column_count);
+    for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+        auto &column = statistics->columns_[column_id];
+        switch (table_entry->GetColumnDefByID(column_id)->type()->type()) {
+            case kBoolean: {
+                BuildColumn<BooleanT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kTinyInt: {
+                BuildColumn<TinyIntT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kSmallInt: {
+                BuildColumn<SmallIntT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kInteger: {
+                BuildColumn<IntegerT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kBigInt: {
+                BuildColumn<BigIntT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kHugeInt: {
+                BuildColumn<HugeIntT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kDecimal: {
+                BuildColumn<DecimalT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kFloat: {
+                BuildColumn<FloatT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kDouble: {
+                BuildColumn<DoubleT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kVarchar: {
+                BuildColumn<VarcharT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kDate: {
+                BuildColumn<DateT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kTime: {
+                BuildColumn<TimeT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kDateTime: {
+                BuildColumn<DateTimeT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            case kTimestamp: {
+                BuildColumn<TimestampT>(column, segment_entry, column_id, buffer_mgr, begin_ts);
+                break;
+            }
+            default: {
+                // embeddings, tensors and other types only get the row count
+                column.row_count_ = segment_entry->actual_row_count();
+                break;
+            }
+        }
+        statistics->row_count_ = std::max<u64>(statistics->row_count_, column.row_count_);
+    }
+    LOG_TRACE(fmt::format("StatisticsBuilder: segment {} analyzed, {} rows", segment_entry->segment_id(), statistics->row_count_));
+    return statistics;
+}
+
+} // namespace infinity
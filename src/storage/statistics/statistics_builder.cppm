@@ -0,0 +1,40 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+module;
+
+export module statistics_builder;
+
+import stl;
+import segment_entry;
+import buffer_manager;
+import column_statistics;
+
+namespace infinity {
+
+export class StatisticsBuilder {
+public:
+    // at most this many rows of a segment are sampled for the histograms
+    constexpr static SizeT MAX_SAMPLE_SIZE = 16384;
+
+    // statistics of the rows of the segment visible at begin_ts
+    static SharedPtr<SegmentStatistics> Build(SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts);
+
+private:
+    template <typename ValueType>
+    static void BuildColumn(ColumnStatistics &column, SegmentEntry *segment_entry, ColumnID column_id, BufferManager *buffer_mgr, TxnTimeStamp begin_ts);
+};
+
+} // namespace infinity
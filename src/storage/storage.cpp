@@ -43,6 +43,7 @@ import bg_task;
 import periodic_trigger_thread;
 import periodic_trigger;
 import log_file;
+import term_meta_cache;
 
 namespace infinity {
 
@@ -51,6 +52,7 @@ Storage::Storage(const Config *config_ptr) : config_ptr_(config_ptr) {}
 void Storage::Init() {
     // Construct buffer manager
     buffer_mgr_ = MakeUnique<BufferManager>(config_ptr_->buffer_pool_size(), config_ptr_->data_dir(), config_ptr_->temp_dir());
+    TermMetaCache::instance().Init(buffer_mgr_.get(), config_ptr_->term_meta_cache_size());
 
     // Construct wal manager
     wal_mgr_ = MakeUnique<WalManager>(this,
@@ -82,7 +84,10 @@ void Storage::Init() {
     std::chrono::seconds optimize_interval = config_ptr_->optimize_interval();
     bool enable_optimize = optimize_interval.count() > 0;
 
-    if (enable_compaction || enable_optimize) {
+    std::chrono::seconds analyze_interval = config_ptr_->analyze_interval();
+    bool enable_analyze = analyze_interval.count() > 0;
+
+    if (enable_compaction || enable_optimize || enable_analyze) {
         compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(), txn_mgr_.get());
     } else {
         LOG_WARN("Compact interval is not set, auto compact is disable");
@@ -118,6 +123,11 @@ void Storage::Init() {
         } else {
             LOG_WARN("Optimize interval is not set, auto optimize task will not be triggered");
         }
+        if (enable_analyze) {
+            periodic_trigger_thread_->AddTrigger(MakeUnique<AnalyzePeriodicTrigger>(analyze_interval, compact_processor_.get()));
+        } else {
+            LOG_WARN("Analyze interval is not set, auto analyze task will not be triggered");
+        }
 
         std::chrono::seconds cleanup_interval = config_ptr_->cleanup_interval();
         if (cleanup_interval.count() > 0) {
@@ -163,6 +173,7 @@ void Storage::UnInit() {
     bg_processor_.reset();
     wal_mgr_.reset();
     new_catalog_.reset();
+    TermMetaCache::instance().UnInit();
     buffer_mgr_.reset();
     config_ptr_ = nullptr;
     fmt::print("Shutdown storage successfully\n");
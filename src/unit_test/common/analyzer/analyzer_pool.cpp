@@ -0,0 +1,87 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import term;
+import analyzer;
+import analyzer_pool;
+using namespace infinity;
+
+class AnalyzerPoolTest : public BaseTest {};
+
+TEST_F(AnalyzerPoolTest, reuse) {
+    Analyzer *first = nullptr;
+    {
+        PooledAnalyzer analyzer = AnalyzerPool::instance().Get(AnalyzerPool::STANDARD);
+        ASSERT_NE(analyzer.get(), nullptr);
+        first = analyzer.get();
+    }
+    {
+        // released analyzers are reused by the same thread
+        PooledAnalyzer analyzer = AnalyzerPool::instance().Get(AnalyzerPool::STANDARD);
+        EXPECT_EQ(analyzer.get(), first);
+        // while it is held, the thread gets another instance
+        PooledAnalyzer other = AnalyzerPool::instance().Get(AnalyzerPool::STANDARD);
+        EXPECT_NE(other.get(), first);
+    }
+    {
+        // analyzers are pooled by their full name
+        PooledAnalyzer bigram = AnalyzerPool::instance().Get("ngram-2");
+        ASSERT_NE(bigram.get(), nullptr);
+        TermList term_list;
+        bigram->Analyze(Term("abc"), term_list);
+        ASSERT_EQ(term_list.size(), 2U);
+    }
+    {
+        PooledAnalyzer trigram = AnalyzerPool::instance().Get("ngram-3");
+        ASSERT_NE(trigram.get(), nullptr);
+        TermList term_list;
+        trigram->Analyze(Term("abc"), term_list);
+        ASSERT_EQ(term_list.size(), 1U);
+    }
+    EXPECT_EQ(AnalyzerPool::instance().Get("unknown").get(), nullptr);
+}
+
+TEST_F(AnalyzerPoolTest, concurrent) {
+    const String input("Boost unit tests, pooled analyzers are shared by the threads.");
+    TermList expected;
+    AnalyzerPool::instance().Get(AnalyzerPool::STANDARD)->Analyze(input, expected);
+
+    const SizeT thread_count = 8;
+    Vector<Thread> threads;
+    Vector<u8> matched(thread_count, false);
+    for (SizeT i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i]() {
+            bool all_matched = true;
+            for (SizeT round = 0; round < 1000; ++round) {
+                PooledAnalyzer analyzer = AnalyzerPool::instance().Get(AnalyzerPool::STANDARD);
+                TermList term_list;
+                analyzer->Analyze(input, term_list);
+                all_matched &= term_list.size() == expected.size();
+                for (SizeT j = 0; all_matched && j < term_list.size(); ++j) {
+                    all_matched &= term_list[j].text_ == expected[j].text_ && term_list[j].word_offset_ == expected[j].word_offset_;
+                }
+            }
+            matched[i] = all_matched;
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (SizeT i = 0; i < thread_count; ++i) {
+        EXPECT_TRUE(matched[i]);
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import tokenizer;
+using namespace infinity;
+
+class TokenizerTest : public BaseTest {};
+
+namespace {
+
+struct Token {
+    String text_;
+    bool is_delimiter_;
+};
+
+// the byte by byte tokenizer the vectorized one replaced
+Vector<Token> ReferenceTokens(const CharTypeTable &table, const String &input) {
+    Vector<Token> tokens;
+    SizeT cursor = 0;
+    while (true) {
+        while (cursor < input.size() && table.GetType(input[cursor]) == SPACE_CHR) {
+            cursor++;
+        }
+        if (cursor == input.size()) {
+            return tokens;
+        }
+        Token token{String(1, input[cursor]), table.GetType(input[cursor]) == DELIMITER_CHR};
+        ++cursor;
+        while (!token.is_delimiter_ && cursor < input.size()) {
+            CharType type = table.GetType(input[cursor]);
+            if (type == SPACE_CHR || type == DELIMITER_CHR) {
+                break;
+            }
+            if (type == ALLOW_CHR) {
+                token.text_ += input[cursor];
+            }
+            ++cursor;
+        }
+        tokens.push_back(std::move(token));
+    }
+}
+
+Vector<Token> Tokens(Tokenizer &tokenizer, const String &input) {
+    Vector<Token> tokens;
+    tokenizer.Tokenize(input);
+    while (tokenizer.NextToken()) {
+        tokens.push_back({String(tokenizer.GetToken(), tokenizer.GetLength()), tokenizer.IsDelimiter()});
+    }
+    return tokens;
+}
+
+String RandomText(std::mt19937 &rng, SizeT length) {
+    static const String alnum("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");
+    static const Vector<String> others{" ", "  ", "\t", "\n", ",", ".", "-", "_", "中文", "é", "\xff"};
+    String text;
+    while (text.size() < length) {
+        u32 r = rng() % 16;
+        if (r < 10) {
+            text += alnum[rng() % alnum.size()];
+        } else if (r < 15) {
+            text += others[rng() % others.size()];
+        } else {
+            // long words cross the 16 / 32 / 64 byte blocks of the scan
+            text += String(rng() % 200, alnum[rng() % alnum.size()]);
+        }
+    }
+    return text;
+}
+
+void ExpectSameTokens(const Vector<Token> &expected, const Vector<Token> &tokens) {
+    ASSERT_EQ(tokens.size(), expected.size());
+    for (SizeT i = 0; i < tokens.size(); ++i) {
+        ASSERT_EQ(tokens[i].text_, expected[i].text_);
+        ASSERT_EQ(tokens[i].is_delimiter_, expected[i].is_delimiter_);
+    }
+}
+
+} // namespace
+
+TEST_F(TokenizerTest, default_table) {
+    Tokenizer tokenizer;
+    auto tokens = Tokens(tokenizer, "Boost  unit tests, 2024.");
+    ASSERT_EQ(tokens.size(), 6U);
+    EXPECT_EQ(tokens[0].text_, "Boost");
+    EXPECT_EQ(tokens[2].text_, "tests");
+    EXPECT_TRUE(tokens[3].is_delimiter_);
+    EXPECT_EQ(tokens[4].text_, "2024");
+    EXPECT_EQ(tokens[5].text_, ".");
+
+    std::mt19937 rng(42);
+    for (SizeT i = 0; i < 200; ++i) {
+        String text = RandomText(rng, rng() % 2000);
+        ExpectSameTokens(ReferenceTokens(CharTypeTable::Default(true), text), Tokens(tokenizer, text));
+    }
+}
+
+TEST_F(TokenizerTest, all_allowed) {
+    Tokenizer tokenizer(false);
+    std::mt19937 rng(42);
+    for (SizeT i = 0; i < 200; ++i) {
+        String text = RandomText(rng, rng() % 2000);
+        ExpectSameTokens(ReferenceTokens(CharTypeTable::Default(false), text), Tokens(tokenizer, text));
+    }
+}
+
+TEST_F(TokenizerTest, user_config) {
+    TokenizeConfig config;
+    config.AddUnites("-_");
+    config.AddDivides("q");
+    config.AddAllows(".\xe4");
+    Tokenizer tokenizer;
+    tokenizer.SetConfig(config);
+    CharTypeTable table;
+    table.SetConfig(config);
+
+    // unite chars are removed from the token
+    auto tokens = Tokens(tokenizer, "e-mail snake_case x.y");
+    ASSERT_EQ(tokens.size(), 3U);
+    EXPECT_EQ(tokens[0].text_, "email");
+    EXPECT_EQ(tokens[1].text_, "snakecase");
+    EXPECT_EQ(tokens[2].text_, "x.y");
+
+    std::mt19937 rng(42);
+    for (SizeT i = 0; i < 200; ++i) {
+        String text = RandomText(rng, i == 0 ? 20000 : rng() % 2000);
+        ExpectSameTokens(ReferenceTokens(table, text), Tokens(tokenizer, text));
+    }
+}
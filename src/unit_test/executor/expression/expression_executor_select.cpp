@@ -33,6 +33,21 @@ import selection;
 import logical_type;
 import internal_types;
 import data_type;
+import catalog;
+import greater;
+import less;
+import equals;
+import and_func;
+import or_func;
+import function_set;
+import scalar_function;
+import scalar_function_set;
+import base_expression;
+import reference_expression;
+import value_expression;
+import function_expression;
+import expression_state;
+import expression_selector;
 
 class ExpressionExecutorSelectTest : public BaseTest {};
 
@@ -135,3 +150,70 @@ TEST_F(ExpressionExecutorSelectTest, test3) {
     EXPECT_EQ(output_true_select->Size(), 0u);
     EXPECT_THROW((*output_true_select)[0], UnrecoverableException);
 }
+
+TEST_F(ExpressionExecutorSelectTest, conjunction) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+    RegisterGreaterFunction(catalog_ptr);
+    RegisterLessFunction(catalog_ptr);
+    RegisterEqualsFunction(catalog_ptr);
+    RegisterAndFunction(catalog_ptr);
+    RegisterOrFunction(catalog_ptr);
+
+    auto make_function = [&](const String &func_name, SharedPtr<BaseExpression> left, SharedPtr<BaseExpression> right) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), func_name);
+        SharedPtr<ScalarFunctionSet> scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+        Vector<SharedPtr<BaseExpression>> arguments{left, right};
+        ScalarFunction func = scalar_function_set->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(func, arguments);
+    };
+    DataType int_type(LogicalType::kInteger);
+    auto column_a = MakeShared<ReferenceExpression>(int_type, "t1", "a", "a", 0);
+    auto column_b = MakeShared<ReferenceExpression>(int_type, "t1", "b", "b", 1);
+    auto constant = [](IntegerT value) { return MakeShared<ValueExpression>(Value::MakeInt(value)); };
+
+    // a > 100 AND b = 3 AND (a < 500 OR b > 5)
+    SharedPtr<BaseExpression> condition = make_function(
+        "AND",
+        make_function("AND", make_function(">", column_a, constant(100)), make_function("=", column_b, constant(3))),
+        make_function("OR", make_function("<", column_a, constant(500)), make_function(">", column_b, constant(5))));
+    ConjunctionStats condition_stats;
+
+    // a fresh state per block carrying the conjunct statistics over, as PhysicalFilter does
+    for (IntegerT block_idx = 0; block_idx < 4; ++block_idx) {
+        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition);
+        std::swap(condition_state->conjunction_stats_, condition_stats);
+        SharedPtr<ColumnVector> a = ColumnVector::Make(MakeShared<DataType>(int_type));
+        SharedPtr<ColumnVector> b = ColumnVector::Make(MakeShared<DataType>(int_type));
+        a->Initialize(ColumnVectorType::kFlat);
+        b->Initialize(ColumnVectorType::kFlat);
+        Vector<IntegerT> expected;
+        for (IntegerT i = 0; i < static_cast<IntegerT>(DEFAULT_VECTOR_SIZE); ++i) {
+            IntegerT a_value = (i * 7 + block_idx * 131) % 1000;
+            IntegerT b_value = i % 11;
+            a->AppendValue(Value::MakeInt(a_value));
+            b->AppendValue(Value::MakeInt(b_value));
+            bool a_null = i % 13 == 0;
+            if (a_null) {
+                a->nulls_ptr_->SetFalse(i);
+            }
+            if (!a_null && a_value > 100 && b_value == 3 && a_value < 500) {
+                expected.push_back(a_value);
+            }
+        }
+        DataBlock input_block;
+        input_block.Init({a, b});
+        DataBlock output_block;
+        ExpressionSelector selector;
+        SizeT selected = selector.Select(condition, condition_state, &input_block, &output_block, input_block.row_count());
+        std::swap(condition_state->conjunction_stats_, condition_stats);
+        ASSERT_EQ(selected, expected.size());
+        for (SizeT i = 0; i < selected; ++i) {
+            EXPECT_EQ(output_block.column_vectors[0]->GetValue(i).value_.integer, expected[i]);
+        }
+    }
+    EXPECT_EQ(condition_stats.order_.size(), 3u);
+    // the first conjunct of each block saw all of its rows
+    EXPECT_GE(std::accumulate(condition_stats.input_rows_.begin(), condition_stats.input_rows_.end(), u64{0}), 4 * DEFAULT_VECTOR_SIZE);
+}
@@ -0,0 +1,159 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import infinity_exception;
+
+import global_resource_usage;
+import third_party;
+
+import logger;
+import stl;
+import infinity_context;
+import catalog;
+import like;
+import like_matcher;
+import scalar_function;
+import scalar_function_set;
+import function_set;
+import function;
+import column_expression;
+import value;
+import default_values;
+import data_block;
+import base_expression;
+import column_vector;
+import logical_type;
+import internal_types;
+import data_type;
+
+class LikeFunctionsTest : public BaseTest {};
+
+TEST_F(LikeFunctionsTest, like_matcher) {
+    using namespace infinity;
+
+    auto match = [](const String &pattern, const String &str, bool case_insensitive = false) {
+        LikeMatcher matcher(pattern, case_insensitive);
+        return matcher.Match(str.data(), str.size());
+    };
+
+    EXPECT_EQ(LikeMatcher("abc").type(), LikeMatcherType::kExact);
+    EXPECT_EQ(LikeMatcher("abc%").type(), LikeMatcherType::kPrefix);
+    EXPECT_EQ(LikeMatcher("%abc").type(), LikeMatcherType::kSuffix);
+    EXPECT_EQ(LikeMatcher("%%abc%").type(), LikeMatcherType::kContains);
+    EXPECT_EQ(LikeMatcher("a_c%").type(), LikeMatcherType::kGeneral);
+    EXPECT_EQ(LikeMatcher("a%b%c").type(), LikeMatcherType::kGeneral);
+
+    EXPECT_TRUE(match("abc", "abc"));
+    EXPECT_FALSE(match("abc", "abcd"));
+    EXPECT_TRUE(match("ab%", "abcd"));
+    EXPECT_FALSE(match("ab%", "a"));
+    EXPECT_TRUE(match("%cd", "abcd"));
+    EXPECT_TRUE(match("%bc%", "abcd"));
+    EXPECT_FALSE(match("%xy%", "abcd"));
+    EXPECT_TRUE(match("%", ""));
+    EXPECT_TRUE(match("a_c", "abc"));
+    EXPECT_FALSE(match("a_c", "ac"));
+    EXPECT_TRUE(match("a%b%c", "aXXbYYc"));
+    EXPECT_FALSE(match("a%b%c", "aXXcYYb"));
+    EXPECT_TRUE(match("%a%a", "banana"));
+    // '_' is one UTF-8 character
+    EXPECT_TRUE(match("caf_", "café"));
+    EXPECT_FALSE(match("caf__", "café"));
+    // escapes
+    EXPECT_TRUE(match("100\\%", "100%"));
+    EXPECT_FALSE(match("100\\%", "1000"));
+    EXPECT_TRUE(match("a\\_c", "a_c"));
+    EXPECT_FALSE(match("a\\_c", "abc"));
+    // ILIKE
+    EXPECT_TRUE(match("%HeLLo%", "say hello world", true));
+    EXPECT_FALSE(match("%HeLLo%", "say hello world"));
+
+    // substring search longer than one SIMD block
+    String haystack(200, 'a');
+    haystack.replace(150, 3, "xyz");
+    EXPECT_TRUE(match("%axyza%", haystack));
+    EXPECT_FALSE(match("%axyzb%", haystack));
+    EXPECT_EQ(LikeFindSubstring(haystack.data(), haystack.size(), "xyz", 3), 150u);
+
+    EXPECT_EQ(LikeMatcher("ab\\%c%d").literal_prefix(), "ab%c");
+    EXPECT_EQ(LikeMatcher("%ab").literal_prefix(), "");
+    EXPECT_EQ(LikeMatcher("AB%", true).literal_prefix(), "");
+}
+
+TEST_F(LikeFunctionsTest, like_func) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+
+    RegisterLikeFunction(catalog_ptr);
+    RegisterNotLikeFunction(catalog_ptr);
+    RegisterILikeFunction(catalog_ptr);
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> result_type = MakeShared<DataType>(LogicalType::kBoolean);
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+
+    SharedPtr<ColumnVector> str_column = ColumnVector::Make(data_type);
+    str_column->Initialize(ColumnVectorType::kFlat);
+    for (SizeT i = 0; i < row_count; ++i) {
+        // long strings are stored in the heap
+        String str = (i % 3 == 0 ? "Apple pie number " : "banana split number ") + std::to_string(i);
+        str_column->AppendValue(Value::MakeVarchar(str));
+    }
+
+    auto run = [&](const String &func_name, const String &pattern) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), func_name);
+        EXPECT_EQ(function_set->type_, FunctionType::kScalar);
+        SharedPtr<ScalarFunctionSet> scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+
+        Vector<SharedPtr<BaseExpression>> inputs;
+        inputs.emplace_back(MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0));
+        inputs.emplace_back(MakeShared<ColumnExpression>(*data_type, "t1", 1, "c2", 1, 0));
+        ScalarFunction func = scalar_function_set->GetMostMatchFunction(inputs);
+        EXPECT_STREQ((func_name + "(Varchar, Varchar)->Boolean").c_str(), func.ToString().c_str());
+
+        SharedPtr<ColumnVector> pattern_column = ColumnVector::Make(data_type);
+        pattern_column->Initialize(ColumnVectorType::kConstant);
+        pattern_column->AppendValue(Value::MakeVarchar(pattern));
+
+        DataBlock data_block;
+        data_block.Init({str_column, pattern_column});
+        SharedPtr<ColumnVector> result = MakeShared<ColumnVector>(result_type);
+        result->Initialize(ColumnVectorType::kCompactBit);
+        func.function_(data_block, result);
+        return result;
+    };
+
+    {
+        auto result = run("like", "Apple%");
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(result->GetValue(i).value_.boolean, i % 3 == 0);
+        }
+    }
+    {
+        auto result = run("not_like", "%split number 1%");
+        for (SizeT i = 0; i < row_count; ++i) {
+            bool matched = i % 3 != 0 && std::to_string(i)[0] == '1';
+            EXPECT_EQ(result->GetValue(i).value_.boolean, !matched);
+        }
+    }
+    {
+        auto result = run("ilike", "apple_pie%");
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(result->GetValue(i).value_.boolean, i % 3 == 0);
+        }
+    }
+}
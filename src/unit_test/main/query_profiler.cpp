@@ -16,6 +16,7 @@
 
 import stl;
 import profiler;
+import third_party;
 
 class QueryProfilerTest : public BaseTest {};
 
@@ -90,4 +91,21 @@ TEST_F(QueryProfilerTest, test3) {
     profiler.StopPhase(infinity::QueryPhase::kExecution);
 
     std::cout << profiler.ToString() << std::endl;
-}
\ No newline at end of file
+}
+
+TEST_F(QueryProfilerTest, strategy_profiler) {
+    infinity::StrategyProfiler profiler;
+    profiler.Record("KnnScan brute force", 100);
+    profiler.Record("KnnScan brute force", 200);
+    profiler.Record("KnnScan widened index", 50);
+
+    nlohmann::json json = profiler.Serialize();
+    EXPECT_EQ(json.size(), 2u);
+    EXPECT_EQ(json[0]["name"], "KnnScan brute force");
+    EXPECT_EQ(json[0]["count"], 2);
+    EXPECT_EQ(json[0]["elapsed"], 300);
+    EXPECT_EQ(json[1]["name"], "KnnScan widened index");
+    EXPECT_EQ(json[1]["count"], 1);
+
+    std::cout << profiler.ToString(4) << std::endl;
+}
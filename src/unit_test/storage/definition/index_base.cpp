@@ -20,6 +20,7 @@ import index_base;
 import index_ivfflat;
 import index_hnsw;
 import index_full_text;
+import serialize;
 
 import statement_common;
 
@@ -55,6 +56,58 @@ TEST_F(IndexBaseTest, ivfflat_readwrite) {
     EXPECT_EQ(*index_base, *index_base1);
 }
 
+TEST_F(IndexBaseTest, ivfflat_encode_type) {
+    using namespace infinity;
+
+    Vector<String> columns{"col1"};
+    Vector<InitParameter *> parameters;
+    parameters.emplace_back(new InitParameter("centroids_count", "100"));
+    parameters.emplace_back(new InitParameter("metric", "ip"));
+    parameters.emplace_back(new InitParameter("encode", "sq8"));
+    auto index_base = IndexIVFFlat::Make(MakeShared<String>("idx1"), "tbl1_idx1", columns, parameters);
+    for (auto parameter : parameters) {
+        delete parameter;
+    }
+
+    int32_t exp_size = index_base->GetSizeInBytes();
+    Vector<char> buf(exp_size, char(0));
+    char *ptr = buf.data();
+    index_base->WriteAdv(ptr);
+    ptr = buf.data();
+    auto index_ivfflat = std::static_pointer_cast<IndexIVFFlat>(IndexBase::ReadAdv(ptr, exp_size));
+    EXPECT_EQ(ptr - buf.data(), exp_size);
+    EXPECT_EQ(index_ivfflat->centroids_count_, 100u);
+    EXPECT_EQ(index_ivfflat->metric_type_, MetricType::kMetricInnerProduct);
+    EXPECT_EQ(index_ivfflat->encode_type_, IVFEncodeType::kSQ8);
+}
+
+TEST_F(IndexBaseTest, ivfflat_read_old_format) {
+    using namespace infinity;
+
+    // the layout written before ivf indexes had an encode type
+    Vector<char> buf(1024, char(0));
+    char *ptr = buf.data();
+    WriteBufAdv(ptr, IndexType::kIVFFlat);
+    WriteBufAdv(ptr, String("idx1"));
+    WriteBufAdv(ptr, String("tbl1_idx1"));
+    WriteBufAdv(ptr, static_cast<int32_t>(1));
+    WriteBufAdv(ptr, String("col1"));
+    WriteBufAdv(ptr, static_cast<size_t>(100));
+    WriteBufAdv(ptr, MetricType::kMetricL2);
+    // the next field of the wal entry
+    WriteBufAdv(ptr, static_cast<int32_t>(12345));
+    int32_t size = ptr - buf.data();
+
+    ptr = buf.data();
+    auto index_ivfflat = std::static_pointer_cast<IndexIVFFlat>(IndexBase::ReadAdv(ptr, size));
+    EXPECT_EQ(ptr - buf.data(), size - static_cast<int32_t>(sizeof(int32_t)));
+    EXPECT_EQ(*index_ivfflat->index_name_, "idx1");
+    EXPECT_EQ(index_ivfflat->centroids_count_, 100u);
+    EXPECT_EQ(index_ivfflat->metric_type_, MetricType::kMetricL2);
+    EXPECT_EQ(index_ivfflat->encode_type_, IVFEncodeType::kPlain);
+    EXPECT_EQ(ReadBufAdv<int32_t>(ptr), 12345);
+}
+
 TEST_F(IndexBaseTest, hnsw_readwrite) {
     using namespace infinity;
 
@@ -1,5 +1,7 @@
 #include "type/complex/row_id.h"
 #include "unit_test/base_test.h"
+#include <fstream>
+#include <iterator>
 
 import stl;
 import posting_merger;
@@ -70,7 +72,8 @@ protected:
                             const Vector<String>& base_names,
                             const Vector<RowID>& base_row_ids,
                             const String &dst_base_name,
-                            const Vector<ExpectedPosting> &expected_postings);
+                            const Vector<ExpectedPosting> &expected_postings,
+                            SizeT part_count = 0);
 
     void GenerateParagraphs(u32 term_num, u32 row_num, u32 word_num, Vector<String>& paragraphs, Vector<ExpectedPosting>& expected_postings);
     void GenerateTerms(Vector<String>& terms, u32 term_num);
@@ -138,8 +141,9 @@ void ColumnIndexMergerTest::MergeAndCheckIndex(const String& index_dir,
                                                const Vector<String>& base_names,
                                                const Vector<RowID>& base_row_ids,
                                                const String &dst_base_name,
-                                               const Vector<ExpectedPosting> &expected_postings) {
-    auto column_index_merger = MakeShared<ColumnIndexMerger>(index_dir, flag_, memory_pool_, buffer_pool_);
+                                               const Vector<ExpectedPosting> &expected_postings,
+                                               SizeT part_count) {
+    auto column_index_merger = MakeShared<ColumnIndexMerger>(index_dir, flag_, memory_pool_, buffer_pool_, part_count);
     column_index_merger->Merge(base_names, base_row_ids, dst_base_name);
 
     auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry(index_dir);
@@ -440,6 +444,39 @@ TEST_F(ColumnIndexMergerTest, GeneratePargraphsMergeTest1) {
     MergeAndCheckIndex(index_dir, base_names, base_row_ids, dst_base_name, expected_postings);
 }
 
+TEST_F(ColumnIndexMergerTest, ParallelMergeTest) {
+    using namespace infinity;
+    Vector<String> paragraphs;
+    Vector<ExpectedPosting> expected_postings;
+
+    u32 term_num = 1000;
+    u32 row_num = 100;
+    u32 word_num_pre_row = 50;
+
+    GenerateParagraphs(term_num, row_num, word_num_pre_row, paragraphs, expected_postings);
+    const String index_dir = GetTmpDir();
+
+    Vector<String> base_names = {"chunk1", "chunk2", "chunk3"};
+    Vector<RowID> base_row_ids = {RowID{0U, 0U}, RowID{0U, 30U}, RowID{0U, 60U}};
+    Vector<u32> row_offsets = {0, 30, 60};
+    Vector<u32> row_counts = {30, 30, 40};
+
+    CreateIndex(paragraphs, index_dir, base_names, base_row_ids, row_offsets, row_counts);
+    MergeAndCheckIndex(index_dir, base_names, base_row_ids, "merged_index", expected_postings, 1);
+    MergeAndCheckIndex(index_dir, base_names, base_row_ids, "merged_index_parallel", expected_postings, 4);
+
+    // the key ranges are concatenated into the same files as a single threaded merge
+    auto read_file = [&](const String &base_name, const String &suffix) {
+        std::ifstream ifs(index_dir + "/" + base_name + suffix, std::ios::binary);
+        return String(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    };
+    for (const String &suffix : {String(DICT_SUFFIX), String(POSTING_SUFFIX)}) {
+        String expected = read_file("merged_index", suffix);
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(read_file("merged_index_parallel", suffix), expected);
+    }
+}
+
 // #define LOCAL_MERGER_TEST
 #ifdef LOCAL_MERGER_TEST
 TEST_F(ColumnIndexMergerTest, GeneratePargraphsMergeTest2) {
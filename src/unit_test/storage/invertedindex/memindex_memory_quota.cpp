@@ -0,0 +1,129 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import global_resource_usage;
+import storage;
+import infinity_context;
+import txn_manager;
+import txn;
+import extra_ddl_info;
+import table_def;
+import column_def;
+import data_type;
+import logical_type;
+import column_vector;
+import data_block;
+import value;
+import index_full_text;
+import index_base;
+import table_index_entry;
+import segment_index_entry;
+import chunk_index_entry;
+import config;
+
+using namespace infinity;
+
+class MemIndexMemoryQuotaTest : public BaseTest {
+protected:
+    void SetUp() override {
+        RemoveDbDirs();
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        auto config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_memindex_memory_quota.toml");
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+        RemoveDbDirs();
+    }
+};
+
+TEST_F(MemIndexMemoryQuotaTest, DumpOnAppend) {
+    EXPECT_EQ(InfinityContext::instance().config()->memindex_memory_quota(), 1024ul);
+    Storage *storage = InfinityContext::instance().storage();
+    TxnManager *txn_mgr = storage->txn_manager();
+
+    auto db_name = std::make_shared<std::string>("default_db");
+    auto table_name = std::make_shared<std::string>("tb1");
+    auto index_name = std::make_shared<std::string>("idx1");
+    auto column_def1 =
+        std::make_shared<ColumnDef>(0, std::make_shared<DataType>(LogicalType::kVarchar), "col1", std::unordered_set<ConstraintType>{});
+    auto table_def = TableDef::Make(db_name, table_name, {column_def1});
+
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        txn->CreateTable(*db_name, table_def, ConflictType::kError);
+        txn_mgr->CommitTxn(txn);
+    }
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        auto [table_entry, status] = txn->GetTableByName(*db_name, *table_name);
+        ASSERT_TRUE(status.ok());
+
+        Vector<String> column_names{"col1"};
+        auto index_fulltext = MakeShared<IndexFullText>(index_name, "idx_file.idx", column_names, "standard");
+        auto [table_index_entry, status2] = txn->CreateIndexDef(table_entry, index_fulltext, ConflictType::kError);
+        ASSERT_TRUE(status2.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    // far below the row capacity, but the row count alone is above the 1KB quota
+    constexpr SizeT append_count = 4;
+    constexpr SizeT row_count = 300;
+    for (SizeT append_idx = 0; append_idx < append_count; ++append_idx) {
+        auto *txn = txn_mgr->BeginTxn();
+        auto column_vector = MakeShared<ColumnVector>(column_def1->type());
+        column_vector->Initialize();
+        for (SizeT i = 0; i < row_count; ++i) {
+            Value v = Value::MakeVarchar(fmt::format("the quick brown fox {} jumps over the lazy dog {}", append_idx, i));
+            column_vector->AppendValue(v);
+        }
+        auto data_block = DataBlock::Make();
+        data_block->Init({column_vector});
+
+        auto status = txn->Append(*db_name, *table_name, data_block);
+        ASSERT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        auto [table_index_entry, status] = txn->GetIndexByName(*db_name, *table_name, *index_name);
+        ASSERT_TRUE(status.ok());
+
+        auto &segment_index_entries = table_index_entry->index_by_segment();
+        ASSERT_EQ(segment_index_entries.size(), 1ul);
+        auto &segment_index_entry = segment_index_entries.begin()->second;
+
+        // every append dumped its rows to a chunk
+        auto [chunk_index_entries, memory_indexer] = segment_index_entry->GetFullTextIndexSnapshot();
+        ASSERT_EQ(chunk_index_entries.size(), append_count);
+        for (const auto &chunk_index_entry : chunk_index_entries) {
+            EXPECT_EQ(chunk_index_entry->row_count_, row_count);
+        }
+        EXPECT_EQ(memory_indexer.get(), nullptr);
+        txn_mgr->CommitTxn(txn);
+    }
+}
@@ -144,6 +144,37 @@ TEST_F(MemoryIndexerTest, Insert) {
     Check(reader);
 }
 
+TEST_F(MemoryIndexerTest, MemUsed) {
+    MemoryIndexer indexer(GetTmpDir(),
+                          "chunk1",
+                          RowID(0U, 0U),
+                          flag_,
+                          "standard",
+                          byte_slice_pool_,
+                          buffer_pool_,
+                          inverting_thread_pool_,
+                          commiting_thread_pool_);
+    EXPECT_EQ(indexer.GetMemUsed(), 0U);
+    for (u32 i = 0; i < 5; ++i) {
+        indexer.Insert(column_, i, 1);
+    }
+    while (indexer.GetInflightTasks() > 0) {
+        indexer.CommitSync(100);
+    }
+    SizeT mem_used = indexer.GetMemUsed();
+    EXPECT_GT(mem_used, 0U);
+
+    // more inserts than one commit batch holds
+    for (u32 i = 0; i < 100; ++i) {
+        indexer.Insert(column_, i % 5, 1);
+    }
+    while (indexer.GetInflightTasks() > 0) {
+        indexer.CommitSync(100);
+    }
+    EXPECT_EQ(indexer.GetDocCount(), 105U);
+    EXPECT_GT(indexer.GetMemUsed(), mem_used);
+}
+
 TEST_F(MemoryIndexerTest, test2) {
     auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry(GetTmpDir());
     MemoryIndexer indexer1(GetTmpDir(),
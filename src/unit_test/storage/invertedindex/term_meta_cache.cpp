@@ -0,0 +1,192 @@
+//  Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <filesystem>
+#include <fstream>
+
+import stl;
+import term_meta;
+import term_meta_cache;
+import buffer_manager;
+import buffer_obj;
+import buffer_handle;
+import data_file_worker;
+import infinity_context;
+import third_party;
+
+using namespace infinity;
+
+class TermMetaCacheTest : public BaseTest {
+protected:
+    void TearDown() override {
+        TermMetaCache::instance().UnInit();
+        BaseTest::TearDown();
+    }
+};
+
+TEST_F(TermMetaCacheTest, GetPut) {
+    TermMetaCache &cache = TermMetaCache::instance();
+    cache.Init(nullptr, 1024 * 1024);
+
+    TermMeta term_meta(3, 7);
+    term_meta.doc_start_ = 100;
+    term_meta.pos_start_ = 120;
+    term_meta.pos_end_ = 150;
+
+    TermMeta cached;
+    bool found = false;
+    EXPECT_FALSE(cache.Get(1, "hello", cached, found));
+    cache.Put(1, "hello", &term_meta);
+    cache.Put(1, "absent", nullptr);
+
+    ASSERT_TRUE(cache.Get(1, "hello", cached, found));
+    EXPECT_TRUE(found);
+    EXPECT_EQ(cached.doc_freq_, 3U);
+    EXPECT_EQ(cached.total_tf_, 7U);
+    EXPECT_EQ(cached.doc_start_, 100U);
+    EXPECT_EQ(cached.pos_start_, 120U);
+    EXPECT_EQ(cached.pos_end_, 150U);
+
+    ASSERT_TRUE(cache.Get(1, "absent", cached, found));
+    EXPECT_FALSE(found);
+    // entries belong to one chunk
+    EXPECT_FALSE(cache.Get(2, "hello", cached, found));
+
+    TermMetaCacheMetrics metrics = cache.Metrics();
+    EXPECT_EQ(metrics.entry_count_, 2U);
+    EXPECT_EQ(metrics.hit_count_, 2U);
+    EXPECT_EQ(metrics.miss_count_, 2U);
+    EXPECT_DOUBLE_EQ(metrics.HitRate(), 0.5);
+
+    // a zero capacity disables the cache
+    cache.Init(nullptr, 0);
+    cache.Put(1, "hello", &term_meta);
+    EXPECT_FALSE(cache.Get(1, "hello", cached, found));
+    EXPECT_EQ(cache.Metrics().entry_count_, 0U);
+}
+
+TEST_F(TermMetaCacheTest, Bounded) {
+    TermMetaCache &cache = TermMetaCache::instance();
+    const SizeT capacity = 64 * 1024;
+    cache.Init(nullptr, capacity);
+
+    TermMeta term_meta(1, 1);
+    for (SizeT i = 0; i < 10000; ++i) {
+        cache.Put(1, fmt::format("term{}", i), &term_meta);
+    }
+    TermMetaCacheMetrics metrics = cache.Metrics();
+    EXPECT_LE(metrics.memory_usage_, capacity);
+    EXPECT_GT(metrics.entry_count_, 0U);
+    EXPECT_LT(metrics.entry_count_, 10000U);
+
+    // the most recent terms stay cached
+    TermMeta cached;
+    bool found = false;
+    EXPECT_TRUE(cache.Get(1, "term9999", cached, found));
+    EXPECT_FALSE(cache.Get(1, "term0", cached, found));
+}
+
+TEST_F(TermMetaCacheTest, BufferManagerAccounting) {
+    auto data_dir = MakeShared<String>(GetDataDir());
+    auto temp_dir = MakeShared<String>(String(GetDataDir()) + "/spill");
+    const SizeT memory_limit = 16 * 1024;
+    BufferManager buffer_manager(memory_limit, data_dir, temp_dir);
+
+    TermMetaCache &cache = TermMetaCache::instance();
+    cache.Init(&buffer_manager, 1024 * 1024);
+    TermMeta term_meta(1, 1);
+    for (SizeT i = 0; i < 1000; ++i) {
+        cache.Put(1, fmt::format("term{}", i), &term_meta);
+    }
+    // the cache gives way to the buffer pool limit instead of its own capacity
+    TermMetaCacheMetrics metrics = cache.Metrics();
+    EXPECT_GT(metrics.entry_count_, 0U);
+    EXPECT_LT(metrics.entry_count_, 1000U);
+    EXPECT_EQ(buffer_manager.memory_usage(), metrics.memory_usage_);
+    EXPECT_LE(buffer_manager.memory_usage(), memory_limit);
+
+    cache.UnInit();
+    EXPECT_EQ(buffer_manager.memory_usage(), 0U);
+}
+
+class TermMetaCacheReclaimTest : public TermMetaCacheTest {
+protected:
+    // buffer objects log their allocations
+    void SetUp() override {
+        TermMetaCacheTest::SetUp();
+        RemoveDbDirs();
+        InfinityContext::instance().Init(nullptr);
+    }
+
+    void TearDown() override {
+        InfinityContext::instance().UnInit();
+        TermMetaCacheTest::TearDown();
+    }
+};
+
+TEST_F(TermMetaCacheReclaimTest, BufferManagerReclaims) {
+    String data_dir(GetDataDir());
+    const SizeT memory_limit = 16 * 1024;
+    BufferManager buffer_manager(memory_limit, MakeShared<String>(data_dir), MakeShared<String>(data_dir + "/spill"));
+
+    TermMetaCache &cache = TermMetaCache::instance();
+    cache.Init(&buffer_manager, 1024 * 1024);
+    TermMeta term_meta(1, 1);
+    for (SizeT i = 0; i < 1000; ++i) {
+        cache.Put(1, fmt::format("term{}", i), &term_meta);
+    }
+    SizeT cache_usage = cache.Metrics().memory_usage_;
+    EXPECT_GT(cache_usage, memory_limit / 2);
+
+    // the buffer only fits once the cache gives way
+    const SizeT buffer_size = memory_limit / 2;
+    auto file_worker = MakeUnique<DataFileWorker>(MakeShared<String>(data_dir + "/reclaim"), MakeShared<String>("buffer"), buffer_size);
+    BufferObj *buffer_obj = buffer_manager.AllocateBufferObject(std::move(file_worker));
+    {
+        BufferHandle buffer_handle = buffer_obj->Load();
+        TermMetaCacheMetrics metrics = cache.Metrics();
+        EXPECT_LT(metrics.memory_usage_, cache_usage);
+        EXPECT_GT(metrics.entry_count_, 0U);
+        EXPECT_EQ(buffer_manager.memory_usage(), metrics.memory_usage_ + buffer_size);
+        EXPECT_LE(buffer_manager.memory_usage(), memory_limit);
+    }
+
+    cache.UnInit();
+    EXPECT_EQ(buffer_manager.memory_usage(), buffer_size);
+}
+
+TEST_F(TermMetaCacheTest, ChunkId) {
+    String dict_file = String(GetDataDir()) + "/term_meta_cache_test.dic";
+    std::filesystem::create_directories(GetDataDir());
+    {
+        std::ofstream out(dict_file);
+        out << "chunk";
+    }
+    u64 chunk_id = TermMetaCache::ChunkId(dict_file);
+    EXPECT_NE(chunk_id, 0U);
+    EXPECT_EQ(TermMetaCache::ChunkId(dict_file), chunk_id);
+
+    // a chunk rewritten under the same name doesn't see the entries of the old one
+    std::filesystem::remove(dict_file);
+    {
+        std::ofstream out(dict_file);
+        out << "rewritten chunk";
+    }
+    EXPECT_NE(TermMetaCache::ChunkId(dict_file), chunk_id);
+    std::filesystem::remove(dict_file);
+    EXPECT_EQ(TermMetaCache::ChunkId(dict_file), 0U);
+}
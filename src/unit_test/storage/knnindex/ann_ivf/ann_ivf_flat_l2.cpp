@@ -14,15 +14,22 @@
 
 #include "unit_test/base_test.h"
 
+#include <filesystem>
+#include <fstream>
+
 import infinity_exception;
 import stl;
 import knn_filter;
 import ann_ivf_flat;
+import index_ivfflat;
+import index_base;
+import annivfflat_index_data;
 import bitmask;
 import knn_expr;
 import internal_types;
 import infinity_context;
 import global_resource_usage;
+import local_file_system;
 
 class AnnIVFFlatL2Test : public BaseTest {
     void SetUp() override {
@@ -171,3 +178,225 @@ TEST_F(AnnIVFFlatL2Test, test1) {
         }
     }
 }
+
+TEST_F(AnnIVFFlatL2Test, test_encoded) {
+    using namespace infinity;
+
+    i64 dimension = 20;
+    i64 top_k = 4;
+    i64 base_embedding_count = 8;
+    UniquePtr<f32[]> base_embedding = MakeUnique<f32[]>(dimension * base_embedding_count);
+    UniquePtr<f32[]> query_embedding = MakeUnique<f32[]>(dimension);
+    // embedding i is filled with i / 8, so its distance to the query (0, 0, ..) grows with i
+    for (i64 i = 0; i < base_embedding_count; ++i) {
+        for (i64 j = 0; j < dimension; ++j) {
+            base_embedding[i * dimension + j] = static_cast<f32>(i) / 8;
+        }
+    }
+    for (i64 j = 0; j < dimension; ++j) {
+        query_embedding[j] = 0;
+    }
+
+    for (IVFEncodeType encode_type : {IVFEncodeType::kSQ8, IVFEncodeType::kFP16}) {
+        auto ann_ivf_l2_index = AnnIVFFlatL2<f32>::CreateIndex(dimension, base_embedding_count, base_embedding.get(), 1, encode_type);
+        EXPECT_TRUE(ann_ivf_l2_index->Encoded());
+        EXPECT_TRUE(ann_ivf_l2_index->vectors_.empty());
+
+        AnnIVFFlatL2<f32> ann_distance(query_embedding.get(), 1, top_k, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(ann_ivf_l2_index.get(), 0, 1);
+        ann_distance.End();
+
+        f32 *distance_array = ann_distance.GetDistanceByIdx(0);
+        RowID *id_array = ann_distance.GetIDByIdx(0);
+        for (i64 i = 0; i < top_k; ++i) {
+            EXPECT_EQ(id_array[i].segment_offset_, i);
+            f32 expect_distance = dimension * (static_cast<f32>(i) / 8) * (static_cast<f32>(i) / 8);
+            EXPECT_NEAR(distance_array[i], expect_distance, 0.1);
+        }
+    }
+}
+
+TEST_F(AnnIVFFlatL2Test, test_incremental) {
+    using namespace infinity;
+
+    u32 dimension = 4;
+    u32 base_embedding_count = 1024;
+    u32 batch_size = 64;
+    UniquePtr<f32[]> base_embedding = MakeUnique<f32[]>(dimension * base_embedding_count);
+    // embeddings lie on a 32 x 32 grid
+    for (u32 i = 0; i < base_embedding_count; ++i) {
+        base_embedding[i * dimension] = static_cast<f32>(i % 32);
+        base_embedding[i * dimension + 1] = static_cast<f32>(i / 32);
+        base_embedding[i * dimension + 2] = 0;
+        base_embedding[i * dimension + 3] = 0;
+    }
+    struct BatchIter {
+        const f32 *data_;
+        u32 dimension_;
+        u32 cur_;
+        u32 end_;
+        Optional<Pair<const f32 *, SegmentOffset>> Next() {
+            if (cur_ == end_) {
+                return None;
+            }
+            const f32 *v = data_ + cur_ * dimension_;
+            return std::make_pair(v, cur_++);
+        }
+    };
+
+    AnnIVFFlatIndexData<f32> index(MetricType::kMetricL2, dimension, 0);
+    EXPECT_FALSE(index.Trained());
+    for (u32 begin = 0; begin < base_embedding_count; begin += batch_size) {
+        EXPECT_EQ(index.AppendData(BatchIter{base_embedding.get(), dimension, begin, begin + batch_size}), batch_size);
+        EXPECT_TRUE(index.Trained());
+    }
+    EXPECT_EQ(index.data_num_, base_embedding_count);
+    // the first batch trained only a few centroids, too few to be shared with other segments
+    EXPECT_EQ(index.partition_num_, batch_size / 32);
+    EXPECT_FALSE(index.Shareable());
+    EXPECT_FALSE(index.ExportTrainedState()->Shareable());
+    // replayed rows are skipped
+    EXPECT_EQ(index.AppendData(BatchIter{base_embedding.get(), dimension, 0, batch_size}), 0u);
+
+    EXPECT_TRUE(index.HasOverfullPartition(4));
+    EXPECT_GT(index.SplitOverfullPartitions(4), 0u);
+    EXPECT_FALSE(index.HasOverfullPartition(4));
+    EXPECT_EQ(index.centroids_.size(), index.partition_num_ * dimension);
+    SizeT list_size_sum = 0;
+    for (const auto &ids : index.ids_) {
+        list_size_sum += ids.size();
+    }
+    EXPECT_EQ(list_size_sum, base_embedding_count);
+
+    for (u32 i = 0; i < base_embedding_count; i += 97) {
+        AnnIVFFlatL2<f32> ann_distance(base_embedding.get() + i * dimension, 1, 1, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(&index, 0, index.partition_num_);
+        ann_distance.End();
+        EXPECT_FLOAT_EQ(ann_distance.GetDistanceByIdx(0)[0], 0);
+        EXPECT_EQ(ann_distance.GetIDByIdx(0)[0].segment_offset_, i);
+    }
+
+    // another segment reuses the centroids instead of training
+    auto trained_state = index.ExportTrainedState();
+    ASSERT_NE(trained_state.get(), nullptr);
+    AnnIVFFlatIndexData<f32> other_index(MetricType::kMetricL2, dimension, 0);
+    other_index.ImportTrainedState(*trained_state);
+    EXPECT_EQ(other_index.AppendData(BatchIter{base_embedding.get(), dimension, 0, batch_size}), batch_size);
+    EXPECT_EQ(other_index.partition_num_, index.partition_num_);
+    EXPECT_EQ(other_index.centroids_, index.centroids_);
+
+    // a full build is always shared
+    AnnIVFFlatIndexData<f32> built_index(MetricType::kMetricL2, dimension, 0);
+    built_index.BuildIndex(dimension, batch_size, base_embedding.get(), batch_size, base_embedding.get());
+    EXPECT_TRUE(built_index.Shareable());
+    EXPECT_TRUE(built_index.ExportTrainedState()->Shareable());
+}
+
+TEST_F(AnnIVFFlatL2Test, test_sq8_widen) {
+    using namespace infinity;
+
+    u32 dimension = 4;
+    u32 batch_size = 64;
+    UniquePtr<f32[]> base_embedding = MakeUnique<f32[]>(dimension * batch_size * 2);
+    // the second batch lies four times as far from the origin as the first one
+    for (u32 i = 0; i < batch_size * 2; ++i) {
+        f32 scale = i < batch_size ? 1.0f : 4.0f;
+        for (u32 d = 0; d < dimension; ++d) {
+            base_embedding[i * dimension + d] = scale * static_cast<f32>((i * (d + 1)) % batch_size) / batch_size;
+        }
+    }
+    struct BatchIter {
+        const f32 *data_;
+        u32 dimension_;
+        u32 cur_;
+        u32 end_;
+        Optional<Pair<const f32 *, SegmentOffset>> Next() {
+            if (cur_ == end_) {
+                return None;
+            }
+            const f32 *v = data_ + cur_ * dimension_;
+            return std::make_pair(v, cur_++);
+        }
+    };
+
+    AnnIVFFlatIndexData<f32> index(MetricType::kMetricL2, dimension, 0, IVFEncodeType::kSQ8);
+    EXPECT_EQ(index.AppendData(BatchIter{base_embedding.get(), dimension, 0, batch_size}), batch_size);
+    EXPECT_LT(index.sq_min_[0] + 255 * index.sq_scale_[0], 1.0f);
+    EXPECT_EQ(index.AppendData(BatchIter{base_embedding.get(), dimension, batch_size, batch_size * 2}), batch_size);
+    // the range is widened rather than the new vectors clamped
+    EXPECT_GT(index.sq_min_[0] + 255 * index.sq_scale_[0], 3.5f);
+
+    // every vector, including the re-encoded first batch, decodes to within one step of its value
+    Vector<f32> decoded(dimension);
+    for (u32 p = 0; p < index.partition_num_; ++p) {
+        for (u32 j = 0; j < index.ids_[p].size(); ++j) {
+            index.DecodeVector(p, j, decoded.data());
+            const f32 *v = base_embedding.get() + index.ids_[p][j] * dimension;
+            for (u32 d = 0; d < dimension; ++d) {
+                EXPECT_NEAR(decoded[d], v[d], index.sq_scale_[d]);
+            }
+        }
+    }
+}
+
+TEST_F(AnnIVFFlatL2Test, test_load_old_format) {
+    using namespace infinity;
+
+    // an index file in the layout written before ivf lists could be encoded: metric, dimension, partition_num, data_num,
+    // centroids, then the size, ids and vectors of each list
+    const u32 dimension = 2;
+    const u32 partition_num = 2;
+    const u32 data_num = 3;
+    Vector<f32> centroids{0, 0, 10, 10};
+    Vector<Vector<u32>> ids{{0, 1}, {2}};
+    Vector<Vector<f32>> vectors{{0, 0, 1, 0}, {10, 10}};
+    std::filesystem::create_directories(GetDataDir());
+    String file_path = String(GetDataDir()) + "/old_ivf_index";
+    {
+        std::ofstream out(file_path, std::ios::binary);
+        MetricType metric = MetricType::kMetricL2;
+        out.write(reinterpret_cast<const char *>(&metric), sizeof(metric));
+        out.write(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+        out.write(reinterpret_cast<const char *>(&partition_num), sizeof(partition_num));
+        out.write(reinterpret_cast<const char *>(&data_num), sizeof(data_num));
+        out.write(reinterpret_cast<const char *>(centroids.data()), sizeof(f32) * centroids.size());
+        for (u32 i = 0; i < partition_num; ++i) {
+            u32 size = ids[i].size();
+            out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+            out.write(reinterpret_cast<const char *>(ids[i].data()), sizeof(u32) * size);
+            out.write(reinterpret_cast<const char *>(vectors[i].data()), sizeof(f32) * vectors[i].size());
+        }
+    }
+
+    auto check = [&](AnnIVFFlatIndexData<f32> *index) {
+        EXPECT_EQ(index->metric_, MetricType::kMetricL2);
+        EXPECT_EQ(index->encode_type_, IVFEncodeType::kPlain);
+        EXPECT_EQ(index->dimension_, dimension);
+        EXPECT_EQ(index->partition_num_, partition_num);
+        EXPECT_EQ(index->data_num_, data_num);
+        EXPECT_EQ(index->centroids_, centroids);
+        EXPECT_EQ(index->ids_, ids);
+        EXPECT_TRUE(index->Shareable());
+
+        f32 query[] = {10, 10};
+        AnnIVFFlatL2<f32> ann_distance(query, 1, 1, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(index, 0, partition_num);
+        ann_distance.End();
+        EXPECT_FLOAT_EQ(ann_distance.GetDistanceByIdx(0)[0], 0);
+        EXPECT_EQ(ann_distance.GetIDByIdx(0)[0].segment_offset_, 2u);
+    };
+    auto index = AnnIVFFlatIndexData<f32>::LoadIndex(file_path, MakeUnique<LocalFileSystem>());
+    check(index.get());
+
+    // saved again in the current layout
+    String new_file_path = String(GetDataDir()) + "/new_ivf_index";
+    index->SaveIndex(new_file_path, MakeUnique<LocalFileSystem>());
+    auto new_index = AnnIVFFlatIndexData<f32>::LoadIndex(new_file_path, MakeUnique<LocalFileSystem>());
+    check(new_index.get());
+
+    std::filesystem::remove(file_path);
+    std::filesystem::remove(new_file_path);
+}
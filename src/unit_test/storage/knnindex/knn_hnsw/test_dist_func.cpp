@@ -14,6 +14,7 @@
 
 #include "../../../../storage/knn_index/knn_hnsw/header.h"
 #include "unit_test/base_test.h"
+#include <bitset>
 #include <cstdint>
 #include <random>
 
@@ -23,6 +24,7 @@ import vec_store_type;
 import hnsw_simd_func;
 import hnsw_common;
 import stl;
+import internal_types;
 
 using namespace infinity;
 
@@ -141,3 +143,84 @@ TEST_F(DistFuncTest, test2) {
         // EXPECT_NEAR(dist1, dist2, 1e-5);
     }
 }
+
+int32_t I8L2Test(const int8_t *v1, const int8_t *v2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; ++i) {
+        int32_t t = int32_t(v1[i]) - v2[i];
+        res += t * t;
+    }
+    return res;
+}
+
+int32_t BitHammingTest(const uint8_t *v1, const uint8_t *v2, size_t size) {
+    int32_t res = 0;
+    for (size_t i = 0; i < size; ++i) {
+        res += std::bitset<8>(v1[i] ^ v2[i]).count();
+    }
+    return res;
+}
+
+TEST_F(DistFuncTest, test_quantized) {
+    size_t max_dim = 300;
+
+    auto vec1 = std::make_unique<int8_t[]>(max_dim);
+    auto vec2 = std::make_unique<int8_t[]>(max_dim);
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> dist(-128, 127);
+    for (size_t j = 0; j < max_dim; ++j) {
+        vec1[j] = static_cast<int8_t>(dist(rng));
+        vec2[j] = static_cast<int8_t>(dist(rng));
+    }
+    // extreme values overflow 16 bit partial sums if not widened
+    vec1[0] = -128;
+    vec2[0] = 127;
+
+    // every dimension, so that the residual of each SIMD width is covered
+    for (size_t dim = 1; dim <= max_dim; ++dim) {
+        EXPECT_EQ(I8IP(vec1.get(), vec2.get(), dim), I8IPTest(vec1.get(), vec2.get(), dim));
+        EXPECT_EQ(I8L2(vec1.get(), vec2.get(), dim), I8L2Test(vec1.get(), vec2.get(), dim));
+
+        const auto *bits1 = reinterpret_cast<const uint8_t *>(vec1.get());
+        const auto *bits2 = reinterpret_cast<const uint8_t *>(vec2.get());
+        EXPECT_EQ(BitHamming(bits1, bits2, dim), BitHammingTest(bits1, bits2, dim));
+        EXPECT_EQ(BitHamming(bits1, bits1, dim), 0);
+    }
+}
+
+TEST_F(DistFuncTest, test_half) {
+    size_t max_dim = 300;
+
+    auto f32_vec1 = std::make_unique<float[]>(max_dim);
+    auto f32_vec2 = std::make_unique<float[]>(max_dim);
+    auto f16_vec1 = std::make_unique<Float16T[]>(max_dim);
+    auto f16_vec2 = std::make_unique<Float16T[]>(max_dim);
+    auto bf16_vec1 = std::make_unique<BFloat16T[]>(max_dim);
+    auto bf16_vec2 = std::make_unique<BFloat16T[]>(max_dim);
+    std::default_random_engine rng;
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    for (size_t j = 0; j < max_dim; ++j) {
+        f16_vec1[j] = Float16T(dist(rng));
+        f16_vec2[j] = Float16T(dist(rng));
+        bf16_vec1[j] = BFloat16T(dist(rng));
+        bf16_vec2[j] = BFloat16T(dist(rng));
+    }
+
+    // the kernels widen to f32, so they agree with the f32 distance of the widened vectors up to the summation order
+    auto expect_near = [](float v, float expected) { EXPECT_NEAR(v, expected, 1e-4f * (1.0f + std::abs(expected))); };
+    for (size_t dim = 1; dim <= max_dim; ++dim) {
+        for (size_t j = 0; j < dim; ++j) {
+            f32_vec1[j] = float(f16_vec1[j]);
+            f32_vec2[j] = float(f16_vec2[j]);
+        }
+        expect_near(F16L2(f16_vec1.get(), f16_vec2.get(), dim), F32L2Test(f32_vec1.get(), f32_vec2.get(), dim));
+        expect_near(F16IP(f16_vec1.get(), f16_vec2.get(), dim), F32IPBF(f32_vec1.get(), f32_vec2.get(), dim));
+
+        for (size_t j = 0; j < dim; ++j) {
+            f32_vec1[j] = float(bf16_vec1[j]);
+            f32_vec2[j] = float(bf16_vec2[j]);
+        }
+        expect_near(BF16L2(bf16_vec1.get(), bf16_vec2.get(), dim), F32L2Test(f32_vec1.get(), f32_vec2.get(), dim));
+        expect_near(BF16IP(bf16_vec1.get(), bf16_vec2.get(), dim), F32IPBF(f32_vec1.get(), f32_vec2.get(), dim));
+    }
+}
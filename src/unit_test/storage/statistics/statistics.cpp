@@ -0,0 +1,124 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <cmath>
+
+import stl;
+import third_party;
+import value;
+import hyper_log_log;
+import equi_depth_histogram;
+import column_statistics;
+using namespace infinity;
+
+class StatisticsTest : public BaseTest {};
+
+TEST_F(StatisticsTest, hyper_log_log) {
+    for (u64 n : {10UL, 1000UL, 100000UL}) {
+        HyperLogLog hll;
+        for (u64 i = 0; i < n; ++i) {
+            // duplicates do not count
+            hll.Add(i);
+            hll.Add(i);
+        }
+        EXPECT_NEAR(hll.Estimate(), static_cast<f64>(n), 0.1 * n);
+    }
+
+    HyperLogLog first;
+    HyperLogLog second;
+    for (u64 i = 0; i < 60000; ++i) {
+        first.Add(i);
+        second.Add(i + 30000);
+    }
+    first.Merge(second);
+    EXPECT_NEAR(first.Estimate(), 90000.0, 9000.0);
+
+    nlohmann::json json;
+    first.SaveToJson(json);
+    HyperLogLog loaded;
+    ASSERT_TRUE(loaded.LoadFromJson(json));
+    EXPECT_EQ(loaded.Estimate(), first.Estimate());
+}
+
+TEST_F(StatisticsTest, equi_depth_histogram) {
+    // 0..9999 uniform, and 5000 rows of 42
+    Vector<f64> sample;
+    for (i64 i = 0; i < 10000; ++i) {
+        sample.push_back(static_cast<f64>(9999 - i));
+    }
+    for (i64 i = 0; i < 5000; ++i) {
+        sample.push_back(42.0);
+    }
+    EquiDepthHistogram histogram;
+    histogram.Build(sample);
+    ASSERT_FALSE(histogram.Empty());
+    EXPECT_LE(histogram.BucketCount(), 2 * EquiDepthHistogram::MAX_BUCKET_COUNT);
+
+    EXPECT_NEAR(histogram.LessFraction(5000.0, false), (5000.0 + 5000.0) / 15000.0, 0.02);
+    EXPECT_NEAR(histogram.RangeFraction(8000.0, true, None, false), 2000.0 / 15000.0, 0.02);
+    EXPECT_NEAR(histogram.RangeFraction(None, false, 10.0, false), 10.0 / 15000.0, 0.02);
+    EXPECT_EQ(histogram.RangeFraction(20000.0, true, None, false), 0.0);
+    EXPECT_EQ(histogram.RangeFraction(None, false, -1.0, true), 0.0);
+    // the frequent value has a bucket of its own
+    EXPECT_NEAR(histogram.PointFraction(42.0), 5001.0 / 15000.0, 1e-9);
+    EXPECT_EQ(histogram.PointFraction(43.0), 0.0);
+
+    nlohmann::json json;
+    histogram.SaveToJson(json);
+    EquiDepthHistogram loaded;
+    ASSERT_TRUE(loaded.LoadFromJson(json));
+    EXPECT_EQ(loaded.BucketCount(), histogram.BucketCount());
+    EXPECT_EQ(loaded.LessFraction(1234.5, true), histogram.LessFraction(1234.5, true));
+}
+
+TEST_F(StatisticsTest, table_statistics) {
+    auto make_segment = [](i64 begin, i64 end) {
+        auto statistics = MakeShared<SegmentStatistics>();
+        statistics->row_count_ = end - begin;
+        auto &column = statistics->columns_.emplace_back();
+        column.row_count_ = end - begin;
+        Vector<f64> sample;
+        for (i64 i = begin; i < end; ++i) {
+            column.distinct_.Add(i);
+            sample.push_back(static_cast<f64>(i));
+        }
+        column.histogram_.Build(sample);
+        return statistics;
+    };
+    // segment 0: [0, 1000), segment 1: [500, 3500), segment 2 never analyzed
+    auto first = make_segment(0, 1000);
+    auto second = SegmentStatistics::Deserialize(make_segment(500, 3500)->Serialize());
+    TableStatistics table_statistics;
+    table_statistics.AddSegment(0, 1000, first);
+    table_statistics.AddSegment(1, 3000, second);
+    table_statistics.AddSegment(2, 500, nullptr);
+
+    EXPECT_EQ(table_statistics.row_count(), 4500UL);
+    EXPECT_EQ(table_statistics.analyzed_row_count(), 4000UL);
+    EXPECT_EQ(table_statistics.GetSegmentStatistics(2), nullptr);
+    ASSERT_NE(table_statistics.GetSegmentStatistics(1), nullptr);
+    EXPECT_EQ(table_statistics.GetSegmentStatistics(1)->row_count_, 3000UL);
+    EXPECT_EQ(table_statistics.NullCount(0), 0UL);
+    EXPECT_NEAR(table_statistics.DistinctCount(0), 3500.0, 350.0);
+    EXPECT_NEAR(table_statistics.EqualSelectivity(0, Value::MakeBigInt(7)), 1.0 / 3500.0, 1e-4);
+
+    auto selectivity = table_statistics.RangeSelectivity(0, 1000.0, true, None, false);
+    ASSERT_TRUE(selectivity.has_value());
+    EXPECT_NEAR(*selectivity, 2500.0 / 4000.0, 0.02);
+    EXPECT_FALSE(table_statistics.RangeSelectivity(1, 1000.0, true, None, false).has_value());
+
+    EXPECT_EQ(StatisticsKey(Value::MakeInt(3)), 3.0);
+    EXPECT_FALSE(StatisticsKey(Value::MakeVarchar(String("abc"))).has_value());
+}
@@ -0,0 +1,105 @@
+import os
+import argparse
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    base_row_n = 1000
+    append_row_n = 71000
+    insert_batch = 1000
+    slt_dir = "./test/sql/dql"
+    slt_name = "/big_index_scan_realtime_merge.slt"
+    table_name = "test_big_index_scan_realtime_merge"
+
+    slt_path = slt_dir + slt_name
+
+    os.makedirs(slt_dir, exist_ok=True)
+    if os.path.exists(slt_path) and generate_if_exists:
+        print("File {} already existed exists. Skip Generating.".format(slt_path))
+        return
+
+    row_n = base_row_n + append_row_n
+    # c1 is a permutation of [0, row_n), c2 is the insert order
+    rows = [((i * 7919) % row_n, i) for i in range(row_n)]
+
+    def write_insert(slt_file, insert_rows):
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("INSERT INTO {} VALUES {};\n".format(
+            table_name, ", ".join("({}, {})".format(c1, c2) for c1, c2 in insert_rows)))
+
+    def write_queries(slt_file, visible_rows):
+        ranges = [(1000, 1100), (35990, 36010), (row_n - 5, row_n + 10)]
+        for begin, end in ranges:
+            expected = sorted(r for r in visible_rows if begin <= r[0] < end)
+            slt_file.write("\nquery II\n")
+            slt_file.write("SELECT COUNT(*), SUM(c2) FROM {} WHERE c1 >= {} AND c1 < {};\n".format(table_name, begin, end))
+            slt_file.write("----\n")
+            slt_file.write("{} {}\n".format(len(expected), sum(r[1] for r in expected)))
+
+            slt_file.write("\nquery II\n")
+            slt_file.write("SELECT c1, c2 FROM {} WHERE c1 >= {} AND c1 < {} ORDER BY c1 LIMIT 20;\n".format(table_name, begin, end))
+            slt_file.write("----\n")
+            for c1, c2 in expected[:20]:
+                slt_file.write("{} {}\n".format(c1, c2))
+
+        # one row of the rows indexed at creation and one appended row
+        for c1 in [rows[10][0], rows[base_row_n + 10][0]]:
+            expected = [r for r in visible_rows if r[0] == c1]
+            slt_file.write("\nquery II\n")
+            slt_file.write("SELECT c1, c2 FROM {} WHERE c1 = {};\n".format(table_name, c1))
+            slt_file.write("----\n")
+            for r in expected:
+                slt_file.write("{} {}\n".format(r[0], r[1]))
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("CREATE TABLE {} (c1 integer, c2 integer);\n".format(table_name))
+
+        for i in range(0, base_row_n, insert_batch):
+            write_insert(slt_file, rows[i:i + insert_batch])
+
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("CREATE INDEX idx_c1 on {}(c1);\n".format(table_name))
+
+        # enough appended rows for optimize to merge the in-memory index of the unsealed segment
+        for i in range(base_row_n, row_n, insert_batch):
+            write_insert(slt_file, rows[i:i + insert_batch])
+
+        slt_file.write("\n# before the merge, the appended rows are in the in-memory index\n")
+        write_queries(slt_file, rows)
+
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("OPTIMIZE {};\n".format(table_name))
+
+        slt_file.write("\n# after the merge, all rows are in the built index\n")
+        write_queries(slt_file, rows)
+
+        slt_file.write("\n# rows appended after the merge go to the in-memory index again\n")
+        extra_rows = [(row_n + i, row_n + i) for i in range(10)]
+        write_insert(slt_file, extra_rows)
+        rows += extra_rows
+        write_queries(slt_file, rows)
+
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("DELETE FROM {} WHERE c2 < 500 OR c2 >= {};\n".format(table_name, row_n + 5))
+        rows = [r for r in rows if not (r[1] < 500 or r[1] >= row_n + 5)]
+        write_queries(slt_file, rows)
+
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("OPTIMIZE {};\n".format(table_name))
+        write_queries(slt_file, rows)
+
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate index scan realtime data for test")
+
+    parser.add_argument("-g", "--generate", type=bool,
+                        default=False, dest="generate_if_exists", )
+    parser.add_argument("-c", "--copy", type=str,
+                        default="/var/infinity/test_data", dest="copy_dir", )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
@@ -0,0 +1,115 @@
+import os
+import argparse
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    row_n = 10000
+    csv_dir = "./test/data/csv"
+    slt_dir = "./test/sql/dql"
+    csv_names = ["/test_big_index_scan_segment_low.csv", "/test_big_index_scan_segment_high.csv"]
+    slt_name = "/big_index_scan_segment.slt"
+    table_name = "test_big_index_scan_segment"
+    plain_table_name = "test_big_index_scan_segment_plain"
+
+    csv_paths = [csv_dir + csv_name for csv_name in csv_names]
+    slt_path = slt_dir + slt_name
+
+    os.makedirs(csv_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if all(os.path.exists(p) for p in csv_paths) and os.path.exists(slt_path) and generate_if_exists:
+        print("File {} and {} already existed exists. Skip Generating.".format(
+            slt_path, csv_paths))
+        return
+
+    # each import is a segment of its own: the low one holds c1 in [0, row_n), the high one [row_n, 2 * row_n)
+    rows = []
+    for part, csv_path in enumerate(csv_paths):
+        with open(csv_path, "w") as csv_file:
+            for i in range(part * row_n, (part + 1) * row_n):
+                s = "key{:05d}".format(i)
+                csv_file.write("{},{}\n".format(i, s))
+                rows.append((i, s))
+    deleted = [10, row_n + 10]
+    rows = [r for r in rows if r[0] not in deleted]
+
+    # predicates selecting most of one segment and a small part of the other one
+    predicates = [
+        ("c1 < {}".format(row_n + 1000), lambda r: r[0] < row_n + 1000),
+        ("c2 < 'key{:05d}'".format(row_n + 1000), lambda r: r[1] < "key{:05d}".format(row_n + 1000)),
+        ("c1 >= 500 AND c2 < 'key{:05d}'".format(row_n + 500),
+         lambda r: r[0] >= 500 and r[1] < "key{:05d}".format(row_n + 500)),
+        ("c2 >= 'key{:05d}' AND c1 < {}".format(1000, 2 * row_n - 9000),
+         lambda r: r[1] >= "key{:05d}".format(1000) and r[0] < 2 * row_n - 9000),
+        # the high segment is skipped by its min / max, the table scan is kept
+        ("c1 < {}".format(row_n - 2000), lambda r: r[0] < row_n - 2000),
+        ("(c1 < 100) OR (c2 >= 'key{:05d}')".format(2 * row_n - 1000),
+         lambda r: r[0] < 100 or r[1] >= "key{:05d}".format(2 * row_n - 1000)),
+    ]
+
+    with open(slt_path, "w") as slt_file:
+        for name in [table_name, plain_table_name]:
+            slt_file.write("statement ok\n")
+            slt_file.write("DROP TABLE IF EXISTS {};\n".format(name))
+            slt_file.write("\nstatement ok\n")
+            slt_file.write("CREATE TABLE {} (c1 integer, c2 varchar);\n".format(name))
+            for csv_name in csv_names:
+                slt_file.write("\nstatement ok\n")
+                slt_file.write("COPY {} FROM '{}{}' WITH ( DELIMITER ',' );\n".format(name, copy_dir, csv_name))
+            slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("CREATE INDEX idx_c1 on {}(c1);\n".format(table_name))
+        slt_file.write("\nstatement ok\n")
+        slt_file.write("CREATE INDEX idx_c2 on {}(c2);\n".format(table_name))
+
+        for name in [table_name, plain_table_name]:
+            for d in deleted:
+                slt_file.write("\nstatement ok\n")
+                slt_file.write("DELETE FROM {} WHERE c1 = {};\n".format(name, d))
+
+        slt_file.write("\n# the low segment is scanned, the high segment reads the index\n")
+        slt_file.write("query I\n")
+        slt_file.write("EXPLAIN SELECT * FROM {} WHERE c1 < {} ORDER BY c1;\n".format(table_name, row_n + 1000))
+        slt_file.write("----\n")
+        slt_file.write(" PROJECT (5)\n")
+        slt_file.write("  - table index: #4\n")
+        slt_file.write("  - expressions: [c1 (#0), c2 (#1)]\n")
+        slt_file.write(" -> SORT (4)\n")
+        slt_file.write("    - expressions: [c1 (#0) ASC]\n")
+        slt_file.write("    - output columns: [c1, __rowid]\n")
+        slt_file.write("   -> INDEX SCAN (7)\n")
+        slt_file.write("      - table name: {}(default_db.{})\n".format(table_name, table_name))
+        slt_file.write("      - table index: #1\n")
+        slt_file.write("      - filter: CAST(c1 (#1.0) AS BigInt) < {}\n".format(row_n + 1000))
+        slt_file.write("      - column scan segments: 1 of 2 (estimated selectivity above 0.2)\n")
+        slt_file.write("      - output_columns: [__rowid]\n")
+
+        # the index scan has to return the same rows as the table scan of the table without index
+        for predicate, selected in predicates:
+            expected = [r for r in rows if selected(r)]
+            for name in [table_name, plain_table_name]:
+                slt_file.write("\nquery II\n")
+                slt_file.write("SELECT COUNT(*), SUM(c1) FROM {} WHERE {};\n".format(name, predicate))
+                slt_file.write("----\n")
+                slt_file.write("{} {}\n".format(len(expected), sum(r[0] for r in expected)))
+
+                slt_file.write("\nquery III\n")
+                slt_file.write("SELECT c1, c2 FROM {} WHERE {} ORDER BY c1 DESC LIMIT 3;\n".format(name, predicate))
+                slt_file.write("----\n")
+                for r in sorted(expected, reverse=True)[:3]:
+                    slt_file.write("{} {}\n".format(r[0], r[1]))
+
+        for name in [table_name, plain_table_name]:
+            slt_file.write("\nstatement ok\n")
+            slt_file.write("DROP TABLE {};\n".format(name))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate index scan data for test")
+
+    parser.add_argument("-g", "--generate", type=bool,
+                        default=False, dest="generate_if_exists", )
+    parser.add_argument("-c", "--copy", type=str,
+                        default="/var/infinity/test_data", dest="copy_dir", )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
@@ -22,6 +22,8 @@ from generate_many_import import generate as generate11
 from generate_big_point_query_test_fastroughfilter import generate as generate12
 from generate_many_import_drop import generate as generate13
 from generate_mem_hnsw import generate as generate14
+from generate_index_scan_segment import generate as generate15
+from generate_index_scan_realtime_merge import generate as generate16
 
 class SpinnerThread(threading.Thread):
     def __init__(self):
@@ -154,6 +156,8 @@ if __name__ == "__main__":
     generate12(args.generate_if_exists, args.copy)
     generate13(args.generate_if_exists, args.copy)
     generate14(args.generate_if_exists, args.copy)
+    generate15(args.generate_if_exists, args.copy)
+    generate16(args.generate_if_exists, args.copy)
     print("Generate file finshed.")
 
     print("Start copying data...")